@@ -41,6 +41,8 @@ class ClientBridge {
   static late final _DartClientSetJvm _dartClientSetJvm;
   static late final _DartClientSetFrameCallback _dartClientSetFrameCallback;
   static late final _DartClientGetServiceUrl _dartClientGetServiceUrl;
+  static late final Pointer<Uint8> Function(Pointer<Utf8>, Pointer<Int64>)
+      _dartClientGetAsset;
 
   // Window/Input functions
   static late final _DartClientSendWindowMetrics _dartClientSendWindowMetrics;
@@ -108,6 +110,11 @@ class ClientBridge {
         Pointer<Utf8> Function(),
         Pointer<Utf8> Function()>('dart_client_get_service_url');
 
+    _dartClientGetAsset = lib.lookupFunction<
+        Pointer<Uint8> Function(Pointer<Utf8>, Pointer<Int64>),
+        Pointer<Uint8> Function(
+            Pointer<Utf8>, Pointer<Int64>)>('dart_client_get_asset');
+
     // Window/Input functions
     _dartClientSendWindowMetrics = lib.lookupFunction<
         Void Function(Int32, Int32, Double),
@@ -271,6 +278,25 @@ class ClientBridge {
     return ptr.toDartString();
   }
 
+  /// Get the bytes of a bundled asset by its path relative to
+  /// flutter_assets (e.g. `fonts/MyFont.ttf`), or null if there is none.
+  ///
+  /// The list is a view of the native memory-mapped asset bundle, not a
+  /// copy; it must not be modified and is only valid until the client
+  /// shuts down.
+  static Uint8List? getAsset(String name) {
+    final namePtr = name.toNativeUtf8();
+    final sizePtr = calloc<Int64>();
+    try {
+      final data = _dartClientGetAsset(namePtr, sizePtr);
+      if (data == nullptr) return null;
+      return data.asTypedList(sizePtr.value);
+    } finally {
+      calloc.free(namePtr);
+      calloc.free(sizePtr);
+    }
+  }
+
   /// Send window size change to Flutter.
   static void sendWindowMetrics(int width, int height, double pixelRatio) {
     _dartClientSendWindowMetrics(width, height, pixelRatio);
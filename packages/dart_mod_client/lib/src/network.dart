@@ -24,6 +24,9 @@ class ClientNetwork {
   // Dart-side packet handlers
   static final List<void Function(ModPacket packet)> _packetHandlers = [];
 
+  // Schemas declared before init()
+  static final List<PacketSchema> _pendingSchemas = [];
+
   // Specific typed handlers for common packet types
   static final List<void Function(BlockUpdatePacket packet)>
       _blockUpdateHandlers = [];
@@ -60,6 +63,11 @@ class ClientNetwork {
 
     // Register native callback for receiving packets
     _registerNativeCallback();
+
+    for (final schema in _pendingSchemas) {
+      _applySchema(schema);
+    }
+    _pendingSchemas.clear();
   }
 
   // Native function bindings
@@ -68,6 +76,7 @@ class ClientNetwork {
   static late final _ClientSetSendPacketToServerCallback
       _clientSetSendPacketToServerCallback;
   static late final _ClientSendPacketToServer _clientSendPacketToServer;
+  static late final PacketSchemaRegister _packetSchemaRegister;
 
   // NativeCallable for thread-safe packet receiving
   // Uses .listener() to safely handle calls from any thread (e.g., JNI/render thread)
@@ -90,6 +99,9 @@ class ClientNetwork {
         Void Function(Int32, Pointer<Uint8>, Int32),
         void Function(int, Pointer<Uint8>, int)>(
         'client_send_packet_to_server');
+
+    _packetSchemaRegister = lib.lookupFunction<PacketSchemaRegisterNative,
+        PacketSchemaRegister>('packet_schema_register');
   }
 
   static void _registerNativeCallback() {
@@ -108,10 +120,7 @@ class ClientNetwork {
   static void _onPacketReceivedFromNative(
       int packetType, Pointer<Uint8> data, int dataLength) {
     // Copy data to Dart memory
-    final bytes = Uint8List(dataLength);
-    for (var i = 0; i < dataLength; i++) {
-      bytes[i] = data[i];
-    }
+    final bytes = Uint8List.fromList(data.asTypedList(dataLength));
 
     // Free the malloc'd native buffer (allocated by client_dispatch_server_packet)
     malloc.free(data);
@@ -197,6 +206,25 @@ class ClientNetwork {
     _packetHandlers.add(handler);
   }
 
+  /// Register a packet schema so its packets can be sent and received.
+  ///
+  /// The server must register the same schemas. Schemas registered before
+  /// [init] are laid out during init.
+  static void registerSchema(PacketSchema schema) {
+    if (!_initialized) {
+      _pendingSchemas.add(schema);
+      return;
+    }
+    _applySchema(schema);
+  }
+
+  static void _applySchema(PacketSchema schema) {
+    if (!schema.applyLayout(_packetSchemaRegister)) {
+      // ignore: avoid_print
+      print('[ClientNetwork] Packet schema ${schema.id} was rejected');
+    }
+  }
+
   /// Register a handler specifically for block update packets.
   static void onBlockUpdate(void Function(BlockUpdatePacket packet) handler) {
     _blockUpdateHandlers.add(handler);
@@ -244,9 +272,7 @@ class ClientNetwork {
     final nativeBytes = calloc<Uint8>(bytes.length);
 
     try {
-      for (var i = 0; i < bytes.length; i++) {
-        nativeBytes[i] = bytes[i];
-      }
+      nativeBytes.asTypedList(bytes.length).setAll(0, bytes);
       _clientSendPacketToServer(packet.typeId, nativeBytes, bytes.length);
       // ignore: avoid_print
       print('[ClientNetwork] sendToServer: Sent to native!');
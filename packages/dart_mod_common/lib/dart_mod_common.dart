@@ -56,6 +56,7 @@ export 'src/registry/entity_registry.dart';
 // Network protocol
 export 'src/protocol/packet.dart';
 export 'src/protocol/packet_types.dart';
+export 'src/protocol/packet_schema.dart';
 export 'src/protocol/server_packets.dart';
 export 'src/protocol/client_packets.dart';
 
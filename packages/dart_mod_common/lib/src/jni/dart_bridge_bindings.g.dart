@@ -0,0 +1,856 @@
+// GENERATED CODE - DO NOT MODIFY BY HAND
+// Generated by tools/generate_bridge_bindings.dart from DartBridge.java
+
+/// Typed bindings for the static methods of com.redstone.DartBridge.
+library;
+
+import 'generic_bridge.dart';
+
+/// Pre-resolved calls into `com.redstone.DartBridge`.
+///
+/// Each method calls a jmethodID resolved once by the native library,
+/// instead of looking the method up by name on every call.
+abstract final class DartBridgeBindings {
+  /// Number of bound methods.
+  static const int count = 279;
+
+  /// Hash of the binding table; must match the native library.
+  static const int tableHash = 0x90d011db;
+
+  static void dispatchClientPacket(int playerId, int packetType, int data) =>
+      GenericJniBridge.callBridgeVoid(0, 'dispatchClientPacket', '(II[B)V', [playerId, packetType, data]);
+
+  static bool safeInitServerRuntime(String? scriptPath, String? packageConfigPath) =>
+      GenericJniBridge.callBridgeBool(1, 'safeInitServerRuntime', '(Ljava/lang/String;Ljava/lang/String;)Z', [scriptPath, packageConfigPath]);
+
+  static void safeShutdownServerRuntime() =>
+      GenericJniBridge.callBridgeVoid(2, 'safeShutdownServerRuntime', '()V');
+
+  static void safeTickServer() =>
+      GenericJniBridge.callBridgeVoid(3, 'safeTickServer', '()V');
+
+  static bool isInitialized() =>
+      GenericJniBridge.callBridgeBool(4, 'isInitialized', '()Z');
+
+  static bool isLibraryLoaded() =>
+      GenericJniBridge.callBridgeBool(5, 'isLibraryLoaded', '()Z');
+
+  static String? getServiceUrl() =>
+      GenericJniBridge.callBridgeString(6, 'getServiceUrl', '()Ljava/lang/String;');
+
+  static int dispatchBlockBreak(int x, int y, int z, int playerId, String? blockId, String? dimension) =>
+      GenericJniBridge.callBridgeInt(7, 'dispatchBlockBreak', '(IIIJLjava/lang/String;Ljava/lang/String;)I', [x, y, z, playerId, blockId, dimension]);
+
+  static int dispatchBlockInteract(int x, int y, int z, int playerId, int hand) =>
+      GenericJniBridge.callBridgeInt(8, 'dispatchBlockInteract', '(IIIJI)I', [x, y, z, playerId, hand]);
+
+  static void dispatchTick(int tick) =>
+      GenericJniBridge.callBridgeVoid(9, 'dispatchTick', '(J)V', [tick]);
+
+  static void dispatchPlayerJoin(int playerId) =>
+      GenericJniBridge.callBridgeVoid(10, 'dispatchPlayerJoin', '(I)V', [playerId]);
+
+  static void dispatchPlayerLeave(int playerId) =>
+      GenericJniBridge.callBridgeVoid(11, 'dispatchPlayerLeave', '(I)V', [playerId]);
+
+  static void dispatchPlayerRespawn(int playerId, bool endConquered) =>
+      GenericJniBridge.callBridgeVoid(12, 'dispatchPlayerRespawn', '(IZ)V', [playerId, endConquered]);
+
+  static void dispatchPlayerChangeDimension(int playerId, String? fromDimension, String? toDimension) =>
+      GenericJniBridge.callBridgeVoid(13, 'dispatchPlayerChangeDimension', '(ILjava/lang/String;Ljava/lang/String;)V', [playerId, fromDimension, toDimension]);
+
+  static void dispatchEntityChangeDimension(int entityId, String? fromDimension, String? toDimension) =>
+      GenericJniBridge.callBridgeVoid(14, 'dispatchEntityChangeDimension', '(ILjava/lang/String;Ljava/lang/String;)V', [entityId, fromDimension, toDimension]);
+
+  static String? dispatchPlayerDeath(int playerId, String? damageSource) =>
+      GenericJniBridge.callBridgeString(15, 'dispatchPlayerDeath', '(ILjava/lang/String;)Ljava/lang/String;', [playerId, damageSource]);
+
+  static bool dispatchEntityDamage(int entityId, String? damageSource, double amount, String? entityType, String? dimension, int x, int y, int z) =>
+      GenericJniBridge.callBridgeBool(16, 'dispatchEntityDamage', '(ILjava/lang/String;DLjava/lang/String;Ljava/lang/String;III)Z', [entityId, damageSource, amount, entityType, dimension, x, y, z]);
+
+  static void dispatchEntityDeath(int entityId, String? damageSource) =>
+      GenericJniBridge.callBridgeVoid(17, 'dispatchEntityDeath', '(ILjava/lang/String;)V', [entityId, damageSource]);
+
+  static bool dispatchPlayerAttackEntity(int playerId, int targetId) =>
+      GenericJniBridge.callBridgeBool(18, 'dispatchPlayerAttackEntity', '(II)Z', [playerId, targetId]);
+
+  static String? dispatchPlayerChat(int playerId, String? message) =>
+      GenericJniBridge.callBridgeString(19, 'dispatchPlayerChat', '(ILjava/lang/String;)Ljava/lang/String;', [playerId, message]);
+
+  static bool dispatchPlayerCommand(int playerId, String? command) =>
+      GenericJniBridge.callBridgeBool(20, 'dispatchPlayerCommand', '(ILjava/lang/String;)Z', [playerId, command]);
+
+  static bool dispatchItemUse(int playerId, String? itemId, int count, int hand, String? dimension, int x, int y, int z) =>
+      GenericJniBridge.callBridgeBool(21, 'dispatchItemUse', '(ILjava/lang/String;IILjava/lang/String;III)Z', [playerId, itemId, count, hand, dimension, x, y, z]);
+
+  static int dispatchItemUseOnBlock(int playerId, String? itemId, int count, int hand, int x, int y, int z, int face) =>
+      GenericJniBridge.callBridgeInt(22, 'dispatchItemUseOnBlock', '(ILjava/lang/String;IIIIII)I', [playerId, itemId, count, hand, x, y, z, face]);
+
+  static int dispatchItemUseOnEntity(int playerId, String? itemId, int count, int hand, int targetId) =>
+      GenericJniBridge.callBridgeInt(23, 'dispatchItemUseOnEntity', '(ILjava/lang/String;III)I', [playerId, itemId, count, hand, targetId]);
+
+  static bool dispatchBlockPlace(int playerId, int x, int y, int z, String? blockId) =>
+      GenericJniBridge.callBridgeBool(24, 'dispatchBlockPlace', '(IIIILjava/lang/String;)Z', [playerId, x, y, z, blockId]);
+
+  static bool dispatchPlayerPickupItem(int playerId, int itemEntityId, String? itemId, String? dimension, int x, int y, int z) =>
+      GenericJniBridge.callBridgeBool(25, 'dispatchPlayerPickupItem', '(IILjava/lang/String;Ljava/lang/String;III)Z', [playerId, itemEntityId, itemId, dimension, x, y, z]);
+
+  static bool dispatchPlayerDropItem(int playerId, String? itemId, int count) =>
+      GenericJniBridge.callBridgeBool(26, 'dispatchPlayerDropItem', '(ILjava/lang/String;I)Z', [playerId, itemId, count]);
+
+  static void dispatchServerStarting() =>
+      GenericJniBridge.callBridgeVoid(27, 'dispatchServerStarting', '()V');
+
+  static void dispatchServerStarted() =>
+      GenericJniBridge.callBridgeVoid(28, 'dispatchServerStarted', '()V');
+
+  static void dispatchServerStopping() =>
+      GenericJniBridge.callBridgeVoid(29, 'dispatchServerStopping', '()V');
+
+  static bool saveWorld() =>
+      GenericJniBridge.callBridgeBool(30, 'saveWorld', '()Z');
+
+  static void stopServer() =>
+      GenericJniBridge.callBridgeVoid(31, 'stopServer', '()V');
+
+  static bool isServerRunning() =>
+      GenericJniBridge.callBridgeBool(32, 'isServerRunning', '()Z');
+
+  static int getServerUptime() =>
+      GenericJniBridge.callBridgeLong(33, 'getServerUptime', '()J');
+
+  static double getAverageTickTime() =>
+      GenericJniBridge.callBridgeDouble(34, 'getAverageTickTime', '()D');
+
+  static void sendS2CPacket(int playerId, int packetType, String? jsonPayload) =>
+      GenericJniBridge.callBridgeVoid(35, 'sendS2CPacket', '(IILjava/lang/String;)V', [playerId, packetType, jsonPayload]);
+
+  static void executeCommand(String? command) =>
+      GenericJniBridge.callBridgeVoid(36, 'executeCommand', '(Ljava/lang/String;)V', [command]);
+
+  static void executeCommandAsPlayer(int playerId, String? command) =>
+      GenericJniBridge.callBridgeVoid(37, 'executeCommandAsPlayer', '(ILjava/lang/String;)V', [playerId, command]);
+
+  static bool isMcpModeEnabled() =>
+      GenericJniBridge.callBridgeBool(38, 'isMcpModeEnabled', '()Z');
+
+  static int getMcpServerPort() =>
+      GenericJniBridge.callBridgeInt(39, 'getMcpServerPort', '()I');
+
+  static void registerContainerType(String? containerId, String? title, int rows, int columns) =>
+      GenericJniBridge.callBridgeVoid(40, 'registerContainerType', '(Ljava/lang/String;Ljava/lang/String;II)V', [containerId, title, rows, columns]);
+
+  static bool openContainerForPlayer(int playerId, String? containerId) =>
+      GenericJniBridge.callBridgeBool(41, 'openContainerForPlayer', '(ILjava/lang/String;)Z', [playerId, containerId]);
+
+  static bool hasContainerType(String? containerId) =>
+      GenericJniBridge.callBridgeBool(42, 'hasContainerType', '(Ljava/lang/String;)Z', [containerId]);
+
+  static String? getContainerIdByTitle(String? title) =>
+      GenericJniBridge.callBridgeString(43, 'getContainerIdByTitle', '(Ljava/lang/String;)Ljava/lang/String;', [title]);
+
+  static String? getBlockId(String? dimension, int x, int y, int z) =>
+      GenericJniBridge.callBridgeString(44, 'getBlockId', '(Ljava/lang/String;III)Ljava/lang/String;', [dimension, x, y, z]);
+
+  static bool setBlock(String? dimension, int x, int y, int z, String? blockId) =>
+      GenericJniBridge.callBridgeBool(45, 'setBlock', '(Ljava/lang/String;IIILjava/lang/String;)Z', [dimension, x, y, z, blockId]);
+
+  static bool isAirBlock(String? dimension, int x, int y, int z) =>
+      GenericJniBridge.callBridgeBool(46, 'isAirBlock', '(Ljava/lang/String;III)Z', [dimension, x, y, z]);
+
+  static int getRedstoneSignal(String? dimension, int x, int y, int z) =>
+      GenericJniBridge.callBridgeInt(47, 'getRedstoneSignal', '(Ljava/lang/String;III)I', [dimension, x, y, z]);
+
+  static bool setProxyBlockState(int worldHash, int x, int y, int z, int stateData) =>
+      GenericJniBridge.callBridgeBool(48, 'setProxyBlockState', '(JIIII)Z', [worldHash, x, y, z, stateData]);
+
+  static bool setChunkForceLoaded(String? dimension, int chunkX, int chunkZ, bool load) =>
+      GenericJniBridge.callBridgeBool(49, 'setChunkForceLoaded', '(Ljava/lang/String;IIZ)Z', [dimension, chunkX, chunkZ, load]);
+
+  static int blockToChunk(int blockCoord) =>
+      GenericJniBridge.callBridgeInt(50, 'blockToChunk', '(I)I', [blockCoord]);
+
+  static double getPlayerX(int playerId) =>
+      GenericJniBridge.callBridgeDouble(51, 'getPlayerX', '(I)D', [playerId]);
+
+  static double getPlayerY(int playerId) =>
+      GenericJniBridge.callBridgeDouble(52, 'getPlayerY', '(I)D', [playerId]);
+
+  static double getPlayerZ(int playerId) =>
+      GenericJniBridge.callBridgeDouble(53, 'getPlayerZ', '(I)D', [playerId]);
+
+  static double getPlayerYaw(int playerId) =>
+      GenericJniBridge.callBridgeDouble(54, 'getPlayerYaw', '(I)D', [playerId]);
+
+  static double getPlayerPitch(int playerId) =>
+      GenericJniBridge.callBridgeDouble(55, 'getPlayerPitch', '(I)D', [playerId]);
+
+  static void teleportPlayer(int playerId, double x, double y, double z, double yaw, double pitch) =>
+      GenericJniBridge.callBridgeVoid(56, 'teleportPlayer', '(IDDDFF)V', [playerId, x, y, z, yaw, pitch]);
+
+  static String? getPlayerDimension(int playerId) =>
+      GenericJniBridge.callBridgeString(57, 'getPlayerDimension', '(I)Ljava/lang/String;', [playerId]);
+
+  static void teleportPlayerToDimension(int playerId, String? dimension, double x, double y, double z, double yaw, double pitch) =>
+      GenericJniBridge.callBridgeVoid(58, 'teleportPlayerToDimension', '(ILjava/lang/String;DDDFF)V', [playerId, dimension, x, y, z, yaw, pitch]);
+
+  static double getPlayerHealth(int playerId) =>
+      GenericJniBridge.callBridgeDouble(59, 'getPlayerHealth', '(I)D', [playerId]);
+
+  static void setPlayerHealth(int playerId, double health) =>
+      GenericJniBridge.callBridgeVoid(60, 'setPlayerHealth', '(IF)V', [playerId, health]);
+
+  static double getPlayerMaxHealth(int playerId) =>
+      GenericJniBridge.callBridgeDouble(61, 'getPlayerMaxHealth', '(I)D', [playerId]);
+
+  static int getPlayerFoodLevel(int playerId) =>
+      GenericJniBridge.callBridgeInt(62, 'getPlayerFoodLevel', '(I)I', [playerId]);
+
+  static void setPlayerFoodLevel(int playerId, int level) =>
+      GenericJniBridge.callBridgeVoid(63, 'setPlayerFoodLevel', '(II)V', [playerId, level]);
+
+  static double getPlayerSaturation(int playerId) =>
+      GenericJniBridge.callBridgeDouble(64, 'getPlayerSaturation', '(I)D', [playerId]);
+
+  static void setPlayerSaturation(int playerId, double saturation) =>
+      GenericJniBridge.callBridgeVoid(65, 'setPlayerSaturation', '(IF)V', [playerId, saturation]);
+
+  static int getPlayerGameMode(int playerId) =>
+      GenericJniBridge.callBridgeInt(66, 'getPlayerGameMode', '(I)I', [playerId]);
+
+  static void setPlayerGameMode(int playerId, int mode) =>
+      GenericJniBridge.callBridgeVoid(67, 'setPlayerGameMode', '(II)V', [playerId, mode]);
+
+  static int getPlayerExperienceLevel(int playerId) =>
+      GenericJniBridge.callBridgeInt(68, 'getPlayerExperienceLevel', '(I)I', [playerId]);
+
+  static void setPlayerExperienceLevel(int playerId, int level) =>
+      GenericJniBridge.callBridgeVoid(69, 'setPlayerExperienceLevel', '(II)V', [playerId, level]);
+
+  static int getPlayerTotalExperience(int playerId) =>
+      GenericJniBridge.callBridgeInt(70, 'getPlayerTotalExperience', '(I)I', [playerId]);
+
+  static void givePlayerExperience(int playerId, int amount) =>
+      GenericJniBridge.callBridgeVoid(71, 'givePlayerExperience', '(II)V', [playerId, amount]);
+
+  static void sendPlayerMessage(int playerId, String? message) =>
+      GenericJniBridge.callBridgeVoid(72, 'sendPlayerMessage', '(ILjava/lang/String;)V', [playerId, message]);
+
+  static void sendPlayerActionBar(int playerId, String? message) =>
+      GenericJniBridge.callBridgeVoid(73, 'sendPlayerActionBar', '(ILjava/lang/String;)V', [playerId, message]);
+
+  static void sendPlayerTitle(int playerId, String? title, String? subtitle, int fadeIn, int stay, int fadeOut) =>
+      GenericJniBridge.callBridgeVoid(74, 'sendPlayerTitle', '(ILjava/lang/String;Ljava/lang/String;III)V', [playerId, title, subtitle, fadeIn, stay, fadeOut]);
+
+  static String? getPlayerName(int playerId) =>
+      GenericJniBridge.callBridgeString(75, 'getPlayerName', '(I)Ljava/lang/String;', [playerId]);
+
+  static String? getPlayerUuid(int playerId) =>
+      GenericJniBridge.callBridgeString(76, 'getPlayerUuid', '(I)Ljava/lang/String;', [playerId]);
+
+  static bool isPlayerOnGround(int playerId) =>
+      GenericJniBridge.callBridgeBool(77, 'isPlayerOnGround', '(I)Z', [playerId]);
+
+  static bool isPlayerSneaking(int playerId) =>
+      GenericJniBridge.callBridgeBool(78, 'isPlayerSneaking', '(I)Z', [playerId]);
+
+  static bool isPlayerSprinting(int playerId) =>
+      GenericJniBridge.callBridgeBool(79, 'isPlayerSprinting', '(I)Z', [playerId]);
+
+  static bool isPlayerSwimming(int playerId) =>
+      GenericJniBridge.callBridgeBool(80, 'isPlayerSwimming', '(I)Z', [playerId]);
+
+  static bool isPlayerFlying(int playerId) =>
+      GenericJniBridge.callBridgeBool(81, 'isPlayerFlying', '(I)Z', [playerId]);
+
+  static int getPlayerCount() =>
+      GenericJniBridge.callBridgeInt(82, 'getPlayerCount', '()I');
+
+  static int getPlayerIdByIndex(int index) =>
+      GenericJniBridge.callBridgeInt(83, 'getPlayerIdByIndex', '(I)I', [index]);
+
+  static int getPlayerIdByName(String? name) =>
+      GenericJniBridge.callBridgeInt(84, 'getPlayerIdByName', '(Ljava/lang/String;)I', [name]);
+
+  static int getPlayerIdByUuid(String? uuidStr) =>
+      GenericJniBridge.callBridgeInt(85, 'getPlayerIdByUuid', '(Ljava/lang/String;)I', [uuidStr]);
+
+  static String? getEntityType(int entityId) =>
+      GenericJniBridge.callBridgeString(86, 'getEntityType', '(I)Ljava/lang/String;', [entityId]);
+
+  static bool isLivingEntity(int entityId) =>
+      GenericJniBridge.callBridgeBool(87, 'isLivingEntity', '(I)Z', [entityId]);
+
+  static bool isMobEntity(int entityId) =>
+      GenericJniBridge.callBridgeBool(88, 'isMobEntity', '(I)Z', [entityId]);
+
+  static bool isPlayerEntity(int entityId) =>
+      GenericJniBridge.callBridgeBool(89, 'isPlayerEntity', '(I)Z', [entityId]);
+
+  static String? getEntityDimension(int entityId) =>
+      GenericJniBridge.callBridgeString(90, 'getEntityDimension', '(I)Ljava/lang/String;', [entityId]);
+
+  static double getEntityX(int entityId) =>
+      GenericJniBridge.callBridgeDouble(91, 'getEntityX', '(I)D', [entityId]);
+
+  static double getEntityY(int entityId) =>
+      GenericJniBridge.callBridgeDouble(92, 'getEntityY', '(I)D', [entityId]);
+
+  static double getEntityZ(int entityId) =>
+      GenericJniBridge.callBridgeDouble(93, 'getEntityZ', '(I)D', [entityId]);
+
+  static void setEntityPosition(int entityId, double x, double y, double z) =>
+      GenericJniBridge.callBridgeVoid(94, 'setEntityPosition', '(IDDD)V', [entityId, x, y, z]);
+
+  static double getEntityVelocityX(int entityId) =>
+      GenericJniBridge.callBridgeDouble(95, 'getEntityVelocityX', '(I)D', [entityId]);
+
+  static double getEntityVelocityY(int entityId) =>
+      GenericJniBridge.callBridgeDouble(96, 'getEntityVelocityY', '(I)D', [entityId]);
+
+  static double getEntityVelocityZ(int entityId) =>
+      GenericJniBridge.callBridgeDouble(97, 'getEntityVelocityZ', '(I)D', [entityId]);
+
+  static void setEntityVelocity(int entityId, double x, double y, double z) =>
+      GenericJniBridge.callBridgeVoid(98, 'setEntityVelocity', '(IDDD)V', [entityId, x, y, z]);
+
+  static double getEntityYaw(int entityId) =>
+      GenericJniBridge.callBridgeDouble(99, 'getEntityYaw', '(I)D', [entityId]);
+
+  static double getEntityPitch(int entityId) =>
+      GenericJniBridge.callBridgeDouble(100, 'getEntityPitch', '(I)D', [entityId]);
+
+  static void teleportEntity(int entityId, double x, double y, double z, double yaw, double pitch) =>
+      GenericJniBridge.callBridgeVoid(101, 'teleportEntity', '(IDDDFF)V', [entityId, x, y, z, yaw, pitch]);
+
+  static void teleportEntityToDimension(int entityId, String? dimension, double x, double y, double z, double yaw, double pitch) =>
+      GenericJniBridge.callBridgeVoid(102, 'teleportEntityToDimension', '(ILjava/lang/String;DDDFF)V', [entityId, dimension, x, y, z, yaw, pitch]);
+
+  static bool isEntityOnGround(int entityId) =>
+      GenericJniBridge.callBridgeBool(103, 'isEntityOnGround', '(I)Z', [entityId]);
+
+  static bool isEntityInWater(int entityId) =>
+      GenericJniBridge.callBridgeBool(104, 'isEntityInWater', '(I)Z', [entityId]);
+
+  static bool isEntityOnFire(int entityId) =>
+      GenericJniBridge.callBridgeBool(105, 'isEntityOnFire', '(I)Z', [entityId]);
+
+  static void setEntityOnFire(int entityId, int seconds) =>
+      GenericJniBridge.callBridgeVoid(106, 'setEntityOnFire', '(II)V', [entityId, seconds]);
+
+  static void extinguishEntity(int entityId) =>
+      GenericJniBridge.callBridgeVoid(107, 'extinguishEntity', '(I)V', [entityId]);
+
+  static bool isEntitySneaking(int entityId) =>
+      GenericJniBridge.callBridgeBool(108, 'isEntitySneaking', '(I)Z', [entityId]);
+
+  static bool isEntitySprinting(int entityId) =>
+      GenericJniBridge.callBridgeBool(109, 'isEntitySprinting', '(I)Z', [entityId]);
+
+  static bool isEntityInvisible(int entityId) =>
+      GenericJniBridge.callBridgeBool(110, 'isEntityInvisible', '(I)Z', [entityId]);
+
+  static void setEntityInvisible(int entityId, bool invisible) =>
+      GenericJniBridge.callBridgeVoid(111, 'setEntityInvisible', '(IZ)V', [entityId, invisible]);
+
+  static bool isEntityGlowing(int entityId) =>
+      GenericJniBridge.callBridgeBool(112, 'isEntityGlowing', '(I)Z', [entityId]);
+
+  static void setEntityGlowing(int entityId, bool glowing) =>
+      GenericJniBridge.callBridgeVoid(113, 'setEntityGlowing', '(IZ)V', [entityId, glowing]);
+
+  static bool entityHasNoGravity(int entityId) =>
+      GenericJniBridge.callBridgeBool(114, 'entityHasNoGravity', '(I)Z', [entityId]);
+
+  static void setEntityNoGravity(int entityId, bool noGravity) =>
+      GenericJniBridge.callBridgeVoid(115, 'setEntityNoGravity', '(IZ)V', [entityId, noGravity]);
+
+  static String? getEntityCustomName(int entityId) =>
+      GenericJniBridge.callBridgeString(116, 'getEntityCustomName', '(I)Ljava/lang/String;', [entityId]);
+
+  static void setEntityCustomName(int entityId, String? name) =>
+      GenericJniBridge.callBridgeVoid(117, 'setEntityCustomName', '(ILjava/lang/String;)V', [entityId, name]);
+
+  static bool isEntityCustomNameVisible(int entityId) =>
+      GenericJniBridge.callBridgeBool(118, 'isEntityCustomNameVisible', '(I)Z', [entityId]);
+
+  static void setEntityCustomNameVisible(int entityId, bool visible) =>
+      GenericJniBridge.callBridgeVoid(119, 'setEntityCustomNameVisible', '(IZ)V', [entityId, visible]);
+
+  static int getEntityTicksExisted(int entityId) =>
+      GenericJniBridge.callBridgeInt(120, 'getEntityTicksExisted', '(I)I', [entityId]);
+
+  static void removeEntity(int entityId) =>
+      GenericJniBridge.callBridgeVoid(121, 'removeEntity', '(I)V', [entityId]);
+
+  static void discardEntity(int entityId) =>
+      GenericJniBridge.callBridgeVoid(122, 'discardEntity', '(I)V', [entityId]);
+
+  static String? getEntityTags(int entityId) =>
+      GenericJniBridge.callBridgeString(123, 'getEntityTags', '(I)Ljava/lang/String;', [entityId]);
+
+  static bool addEntityTag(int entityId, String? tag) =>
+      GenericJniBridge.callBridgeBool(124, 'addEntityTag', '(ILjava/lang/String;)Z', [entityId, tag]);
+
+  static bool removeEntityTag(int entityId, String? tag) =>
+      GenericJniBridge.callBridgeBool(125, 'removeEntityTag', '(ILjava/lang/String;)Z', [entityId, tag]);
+
+  static double getLivingEntityHealth(int entityId) =>
+      GenericJniBridge.callBridgeDouble(126, 'getLivingEntityHealth', '(I)D', [entityId]);
+
+  static void setLivingEntityHealth(int entityId, double health) =>
+      GenericJniBridge.callBridgeVoid(127, 'setLivingEntityHealth', '(IF)V', [entityId, health]);
+
+  static double getLivingEntityMaxHealth(int entityId) =>
+      GenericJniBridge.callBridgeDouble(128, 'getLivingEntityMaxHealth', '(I)D', [entityId]);
+
+  static bool isLivingEntityDead(int entityId) =>
+      GenericJniBridge.callBridgeBool(129, 'isLivingEntityDead', '(I)Z', [entityId]);
+
+  static double getLivingEntityArmor(int entityId) =>
+      GenericJniBridge.callBridgeDouble(130, 'getLivingEntityArmor', '(I)D', [entityId]);
+
+  static void hurtEntity(int entityId, double amount) =>
+      GenericJniBridge.callBridgeVoid(131, 'hurtEntity', '(ID)V', [entityId, amount]);
+
+  static void addEntityEffect(int entityId, String? effectId, int duration, int amplifier, bool ambient, bool showParticles) =>
+      GenericJniBridge.callBridgeVoid(132, 'addEntityEffect', '(ILjava/lang/String;IIZZ)V', [entityId, effectId, duration, amplifier, ambient, showParticles]);
+
+  static void removeEntityEffect(int entityId, String? effectId) =>
+      GenericJniBridge.callBridgeVoid(133, 'removeEntityEffect', '(ILjava/lang/String;)V', [entityId, effectId]);
+
+  static bool entityHasEffect(int entityId, String? effectId) =>
+      GenericJniBridge.callBridgeBool(134, 'entityHasEffect', '(ILjava/lang/String;)Z', [entityId, effectId]);
+
+  static void clearEntityEffects(int entityId) =>
+      GenericJniBridge.callBridgeVoid(135, 'clearEntityEffects', '(I)V', [entityId]);
+
+  static int getLivingEntityLookingAt(int entityId) =>
+      GenericJniBridge.callBridgeInt(136, 'getLivingEntityLookingAt', '(I)I', [entityId]);
+
+  static bool mobHasAI(int entityId) =>
+      GenericJniBridge.callBridgeBool(137, 'mobHasAI', '(I)Z', [entityId]);
+
+  static void setMobAI(int entityId, bool hasAI) =>
+      GenericJniBridge.callBridgeVoid(138, 'setMobAI', '(IZ)V', [entityId, hasAI]);
+
+  static int getMobTarget(int entityId) =>
+      GenericJniBridge.callBridgeInt(139, 'getMobTarget', '(I)I', [entityId]);
+
+  static void setMobTarget(int entityId, int targetEntityId) =>
+      GenericJniBridge.callBridgeVoid(140, 'setMobTarget', '(II)V', [entityId, targetEntityId]);
+
+  static bool isMobPersistent(int entityId) =>
+      GenericJniBridge.callBridgeBool(141, 'isMobPersistent', '(I)Z', [entityId]);
+
+  static void setMobPersistent(int entityId, bool persistent) =>
+      GenericJniBridge.callBridgeVoid(142, 'setMobPersistent', '(IZ)V', [entityId, persistent]);
+
+  static int spawnEntity(String? dimension, String? entityType, double x, double y, double z) =>
+      GenericJniBridge.callBridgeInt(143, 'spawnEntity', '(Ljava/lang/String;Ljava/lang/String;DDD)I', [dimension, entityType, x, y, z]);
+
+  static int spawnDartEntity(String? dimensionId, int handlerId, double x, double y, double z) =>
+      GenericJniBridge.callBridgeInt(144, 'spawnDartEntity', '(Ljava/lang/String;JDDD)I', [dimensionId, handlerId, x, y, z]);
+
+  static int spawnFlutterDisplay(String? dimension, double x, double y, double z, double yaw, double pitch, int billboardMode, double width, double height, String? route) =>
+      GenericJniBridge.callBridgeInt(145, 'spawnFlutterDisplay', '(Ljava/lang/String;DDDFFIFFLjava/lang/String;)I', [dimension, x, y, z, yaw, pitch, billboardMode, width, height, route]);
+
+  static double getFlutterDisplayWidth(int entityId) =>
+      GenericJniBridge.callBridgeDouble(146, 'getFlutterDisplayWidth', '(I)D', [entityId]);
+
+  static void setFlutterDisplayWidth(int entityId, double width) =>
+      GenericJniBridge.callBridgeVoid(147, 'setFlutterDisplayWidth', '(IF)V', [entityId, width]);
+
+  static double getFlutterDisplayHeight(int entityId) =>
+      GenericJniBridge.callBridgeDouble(148, 'getFlutterDisplayHeight', '(I)D', [entityId]);
+
+  static void setFlutterDisplayHeight(int entityId, double height) =>
+      GenericJniBridge.callBridgeVoid(149, 'setFlutterDisplayHeight', '(IF)V', [entityId, height]);
+
+  static int getFlutterDisplayBillboardMode(int entityId) =>
+      GenericJniBridge.callBridgeInt(150, 'getFlutterDisplayBillboardMode', '(I)I', [entityId]);
+
+  static void setFlutterDisplayBillboardMode(int entityId, int mode) =>
+      GenericJniBridge.callBridgeVoid(151, 'setFlutterDisplayBillboardMode', '(II)V', [entityId, mode]);
+
+  static String? getFlutterDisplayRoute(int entityId) =>
+      GenericJniBridge.callBridgeString(152, 'getFlutterDisplayRoute', '(I)Ljava/lang/String;', [entityId]);
+
+  static void setEntityRotation(int entityId, double yaw, double pitch) =>
+      GenericJniBridge.callBridgeVoid(153, 'setEntityRotation', '(IFF)V', [entityId, yaw, pitch]);
+
+  static String? getEntitiesInBox(String? dimension, double minX, double minY, double minZ, double maxX, double maxY, double maxZ) =>
+      GenericJniBridge.callBridgeString(154, 'getEntitiesInBox', '(Ljava/lang/String;DDDDDD)Ljava/lang/String;', [dimension, minX, minY, minZ, maxX, maxY, maxZ]);
+
+  static String? getEntitiesInRadius(String? dimension, double x, double y, double z, double radius) =>
+      GenericJniBridge.callBridgeString(155, 'getEntitiesInRadius', '(Ljava/lang/String;DDDD)Ljava/lang/String;', [dimension, x, y, z, radius]);
+
+  static String? getEntitiesByType(String? dimension, String? entityType) =>
+      GenericJniBridge.callBridgeString(156, 'getEntitiesByType', '(Ljava/lang/String;Ljava/lang/String;)Ljava/lang/String;', [dimension, entityType]);
+
+  static int getItemMaxStackSize(String? itemId) =>
+      GenericJniBridge.callBridgeInt(157, 'getItemMaxStackSize', '(Ljava/lang/String;)I', [itemId]);
+
+  static String? getItemDisplayName(String? itemId) =>
+      GenericJniBridge.callBridgeString(158, 'getItemDisplayName', '(Ljava/lang/String;)Ljava/lang/String;', [itemId]);
+
+  static int getItemStackDamage(int playerId, int slot) =>
+      GenericJniBridge.callBridgeInt(159, 'getItemStackDamage', '(II)I', [playerId, slot]);
+
+  static int getItemStackMaxDamage(int playerId, int slot) =>
+      GenericJniBridge.callBridgeInt(160, 'getItemStackMaxDamage', '(II)I', [playerId, slot]);
+
+  static bool isItemStackDamageable(int playerId, int slot) =>
+      GenericJniBridge.callBridgeBool(161, 'isItemStackDamageable', '(II)Z', [playerId, slot]);
+
+  static String? getItemStackDisplayName(int playerId, int slot) =>
+      GenericJniBridge.callBridgeString(162, 'getItemStackDisplayName', '(II)Ljava/lang/String;', [playerId, slot]);
+
+  static String? getPlayerInventoryItem(int playerId, int slot) =>
+      GenericJniBridge.callBridgeString(163, 'getPlayerInventoryItem', '(II)Ljava/lang/String;', [playerId, slot]);
+
+  static void setPlayerInventoryItem(int playerId, int slot, String? itemId, int count) =>
+      GenericJniBridge.callBridgeVoid(164, 'setPlayerInventoryItem', '(IILjava/lang/String;I)V', [playerId, slot, itemId, count]);
+
+  static void clearPlayerInventorySlot(int playerId, int slot) =>
+      GenericJniBridge.callBridgeVoid(165, 'clearPlayerInventorySlot', '(II)V', [playerId, slot]);
+
+  static int getPlayerSelectedSlot(int playerId) =>
+      GenericJniBridge.callBridgeInt(166, 'getPlayerSelectedSlot', '(I)I', [playerId]);
+
+  static void setPlayerSelectedSlot(int playerId, int slot) =>
+      GenericJniBridge.callBridgeVoid(167, 'setPlayerSelectedSlot', '(II)V', [playerId, slot]);
+
+  static int findPlayerInventoryItem(int playerId, String? itemId) =>
+      GenericJniBridge.callBridgeInt(168, 'findPlayerInventoryItem', '(ILjava/lang/String;)I', [playerId, itemId]);
+
+  static int findPlayerEmptySlot(int playerId) =>
+      GenericJniBridge.callBridgeInt(169, 'findPlayerEmptySlot', '(I)I', [playerId]);
+
+  static int countPlayerInventoryItem(int playerId, String? itemId) =>
+      GenericJniBridge.callBridgeInt(170, 'countPlayerInventoryItem', '(ILjava/lang/String;)I', [playerId, itemId]);
+
+  static bool givePlayerItem(int playerId, String? itemId, int count) =>
+      GenericJniBridge.callBridgeBool(171, 'givePlayerItem', '(ILjava/lang/String;I)Z', [playerId, itemId, count]);
+
+  static int removePlayerItem(int playerId, String? itemId, int count) =>
+      GenericJniBridge.callBridgeInt(172, 'removePlayerItem', '(ILjava/lang/String;I)I', [playerId, itemId, count]);
+
+  static void clearPlayerInventory(int playerId) =>
+      GenericJniBridge.callBridgeVoid(173, 'clearPlayerInventory', '(I)V', [playerId]);
+
+  static int dropItem(String? dimension, double x, double y, double z, String? itemId, int count, double vx, double vy, double vz) =>
+      GenericJniBridge.callBridgeInt(174, 'dropItem', '(Ljava/lang/String;DDDLjava/lang/String;IDDD)I', [dimension, x, y, z, itemId, count, vx, vy, vz]);
+
+  static String? getItemEntityStack(int entityId) =>
+      GenericJniBridge.callBridgeString(175, 'getItemEntityStack', '(I)Ljava/lang/String;', [entityId]);
+
+  static void setItemEntityStack(int entityId, String? itemId, int count) =>
+      GenericJniBridge.callBridgeVoid(176, 'setItemEntityStack', '(ILjava/lang/String;I)V', [entityId, itemId, count]);
+
+  static int getItemEntityPickupDelay(int entityId) =>
+      GenericJniBridge.callBridgeInt(177, 'getItemEntityPickupDelay', '(I)I', [entityId]);
+
+  static void setItemEntityPickupDelay(int entityId, int ticks) =>
+      GenericJniBridge.callBridgeVoid(178, 'setItemEntityPickupDelay', '(II)V', [entityId, ticks]);
+
+  static int getItemEntityAge(int entityId) =>
+      GenericJniBridge.callBridgeInt(179, 'getItemEntityAge', '(I)I', [entityId]);
+
+  static void setItemEntityAge(int entityId, int ticks) =>
+      GenericJniBridge.callBridgeVoid(180, 'setItemEntityAge', '(II)V', [entityId, ticks]);
+
+  static int getTimeOfDay(String? dimension) =>
+      GenericJniBridge.callBridgeLong(181, 'getTimeOfDay', '(Ljava/lang/String;)J', [dimension]);
+
+  static void setTimeOfDay(String? dimension, int time) =>
+      GenericJniBridge.callBridgeVoid(182, 'setTimeOfDay', '(Ljava/lang/String;J)V', [dimension, time]);
+
+  static int getGameTime(String? dimension) =>
+      GenericJniBridge.callBridgeLong(183, 'getGameTime', '(Ljava/lang/String;)J', [dimension]);
+
+  static int getDayCount(String? dimension) =>
+      GenericJniBridge.callBridgeLong(184, 'getDayCount', '(Ljava/lang/String;)J', [dimension]);
+
+  static int getWeather(String? dimension) =>
+      GenericJniBridge.callBridgeInt(185, 'getWeather', '(Ljava/lang/String;)I', [dimension]);
+
+  static void setWeather(String? dimension, int weather, int duration) =>
+      GenericJniBridge.callBridgeVoid(186, 'setWeather', '(Ljava/lang/String;II)V', [dimension, weather, duration]);
+
+  static bool isRaining(String? dimension) =>
+      GenericJniBridge.callBridgeBool(187, 'isRaining', '(Ljava/lang/String;)Z', [dimension]);
+
+  static bool isThundering(String? dimension) =>
+      GenericJniBridge.callBridgeBool(188, 'isThundering', '(Ljava/lang/String;)Z', [dimension]);
+
+  static void freezeTicks() =>
+      GenericJniBridge.callBridgeVoid(189, 'freezeTicks', '()V');
+
+  static void unfreezeTicks() =>
+      GenericJniBridge.callBridgeVoid(190, 'unfreezeTicks', '()V');
+
+  static void stepTicks(int count) =>
+      GenericJniBridge.callBridgeVoid(191, 'stepTicks', '(I)V', [count]);
+
+  static void setTickRate(double rate) =>
+      GenericJniBridge.callBridgeVoid(192, 'setTickRate', '(D)V', [rate]);
+
+  static void sprintTicks(int count) =>
+      GenericJniBridge.callBridgeVoid(193, 'sprintTicks', '(I)V', [count]);
+
+  static String? getTickState() =>
+      GenericJniBridge.callBridgeString(194, 'getTickState', '()Ljava/lang/String;');
+
+  static void playSound(String? dimension, double x, double y, double z, String? sound, String? category, double volume, double pitch) =>
+      GenericJniBridge.callBridgeVoid(195, 'playSound', '(Ljava/lang/String;DDDLjava/lang/String;Ljava/lang/String;FF)V', [dimension, x, y, z, sound, category, volume, pitch]);
+
+  static void playSoundToPlayer(int playerId, String? sound, String? category, double volume, double pitch) =>
+      GenericJniBridge.callBridgeVoid(196, 'playSoundToPlayer', '(ILjava/lang/String;Ljava/lang/String;FF)V', [playerId, sound, category, volume, pitch]);
+
+  static void spawnParticles(String? dimension, String? particle, double x, double y, double z, int count, double dx, double dy, double dz, double speed) =>
+      GenericJniBridge.callBridgeVoid(197, 'spawnParticles', '(Ljava/lang/String;Ljava/lang/String;DDDIDDDD)V', [dimension, particle, x, y, z, count, dx, dy, dz, speed]);
+
+  static void spawnParticlesToPlayer(int playerId, String? particle, double x, double y, double z, int count, double dx, double dy, double dz, double speed) =>
+      GenericJniBridge.callBridgeVoid(198, 'spawnParticlesToPlayer', '(ILjava/lang/String;DDDIDDDD)V', [playerId, particle, x, y, z, count, dx, dy, dz, speed]);
+
+  static void createExplosion(String? dimension, double x, double y, double z, double power, bool fire, int mode, int sourceEntityId) =>
+      GenericJniBridge.callBridgeVoid(199, 'createExplosion', '(Ljava/lang/String;DDDFZII)V', [dimension, x, y, z, power, fire, mode, sourceEntityId]);
+
+  static int spawnLightning(String? dimension, double x, double y, double z, bool damageOnly) =>
+      GenericJniBridge.callBridgeInt(200, 'spawnLightning', '(Ljava/lang/String;DDDZ)I', [dimension, x, y, z, damageOnly]);
+
+  static String? getWorldBorderCenter(String? dimension) =>
+      GenericJniBridge.callBridgeString(201, 'getWorldBorderCenter', '(Ljava/lang/String;)Ljava/lang/String;', [dimension]);
+
+  static void setWorldBorderCenter(String? dimension, double x, double z) =>
+      GenericJniBridge.callBridgeVoid(202, 'setWorldBorderCenter', '(Ljava/lang/String;DD)V', [dimension, x, z]);
+
+  static double getWorldBorderSize(String? dimension) =>
+      GenericJniBridge.callBridgeDouble(203, 'getWorldBorderSize', '(Ljava/lang/String;)D', [dimension]);
+
+  static void setWorldBorderSize(String? dimension, double size, int timeMillis) =>
+      GenericJniBridge.callBridgeVoid(204, 'setWorldBorderSize', '(Ljava/lang/String;DJ)V', [dimension, size, timeMillis]);
+
+  static String? getSpawnPoint(String? dimension) =>
+      GenericJniBridge.callBridgeString(205, 'getSpawnPoint', '(Ljava/lang/String;)Ljava/lang/String;', [dimension]);
+
+  static void setSpawnPoint(String? dimension, int x, int y, int z) =>
+      GenericJniBridge.callBridgeVoid(206, 'setSpawnPoint', '(Ljava/lang/String;III)V', [dimension, x, y, z]);
+
+  static int getDifficulty() =>
+      GenericJniBridge.callBridgeInt(207, 'getDifficulty', '()I');
+
+  static void setDifficulty(int difficulty) =>
+      GenericJniBridge.callBridgeVoid(208, 'setDifficulty', '(I)V', [difficulty]);
+
+  static String? getGameRule(String? dimension, String? rule) =>
+      GenericJniBridge.callBridgeString(209, 'getGameRule', '(Ljava/lang/String;Ljava/lang/String;)Ljava/lang/String;', [dimension, rule]);
+
+  static void setGameRule(String? dimension, String? rule, String? value) =>
+      GenericJniBridge.callBridgeVoid(210, 'setGameRule', '(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)V', [dimension, rule, value]);
+
+  static void dispatchScreenInit(int screenId, int width, int height) =>
+      GenericJniBridge.callBridgeVoid(211, 'dispatchScreenInit', '(JII)V', [screenId, width, height]);
+
+  static void dispatchScreenTick(int screenId) =>
+      GenericJniBridge.callBridgeVoid(212, 'dispatchScreenTick', '(J)V', [screenId]);
+
+  static void dispatchScreenRender(int screenId, int mouseX, int mouseY, double partialTick) =>
+      GenericJniBridge.callBridgeVoid(213, 'dispatchScreenRender', '(JIIF)V', [screenId, mouseX, mouseY, partialTick]);
+
+  static void dispatchScreenClose(int screenId) =>
+      GenericJniBridge.callBridgeVoid(214, 'dispatchScreenClose', '(J)V', [screenId]);
+
+  static bool dispatchScreenKeyPressed(int screenId, int keyCode, int scanCode, int modifiers) =>
+      GenericJniBridge.callBridgeBool(215, 'dispatchScreenKeyPressed', '(JIII)Z', [screenId, keyCode, scanCode, modifiers]);
+
+  static bool dispatchScreenKeyReleased(int screenId, int keyCode, int scanCode, int modifiers) =>
+      GenericJniBridge.callBridgeBool(216, 'dispatchScreenKeyReleased', '(JIII)Z', [screenId, keyCode, scanCode, modifiers]);
+
+  static bool dispatchScreenCharTyped(int screenId, int codePoint, int modifiers) =>
+      GenericJniBridge.callBridgeBool(217, 'dispatchScreenCharTyped', '(JII)Z', [screenId, codePoint, modifiers]);
+
+  static bool dispatchScreenMouseClicked(int screenId, double mouseX, double mouseY, int button) =>
+      GenericJniBridge.callBridgeBool(218, 'dispatchScreenMouseClicked', '(JDDI)Z', [screenId, mouseX, mouseY, button]);
+
+  static bool dispatchScreenMouseReleased(int screenId, double mouseX, double mouseY, int button) =>
+      GenericJniBridge.callBridgeBool(219, 'dispatchScreenMouseReleased', '(JDDI)Z', [screenId, mouseX, mouseY, button]);
+
+  static bool dispatchScreenMouseDragged(int screenId, double mouseX, double mouseY, int button, double dragX, double dragY) =>
+      GenericJniBridge.callBridgeBool(220, 'dispatchScreenMouseDragged', '(JDDIDD)Z', [screenId, mouseX, mouseY, button, dragX, dragY]);
+
+  static bool dispatchScreenMouseScrolled(int screenId, double mouseX, double mouseY, double deltaX, double deltaY) =>
+      GenericJniBridge.callBridgeBool(221, 'dispatchScreenMouseScrolled', '(JDDDD)Z', [screenId, mouseX, mouseY, deltaX, deltaY]);
+
+  static void dispatchWidgetPressed(int screenId, int widgetId) =>
+      GenericJniBridge.callBridgeVoid(222, 'dispatchWidgetPressed', '(JJ)V', [screenId, widgetId]);
+
+  static void dispatchWidgetTextChanged(int screenId, int widgetId, String? text) =>
+      GenericJniBridge.callBridgeVoid(223, 'dispatchWidgetTextChanged', '(JJLjava/lang/String;)V', [screenId, widgetId, text]);
+
+  static void dispatchContainerScreenInit(int screenId, int width, int height, int leftPos, int topPos, int imageWidth, int imageHeight) =>
+      GenericJniBridge.callBridgeVoid(224, 'dispatchContainerScreenInit', '(JIIIIII)V', [screenId, width, height, leftPos, topPos, imageWidth, imageHeight]);
+
+  static void dispatchContainerScreenRenderBg(int screenId, int mouseX, int mouseY, double partialTick, int leftPos, int topPos) =>
+      GenericJniBridge.callBridgeVoid(225, 'dispatchContainerScreenRenderBg', '(JIIFII)V', [screenId, mouseX, mouseY, partialTick, leftPos, topPos]);
+
+  static void dispatchContainerScreenClose(int screenId) =>
+      GenericJniBridge.callBridgeVoid(226, 'dispatchContainerScreenClose', '(J)V', [screenId]);
+
+  static int dispatchContainerSlotClick(int menuId, int slotIndex, int button, int clickType, String? carriedItem) =>
+      GenericJniBridge.callBridgeInt(227, 'dispatchContainerSlotClick', '(JIIILjava/lang/String;)I', [menuId, slotIndex, button, clickType, carriedItem]);
+
+  static String? dispatchContainerQuickMove(int menuId, int slotIndex) =>
+      GenericJniBridge.callBridgeString(228, 'dispatchContainerQuickMove', '(JI)Ljava/lang/String;', [menuId, slotIndex]);
+
+  static bool dispatchContainerMayPlace(int menuId, int slotIndex, String? itemData) =>
+      GenericJniBridge.callBridgeBool(229, 'dispatchContainerMayPlace', '(JILjava/lang/String;)Z', [menuId, slotIndex, itemData]);
+
+  static bool dispatchContainerMayPickup(int menuId, int slotIndex) =>
+      GenericJniBridge.callBridgeBool(230, 'dispatchContainerMayPickup', '(JI)Z', [menuId, slotIndex]);
+
+  static bool onCustomGoalCanUse(String? goalId, int entityId) =>
+      GenericJniBridge.callBridgeBool(231, 'onCustomGoalCanUse', '(Ljava/lang/String;I)Z', [goalId, entityId]);
+
+  static bool onCustomGoalCanContinueToUse(String? goalId, int entityId) =>
+      GenericJniBridge.callBridgeBool(232, 'onCustomGoalCanContinueToUse', '(Ljava/lang/String;I)Z', [goalId, entityId]);
+
+  static void onCustomGoalStart(String? goalId, int entityId) =>
+      GenericJniBridge.callBridgeVoid(233, 'onCustomGoalStart', '(Ljava/lang/String;I)V', [goalId, entityId]);
+
+  static void onCustomGoalTick(String? goalId, int entityId) =>
+      GenericJniBridge.callBridgeVoid(234, 'onCustomGoalTick', '(Ljava/lang/String;I)V', [goalId, entityId]);
+
+  static void onCustomGoalStop(String? goalId, int entityId) =>
+      GenericJniBridge.callBridgeVoid(235, 'onCustomGoalStop', '(Ljava/lang/String;I)V', [goalId, entityId]);
+
+  static void entityMoveTo(int entityId, double x, double y, double z, double speed) =>
+      GenericJniBridge.callBridgeVoid(236, 'entityMoveTo', '(IDDDD)V', [entityId, x, y, z, speed]);
+
+  static void entityLookAt(int entityId, double x, double y, double z) =>
+      GenericJniBridge.callBridgeVoid(237, 'entityLookAt', '(IDDD)V', [entityId, x, y, z]);
+
+  static void entityLookAtEntity(int entityId, int targetId) =>
+      GenericJniBridge.callBridgeVoid(238, 'entityLookAtEntity', '(II)V', [entityId, targetId]);
+
+  static void entityStopMoving(int entityId) =>
+      GenericJniBridge.callBridgeVoid(239, 'entityStopMoving', '(I)V', [entityId]);
+
+  static double entityDistanceTo(int entityId, int targetId) =>
+      GenericJniBridge.callBridgeDouble(240, 'entityDistanceTo', '(II)D', [entityId, targetId]);
+
+  static double entityDistanceToSqr(int entityId, double x, double y, double z) =>
+      GenericJniBridge.callBridgeDouble(241, 'entityDistanceToSqr', '(IDDD)D', [entityId, x, y, z]);
+
+  static bool entityHasNearbyPlayer(int entityId, double radius) =>
+      GenericJniBridge.callBridgeBool(242, 'entityHasNearbyPlayer', '(ID)Z', [entityId, radius]);
+
+  static int entityGetNearestPlayer(int entityId, double radius) =>
+      GenericJniBridge.callBridgeInt(243, 'entityGetNearestPlayer', '(ID)I', [entityId, radius]);
+
+  static int entityGetTarget(int entityId) =>
+      GenericJniBridge.callBridgeInt(244, 'entityGetTarget', '(I)I', [entityId]);
+
+  static void entitySetTarget(int entityId, int targetId) =>
+      GenericJniBridge.callBridgeVoid(245, 'entitySetTarget', '(II)V', [entityId, targetId]);
+
+  static double entityGetX(int entityId) =>
+      GenericJniBridge.callBridgeDouble(246, 'entityGetX', '(I)D', [entityId]);
+
+  static double entityGetY(int entityId) =>
+      GenericJniBridge.callBridgeDouble(247, 'entityGetY', '(I)D', [entityId]);
+
+  static double entityGetZ(int entityId) =>
+      GenericJniBridge.callBridgeDouble(248, 'entityGetZ', '(I)D', [entityId]);
+
+  static bool entityCanSee(int entityId, int targetId) =>
+      GenericJniBridge.callBridgeBool(249, 'entityCanSee', '(II)Z', [entityId, targetId]);
+
+  static void entityJump(int entityId) =>
+      GenericJniBridge.callBridgeVoid(250, 'entityJump', '(I)V', [entityId]);
+
+  static void entitySetSpeed(int entityId, double speed) =>
+      GenericJniBridge.callBridgeVoid(251, 'entitySetSpeed', '(ID)V', [entityId, speed]);
+
+  static String? getBlockEntitySlot(String? dimension, int x, int y, int z, int slot) =>
+      GenericJniBridge.callBridgeString(252, 'getBlockEntitySlot', '(Ljava/lang/String;IIII)Ljava/lang/String;', [dimension, x, y, z, slot]);
+
+  static void setBlockEntitySlot(String? dimension, int x, int y, int z, int slot, String? itemId, int count) =>
+      GenericJniBridge.callBridgeVoid(253, 'setBlockEntitySlot', '(Ljava/lang/String;IIIILjava/lang/String;I)V', [dimension, x, y, z, slot, itemId, count]);
+
+  static void setAnimationState(int blockPosHash, String? key, double targetValue, double speed) =>
+      GenericJniBridge.callBridgeVoid(254, 'setAnimationState', '(JLjava/lang/String;DD)V', [blockPosHash, key, targetValue, speed]);
+
+  static int storePlayerItemStackHandle(int playerId, int slot) =>
+      GenericJniBridge.callBridgeLong(255, 'storePlayerItemStackHandle', '(II)J', [playerId, slot]);
+
+  static void releaseItemStackHandle(int handle) =>
+      GenericJniBridge.callBridgeVoid(256, 'releaseItemStackHandle', '(J)V', [handle]);
+
+  static String? getItemStackComponent(int handle, String? componentId) =>
+      GenericJniBridge.callBridgeString(257, 'getItemStackComponent', '(JLjava/lang/String;)Ljava/lang/String;', [handle, componentId]);
+
+  static void setItemStackComponent(int handle, String? componentId, String? valueJson) =>
+      GenericJniBridge.callBridgeVoid(258, 'setItemStackComponent', '(JLjava/lang/String;Ljava/lang/String;)V', [handle, componentId, valueJson]);
+
+  static bool hasItemStackComponent(int handle, String? componentId) =>
+      GenericJniBridge.callBridgeBool(259, 'hasItemStackComponent', '(JLjava/lang/String;)Z', [handle, componentId]);
+
+  static void removeItemStackComponent(int handle, String? componentId) =>
+      GenericJniBridge.callBridgeVoid(260, 'removeItemStackComponent', '(JLjava/lang/String;)V', [handle, componentId]);
+
+  static int getItemMaxStackSize2(int handle) =>
+      GenericJniBridge.callBridgeInt(261, 'getItemMaxStackSize', '(J)I', [handle]);
+
+  static void setItemMaxStackSize(int handle, int size) =>
+      GenericJniBridge.callBridgeVoid(262, 'setItemMaxStackSize', '(JI)V', [handle, size]);
+
+  static int getItemDamage(int handle) =>
+      GenericJniBridge.callBridgeInt(263, 'getItemDamage', '(J)I', [handle]);
+
+  static void setItemDamage(int handle, int damage) =>
+      GenericJniBridge.callBridgeVoid(264, 'setItemDamage', '(JI)V', [handle, damage]);
+
+  static int getItemMaxDamage(int handle) =>
+      GenericJniBridge.callBridgeInt(265, 'getItemMaxDamage', '(J)I', [handle]);
+
+  static void setItemMaxDamage(int handle, int maxDamage) =>
+      GenericJniBridge.callBridgeVoid(266, 'setItemMaxDamage', '(JI)V', [handle, maxDamage]);
+
+  static String? getItemCustomName(int handle) =>
+      GenericJniBridge.callBridgeString(267, 'getItemCustomName', '(J)Ljava/lang/String;', [handle]);
+
+  static void setItemCustomName(int handle, String? name) =>
+      GenericJniBridge.callBridgeVoid(268, 'setItemCustomName', '(JLjava/lang/String;)V', [handle, name]);
+
+  static String? getItemLore(int handle) =>
+      GenericJniBridge.callBridgeString(269, 'getItemLore', '(J)Ljava/lang/String;', [handle]);
+
+  static void setItemLore(int handle, String? loreJson) =>
+      GenericJniBridge.callBridgeVoid(270, 'setItemLore', '(JLjava/lang/String;)V', [handle, loreJson]);
+
+  static bool isItemUnbreakable(int handle) =>
+      GenericJniBridge.callBridgeBool(271, 'isItemUnbreakable', '(J)Z', [handle]);
+
+  static void setItemUnbreakable(int handle, bool unbreakable) =>
+      GenericJniBridge.callBridgeVoid(272, 'setItemUnbreakable', '(JZ)V', [handle, unbreakable]);
+
+  static bool isItemDamageResistant(int handle) =>
+      GenericJniBridge.callBridgeBool(273, 'isItemDamageResistant', '(J)Z', [handle]);
+
+  static void setItemFireResistant(int handle, bool resistant) =>
+      GenericJniBridge.callBridgeVoid(274, 'setItemFireResistant', '(JZ)V', [handle, resistant]);
+
+  static String? getItemEnchantments(int handle) =>
+      GenericJniBridge.callBridgeString(275, 'getItemEnchantments', '(J)Ljava/lang/String;', [handle]);
+
+  static void setItemEnchantments(int handle, String? enchantmentsJson) =>
+      GenericJniBridge.callBridgeVoid(276, 'setItemEnchantments', '(JLjava/lang/String;)V', [handle, enchantmentsJson]);
+
+  static String? getLoadedDimensions() =>
+      GenericJniBridge.callBridgeString(277, 'getLoadedDimensions', '()Ljava/lang/String;');
+
+  static String? getDimensionProperties(String? dimension) =>
+      GenericJniBridge.callBridgeString(278, 'getDimensionProperties', '(Ljava/lang/String;)Ljava/lang/String;', [dimension]);
+}
@@ -9,6 +9,7 @@ import 'dart:typed_data';
 
 import 'package:ffi/ffi.dart';
 
+import 'dart_bridge_bindings.g.dart';
 import 'java_object.dart' show JniException;
 
 // ============================================================================
@@ -410,6 +411,63 @@ typedef DartGetStaticIntField = int Function(
     Pointer<Utf8> fieldName,
     Pointer<Utf8> sig);
 
+// Multi-Field Access
+typedef NativeResolveField = Int64 Function(
+    Pointer<Utf8> className,
+    Pointer<Utf8> fieldName,
+    Pointer<Utf8> sig);
+typedef DartResolveField = int Function(
+    Pointer<Utf8> className,
+    Pointer<Utf8> fieldName,
+    Pointer<Utf8> sig);
+
+typedef NativeFieldTokenSize = Int32 Function(Int64 token);
+typedef DartFieldTokenSize = int Function(int token);
+
+typedef NativeReadFields = Int32 Function(
+    Int64 handle, Pointer<Int64> tokens, Int32 count, Pointer<Uint8> out);
+typedef DartReadFields = int Function(
+    int handle, Pointer<Int64> tokens, int count, Pointer<Uint8> out);
+
+typedef NativeWriteFields = Int32 Function(
+    Int64 handle, Pointer<Int64> tokens, Int32 count, Pointer<Uint8> input);
+typedef DartWriteFields = int Function(
+    int handle, Pointer<Int64> tokens, int count, Pointer<Uint8> input);
+
+// DartBridge Binding Calls
+typedef NativeBridgeBindingsHash = Uint32 Function();
+typedef DartBridgeBindingsHash = int Function();
+
+typedef NativeBridgeCallVoid = Void Function(
+    Int32 index, Pointer<Int64> args, Int32 argCount);
+typedef DartBridgeCallVoid = void Function(
+    int index, Pointer<Int64> args, int argCount);
+
+typedef NativeBridgeCallInt = Int32 Function(
+    Int32 index, Pointer<Int64> args, Int32 argCount);
+typedef DartBridgeCallInt = int Function(
+    int index, Pointer<Int64> args, int argCount);
+
+typedef NativeBridgeCallLong = Int64 Function(
+    Int32 index, Pointer<Int64> args, Int32 argCount);
+typedef DartBridgeCallLong = int Function(
+    int index, Pointer<Int64> args, int argCount);
+
+typedef NativeBridgeCallDouble = Double Function(
+    Int32 index, Pointer<Int64> args, Int32 argCount);
+typedef DartBridgeCallDouble = double Function(
+    int index, Pointer<Int64> args, int argCount);
+
+typedef NativeBridgeCallBool = Bool Function(
+    Int32 index, Pointer<Int64> args, Int32 argCount);
+typedef DartBridgeCallBool = bool Function(
+    int index, Pointer<Int64> args, int argCount);
+
+typedef NativeBridgeCallString = Pointer<Utf8> Function(
+    Int32 index, Pointer<Int64> args, Int32 argCount);
+typedef DartBridgeCallString = Pointer<Utf8> Function(
+    int index, Pointer<Int64> args, int argCount);
+
 // Object Lifecycle
 typedef NativeReleaseObject = Void Function(Int64 handle);
 typedef DartReleaseObject = void Function(int handle);
@@ -484,6 +542,29 @@ class GenericJniBridge {
   static late DartGetStaticObjectField _getStaticObjectField;
   static late DartGetStaticIntField _getStaticIntField;
 
+  // Function pointers - Multi-Field Access
+  static late DartResolveField _resolveField;
+  static late DartFieldTokenSize _fieldTokenSize;
+  static late DartReadFields _readFields;
+  static late DartWriteFields _writeFields;
+
+  // Function pointers - DartBridge Binding Calls
+  static late DartBridgeCallVoid _bridgeCallVoid;
+  static late DartBridgeCallInt _bridgeCallInt;
+  static late DartBridgeCallLong _bridgeCallLong;
+  static late DartBridgeCallDouble _bridgeCallDouble;
+  static late DartBridgeCallBool _bridgeCallBool;
+  static late DartBridgeCallLong _bridgeCallObject;
+  static late DartBridgeCallString _bridgeCallString;
+
+  /// Whether the native binding table matches [DartBridgeBindings].
+  ///
+  /// False with an older native library; binding calls then fall back to
+  /// the by-name static calls.
+  static bool _bridgeBindingsMatch = false;
+
+  static const _dartBridgeClass = 'com/redstone/DartBridge';
+
   // Function pointers - Lifecycle
   static late DartReleaseObject _releaseObject;
   static late DartFreeString _freeString;
@@ -586,6 +667,43 @@ class GenericJniBridge {
         _lib.lookupFunction<NativeGetStaticIntField, DartGetStaticIntField>(
             'jni_get_static_int_field');
 
+    // Multi-Field Access
+    _resolveField = _lib.lookupFunction<NativeResolveField, DartResolveField>(
+        'jni_resolve_field');
+    _fieldTokenSize = _lib.lookupFunction<NativeFieldTokenSize, DartFieldTokenSize>(
+        'jni_field_token_size');
+    _readFields = _lib.lookupFunction<NativeReadFields, DartReadFields>(
+        'jni_read_fields');
+    _writeFields = _lib.lookupFunction<NativeWriteFields, DartWriteFields>(
+        'jni_write_fields');
+
+    // DartBridge Binding Calls
+    if (_lib.providesSymbol('jni_bridge_bindings_hash')) {
+      final tableHash = _lib
+          .lookupFunction<NativeBridgeBindingsHash, DartBridgeBindingsHash>(
+              'jni_bridge_bindings_hash')();
+      _bridgeBindingsMatch = tableHash == DartBridgeBindings.tableHash;
+    }
+    if (_bridgeBindingsMatch) {
+      _bridgeCallVoid = _lib.lookupFunction<NativeBridgeCallVoid, DartBridgeCallVoid>(
+          'jni_bridge_call_void');
+      _bridgeCallInt = _lib.lookupFunction<NativeBridgeCallInt, DartBridgeCallInt>(
+          'jni_bridge_call_int');
+      _bridgeCallLong = _lib.lookupFunction<NativeBridgeCallLong, DartBridgeCallLong>(
+          'jni_bridge_call_long');
+      _bridgeCallDouble = _lib.lookupFunction<NativeBridgeCallDouble, DartBridgeCallDouble>(
+          'jni_bridge_call_double');
+      _bridgeCallBool = _lib.lookupFunction<NativeBridgeCallBool, DartBridgeCallBool>(
+          'jni_bridge_call_bool');
+      _bridgeCallObject = _lib.lookupFunction<NativeBridgeCallLong, DartBridgeCallLong>(
+          'jni_bridge_call_object');
+      _bridgeCallString = _lib.lookupFunction<NativeBridgeCallString, DartBridgeCallString>(
+          'jni_bridge_call_string');
+    } else {
+      print('[GenericJniBridge] DartBridge bindings do not match the native library, '
+          'using by-name calls');
+    }
+
     // Lifecycle
     _releaseObject = _lib.lookupFunction<NativeReleaseObject, DartReleaseObject>(
         'jni_release_object');
@@ -1268,6 +1386,139 @@ class GenericJniBridge {
     }
   }
 
+  // ==========================================================================
+  // DartBridge Binding Calls
+  // ==========================================================================
+  //
+  // Used by the generated [DartBridgeBindings]. [index] selects a method
+  // pre-resolved by the native library; [methodName] is only used for the
+  // by-name fallback when the native table does not match.
+
+  /// Call a bound DartBridge method returning void.
+  static void callBridgeVoid(int index, String methodName, String sig,
+      [List<Object?> args = const []]) {
+    if (_datagenMode) return;
+    if (!_bridgeBindingsMatch) {
+      return callStaticVoidMethod(_dartBridgeClass, methodName, sig, args);
+    }
+
+    final encodedArgs = _encodeArgs(args, sig);
+    try {
+      _bridgeCallVoid(index, encodedArgs.ptr, args.length);
+      checkError();
+    } finally {
+      encodedArgs.free();
+    }
+  }
+
+  /// Call a bound DartBridge method returning int (or byte, char, short).
+  static int callBridgeInt(int index, String methodName, String sig,
+      [List<Object?> args = const []]) {
+    if (_datagenMode) return 0;
+    if (!_bridgeBindingsMatch) {
+      return callStaticIntMethod(_dartBridgeClass, methodName, sig, args);
+    }
+
+    final encodedArgs = _encodeArgs(args, sig);
+    try {
+      final result = _bridgeCallInt(index, encodedArgs.ptr, args.length);
+      checkError();
+      return result;
+    } finally {
+      encodedArgs.free();
+    }
+  }
+
+  /// Call a bound DartBridge method returning long.
+  static int callBridgeLong(int index, String methodName, String sig,
+      [List<Object?> args = const []]) {
+    if (_datagenMode || !_bridgeBindingsMatch) {
+      return callStaticLongMethod(_dartBridgeClass, methodName, sig, args);
+    }
+
+    final encodedArgs = _encodeArgs(args, sig);
+    try {
+      final result = _bridgeCallLong(index, encodedArgs.ptr, args.length);
+      checkError();
+      return result;
+    } finally {
+      encodedArgs.free();
+    }
+  }
+
+  /// Call a bound DartBridge method returning double.
+  static double callBridgeDouble(int index, String methodName, String sig,
+      [List<Object?> args = const []]) {
+    if (_datagenMode) return 0.0;
+    if (!_bridgeBindingsMatch) {
+      return callStaticDoubleMethod(_dartBridgeClass, methodName, sig, args);
+    }
+
+    final encodedArgs = _encodeArgs(args, sig);
+    try {
+      return _bridgeCallDouble(index, encodedArgs.ptr, args.length);
+    } finally {
+      encodedArgs.free();
+    }
+  }
+
+  /// Call a bound DartBridge method returning boolean.
+  static bool callBridgeBool(int index, String methodName, String sig,
+      [List<Object?> args = const []]) {
+    if (_datagenMode) return true;
+    if (!_bridgeBindingsMatch) {
+      return callStaticBoolMethod(_dartBridgeClass, methodName, sig, args);
+    }
+
+    final encodedArgs = _encodeArgs(args, sig);
+    try {
+      return _bridgeCallBool(index, encodedArgs.ptr, args.length);
+    } finally {
+      encodedArgs.free();
+    }
+  }
+
+  /// Call a bound DartBridge method returning an object (array) handle.
+  static int callBridgeObject(int index, String methodName, String sig,
+      [List<Object?> args = const []]) {
+    if (_datagenMode) return 0;
+    if (!_bridgeBindingsMatch) {
+      return callStaticObjectMethod(_dartBridgeClass, methodName, sig, args);
+    }
+
+    final encodedArgs = _encodeArgs(args, sig);
+    try {
+      final result = _bridgeCallObject(index, encodedArgs.ptr, args.length);
+      checkError();
+      return result;
+    } finally {
+      encodedArgs.free();
+    }
+  }
+
+  /// Call a bound DartBridge method returning String.
+  static String? callBridgeString(int index, String methodName, String sig,
+      [List<Object?> args = const []]) {
+    if (_datagenMode) return null;
+    if (!_bridgeBindingsMatch) {
+      return callStaticStringMethod(_dartBridgeClass, methodName, sig, args);
+    }
+
+    final encodedArgs = _encodeArgs(args, sig);
+    try {
+      final resultPtr = _bridgeCallString(index, encodedArgs.ptr, args.length);
+      checkError();
+
+      if (resultPtr == nullptr) return null;
+
+      final result = resultPtr.toDartString();
+      _freeString(resultPtr);
+      return result;
+    } finally {
+      encodedArgs.free();
+    }
+  }
+
   // ==========================================================================
   // Field Access
   // ==========================================================================
@@ -1544,6 +1795,52 @@ class GenericJniBridge {
     }
   }
 
+  // ==========================================================================
+  // Multi-Field Access
+  // ==========================================================================
+
+  /// Resolve a primitive instance field to a token for [readFields] and
+  /// [writeFields]. Returns 0 if the field does not exist or is not primitive.
+  static int resolveField(String className, String fieldName, String sig) {
+    if (_datagenMode) return 0;
+
+    final classNamePtr = className.toNativeUtf8();
+    final fieldNamePtr = fieldName.toNativeUtf8();
+    final sigPtr = sig.toNativeUtf8();
+
+    try {
+      return _resolveField(classNamePtr, fieldNamePtr, sigPtr);
+    } finally {
+      calloc.free(classNamePtr);
+      calloc.free(fieldNamePtr);
+      calloc.free(sigPtr);
+    }
+  }
+
+  /// Size in bytes of a field token's value in the packed layout.
+  static int fieldTokenSize(int token) {
+    if (_datagenMode) return 0;
+    return _fieldTokenSize(token);
+  }
+
+  /// Read several primitive fields of one object in a single call.
+  ///
+  /// Values are packed into [out] in token order without padding (host byte
+  /// order). Returns the number of bytes written, or -1 on error.
+  static int readFields(int handle, Pointer<Int64> tokens, int count, Pointer<Uint8> out) {
+    if (_datagenMode) return -1;
+    return _readFields(handle, tokens, count, out);
+  }
+
+  /// Write several primitive fields of one object in a single call.
+  ///
+  /// [input] uses the same packed layout as [readFields]. Returns the number
+  /// of bytes consumed, or -1 on error.
+  static int writeFields(int handle, Pointer<Int64> tokens, int count, Pointer<Uint8> input) {
+    if (_datagenMode) return -1;
+    return _writeFields(handle, tokens, count, input);
+  }
+
   // ==========================================================================
   // Object Lifecycle
   // ==========================================================================
@@ -1563,6 +1860,71 @@ class GenericJniBridge {
 // Helper Classes
 // ============================================================================
 
+/// A fixed set of primitive fields of one Java class, read or written in a
+/// single native call.
+///
+/// ```dart
+/// final pos = JniFieldSet('net/minecraft/world/entity/Entity',
+///     [('xo', 'D'), ('yo', 'D'), ('zo', 'D'), ('yRot', 'F')]);
+/// final data = pos.read(entityHandle);
+/// if (data != null) {
+///   final x = data.getFloat64(pos.offsetOf(0), Endian.host);
+/// }
+/// ```
+///
+/// Tokens and buffers are resolved and allocated once; the set lives for the
+/// rest of the isolate. Tokens become invalid after the JNI bridge shuts down.
+class JniFieldSet {
+  final Pointer<Int64> _tokens;
+  final Pointer<Uint8> _buffer;
+  final List<int> _offsets;
+
+  /// Number of fields in the set.
+  final int length;
+
+  /// Size in bytes of the packed values.
+  final int size;
+
+  JniFieldSet._(this._tokens, this._buffer, this._offsets, this.length, this.size);
+
+  /// Resolve [fields] as (name, signature) pairs of [className].
+  /// Throws [JniException] if any field cannot be resolved.
+  factory JniFieldSet(String className, List<(String, String)> fields) {
+    final tokens = calloc<Int64>(fields.length);
+    final offsets = <int>[];
+    var size = 0;
+    for (var i = 0; i < fields.length; i++) {
+      final (name, sig) = fields[i];
+      final token = GenericJniBridge.resolveField(className, name, sig);
+      if (token == 0) {
+        calloc.free(tokens);
+        throw JniException('Cannot resolve primitive field $className.$name ($sig)');
+      }
+      tokens[i] = token;
+      offsets.add(size);
+      size += GenericJniBridge.fieldTokenSize(token);
+    }
+    return JniFieldSet._(tokens, calloc<Uint8>(size == 0 ? 1 : size), offsets, fields.length, size);
+  }
+
+  /// Byte offset of field [index] in the packed data.
+  int offsetOf(int index) => _offsets[index];
+
+  /// Read all fields of [handle]. The returned view is reused by the next
+  /// [read] call; returns null on error.
+  ByteData? read(int handle) {
+    if (GenericJniBridge.readFields(handle, _tokens, length, _buffer) < 0) return null;
+    return _buffer.asTypedList(size).buffer.asByteData(0, size);
+  }
+
+  /// Write all fields of [handle] from [data] (same layout as [read]).
+  /// Returns false on error.
+  bool write(int handle, ByteData data) {
+    _buffer.asTypedList(size).setRange(0, size, data.buffer.asUint8List(data.offsetInBytes, size));
+    return GenericJniBridge.writeFields(handle, _tokens, length, _buffer) >= 0;
+  }
+}
+
 /// Interface for objects that hold a Java object handle.
 abstract interface class JavaObjectHandle {
   int get handle;
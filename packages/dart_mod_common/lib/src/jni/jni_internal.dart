@@ -6,6 +6,7 @@
 /// accidentally depending on internal JNI APIs.
 library;
 
+export 'dart_bridge_bindings.g.dart';
 export 'generic_bridge.dart';
 export 'jni.dart';
 export 'java_object.dart';
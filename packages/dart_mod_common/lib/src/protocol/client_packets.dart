@@ -4,6 +4,7 @@ library;
 import 'dart:typed_data';
 
 import 'packet.dart';
+import 'packet_schema.dart';
 import 'packet_types.dart';
 
 /// UI action types.
@@ -214,4 +215,5 @@ void registerC2SPackets() {
   PacketRegistry.register(PacketTypes.requestData, RequestDataPacket.decode);
   PacketRegistry.register(PacketTypes.clientEvent, ClientEventPacket.decode);
   PacketRegistry.register(PacketTypes.containerDataUpdate, ContainerDataUpdatePacket.decode);
+  PacketRegistry.register(PacketTypes.schemaC2S, SchemaPacket.decode);
 }
@@ -80,10 +80,17 @@ class PacketRegistry {
   }
 
   /// Decode a packet by type ID.
+  ///
+  /// Returns null if the type is unknown or the payload is malformed.
   static ModPacket? decode(int typeId, Uint8List payload) {
     final decoder = _decoders[typeId];
     if (decoder == null) return null;
-    return decoder(payload);
+    try {
+      return decoder(payload);
+    } on FormatException catch (e) {
+      print('[PacketRegistry] Malformed packet 0x${typeId.toRadixString(16)}: ${e.message}');
+      return null;
+    }
   }
 
   /// Check if a packet type is registered.
@@ -0,0 +1,358 @@
+/// Schema-driven fixed-layout packets.
+library;
+
+import 'dart:convert';
+import 'dart:ffi';
+import 'dart:typed_data';
+
+import 'package:ffi/ffi.dart';
+
+import 'packet.dart';
+import 'packet_types.dart';
+
+/// Type of a [SchemaField].
+///
+/// Codes must match PACKET_FIELD_* in packet_schema.h.
+enum SchemaFieldType {
+  boolean(1, 1),
+  uint8(2, 1),
+  int16(3, 2),
+  int32(4, 4),
+  int64(5, 8),
+  float32(6, 4),
+  float64(7, 8),
+  string(8, 0),
+  bytes(9, 0);
+
+  /// The PACKET_FIELD_* code.
+  final int code;
+
+  /// Size in bytes, 0 for variable-length fields.
+  final int size;
+
+  const SchemaFieldType(this.code, this.size);
+
+  /// Whether the field is stored in the variable section.
+  bool get isVariable => size == 0;
+}
+
+/// A typed field of a [PacketSchema].
+///
+/// A field belongs to exactly one schema. Keep it in a final variable and
+/// use it to read and write [SchemaPacket]s:
+///
+/// ```dart
+/// final x = SchemaField.int32('x');
+/// final label = SchemaField.string('label');
+/// final markerSchema = PacketSchema(0x0100, [x, label]);
+///
+/// final value = packet.get(x); // int
+/// ```
+class SchemaField<T extends Object> {
+  /// Field name, used only in diagnostics (it is not sent).
+  final String name;
+
+  /// The field's wire type.
+  final SchemaFieldType type;
+
+  PacketSchema? _schema;
+
+  /// Payload offset (fixed fields) or offset of the u32 end entry
+  /// (variable fields), assigned by the bridge.
+  int _offset = -1;
+
+  /// Position among the schema's variable fields, -1 for fixed fields.
+  int _varIndex = -1;
+
+  SchemaField._(this.name, this.type);
+
+  static SchemaField<bool> boolean(String name) =>
+      SchemaField._(name, SchemaFieldType.boolean);
+  static SchemaField<int> uint8(String name) =>
+      SchemaField._(name, SchemaFieldType.uint8);
+  static SchemaField<int> int16(String name) =>
+      SchemaField._(name, SchemaFieldType.int16);
+  static SchemaField<int> int32(String name) =>
+      SchemaField._(name, SchemaFieldType.int32);
+  static SchemaField<int> int64(String name) =>
+      SchemaField._(name, SchemaFieldType.int64);
+  static SchemaField<double> float32(String name) =>
+      SchemaField._(name, SchemaFieldType.float32);
+  static SchemaField<double> float64(String name) =>
+      SchemaField._(name, SchemaFieldType.float64);
+  static SchemaField<String> string(String name) =>
+      SchemaField._(name, SchemaFieldType.string);
+  static SchemaField<Uint8List> bytes(String name) =>
+      SchemaField._(name, SchemaFieldType.bytes);
+
+  @override
+  String toString() => 'SchemaField($name: ${type.name})';
+}
+
+/// Native `packet_schema_register` binding, see [PacketSchema.applyLayout].
+typedef PacketSchemaRegisterNative = Int32 Function(
+    Int32 schemaId, Pointer<Uint8> fieldTypes, Int32 fieldCount,
+    Pointer<Int32> outOffsets, Pointer<Int32> outFingerprint);
+typedef PacketSchemaRegister = int Function(
+    int schemaId, Pointer<Uint8> fieldTypes, int fieldCount,
+    Pointer<Int32> outOffsets, Pointer<Int32> outFingerprint);
+
+/// A packet layout declared once and shared by server and client.
+///
+/// Declare schemas in code that runs on both sides and register them with
+/// `ServerNetwork.registerSchema` and `ClientNetwork.registerSchema`. The
+/// bridge computes every field's offset, so packets are written and read
+/// with direct accesses at fixed positions. The wire carries only the
+/// schema id, never field names. Layout in native packet_schema.h.
+///
+/// ```dart
+/// final x = SchemaField.int32('x');
+/// final y = SchemaField.int32('y');
+/// final z = SchemaField.int32('z');
+/// final power = SchemaField.float32('power');
+/// final blockPulse = PacketSchema(0x0101, [x, y, z, power]);
+///
+/// ServerNetwork.sendToPlayer(playerId, blockPulse.build()
+///   ..set(x, 10)..set(y, 64)..set(z, -3)..set(power, 0.5));
+///
+/// ClientNetwork.onPacketReceived((packet) {
+///   if (packet is SchemaPacket && packet.schema == blockPulse) {
+///     spawnPulse(packet.get(x), packet.get(y), packet.get(z), packet.get(power));
+///   }
+/// });
+/// ```
+class PacketSchema {
+  static final Map<int, PacketSchema> _schemas = {};
+
+  /// Schema id (0 - 0xFFFF), unique per mod set.
+  final int id;
+
+  /// Whether packets of this schema go client -> server.
+  final bool toServer;
+
+  /// Fields in declaration order.
+  final List<SchemaField> fields;
+
+  int _fixedSize = -1;
+  int _fingerprint = 0;
+  int _varCount = 0;
+
+  PacketSchema(this.id, List<SchemaField> fields, {this.toServer = false})
+      : fields = List.unmodifiable(fields) {
+    if (id < 0 || id > 0xFFFF) {
+      throw ArgumentError.value(id, 'id', 'Schema id must fit in 16 bits');
+    }
+    for (final field in fields) {
+      if (field._schema != null) {
+        throw ArgumentError('$field already belongs to schema ${field._schema!.id}');
+      }
+      field._schema = this;
+    }
+  }
+
+  /// The packet type schema packets are sent with.
+  int get typeId => toServer ? PacketTypes.schemaC2S : PacketTypes.schemaS2C;
+
+  /// Whether the bridge has laid out this schema.
+  bool get isRegistered => _fixedSize >= 0;
+
+  /// Size of the fixed part of the payload (header, fixed fields and
+  /// variable end offsets).
+  int get fixedSize => _fixedSize;
+
+  /// Look up a registered schema by id.
+  static PacketSchema? byId(int id) => _schemas[id];
+
+  /// Start a new outgoing packet with all fields zero or empty.
+  SchemaPacket build() {
+    if (!isRegistered) {
+      throw StateError('Packet schema $id is not registered');
+    }
+    return SchemaPacket._build(this);
+  }
+
+  /// Have the bridge lay out this schema.
+  ///
+  /// Called by the server and client network modules through their binding
+  /// of `packet_schema_register`. Returns false if the bridge rejected it.
+  bool applyLayout(PacketSchemaRegister register) {
+    final count = fields.length;
+    final types = calloc<Uint8>(count == 0 ? 1 : count);
+    final offsets = calloc<Int32>(count == 0 ? 1 : count);
+    final fingerprint = calloc<Int32>();
+    try {
+      for (var i = 0; i < count; i++) {
+        types[i] = fields[i].type.code;
+      }
+      final fixedSize = register(id, types, count, offsets, fingerprint);
+      if (fixedSize < 0) return false;
+
+      var varIndex = 0;
+      for (var i = 0; i < count; i++) {
+        final field = fields[i];
+        field._offset = offsets[i];
+        field._varIndex = field.type.isVariable ? varIndex++ : -1;
+      }
+      _varCount = varIndex;
+      _fingerprint = fingerprint.value;
+      _fixedSize = fixedSize;
+      _schemas[id] = this;
+      return true;
+    } finally {
+      calloc.free(types);
+      calloc.free(offsets);
+      calloc.free(fingerprint);
+    }
+  }
+
+  @override
+  String toString() => 'PacketSchema($id, ${fields.length} fields)';
+}
+
+/// A packet with a [PacketSchema] layout.
+///
+/// Received packets are views over the payload bytes: nothing is decoded
+/// until a field is read, and fixed fields are single loads at precomputed
+/// offsets. Packets from [PacketSchema.build] are written in place.
+class SchemaPacket extends ModPacket {
+  /// The packet's layout.
+  final PacketSchema schema;
+
+  /// Received: the whole payload. Built: the fixed part.
+  final ByteData _data;
+
+  /// Encoded variable fields of a built packet, null when received.
+  final List<Uint8List?>? _variable;
+
+  SchemaPacket._build(this.schema)
+      : _data = ByteData(schema._fixedSize),
+        _variable = List.filled(schema._varCount, null) {
+    _data.setUint16(0, schema.id, Endian.little);
+    _data.setUint16(2, schema._fingerprint, Endian.little);
+  }
+
+  SchemaPacket._view(this.schema, this._data) : _variable = null;
+
+  /// Decode a schema packet payload (registered for
+  /// [PacketTypes.schemaS2C] and [PacketTypes.schemaC2S]).
+  ///
+  /// The bridge has already checked the payload against the layout; this
+  /// only resolves the schema.
+  static SchemaPacket decode(Uint8List payload) {
+    if (payload.length < 4) {
+      throw const FormatException('Schema packet too short');
+    }
+    final data = ByteData.sublistView(payload);
+    final id = data.getUint16(0, Endian.little);
+    final schema = PacketSchema._schemas[id];
+    if (schema == null) {
+      throw FormatException('Unknown packet schema $id');
+    }
+    if (data.getUint16(2, Endian.little) != schema._fingerprint) {
+      throw FormatException('Packet schema $id layout mismatch');
+    }
+    return SchemaPacket._view(schema, data);
+  }
+
+  @override
+  int get typeId => schema.typeId;
+
+  /// Read a field.
+  T get<T extends Object>(SchemaField<T> field) {
+    _checkField(field);
+    final data = _data;
+    final offset = field._offset;
+    final Object value = switch (field.type) {
+      SchemaFieldType.boolean => data.getUint8(offset) != 0,
+      SchemaFieldType.uint8 => data.getUint8(offset),
+      SchemaFieldType.int16 => data.getInt16(offset, Endian.little),
+      SchemaFieldType.int32 => data.getInt32(offset, Endian.little),
+      SchemaFieldType.int64 => data.getInt64(offset, Endian.little),
+      SchemaFieldType.float32 => data.getFloat32(offset, Endian.little),
+      SchemaFieldType.float64 => data.getFloat64(offset, Endian.little),
+      SchemaFieldType.string => utf8.decode(_variableBytes(field)),
+      SchemaFieldType.bytes => _variableBytes(field),
+    };
+    return value as T;
+  }
+
+  /// Write a field of a packet from [PacketSchema.build].
+  void set<T extends Object>(SchemaField<T> field, T value) {
+    _checkField(field);
+    final variable = _variable;
+    if (variable == null) {
+      throw StateError('Received schema packets are read-only');
+    }
+    final data = _data;
+    final offset = field._offset;
+    switch (field.type) {
+      case SchemaFieldType.boolean:
+        data.setUint8(offset, (value as bool) ? 1 : 0);
+      case SchemaFieldType.uint8:
+        data.setUint8(offset, value as int);
+      case SchemaFieldType.int16:
+        data.setInt16(offset, value as int, Endian.little);
+      case SchemaFieldType.int32:
+        data.setInt32(offset, value as int, Endian.little);
+      case SchemaFieldType.int64:
+        data.setInt64(offset, value as int, Endian.little);
+      case SchemaFieldType.float32:
+        data.setFloat32(offset, value as double, Endian.little);
+      case SchemaFieldType.float64:
+        data.setFloat64(offset, value as double, Endian.little);
+      case SchemaFieldType.string:
+        variable[field._varIndex] = const Utf8Encoder().convert(value as String);
+      case SchemaFieldType.bytes:
+        variable[field._varIndex] = value as Uint8List;
+    }
+  }
+
+  @override
+  Uint8List encodePayload() {
+    final variable = _variable;
+    if (variable == null) {
+      return Uint8List.sublistView(_data);
+    }
+
+    final fixedSize = schema._fixedSize;
+    var end = 0;
+    for (final field in schema.fields) {
+      if (field._varIndex < 0) continue;
+      end += variable[field._varIndex]?.length ?? 0;
+      _data.setUint32(field._offset, end, Endian.little);
+    }
+
+    final bytes = Uint8List(fixedSize + end);
+    bytes.setRange(0, fixedSize, _data.buffer.asUint8List());
+    var position = fixedSize;
+    for (final value in variable) {
+      if (value == null) continue;
+      bytes.setRange(position, position + value.length, value);
+      position += value.length;
+    }
+    return bytes;
+  }
+
+  Uint8List _variableBytes(SchemaField field) {
+    final variable = _variable;
+    if (variable != null) {
+      return variable[field._varIndex] ?? Uint8List(0);
+    }
+    // End entries are consecutive, so the previous field's end is just before
+    final start = field._varIndex == 0
+        ? 0
+        : _data.getUint32(field._offset - 4, Endian.little);
+    final end = _data.getUint32(field._offset, Endian.little);
+    final base = _data.offsetInBytes + schema._fixedSize;
+    return _data.buffer.asUint8List(base + start, end - start);
+  }
+
+  void _checkField(SchemaField field) {
+    if (!identical(field._schema, schema)) {
+      throw ArgumentError('$field is not part of $schema');
+    }
+  }
+
+  @override
+  String toString() => 'SchemaPacket(${schema.id})';
+}
@@ -25,6 +25,9 @@ abstract class PacketTypes {
   /// Custom event from server (server -> client).
   static const int serverEvent = 0x05;
 
+  /// Packet with a registered [PacketSchema] layout (server -> client).
+  static const int schemaS2C = 0x7F;
+
   // ==========================================================================
   // Client-to-Server (C2S) Packets: 0x80 - 0xFF
   // ==========================================================================
@@ -42,6 +45,9 @@ abstract class PacketTypes {
   /// Used when client-side UI changes a SyncedInt value.
   static const int containerDataUpdate = 0x83;
 
+  /// Packet with a registered [PacketSchema] layout (client -> server).
+  static const int schemaC2S = 0xFF;
+
   /// Check if a packet type is server-to-client.
   static bool isS2C(int typeId) => typeId >= 0x00 && typeId < 0x80;
 
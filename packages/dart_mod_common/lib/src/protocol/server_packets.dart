@@ -4,6 +4,7 @@ library;
 import 'dart:typed_data';
 
 import 'packet.dart';
+import 'packet_schema.dart';
 import 'packet_types.dart';
 
 /// Notify client of a block change.
@@ -251,4 +252,5 @@ void registerS2CPackets() {
   PacketRegistry.register(PacketTypes.screenData, ScreenDataPacket.decode);
   PacketRegistry.register(PacketTypes.syncState, SyncStatePacket.decode);
   PacketRegistry.register(PacketTypes.serverEvent, ServerEventPacket.decode);
+  PacketRegistry.register(PacketTypes.schemaS2C, SchemaPacket.decode);
 }
@@ -13,6 +13,7 @@ export 'package:dart_mod_common/dart_mod_common.dart'
 export 'src/bridge.dart' show ServerBridge, Bridge;
 export 'src/registries.dart';
 export 'src/events.dart';
+export 'src/event_filters.dart';
 export 'src/player.dart';
 export 'src/entity.dart';
 export 'src/entity_actions.dart';
@@ -30,7 +31,11 @@ export 'src/client_bridge.dart';
 export 'src/block_entity/block_entity.dart';
 export 'src/flutter_display.dart';
 export 'src/data_components.dart';
+export 'src/item_components.dart' show ItemComponent;
 export 'src/item_stack_handle.dart';
 export 'src/server.dart';
 export 'src/dimension_registry.dart';
 export 'src/world_gen.dart';
+export 'src/chunk_snapshot.dart';
+export 'src/chunk_data_store.dart';
+export 'src/world_query.dart' show WorldQueries, WorldQueryReply, WorldQueryException, BlockRaycastHit;
@@ -6,6 +6,7 @@ library;
 
 import 'dart:convert';
 import 'dart:ffi';
+import 'dart:typed_data';
 
 import 'package:dart_mod_common/dart_mod_common.dart';
 import 'package:ffi/ffi.dart';
@@ -54,6 +55,23 @@ typedef _BlockEntityContainerOpenCallbackNative = Void Function(
 typedef _BlockEntityContainerCloseCallbackNative = Void Function(
     Int32 handlerId, Int64 blockPosHash);
 
+// void (*BlockEntityLoadChunkCallback)(const int32_t* handler_ids, const int64_t* block_pos_hashes,
+//                                      const uint8_t* data, const int32_t* offsets, int32_t count);
+typedef _BlockEntityLoadChunkCallbackNative = Void Function(Pointer<Int32> handlerIds,
+    Pointer<Int64> blockPosHashes, Pointer<Uint8> data, Pointer<Int32> offsets, Int32 count);
+
+// int32_t (*BlockEntitySaveChunkCallback)(const int32_t* handler_ids, const int64_t* block_pos_hashes,
+//                                         int32_t count, int32_t* out_offsets);
+typedef _BlockEntitySaveChunkCallbackNative = Int32 Function(
+    Pointer<Int32> handlerIds, Pointer<Int64> blockPosHashes, Int32 count, Pointer<Int32> outOffsets);
+
+// uint8_t* server_block_entity_chunk_reserve(int32_t length);
+typedef _ChunkReserveNative = Pointer<Uint8> Function(Int32 length);
+typedef _ChunkReserve = Pointer<Uint8> Function(int length);
+
+late final _ChunkReserve _chunkReserve = ServerBridge.library
+    .lookupFunction<_ChunkReserveNative, _ChunkReserve>('server_block_entity_chunk_reserve');
+
 // =============================================================================
 // Callback Handlers (called from native code)
 // =============================================================================
@@ -109,6 +127,70 @@ Pointer<Utf8> _onBlockEntitySaveAdditional(int handlerId, int blockPosHash) {
   }
 }
 
+/// Handle a chunk-batched load.
+/// Each entry is loaded from its JSON span (skipped when empty), then receives
+/// setLevel - the same order Minecraft uses when a chunk is loaded.
+@pragma('vm:entry-point')
+void _onBlockEntityLoadChunk(Pointer<Int32> handlerIdsPtr, Pointer<Int64> blockPosHashesPtr,
+    Pointer<Uint8> dataPtr, Pointer<Int32> offsetsPtr, int count) {
+  final handlerIds = handlerIdsPtr.asTypedList(count);
+  final blockPosHashes = blockPosHashesPtr.asTypedList(count);
+  final offsets = offsetsPtr.asTypedList(count + 1);
+  final data = offsets[count] > 0 ? dataPtr.asTypedList(offsets[count]) : Uint8List(0);
+
+  for (var i = 0; i < count; i++) {
+    try {
+      final instance = BlockEntityRegistry.getOrCreate(handlerIds[i], blockPosHashes[i]);
+      final start = offsets[i];
+      final end = offsets[i + 1];
+      if (end > start) {
+        final nbtJson = utf8.decode(Uint8List.sublistView(data, start, end));
+        instance.loadAdditional(jsonDecode(nbtJson) as Map<String, dynamic>);
+      }
+      instance.setLevel();
+    } catch (e, stack) {
+      print('BlockEntityCallbacks: Error in chunk load handler: $e\n$stack');
+    }
+  }
+}
+
+/// Handle a chunk-batched save.
+/// Writes every entry's JSON into the native chunk buffer and fills
+/// [outOffsetsPtr] with count + 1 offsets. Returns the payload length.
+@pragma('vm:entry-point')
+int _onBlockEntitySaveChunk(
+    Pointer<Int32> handlerIdsPtr, Pointer<Int64> blockPosHashesPtr, int count, Pointer<Int32> outOffsetsPtr) {
+  try {
+    final handlerIds = handlerIdsPtr.asTypedList(count);
+    final blockPosHashes = blockPosHashesPtr.asTypedList(count);
+    final offsets = outOffsetsPtr.asTypedList(count + 1);
+
+    final encoded = List<List<int>>.filled(count, const <int>[]);
+    var total = 0;
+    for (var i = 0; i < count; i++) {
+      offsets[i] = total;
+      try {
+        final instance = BlockEntityRegistry.get(handlerIds[i], blockPosHashes[i]);
+        encoded[i] = utf8.encode(instance == null ? '{}' : jsonEncode(instance.saveAdditional()));
+      } catch (e, stack) {
+        print('BlockEntityCallbacks: Error in chunk save handler: $e\n$stack');
+        encoded[i] = utf8.encode('{}');
+      }
+      total += encoded[i].length;
+    }
+    offsets[count] = total;
+
+    final out = _chunkReserve(total).asTypedList(total);
+    for (var i = 0; i < count; i++) {
+      out.setRange(offsets[i], offsets[i + 1], encoded[i]);
+    }
+    return total;
+  } catch (e, stack) {
+    print('BlockEntityCallbacks: Error in chunk save handler: $e\n$stack');
+    return -1;
+  }
+}
+
 /// Handle block entity tick event.
 @pragma('vm:entry-point')
 void _onBlockEntityTick(int handlerId, int blockPosHash) {
@@ -276,6 +358,20 @@ void initBlockEntityCallbacks() {
       'server_register_block_entity_container_close_handler');
   registerContainerClose(Pointer.fromFunction<_BlockEntityContainerCloseCallbackNative>(_onBlockEntityContainerClose));
 
+  // Register chunk-batched load/save handlers (one isolate entry per chunk)
+  final registerLoadChunk = lib.lookupFunction<
+      Void Function(Pointer<NativeFunction<_BlockEntityLoadChunkCallbackNative>>),
+      void Function(Pointer<NativeFunction<_BlockEntityLoadChunkCallbackNative>>)>(
+      'server_register_block_entity_load_chunk_handler');
+  registerLoadChunk(Pointer.fromFunction<_BlockEntityLoadChunkCallbackNative>(_onBlockEntityLoadChunk));
+
+  final registerSaveChunk = lib.lookupFunction<
+      Void Function(Pointer<NativeFunction<_BlockEntitySaveChunkCallbackNative>>),
+      void Function(Pointer<NativeFunction<_BlockEntitySaveChunkCallbackNative>>)>(
+      'server_register_block_entity_save_chunk_handler');
+  registerSaveChunk(
+      Pointer.fromFunction<_BlockEntitySaveChunkCallbackNative>(_onBlockEntitySaveChunk, -1));
+
   // Enable JNI-based inventory access for block entities on the server
   BlockEntityWithInventory.enableJniInventoryAccess();
 
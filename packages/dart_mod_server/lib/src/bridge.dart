@@ -1505,7 +1505,7 @@ typedef _ProxyItemAttackEntityCallbackNative = Bool Function(Int64, Int32, Int32
 typedef _ProxyItemUseCallbackNative = Int32 Function(Int64, Int64, Int32, Int32);
 typedef _ProxyItemUseOnBlockCallbackNative = Int32 Function(Int64, Int64, Int32, Int32, Int32, Int32, Int32);
 typedef _ProxyItemUseOnEntityCallbackNative = Int32 Function(Int64, Int64, Int32, Int32, Int32);
-typedef _CommandExecuteCallbackNative = Int32 Function(Int64, Int32, Pointer<Utf8>);
+typedef _CommandExecuteCallbackNative = Int32 Function(Int64, Int32, Pointer<Uint8>, Int32);
 typedef _CustomGoalCanUseCallbackNative = Bool Function(Pointer<Utf8>, Int32);
 typedef _CustomGoalCanContinueToUseCallbackNative = Bool Function(Pointer<Utf8>, Int32);
 typedef _CustomGoalStartCallbackNative = Void Function(Pointer<Utf8>, Int32);
@@ -0,0 +1,95 @@
+/// Persistent per-chunk data pages for mod state.
+///
+/// Each store keeps one fixed-size page per chunk in memory-mapped region
+/// files inside the world folder. Pages of loaded chunks are read and written
+/// in place through typed views; nothing is loaded up front and saving only
+/// writes the pages that changed.
+library;
+
+import 'dart:ffi';
+import 'dart:typed_data';
+
+import 'package:ffi/ffi.dart';
+
+import 'bridge.dart';
+import 'chunk_snapshot.dart';
+
+typedef _OpenNative = Int32 Function(Pointer<Utf8>, Int32);
+typedef _Open = int Function(Pointer<Utf8>, int);
+typedef _PageSizeNative = Int32 Function(Int32);
+typedef _PageSize = int Function(int);
+typedef _PageNative = Pointer<Uint8> Function(Int32, Int32, Int32, Int32, Bool);
+typedef _Page = Pointer<Uint8> Function(int, int, int, int, bool);
+typedef _MarkDirtyNative = Void Function(Int32, Int32, Int32, Int32);
+typedef _MarkDirty = void Function(int, int, int, int);
+
+final _Open _open =
+    ServerBridge.library.lookupFunction<_OpenNative, _Open>('chunk_data_open');
+final _PageSize _pageSize =
+    ServerBridge.library.lookupFunction<_PageSizeNative, _PageSize>('chunk_data_page_size');
+final _Page _page =
+    ServerBridge.library.lookupFunction<_PageNative, _Page>('chunk_data_page');
+final _MarkDirty _markDirty =
+    ServerBridge.library.lookupFunction<_MarkDirtyNative, _MarkDirty>('chunk_data_mark_dirty');
+
+/// A named store of per-chunk data pages.
+///
+/// ```dart
+/// final claims = ChunkDataStore.open('mymod_claims', pageSize: 4096);
+/// final world = ChunkSnapshots.worldId('minecraft:overworld');
+/// final page = claims.page(world, chunkX, chunkZ);
+/// if (page != null) {
+///   page.buffer.asByteData(page.offsetInBytes).setInt32(0, ownerId);
+///   claims.markDirty(world, chunkX, chunkZ);
+/// }
+/// ```
+///
+/// The page layout is up to the mod. A page is only available while its
+/// chunk is loaded; new pages start zeroed.
+class ChunkDataStore {
+  /// Native store handle.
+  final int handle;
+
+  /// Page size in bytes (the requested size rounded up to 4096).
+  final int pageSize;
+
+  ChunkDataStore._(this.handle, this.pageSize);
+
+  /// Open the store [name] (letters, digits, `_` and `-`).
+  ///
+  /// Opening the same name again returns the same store. Throws if the name
+  /// is invalid or the store is already open with a different page size.
+  static ChunkDataStore open(String name, {int pageSize = 4096}) {
+    final namePtr = name.toNativeUtf8();
+    try {
+      final handle = _open(namePtr, pageSize);
+      if (handle < 0) {
+        throw ArgumentError('Cannot open chunk data store "$name" with page size $pageSize');
+      }
+      return ChunkDataStore._(handle, _pageSize(handle));
+    } finally {
+      calloc.free(namePtr);
+    }
+  }
+
+  /// The page of a loaded chunk, or null if the chunk is not loaded.
+  ///
+  /// With [create] false, chunks that never had a page also return null.
+  /// The returned view writes straight into the mapped file; call [markDirty]
+  /// after modifying it so the next world save persists it.
+  Uint8List? page(int worldId, int chunkX, int chunkZ, {bool create = true}) {
+    final ptr = _page(handle, worldId, chunkX, chunkZ, create);
+    if (ptr == nullptr) return null;
+    return ptr.asTypedList(pageSize);
+  }
+
+  /// [page] looked up by dimension id (e.g. "minecraft:overworld").
+  Uint8List? pageIn(String dimension, int chunkX, int chunkZ, {bool create = true}) {
+    return page(ChunkSnapshots.worldId(dimension), chunkX, chunkZ, create: create);
+  }
+
+  /// Mark a page as modified.
+  void markDirty(int worldId, int chunkX, int chunkZ) {
+    _markDirty(handle, worldId, chunkX, chunkZ);
+  }
+}
@@ -0,0 +1,186 @@
+/// Immutable chunk snapshots readable from any isolate.
+///
+/// Java publishes copies of chunk sections and heightmaps into native memory
+/// once per server tick. Reads go straight to that memory through FFI, so
+/// worker isolates (pathfinding, structure scans, AI) can inspect terrain
+/// without JNI calls or the server thread.
+library;
+
+import 'dart:ffi';
+
+import 'package:ffi/ffi.dart';
+
+import 'bridge.dart';
+
+// Must match chunk_snapshot.h
+const int _modeOnce = 0;
+const int _modeWatch = 1;
+const int _modeUnwatch = 2;
+const int _heightmapArea = 256;
+// Header sizes in 32-bit words
+const int _sectionHeaderWords = 8;
+const int _heightmapHeaderWords = 6;
+
+/// Heightmap types stored in a [ChunkHeightmapSnapshot], in snapshot order.
+enum SnapshotHeightmap {
+  worldSurface,
+  motionBlocking,
+  motionBlockingNoLeaves,
+  oceanFloor,
+}
+
+typedef _WorldIdNative = Int32 Function(Pointer<Utf8>);
+typedef _WorldId = int Function(Pointer<Utf8>);
+typedef _RequestNative = Void Function(Int32, Int32, Int32, Int32);
+typedef _Request = void Function(int, int, int, int);
+typedef _AcquireSectionNative = Pointer<Uint8> Function(Int32, Int32, Int32, Int32);
+typedef _AcquireSection = Pointer<Uint8> Function(int, int, int, int);
+typedef _AcquireHeightmapsNative = Pointer<Uint8> Function(Int32, Int32, Int32);
+typedef _AcquireHeightmaps = Pointer<Uint8> Function(int, int, int);
+typedef _ReleaseNative = Void Function(Pointer<Uint8>);
+typedef _Release = void Function(Pointer<Uint8>);
+
+// Worker isolates never initialize ServerBridge, but the bridge symbols are
+// still in the process.
+final DynamicLibrary _lib =
+    ServerBridge.isInitialized ? ServerBridge.library : DynamicLibrary.process();
+
+final _WorldId _worldId =
+    _lib.lookupFunction<_WorldIdNative, _WorldId>('chunk_snapshot_world_id');
+final _Request _request =
+    _lib.lookupFunction<_RequestNative, _Request>('chunk_snapshot_request');
+final _AcquireSection _acquireSection = _lib
+    .lookupFunction<_AcquireSectionNative, _AcquireSection>('chunk_snapshot_acquire_section');
+final _AcquireHeightmaps _acquireHeightmaps = _lib
+    .lookupFunction<_AcquireHeightmapsNative, _AcquireHeightmaps>('chunk_snapshot_acquire_heightmaps');
+final _Release _release =
+    _lib.lookupFunction<_ReleaseNative, _Release>('chunk_snapshot_release');
+
+/// Entry point for requesting and reading chunk snapshots.
+///
+/// ```dart
+/// final world = ChunkSnapshots.worldId('minecraft:overworld');
+/// ChunkSnapshots.request(world, 0, 0, watch: true);
+/// // ...later, on any isolate:
+/// final section = ChunkSnapshots.acquireSection(world, 0, 4, 0);
+/// if (section != null) {
+///   final id = section.blockStateId(3, 7, 9);
+///   section.release();
+/// }
+/// ```
+class ChunkSnapshots {
+  ChunkSnapshots._();
+
+  /// Small integer id for a dimension (e.g. "minecraft:overworld").
+  static int worldId(String dimension) {
+    final ptr = dimension.toNativeUtf8();
+    try {
+      return _worldId(ptr);
+    } finally {
+      calloc.free(ptr);
+    }
+  }
+
+  /// Ask the server to publish a loaded chunk at the end of the next tick.
+  ///
+  /// With [watch], the chunk is republished after every block change until
+  /// [unwatch] is called or the chunk unloads. Unloaded chunks are never
+  /// force-loaded.
+  static void request(int worldId, int chunkX, int chunkZ, {bool watch = false}) {
+    _request(worldId, chunkX, chunkZ, watch ? _modeWatch : _modeOnce);
+  }
+
+  /// Stop republishing a watched chunk.
+  static void unwatch(int worldId, int chunkX, int chunkZ) {
+    _request(worldId, chunkX, chunkZ, _modeUnwatch);
+  }
+
+  /// The latest snapshot of a 16x16x16 section, or null if never published.
+  ///
+  /// [sectionY] is the section coordinate (block Y >> 4). The snapshot stays
+  /// valid until [ChunkSectionSnapshot.release] even if newer versions are
+  /// published in the meantime.
+  static ChunkSectionSnapshot? acquireSection(int worldId, int chunkX, int sectionY, int chunkZ) {
+    final ptr = _acquireSection(worldId, chunkX, sectionY, chunkZ);
+    return ptr == nullptr ? null : ChunkSectionSnapshot._(ptr);
+  }
+
+  /// The latest heightmaps of a chunk, or null if never published.
+  static ChunkHeightmapSnapshot? acquireHeightmaps(int worldId, int chunkX, int chunkZ) {
+    final ptr = _acquireHeightmaps(worldId, chunkX, chunkZ);
+    return ptr == nullptr ? null : ChunkHeightmapSnapshot._(ptr);
+  }
+}
+
+/// A read-only copy of one chunk section.
+///
+/// Block states are global block state ids (Java `Block.getId`).
+class ChunkSectionSnapshot {
+  Pointer<Uint8> _ptr;
+
+  ChunkSectionSnapshot._(this._ptr);
+
+  /// Publish sequence number; higher is newer.
+  int get version => _ptr.cast<Uint64>().value;
+
+  int get chunkX => _ptr.cast<Int32>()[3];
+  int get sectionY => _ptr.cast<Int32>()[4];
+  int get chunkZ => _ptr.cast<Int32>()[5];
+
+  /// Number of distinct block states in this section.
+  int get paletteSize => _ptr.cast<Int32>()[6];
+
+  /// Whether every block in the section has the same state.
+  bool get isUniform => paletteSize == 1;
+
+  /// Block state id at local coordinates (0-15 each).
+  int blockStateId(int x, int y, int z) {
+    final words = _ptr.cast<Int32>();
+    final size = words[6];
+    if (size == 1) return words[_sectionHeaderWords];
+    // Indices follow the palette; offsets in 16-bit units
+    final index = _ptr.cast<Uint16>()[2 * (_sectionHeaderWords + size) +
+        (((y & 15) << 8) | ((z & 15) << 4) | (x & 15))];
+    return words[_sectionHeaderWords + index];
+  }
+
+  /// Release the snapshot. It must not be used afterwards.
+  void release() {
+    if (_ptr == nullptr) return;
+    _release(_ptr);
+    _ptr = nullptr;
+  }
+}
+
+/// A read-only copy of a chunk's heightmaps.
+class ChunkHeightmapSnapshot {
+  Pointer<Uint8> _ptr;
+
+  ChunkHeightmapSnapshot._(this._ptr);
+
+  /// Publish sequence number; higher is newer.
+  int get version => _ptr.cast<Uint64>().value;
+
+  int get chunkX => _ptr.cast<Int32>()[3];
+  int get chunkZ => _ptr.cast<Int32>()[4];
+
+  /// Number of heightmap types stored.
+  int get typeCount => _ptr.cast<Int32>()[5];
+
+  /// Height (first free block Y) at local column x, z (0-15 each).
+  int height(SnapshotHeightmap type, int x, int z) {
+    if (type.index >= typeCount) {
+      throw RangeError.range(type.index, 0, typeCount - 1, 'type');
+    }
+    return _ptr.cast<Int16>()[2 * _heightmapHeaderWords +
+        type.index * _heightmapArea +
+        (((z & 15) << 4) | (x & 15))];
+  }
+
+  /// Release the snapshot. It must not be used afterwards.
+  void release() {
+    if (_ptr == nullptr) return;
+    _release(_ptr);
+    _ptr = nullptr;
+  }
+}
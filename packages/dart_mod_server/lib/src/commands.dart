@@ -27,9 +27,10 @@ library;
 
 import 'dart:convert';
 import 'dart:ffi';
+import 'dart:typed_data';
 
+import 'package:dart_mod_common/dart_mod_common.dart' show BlockPos;
 import 'package:dart_mod_common/src/jni/jni_internal.dart';
-import 'package:ffi/ffi.dart';
 
 import 'bridge.dart';
 import 'player.dart';
@@ -95,13 +96,143 @@ class CommandArgument {
       };
 }
 
+/// Parsed arguments of one command invocation, with their Minecraft types.
+///
+/// Decoded straight from the bridge's binary argument buffer (layout in
+/// native command_args.h) while the command is dispatched. Optional arguments
+/// that were not given read as null.
+class CommandArguments {
+  // Buffer tags - must match command_args.h
+  static const int _version = 1;
+  static const int _tagInt = 1;
+  static const int _tagDouble = 2;
+  static const int _tagBool = 3;
+  static const int _tagString = 4;
+  static const int _tagEntity = 5;
+  static const int _tagBlockPos = 6;
+
+  final List<CommandArgument> _definitions;
+
+  /// Values by argument index: int, double, bool, String, Player or BlockPos.
+  final List<Object?> _values;
+
+  CommandArguments._(this._definitions, this._values);
+
+  /// Decode a buffer without copying it first. Strings are the only values
+  /// that allocate.
+  factory CommandArguments._decode(
+    List<CommandArgument> definitions,
+    Pointer<Uint8> data,
+    int length,
+  ) {
+    final values = List<Object?>.filled(definitions.length, null);
+    if (length < 2) return CommandArguments._(definitions, values);
+
+    final bytes = data.asTypedList(length);
+    final view = ByteData.sublistView(bytes);
+    if (bytes[0] != _version) {
+      throw FormatException('Unsupported command argument buffer version ${bytes[0]}');
+    }
+
+    final count = bytes[1];
+    var offset = 2;
+    for (var i = 0; i < count; i++) {
+      final index = bytes[offset];
+      final tag = bytes[offset + 1];
+      offset += 2;
+
+      Object? value;
+      switch (tag) {
+        case _tagInt:
+          value = view.getInt32(offset, Endian.little);
+          offset += 4;
+        case _tagDouble:
+          value = view.getFloat64(offset, Endian.little);
+          offset += 8;
+        case _tagBool:
+          value = bytes[offset] != 0;
+          offset += 1;
+        case _tagString:
+          final byteLength = view.getUint32(offset, Endian.little);
+          offset += 4;
+          value = utf8.decode(Uint8List.sublistView(bytes, offset, offset + byteLength));
+          offset += byteLength;
+        case _tagEntity:
+          value = Player(view.getInt32(offset, Endian.little));
+          offset += 4;
+        case _tagBlockPos:
+          value = BlockPos(
+            view.getInt32(offset, Endian.little),
+            view.getInt32(offset + 4, Endian.little),
+            view.getInt32(offset + 8, Endian.little),
+          );
+          offset += 12;
+        default:
+          throw FormatException('Unknown command argument tag $tag');
+      }
+      if (index < values.length) values[index] = value;
+    }
+    return CommandArguments._(definitions, values);
+  }
+
+  int _indexOf(String name) {
+    for (var i = 0; i < _definitions.length; i++) {
+      if (_definitions[i].name == name) return i;
+    }
+    return -1;
+  }
+
+  /// The typed value of an argument, or null if it was not given.
+  Object? operator [](String name) {
+    final index = _indexOf(name);
+    return index < 0 ? null : _values[index];
+  }
+
+  /// An integer argument.
+  int? getInt(String name) => this[name] as int?;
+
+  /// A floating-point argument.
+  double? getDouble(String name) => (this[name] as num?)?.toDouble();
+
+  /// A boolean argument.
+  bool? getBool(String name) => this[name] as bool?;
+
+  /// A string, greedy string, block id or item id argument.
+  String? getString(String name) => this[name] as String?;
+
+  /// A player argument.
+  Player? getPlayer(String name) => this[name] as Player?;
+
+  /// A block position argument.
+  BlockPos? getBlockPos(String name) => this[name] as BlockPos?;
+
+  /// Values in the string form commands received before typed arguments
+  /// (player ids as numbers, positions as "x,y,z").
+  Map<String, dynamic> toStringMap() {
+    final map = <String, dynamic>{};
+    for (var i = 0; i < _definitions.length; i++) {
+      final value = _values[i];
+      if (value == null) continue;
+      map[_definitions[i].name] = switch (value) {
+        Player(:final id) => '$id',
+        BlockPos(:final x, :final y, :final z) => '$x,$y,$z',
+        _ => '$value',
+      };
+    }
+    return map;
+  }
+}
+
 /// Context provided to command execution callbacks.
 class CommandContext {
   /// The player who executed the command.
   final Player source;
 
-  /// The parsed arguments as a map.
-  final Map<String, dynamic> arguments;
+  /// The parsed arguments with their types.
+  final CommandArguments args;
+
+  /// The parsed arguments as a map of strings.
+  late final Map<String, dynamic> arguments = args.toStringMap();
 
   /// Internal handler for sending feedback.
   final void Function(String message) _sendFeedback;
@@ -111,7 +242,7 @@ class CommandContext {
 
   CommandContext._({
     required this.source,
-    required this.arguments,
+    required this.args,
     required void Function(String) sendFeedback,
     required void Function(String) sendError,
   })  : _sendFeedback = sendFeedback,
@@ -124,15 +255,22 @@ class CommandContext {
   void sendError(String message) => _sendError(message);
 
   /// Get an argument by name with type casting.
-  T? getArgument<T>(String name) => arguments[name] as T?;
+  ///
+  /// Returns the typed value (int, double, bool, String, Player or BlockPos)
+  /// when it is a [T], otherwise its string form.
+  T? getArgument<T>(String name) {
+    final value = args[name];
+    if (value is T) return value;
+    return arguments[name] as T?;
+  }
 
   /// Get a required argument, throwing if not present.
   T requireArgument<T>(String name) {
-    final value = arguments[name];
+    final value = getArgument<T>(name);
     if (value == null) {
       throw ArgumentError('Required argument "$name" not provided');
     }
-    return value as T;
+    return value;
   }
 }
 
@@ -225,7 +363,8 @@ class Commands {
   static int _onCommandExecute(
     int commandId,
     int playerId,
-    Pointer<Utf8> argsJson,
+    Pointer<Uint8> args,
+    int argsLength,
   ) {
     final command = _commands[commandId];
     if (command == null) {
@@ -234,15 +373,10 @@ class Commands {
     }
 
     try {
-      // Parse the arguments JSON
-      final argsString = argsJson.toDartString();
-      final Map<String, dynamic> args =
-          argsString.isEmpty ? {} : jsonDecode(argsString);
-
-      // Create the context
+      // Decode the argument buffer now; it is only valid during this call
       final context = CommandContext._(
         source: Player(playerId),
-        arguments: args,
+        args: CommandArguments._decode(command.arguments, args, argsLength),
         sendFeedback: (msg) => _sendFeedback(playerId, msg),
         sendError: (msg) => _sendError(playerId, msg),
       );
@@ -376,5 +510,6 @@ class CommandExecutor {
 typedef _CommandExecuteCallbackNative = Int32 Function(
   Int64 commandId,
   Int32 playerId,
-  Pointer<Utf8> argsJson,
+  Pointer<Uint8> args,
+  Int32 argsLength,
 );
@@ -26,43 +26,23 @@ class Entity {
 
   /// Get the entity type identifier (e.g., "minecraft:pig", "minecraft:zombie").
   String get type {
-    return GenericJniBridge.callStaticStringMethod(
-          _dartBridge,
-          'getEntityType',
-          '(I)Ljava/lang/String;',
-          [id],
-        ) ??
+    return DartBridgeBindings.getEntityType(id) ??
         'minecraft:unknown';
   }
 
   /// Check if this entity is a living entity.
   bool get isLiving {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isLivingEntity',
-      '(I)Z',
-      [id],
-    );
+    return DartBridgeBindings.isLivingEntity(id);
   }
 
   /// Check if this entity is a player.
   bool get isPlayer {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isPlayerEntity',
-      '(I)Z',
-      [id],
-    );
+    return DartBridgeBindings.isPlayerEntity(id);
   }
 
   /// Get the dimension/world this entity is in.
   World get dimension {
-    final dimensionId = GenericJniBridge.callStaticStringMethod(
-      _dartBridge,
-      'getEntityDimension',
-      '(I)Ljava/lang/String;',
-      [id],
-    );
+    final dimensionId = DartBridgeBindings.getEntityDimension(id);
     return World(dimensionId ?? 'minecraft:overworld');
   }
 
@@ -72,107 +52,62 @@ class Entity {
 
   /// Get the entity's current position.
   Vec3 get position {
-    final x = GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getEntityX',
-      '(I)D',
-      [id],
-    );
-    final y = GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getEntityY',
-      '(I)D',
-      [id],
-    );
-    final z = GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getEntityZ',
-      '(I)D',
-      [id],
-    );
+    final x = DartBridgeBindings.getEntityX(id);
+    final y = DartBridgeBindings.getEntityY(id);
+    final z = DartBridgeBindings.getEntityZ(id);
     return Vec3(x, y, z);
   }
 
   /// Set the entity's position.
   set position(Vec3 pos) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setEntityPosition',
-      '(IDDD)V',
-      [id, pos.x, pos.y, pos.z],
-    );
+    DartBridgeBindings.setEntityPosition(id, pos.x, pos.y, pos.z);
   }
 
   /// Get the entity's velocity.
   Vec3 get velocity {
-    final x = GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getEntityVelocityX',
-      '(I)D',
-      [id],
-    );
-    final y = GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getEntityVelocityY',
-      '(I)D',
-      [id],
-    );
-    final z = GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getEntityVelocityZ',
-      '(I)D',
-      [id],
-    );
+    final x = DartBridgeBindings.getEntityVelocityX(id);
+    final y = DartBridgeBindings.getEntityVelocityY(id);
+    final z = DartBridgeBindings.getEntityVelocityZ(id);
     return Vec3(x, y, z);
   }
 
   /// Set the entity's velocity.
   set velocity(Vec3 vel) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setEntityVelocity',
-      '(IDDD)V',
-      [id, vel.x, vel.y, vel.z],
-    );
+    DartBridgeBindings.setEntityVelocity(id, vel.x, vel.y, vel.z);
   }
 
   /// Get the entity's yaw (horizontal rotation).
   double get yaw {
-    return GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getEntityYaw',
-      '(I)D',
-      [id],
-    );
+    return DartBridgeBindings.getEntityYaw(id);
   }
 
   /// Get the entity's pitch (vertical rotation).
   double get pitch {
-    return GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getEntityPitch',
-      '(I)D',
-      [id],
-    );
+    return DartBridgeBindings.getEntityPitch(id);
   }
 
   /// Teleport the entity to a position with optional rotation.
   void teleport(Vec3 pos, {double? yaw, double? pitch}) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'teleportEntity',
-      '(IDDDFF)V',
-      [id, pos.x, pos.y, pos.z, yaw ?? this.yaw, pitch ?? this.pitch],
+    DartBridgeBindings.teleportEntity(
+      id,
+      pos.x,
+      pos.y,
+      pos.z,
+      yaw ?? this.yaw,
+      pitch ?? this.pitch,
     );
   }
 
   /// Teleport the entity to a position in a specific dimension.
   void teleportToDimension(String dimension, Vec3 pos, {double? yaw, double? pitch}) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'teleportEntityToDimension',
-      '(ILjava/lang/String;DDDFF)V',
-      [id, dimension, pos.x, pos.y, pos.z, (yaw ?? this.yaw).toDouble(), (pitch ?? this.pitch).toDouble()],
+    DartBridgeBindings.teleportEntityToDimension(
+      id,
+      dimension,
+      pos.x,
+      pos.y,
+      pos.z,
+      (yaw ?? this.yaw).toDouble(),
+      (pitch ?? this.pitch).toDouble(),
     );
   }
 
@@ -182,141 +117,71 @@ class Entity {
 
   /// Check if the entity is on the ground.
   bool get isOnGround {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isEntityOnGround',
-      '(I)Z',
-      [id],
-    );
+    return DartBridgeBindings.isEntityOnGround(id);
   }
 
   /// Check if the entity is in water.
   bool get isInWater {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isEntityInWater',
-      '(I)Z',
-      [id],
-    );
+    return DartBridgeBindings.isEntityInWater(id);
   }
 
   /// Check if the entity is on fire.
   bool get isOnFire {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isEntityOnFire',
-      '(I)Z',
-      [id],
-    );
+    return DartBridgeBindings.isEntityOnFire(id);
   }
 
   /// Set the entity on fire for a number of seconds, or extinguish.
   set isOnFire(bool value) {
     if (value) {
-      GenericJniBridge.callStaticVoidMethod(
-        _dartBridge,
-        'setEntityOnFire',
-        '(II)V',
-        [id, 8], // Default 8 seconds
-      );
+      DartBridgeBindings.setEntityOnFire(id, 8); // Default 8 seconds
     } else {
-      GenericJniBridge.callStaticVoidMethod(
-        _dartBridge,
-        'extinguishEntity',
-        '(I)V',
-        [id],
-      );
+      DartBridgeBindings.extinguishEntity(id);
     }
   }
 
   /// Set the entity on fire for a specific number of seconds.
   void setOnFire(int seconds) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setEntityOnFire',
-      '(II)V',
-      [id, seconds],
-    );
+    DartBridgeBindings.setEntityOnFire(id, seconds);
   }
 
   /// Check if the entity is sneaking.
   bool get isSneaking {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isEntitySneaking',
-      '(I)Z',
-      [id],
-    );
+    return DartBridgeBindings.isEntitySneaking(id);
   }
 
   /// Check if the entity is sprinting.
   bool get isSprinting {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isEntitySprinting',
-      '(I)Z',
-      [id],
-    );
+    return DartBridgeBindings.isEntitySprinting(id);
   }
 
   /// Check if the entity is invisible.
   bool get isInvisible {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isEntityInvisible',
-      '(I)Z',
-      [id],
-    );
+    return DartBridgeBindings.isEntityInvisible(id);
   }
 
   /// Set the entity's invisibility.
   set isInvisible(bool value) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setEntityInvisible',
-      '(IZ)V',
-      [id, value],
-    );
+    DartBridgeBindings.setEntityInvisible(id, value);
   }
 
   /// Check if the entity is glowing.
   bool get isGlowing {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isEntityGlowing',
-      '(I)Z',
-      [id],
-    );
+    return DartBridgeBindings.isEntityGlowing(id);
   }
 
   /// Set the entity's glowing effect.
   set isGlowing(bool value) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setEntityGlowing',
-      '(IZ)V',
-      [id, value],
-    );
+    DartBridgeBindings.setEntityGlowing(id, value);
   }
 
   /// Check if the entity has no gravity.
   bool get hasNoGravity {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'entityHasNoGravity',
-      '(I)Z',
-      [id],
-    );
+    return DartBridgeBindings.entityHasNoGravity(id);
   }
 
   /// Set whether the entity has gravity.
   set hasNoGravity(bool value) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setEntityNoGravity',
-      '(IZ)V',
-      [id, value],
-    );
+    DartBridgeBindings.setEntityNoGravity(id, value);
   }
 
   // ==========================================================================
@@ -325,53 +190,28 @@ class Entity {
 
   /// Get the entity's custom name.
   String? get customName {
-    final name = GenericJniBridge.callStaticStringMethod(
-      _dartBridge,
-      'getEntityCustomName',
-      '(I)Ljava/lang/String;',
-      [id],
-    );
+    final name = DartBridgeBindings.getEntityCustomName(id);
     return (name == null || name.isEmpty) ? null : name;
   }
 
   /// Set the entity's custom name.
   set customName(String? name) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setEntityCustomName',
-      '(ILjava/lang/String;)V',
-      [id, name ?? ''],
-    );
+    DartBridgeBindings.setEntityCustomName(id, name ?? '');
   }
 
   /// Check if the entity's custom name is visible.
   bool get isCustomNameVisible {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isEntityCustomNameVisible',
-      '(I)Z',
-      [id],
-    );
+    return DartBridgeBindings.isEntityCustomNameVisible(id);
   }
 
   /// Set whether the entity's custom name is visible.
   set isCustomNameVisible(bool visible) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setEntityCustomNameVisible',
-      '(IZ)V',
-      [id, visible],
-    );
+    DartBridgeBindings.setEntityCustomNameVisible(id, visible);
   }
 
   /// Get the number of ticks this entity has existed.
   int get ticksExisted {
-    return GenericJniBridge.callStaticIntMethod(
-      _dartBridge,
-      'getEntityTicksExisted',
-      '(I)I',
-      [id],
-    );
+    return DartBridgeBindings.getEntityTicksExisted(id);
   }
 
   // ==========================================================================
@@ -380,22 +220,12 @@ class Entity {
 
   /// Remove the entity from the world (with death effects).
   void remove() {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'removeEntity',
-      '(I)V',
-      [id],
-    );
+    DartBridgeBindings.removeEntity(id);
   }
 
   /// Discard the entity without death effects.
   void discard() {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'discardEntity',
-      '(I)V',
-      [id],
-    );
+    DartBridgeBindings.discardEntity(id);
   }
 
   /// Kill the entity (applies death damage).
@@ -415,34 +245,19 @@ class Entity {
 
   /// Get the entity's scoreboard tags.
   Set<String> get tags {
-    final tagsStr = GenericJniBridge.callStaticStringMethod(
-      _dartBridge,
-      'getEntityTags',
-      '(I)Ljava/lang/String;',
-      [id],
-    );
+    final tagsStr = DartBridgeBindings.getEntityTags(id);
     if (tagsStr == null || tagsStr.isEmpty) return {};
     return tagsStr.split(',').toSet();
   }
 
   /// Add a tag to the entity.
   bool addTag(String tag) {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'addEntityTag',
-      '(ILjava/lang/String;)Z',
-      [id, tag],
-    );
+    return DartBridgeBindings.addEntityTag(id, tag);
   }
 
   /// Remove a tag from the entity.
   bool removeTag(String tag) {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'removeEntityTag',
-      '(ILjava/lang/String;)Z',
-      [id, tag],
-    );
+    return DartBridgeBindings.removeEntityTag(id, tag);
   }
 
   /// Check if the entity has a specific tag.
@@ -470,42 +285,22 @@ class LivingEntity extends Entity {
 
   /// Get the entity's current health.
   double get health {
-    return GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getLivingEntityHealth',
-      '(I)D',
-      [id],
-    );
+    return DartBridgeBindings.getLivingEntityHealth(id);
   }
 
   /// Set the entity's health.
   set health(double value) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setLivingEntityHealth',
-      '(IF)V',
-      [id, value],
-    );
+    DartBridgeBindings.setLivingEntityHealth(id, value);
   }
 
   /// Get the entity's max health.
   double get maxHealth {
-    return GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getLivingEntityMaxHealth',
-      '(I)D',
-      [id],
-    );
+    return DartBridgeBindings.getLivingEntityMaxHealth(id);
   }
 
   /// Check if the entity is dead.
   bool get isDead {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isLivingEntityDead',
-      '(I)Z',
-      [id],
-    );
+    return DartBridgeBindings.isLivingEntityDead(id);
   }
 
   // ==========================================================================
@@ -514,22 +309,12 @@ class LivingEntity extends Entity {
 
   /// Get the entity's armor value.
   double get armor {
-    return GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getLivingEntityArmor',
-      '(I)D',
-      [id],
-    );
+    return DartBridgeBindings.getLivingEntityArmor(id);
   }
 
   /// Deal damage to the entity.
   void hurt(double amount) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'hurtEntity',
-      '(ID)V',
-      [id, amount],
-    );
+    DartBridgeBindings.hurtEntity(id, amount);
   }
 
   // ==========================================================================
@@ -544,42 +329,29 @@ class LivingEntity extends Entity {
     bool ambient = false,
     bool showParticles = true,
   }) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'addEntityEffect',
-      '(ILjava/lang/String;IIZZ)V',
-      [id, effect.id, duration, amplifier, ambient, showParticles],
+    DartBridgeBindings.addEntityEffect(
+      id,
+      effect.id,
+      duration,
+      amplifier,
+      ambient,
+      showParticles,
     );
   }
 
   /// Remove a status effect from the entity.
   void removeEffect(StatusEffect effect) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'removeEntityEffect',
-      '(ILjava/lang/String;)V',
-      [id, effect.id],
-    );
+    DartBridgeBindings.removeEntityEffect(id, effect.id);
   }
 
   /// Check if the entity has a status effect.
   bool hasEffect(StatusEffect effect) {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'entityHasEffect',
-      '(ILjava/lang/String;)Z',
-      [id, effect.id],
-    );
+    return DartBridgeBindings.entityHasEffect(id, effect.id);
   }
 
   /// Clear all status effects from the entity.
   void clearEffects() {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'clearEntityEffects',
-      '(I)V',
-      [id],
-    );
+    DartBridgeBindings.clearEntityEffects(id);
   }
 
   // ==========================================================================
@@ -588,12 +360,7 @@ class LivingEntity extends Entity {
 
   /// Get the entity this entity is looking at (raycast).
   Entity? get lookingAt {
-    final targetId = GenericJniBridge.callStaticIntMethod(
-      _dartBridge,
-      'getLivingEntityLookingAt',
-      '(I)I',
-      [id],
-    );
+    final targetId = DartBridgeBindings.getLivingEntityLookingAt(id);
     if (targetId < 0) return null;
     return Entities.getTypedEntity(targetId);
   }
@@ -613,64 +380,34 @@ class MobEntity extends LivingEntity {
 
   /// Check if the mob has AI enabled.
   bool get hasAI {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'mobHasAI',
-      '(I)Z',
-      [id],
-    );
+    return DartBridgeBindings.mobHasAI(id);
   }
 
   /// Set whether the mob has AI enabled.
   set hasAI(bool value) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setMobAI',
-      '(IZ)V',
-      [id, value],
-    );
+    DartBridgeBindings.setMobAI(id, value);
   }
 
   /// Get the mob's current target.
   Entity? get target {
-    final targetId = GenericJniBridge.callStaticIntMethod(
-      _dartBridge,
-      'getMobTarget',
-      '(I)I',
-      [id],
-    );
+    final targetId = DartBridgeBindings.getMobTarget(id);
     if (targetId < 0) return null;
     return Entities.getTypedEntity(targetId);
   }
 
   /// Set the mob's target.
   set target(Entity? target) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setMobTarget',
-      '(II)V',
-      [id, target?.id ?? -1],
-    );
+    DartBridgeBindings.setMobTarget(id, target?.id ?? -1);
   }
 
   /// Check if the mob is persistent (won't despawn naturally).
   bool get isPersistent {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isMobPersistent',
-      '(I)Z',
-      [id],
-    );
+    return DartBridgeBindings.isMobPersistent(id);
   }
 
   /// Set whether the mob is persistent.
   set isPersistent(bool value) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setMobPersistent',
-      '(IZ)V',
-      [id, value],
-    );
+    DartBridgeBindings.setMobPersistent(id, value);
   }
 
   @override
@@ -710,12 +447,7 @@ class Entities {
   /// Get an entity by ID.
   static Entity? getEntity(int id) {
     // Check if entity exists by getting its type
-    final entityType = GenericJniBridge.callStaticStringMethod(
-      _dartBridge,
-      'getEntityType',
-      '(I)Ljava/lang/String;',
-      [id],
-    );
+    final entityType = DartBridgeBindings.getEntityType(id);
     if (entityType == null || entityType.isEmpty) return null;
     return Entity(id);
   }
@@ -723,30 +455,15 @@ class Entities {
   /// Get a typed entity by ID (returns LivingEntity or MobEntity if applicable).
   static Entity? getTypedEntity(int id) {
     // Check if entity exists
-    final entityType = GenericJniBridge.callStaticStringMethod(
-      _dartBridge,
-      'getEntityType',
-      '(I)Ljava/lang/String;',
-      [id],
-    );
+    final entityType = DartBridgeBindings.getEntityType(id);
     if (entityType == null || entityType.isEmpty) return null;
 
     // Check if it's a mob (has AI capabilities)
-    final isMob = GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isMobEntity',
-      '(I)Z',
-      [id],
-    );
+    final isMob = DartBridgeBindings.isMobEntity(id);
     if (isMob) return MobEntity(id);
 
     // Check if it's a living entity
-    final isLiving = GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isLivingEntity',
-      '(I)Z',
-      [id],
-    );
+    final isLiving = DartBridgeBindings.isLivingEntity(id);
     if (isLiving) return LivingEntity(id);
 
     return Entity(id);
@@ -761,11 +478,12 @@ class Entities {
     for (final custom in EntityRegistry.instance.allEntities) {
       if (custom.id == entityType) {
         // Spawn via custom entity system
-        final entityId = GenericJniBridge.callStaticIntMethod(
-          _dartBridge,
-          'spawnDartEntity',
-          '(Ljava/lang/String;JDDD)I',
-          [world.dimensionId, custom.handlerId, position.x, position.y, position.z],
+        final entityId = DartBridgeBindings.spawnDartEntity(
+          world.dimensionId,
+          custom.handlerId,
+          position.x,
+          position.y,
+          position.z,
         );
         if (entityId < 0) return null;
         return getTypedEntity(entityId);
@@ -773,11 +491,12 @@ class Entities {
     }
 
     // Fall back to vanilla spawn
-    final entityId = GenericJniBridge.callStaticIntMethod(
-      _dartBridge,
-      'spawnEntity',
-      '(Ljava/lang/String;Ljava/lang/String;DDD)I',
-      [world.dimensionId, entityType, position.x, position.y, position.z],
+    final entityId = DartBridgeBindings.spawnEntity(
+      world.dimensionId,
+      entityType,
+      position.x,
+      position.y,
+      position.z,
     );
     if (entityId < 0) return null;
     return getTypedEntity(entityId);
@@ -786,11 +505,14 @@ class Entities {
   /// Get entities in an axis-aligned bounding box.
   static List<Entity> getEntitiesInBox(World world, Vec3 min, Vec3 max,
       {String? type}) {
-    final entityIdsStr = GenericJniBridge.callStaticStringMethod(
-      _dartBridge,
-      'getEntitiesInBox',
-      '(Ljava/lang/String;DDDDDD)Ljava/lang/String;',
-      [world.dimensionId, min.x, min.y, min.z, max.x, max.y, max.z],
+    final entityIdsStr = DartBridgeBindings.getEntitiesInBox(
+      world.dimensionId,
+      min.x,
+      min.y,
+      min.z,
+      max.x,
+      max.y,
+      max.z,
     );
     if (entityIdsStr == null || entityIdsStr.isEmpty) return [];
 
@@ -816,11 +538,12 @@ class Entities {
     double radius, {
     String? type,
   }) {
-    final entityIdsStr = GenericJniBridge.callStaticStringMethod(
-      _dartBridge,
-      'getEntitiesInRadius',
-      '(Ljava/lang/String;DDDD)Ljava/lang/String;',
-      [world.dimensionId, center.x, center.y, center.z, radius],
+    final entityIdsStr = DartBridgeBindings.getEntitiesInRadius(
+      world.dimensionId,
+      center.x,
+      center.y,
+      center.z,
+      radius,
     );
     if (entityIdsStr == null || entityIdsStr.isEmpty) return [];
 
@@ -869,11 +592,9 @@ class Entities {
 
   /// Get all entities of a specific type in a world.
   static List<Entity> getEntitiesByType(World world, String type) {
-    final entityIdsStr = GenericJniBridge.callStaticStringMethod(
-      _dartBridge,
-      'getEntitiesByType',
-      '(Ljava/lang/String;Ljava/lang/String;)Ljava/lang/String;',
-      [world.dimensionId, type],
+    final entityIdsStr = DartBridgeBindings.getEntitiesByType(
+      world.dimensionId,
+      type,
     );
     if (entityIdsStr == null || entityIdsStr.isEmpty) return [];
 
@@ -0,0 +1,112 @@
+/// Native-side filters for global server events.
+///
+/// A filtered event is checked in the bridge before the server isolate is
+/// entered. Events that do not match the filter never reach Dart and get
+/// their default result (the action is allowed).
+library;
+
+import 'dart:ffi';
+
+import 'package:dart_mod_common/dart_mod_common.dart';
+import 'package:ffi/ffi.dart';
+
+import 'bridge.dart';
+
+typedef _SetNative = Bool Function(Int32, Pointer<Utf8>, Pointer<Utf8>, Pointer<Int32>);
+typedef _Set = bool Function(int, Pointer<Utf8>, Pointer<Utf8>, Pointer<Int32>);
+typedef _ClearNative = Void Function(Int32);
+typedef _Clear = void Function(int);
+typedef _RejectedCountNative = Int64 Function(Int32);
+typedef _RejectedCount = int Function(int);
+
+final _Set _set =
+    ServerBridge.library.lookupFunction<_SetNative, _Set>('event_filter_set');
+final _Clear _clear =
+    ServerBridge.library.lookupFunction<_ClearNative, _Clear>('event_filter_clear');
+final _RejectedCount _rejectedCount = ServerBridge.library
+    .lookupFunction<_RejectedCountNative, _RejectedCount>('event_filter_rejected_count');
+
+/// Global events that can be filtered natively.
+///
+/// Indices must match EVENT_FILTER_* in event_filter.h.
+enum FilteredEvent {
+  /// [Events.onBlockBreak]. Ids are block ids; the box tests the block.
+  blockBreak,
+
+  /// [Events.onItemUse]. Ids are item ids; the box tests the player.
+  itemUse,
+
+  /// [Events.onEntityDamage]. Ids are entity type ids; the box tests the
+  /// damaged entity.
+  entityDamage,
+
+  /// [Events.onPlayerPickupItem]. Ids are item ids; the box tests the player.
+  playerPickupItem,
+}
+
+/// Conditions an event must meet to reach its Dart handler.
+///
+/// All given conditions must match; omitted ones match everything.
+///
+/// ```dart
+/// Events.onBlockBreak(onOreBroken, filter: EventFilter(
+///   ids: {'minecraft:diamond_ore', 'minecraft:deepslate_diamond_ore'},
+///   dimensions: {'minecraft:overworld'},
+/// ));
+/// ```
+class EventFilter {
+  /// Block, item or entity type ids (e.g. "minecraft:stone").
+  final Set<String>? ids;
+
+  /// Dimension ids of the event's world (e.g. "minecraft:overworld").
+  final Set<String>? dimensions;
+
+  /// Inclusive corners of a block-position box. Both or neither must be set.
+  final BlockPos? min;
+  final BlockPos? max;
+
+  const EventFilter({this.ids, this.dimensions, this.min, this.max})
+      : assert((min == null) == (max == null), 'Set both min and max');
+}
+
+/// Attach, remove and inspect native event filters.
+class EventFilters {
+  EventFilters._();
+
+  /// Set the filter for [event], or remove it when [filter] is null.
+  ///
+  /// The filter applies to whichever handler is registered for the event.
+  static void set(FilteredEvent event, EventFilter? filter) {
+    if (filter == null) {
+      _clear(event.index);
+      return;
+    }
+
+    final ids = filter.ids;
+    final dimensions = filter.dimensions;
+    final idsPtr = ids == null ? nullptr : ids.join('\n').toNativeUtf8();
+    final dimensionsPtr =
+        dimensions == null ? nullptr : dimensions.join('\n').toNativeUtf8();
+    final box = filter.min == null ? nullptr : calloc<Int32>(6);
+    try {
+      if (box != nullptr) {
+        final min = filter.min!;
+        final max = filter.max!;
+        box[0] = min.x < max.x ? min.x : max.x;
+        box[1] = min.y < max.y ? min.y : max.y;
+        box[2] = min.z < max.z ? min.z : max.z;
+        box[3] = min.x < max.x ? max.x : min.x;
+        box[4] = min.y < max.y ? max.y : min.y;
+        box[5] = min.z < max.z ? max.z : min.z;
+      }
+      _set(event.index, idsPtr, dimensionsPtr, box);
+    } finally {
+      if (idsPtr != nullptr) calloc.free(idsPtr);
+      if (dimensionsPtr != nullptr) calloc.free(dimensionsPtr);
+      if (box != nullptr) calloc.free(box);
+    }
+  }
+
+  /// Number of [event] occurrences the filter kept out of Dart.
+  static int rejectedCount(FilteredEvent event) => _rejectedCount(event.index);
+}
@@ -10,6 +10,7 @@ import 'package:dart_mod_common/dart_mod_common.dart';
 import 'package:ffi/ffi.dart';
 
 import 'bridge.dart';
+import 'event_filters.dart';
 import 'player.dart';
 import 'entity.dart';
 import 'registries.dart';
@@ -509,8 +510,12 @@ class Events {
   ///
   /// The handler receives the block coordinates and player ID.
   /// Return [EventResult.allow] to allow the break, or [EventResult.cancel] to prevent it.
-  static void onBlockBreak(BlockBreakHandler handler) {
+  ///
+  /// With a [filter], only matching breaks enter Dart; the rest are allowed
+  /// natively. Registering replaces the previous handler's filter.
+  static void onBlockBreak(BlockBreakHandler handler, {EventFilter? filter}) {
     _blockBreakHandler = handler;
+    EventFilters.set(FilteredEvent.blockBreak, filter);
     final callback =
         Pointer.fromFunction<_BlockBreakCallbackNative>(_onBlockBreak, 1);
     ServerBridge.registerBlockBreakHandler(callback);
@@ -853,7 +858,10 @@ class Events {
 
   /// Set a handler for entity damage events.
   ///
-  /// Return false to cancel the damage, true to allow it.
+  /// Return false to cancel the damage, true to allow it. Use
+  /// [EventFilters.set] with [FilteredEvent.entityDamage] to receive only
+  /// some entity types, dimensions or areas. Setting null also removes the
+  /// filter.
   static set onEntityDamage(
       bool Function(Entity entity, String damageSource, double amount)?
           handler) {
@@ -862,6 +870,8 @@ class Events {
       final callback = Pointer.fromFunction<_EntityDamageCallbackNative>(
           _onEntityDamage, true);
       ServerBridge.registerEntityDamageHandler(callback);
+    } else {
+      EventFilters.set(FilteredEvent.entityDamage, null);
     }
   }
 
@@ -929,7 +939,9 @@ class Events {
 
   /// Set a handler for item use events (right-click with item).
   ///
-  /// Return false to cancel the use, true to allow it.
+  /// Return false to cancel the use, true to allow it. Use
+  /// [EventFilters.set] with [FilteredEvent.itemUse] to receive only some
+  /// items, dimensions or areas. Setting null also removes the filter.
   static set onItemUse(
       bool Function(Player player, ItemStack item, Hand hand)? handler) {
     _itemUseHandler = handler;
@@ -937,6 +949,8 @@ class Events {
       final callback =
           Pointer.fromFunction<_ItemUseCallbackNative>(_onItemUse, true);
       ServerBridge.registerItemUseHandler(callback);
+    } else {
+      EventFilters.set(FilteredEvent.itemUse, null);
     }
   }
 
@@ -993,7 +1007,9 @@ class Events {
 
   /// Set a handler for player pickup item events.
   ///
-  /// Return false to cancel the pickup, true to allow it.
+  /// Return false to cancel the pickup, true to allow it. Use
+  /// [EventFilters.set] with [FilteredEvent.playerPickupItem] to receive only
+  /// some items, dimensions or areas. Setting null also removes the filter.
   static set onPlayerPickupItem(
       bool Function(Player player, ItemEntity item)? handler) {
     _playerPickupItemHandler = handler;
@@ -1002,6 +1018,8 @@ class Events {
           Pointer.fromFunction<_PlayerPickupItemCallbackNative>(
               _onPlayerPickupItem, true);
       ServerBridge.registerPlayerPickupItemHandler(callback);
+    } else {
+      EventFilters.set(FilteredEvent.playerPickupItem, null);
     }
   }
 
@@ -0,0 +1,210 @@
+/// Binary encoding of item stack data components.
+///
+/// Layout and codes match item_components.h. Used by
+/// `ItemStackHandle.readComponents` and `ItemStackHandle.writeComponents`;
+/// kept free of FFI so it can be tested without the bridge.
+library;
+
+import 'dart:convert';
+import 'dart:typed_data';
+
+// Layout constants, must match item_components.h
+const _version = 1;
+const _tagAbsent = 0;
+const _tagInt = 1;
+const _tagBool = 2;
+const _tagString = 3;
+const _tagStringList = 4;
+const _tagIntMap = 5;
+
+/// item_components_read result when the buffer is too small
+/// (ITEM_COMPONENTS_OVERFLOW in item_components.h).
+const itemComponentsOverflow = -2;
+
+/// Smallest buffer handed to item_components_read; below the blob header
+/// size the native side fails instead of reporting an overflow.
+const minComponentBufferSize = 1024;
+
+/// Largest buffer [ItemComponentCodec.readGrowing] will grow to.
+const maxComponentBufferSize = 16 * 1024 * 1024;
+
+/// Data components that can be read and written in bulk with
+/// `ItemStackHandle.readComponents` and `ItemStackHandle.writeComponents`.
+///
+/// Codes must match ITEM_COMPONENT_* in item_components.h.
+enum ItemComponent {
+  /// `int`.
+  maxStackSize(1),
+
+  /// `int`.
+  damage(2),
+
+  /// `int`.
+  maxDamage(3),
+
+  /// `String` (plain text).
+  customName(4),
+
+  /// `List<String>` (plain text lines).
+  lore(5),
+
+  /// `Map<String, int>` of enchantment id to level.
+  enchantments(6),
+
+  /// `bool`.
+  unbreakable(7),
+
+  /// `bool`. Resistance to fire damage.
+  fireResistant(8);
+
+  /// ITEM_COMPONENT_* code.
+  final int code;
+
+  const ItemComponent(this.code);
+
+  static final Map<int, ItemComponent> byCode = {
+    for (final component in values) component.code: component,
+  };
+}
+
+/// Encodes and decodes component blobs.
+class ItemComponentCodec {
+  ItemComponentCodec._();
+
+  /// Call [read] with a buffer capacity, doubling it while [read] returns
+  /// [itemComponentsOverflow].
+  ///
+  /// Starts at [capacity] but never below [minComponentBufferSize], and
+  /// stops growing at [maxComponentBufferSize]. Returns the last result of
+  /// [read]: a blob length, or a negative code on failure.
+  static int readGrowing(int capacity, int Function(int capacity) read) {
+    var size = capacity < minComponentBufferSize ? minComponentBufferSize : capacity;
+    while (true) {
+      final length = read(size);
+      if (length != itemComponentsOverflow || size * 2 > maxComponentBufferSize) return length;
+      size *= 2;
+    }
+  }
+
+  /// Decode a blob into component values; absent components map to null.
+  ///
+  /// The blob must already be validated (item_components_validate).
+  static Map<ItemComponent, Object?> decode(Uint8List bytes) {
+    final view = ByteData.sublistView(bytes);
+    var offset = 2;
+
+    int readInt32() {
+      final value = view.getInt32(offset, Endian.little);
+      offset += 4;
+      return value;
+    }
+
+    String readString() {
+      final byteLength = view.getUint32(offset, Endian.little);
+      offset += 4;
+      final value = utf8.decode(Uint8List.sublistView(bytes, offset, offset + byteLength));
+      offset += byteLength;
+      return value;
+    }
+
+    final result = <ItemComponent, Object?>{};
+    final count = bytes[1];
+    for (var i = 0; i < count; i++) {
+      final component = ItemComponent.byCode[bytes[offset]];
+      final tag = bytes[offset + 1];
+      offset += 2;
+
+      Object? value;
+      switch (tag) {
+        case _tagInt:
+          value = readInt32();
+        case _tagBool:
+          value = bytes[offset++] != 0;
+        case _tagString:
+          value = readString();
+        case _tagStringList:
+          final length = view.getUint32(offset, Endian.little);
+          offset += 4;
+          value = [for (var j = 0; j < length; j++) readString()];
+        case _tagIntMap:
+          final length = view.getUint32(offset, Endian.little);
+          offset += 4;
+          final map = <String, int>{};
+          for (var j = 0; j < length; j++) {
+            final key = readString();
+            map[key] = readInt32();
+          }
+          value = map;
+      }
+      if (component != null) result[component] = value;
+    }
+    return result;
+  }
+
+  /// Encode component values into a blob; null values remove the component.
+  ///
+  /// Throws [ArgumentError] if a value does not have its component's type.
+  static Uint8List encode(Map<ItemComponent, Object?> values) {
+    if (values.length > 255) {
+      throw ArgumentError('At most 255 components per call');
+    }
+    // Every chunk added below is a fresh list, so the builder can keep them
+    final builder = BytesBuilder(copy: false);
+
+    void writeInt32(int value) {
+      final bytes = Uint8List(4);
+      bytes.buffer.asByteData().setInt32(0, value, Endian.little);
+      builder.add(bytes);
+    }
+
+    void writeString(String value) {
+      final encoded = utf8.encode(value);
+      writeInt32(encoded.length);
+      builder.add(encoded);
+    }
+
+    builder.add([_version, values.length]);
+    values.forEach((component, value) {
+      builder.addByte(component.code);
+      if (value == null) {
+        builder.addByte(_tagAbsent);
+        return;
+      }
+      switch (component) {
+        case ItemComponent.maxStackSize:
+        case ItemComponent.damage:
+        case ItemComponent.maxDamage:
+          if (value is! int) throw ArgumentError.value(value, component.name, 'Expected int');
+          builder.addByte(_tagInt);
+          writeInt32(value);
+        case ItemComponent.customName:
+          if (value is! String) throw ArgumentError.value(value, component.name, 'Expected String');
+          builder.addByte(_tagString);
+          writeString(value);
+        case ItemComponent.lore:
+          if (value is! List<String>) {
+            throw ArgumentError.value(value, component.name, 'Expected List<String>');
+          }
+          builder.addByte(_tagStringList);
+          writeInt32(value.length);
+          value.forEach(writeString);
+        case ItemComponent.enchantments:
+          if (value is! Map<String, int>) {
+            throw ArgumentError.value(value, component.name, 'Expected Map<String, int>');
+          }
+          builder.addByte(_tagIntMap);
+          writeInt32(value.length);
+          value.forEach((id, level) {
+            writeString(id);
+            writeInt32(level);
+          });
+        case ItemComponent.unbreakable:
+        case ItemComponent.fireResistant:
+          if (value is! bool) throw ArgumentError.value(value, component.name, 'Expected bool');
+          builder.addByte(_tagBool);
+          builder.addByte(value ? 1 : 0);
+      }
+    });
+    return builder.takeBytes();
+  }
+}
@@ -1,16 +1,47 @@
 /// Live ItemStack handle API for accessing and modifying data components.
 library;
 
-import 'dart:convert';
+import 'dart:ffi';
 
 import 'package:dart_mod_common/src/jni/jni_internal.dart';
+import 'package:ffi/ffi.dart';
 
+import 'bridge.dart';
 import 'inventory.dart';
+import 'item_components.dart';
 import 'player.dart';
 
 /// The Java class name for DartBridge.
 const _dartBridge = 'com/redstone/DartBridge';
 
+typedef _ReadComponentsNative = Int32 Function(Int64, Pointer<Uint8>, Int32, Pointer<Uint8>, Int32);
+typedef _ReadComponents = int Function(int, Pointer<Uint8>, int, Pointer<Uint8>, int);
+typedef _WriteComponentsNative = Bool Function(Int64, Pointer<Uint8>, Int32);
+typedef _WriteComponents = bool Function(int, Pointer<Uint8>, int);
+
+final _ReadComponents _readComponents = ServerBridge.library
+    .lookupFunction<_ReadComponentsNative, _ReadComponents>('item_components_read');
+final _WriteComponents _writeComponents = ServerBridge.library
+    .lookupFunction<_WriteComponentsNative, _WriteComponents>('item_components_write');
+
+/// Reusable native buffer for component blobs, grown on demand.
+class _Scratch {
+  static Pointer<Uint8> buffer = nullptr;
+  static int capacity = 0;
+
+  // One byte per requested component code
+  static final Pointer<Uint8> request = calloc<Uint8>(256);
+
+  static Pointer<Uint8> ensure(int size) {
+    if (size > capacity) {
+      if (buffer != nullptr) calloc.free(buffer);
+      capacity = size < minComponentBufferSize ? minComponentBufferSize : size;
+      buffer = calloc<Uint8>(capacity);
+    }
+    return buffer;
+  }
+}
+
 /// A handle to a live ItemStack in a player's inventory.
 ///
 /// Unlike [ItemStack] which is a pure data snapshot, [ItemStackHandle]
@@ -163,32 +194,15 @@ class ItemStackHandle {
     );
   }
 
-  /// Get lore lines.
+  /// Get lore lines (empty if the stack has none or cannot be read).
   List<String> get lore {
-    _checkReleased();
-    final json = GenericJniBridge.callStaticStringMethod(
-      _dartBridge,
-      'getItemLore',
-      '(J)Ljava/lang/String;',
-      [_handle],
-    );
-    if (json == null || json.isEmpty || json == '[]') return [];
-    try {
-      return (jsonDecode(json) as List).cast<String>();
-    } catch (_) {
-      return [];
-    }
+    final value = _tryReadComponent(ItemComponent.lore);
+    return value == null ? [] : value as List<String>;
   }
 
   /// Set lore lines.
   set lore(List<String> value) {
-    _checkReleased();
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setItemLore',
-      '(JLjava/lang/String;)V',
-      [_handle, jsonEncode(value)],
-    );
+    writeComponents({ItemComponent.lore: value.isEmpty ? null : value});
   }
 
   /// Whether item is unbreakable.
@@ -235,7 +249,8 @@ class ItemStackHandle {
     );
   }
 
-  /// Get enchantments as map of enchantment ID to level.
+  /// Get enchantments as map of enchantment ID to level (empty if the stack
+  /// has none or cannot be read).
   ///
   /// Example:
   /// ```dart
@@ -243,19 +258,8 @@ class ItemStackHandle {
   /// // {'minecraft:sharpness': 5, 'minecraft:looting': 3}
   /// ```
   Map<String, int> get enchantments {
-    _checkReleased();
-    final json = GenericJniBridge.callStaticStringMethod(
-      _dartBridge,
-      'getItemEnchantments',
-      '(J)Ljava/lang/String;',
-      [_handle],
-    );
-    if (json == null || json.isEmpty || json == '{}') return {};
-    try {
-      return (jsonDecode(json) as Map).cast<String, int>();
-    } catch (_) {
-      return {};
-    }
+    final value = _tryReadComponent(ItemComponent.enchantments);
+    return value == null ? {} : value as Map<String, int>;
   }
 
   /// Set enchantments from map of enchantment ID to level.
@@ -268,13 +272,79 @@ class ItemStackHandle {
   /// };
   /// ```
   set enchantments(Map<String, int> value) {
+    writeComponents({ItemComponent.enchantments: value.isEmpty ? null : value});
+  }
+
+  // ==========================================================================
+  // Bulk Component Access
+  // ==========================================================================
+
+  /// Read several components in one call.
+  ///
+  /// Values have the types listed on [ItemComponent]; components that are
+  /// not set map to null. Throws [StateError] if the bridge fails. Cheaper than the individual getters when reading
+  /// more than one component, and lore and enchantments are not converted
+  /// through JSON.
+  ///
+  /// ```dart
+  /// final values = handle.readComponents([
+  ///   ItemComponent.damage,
+  ///   ItemComponent.maxDamage,
+  ///   ItemComponent.enchantments,
+  /// ]);
+  /// final damage = values[ItemComponent.damage] as int;
+  /// ```
+  Map<ItemComponent, Object?> readComponents(Iterable<ItemComponent> components) {
     _checkReleased();
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setItemEnchantments',
-      '(JLjava/lang/String;)V',
-      [_handle, jsonEncode(value)],
-    );
+    final requested = components.toSet().toList();
+    if (requested.length > 255) {
+      throw ArgumentError('At most 255 components per call');
+    }
+    for (var i = 0; i < requested.length; i++) {
+      _Scratch.request[i] = requested[i].code;
+    }
+
+    final length = ItemComponentCodec.readGrowing(_Scratch.capacity, (size) {
+      final out = _Scratch.ensure(size);
+      return _readComponents(_handle, _Scratch.request, requested.length, out, _Scratch.capacity);
+    });
+    if (length < 0) {
+      throw StateError('Failed to read components of $this');
+    }
+    return ItemComponentCodec.decode(_Scratch.buffer.asTypedList(length));
+  }
+
+  /// Write several components in one call.
+  ///
+  /// Values must have the types listed on [ItemComponent]; null removes the
+  /// component. Returns false if a value was rejected, e.g. an unknown
+  /// enchantment id (the known enchantments are still applied). Writes to an
+  /// empty stack are ignored.
+  ///
+  /// ```dart
+  /// handle.writeComponents({
+  ///   ItemComponent.customName: 'Excalibur',
+  ///   ItemComponent.lore: ['Forged in Dart'],
+  ///   ItemComponent.enchantments: {'minecraft:sharpness': 5},
+  ///   ItemComponent.unbreakable: true,
+  /// });
+  /// ```
+  bool writeComponents(Map<ItemComponent, Object?> values) {
+    _checkReleased();
+    final blob = ItemComponentCodec.encode(values);
+    final data = _Scratch.ensure(blob.length);
+    data.asTypedList(blob.length).setAll(0, blob);
+    return _writeComponents(_handle, data, blob.length);
+  }
+
+  // Single-component read for the typed getters, null on bridge failure
+  Object? _tryReadComponent(ItemComponent component) {
+    _checkReleased();
+    try {
+      return readComponents([component])[component];
+    } on StateError {
+      return null;
+    }
   }
 
   // ==========================================================================
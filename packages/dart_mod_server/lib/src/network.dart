@@ -14,6 +14,49 @@ import 'package:ffi/ffi.dart';
 /// The Java class name for DartBridge.
 const _dartBridge = 'com/redstone/DartBridge';
 
+/// Priority class of an outbound packet.
+///
+/// Queued packets are sent control first, then gameplay, then bulk. Gameplay
+/// and bulk packets share a per-player byte budget each tick; when a player's
+/// queue is full, the oldest bulk packets are dropped first. Values must match
+/// OUTBOUND_PRIORITY_* in outbound_queue.h.
+enum PacketPriority {
+  /// Small packets that must not be dropped or delayed (screen open/close, kicks).
+  control,
+
+  /// Regular gameplay updates.
+  gameplay,
+
+  /// Large or frequent updates that may be delayed, dropped or merged.
+  bulk,
+}
+
+/// Outbound queue counters for one player or for the whole server.
+class OutboundQueueStats {
+  final int queuedPackets;
+  final int queuedBytes;
+  final int sentPackets;
+  final int sentBytes;
+  final int droppedPackets;
+  final int droppedBytes;
+  final int mergedPackets;
+
+  const OutboundQueueStats({
+    required this.queuedPackets,
+    required this.queuedBytes,
+    required this.sentPackets,
+    required this.sentBytes,
+    required this.droppedPackets,
+    required this.droppedBytes,
+    required this.mergedPackets,
+  });
+
+  @override
+  String toString() => 'OutboundQueueStats(queued: $queuedPackets/$queuedBytes B, '
+      'sent: $sentPackets/$sentBytes B, dropped: $droppedPackets/$droppedBytes B, '
+      'merged: $mergedPackets)';
+}
+
 /// Server-side network handler for sending packets to clients.
 ///
 /// This class provides the server-side API for sending packets to clients
@@ -26,6 +69,9 @@ class ServerNetwork {
   static final List<void Function(int playerId, ModPacket packet)>
       _packetHandlers = [];
 
+  // Schemas declared before init()
+  static final List<PacketSchema> _pendingSchemas = [];
+
   /// Initialize the server network module.
   static void init(String libraryPath) {
     if (_initialized) return;
@@ -42,6 +88,11 @@ class ServerNetwork {
 
     // Register native callback for receiving packets
     _registerNativeCallback();
+
+    for (final schema in _pendingSchemas) {
+      _applySchema(schema);
+    }
+    _pendingSchemas.clear();
   }
 
   // Native function bindings
@@ -50,6 +101,9 @@ class ServerNetwork {
   static late final _ServerSetSendPacketToClientCallback
       _serverSetSendPacketToClientCallback;
   static late final _ServerSendPacketToClient _serverSendPacketToClient;
+  static late final _ServerQueuePacketToClient _serverQueuePacketToClient;
+  static late final _OutboundQueueStats _outboundQueueStats;
+  static late final PacketSchemaRegister _packetSchemaRegister;
 
   static void _bindFunctions() {
     final lib = _lib!;
@@ -68,6 +122,18 @@ class ServerNetwork {
         Void Function(Int32, Int32, Pointer<Uint8>, Int32),
         void Function(int, int, Pointer<Uint8>, int)>(
         'server_send_packet_to_client');
+
+    _serverQueuePacketToClient = lib.lookupFunction<
+        Bool Function(Int32, Int32, Int32, Int64, Pointer<Uint8>, Int32),
+        bool Function(int, int, int, int, Pointer<Uint8>, int)>(
+        'server_queue_packet_to_client');
+
+    _outboundQueueStats = lib.lookupFunction<
+        Int32 Function(Int32, Pointer<Int64>, Int32),
+        int Function(int, Pointer<Int64>, int)>('outbound_queue_stats');
+
+    _packetSchemaRegister = lib.lookupFunction<PacketSchemaRegisterNative,
+        PacketSchemaRegister>('packet_schema_register');
   }
 
   static void _registerNativeCallback() {
@@ -81,10 +147,7 @@ class ServerNetwork {
   static void _onPacketReceived(
       int playerId, int packetType, Pointer<Uint8> data, int dataLength) {
     // Copy data to Dart memory
-    final bytes = Uint8List(dataLength);
-    for (var i = 0; i < dataLength; i++) {
-      bytes[i] = data[i];
-    }
+    final bytes = Uint8List.fromList(data.asTypedList(dataLength));
 
     // Decode the packet
     final packet = PacketRegistry.decode(packetType, bytes);
@@ -122,6 +185,24 @@ class ServerNetwork {
     _packetHandlers.add(handler);
   }
 
+  /// Register a packet schema so its packets can be sent and received.
+  ///
+  /// The client must register the same schemas. Schemas registered before
+  /// [init] are laid out during init.
+  static void registerSchema(PacketSchema schema) {
+    if (!_initialized) {
+      _pendingSchemas.add(schema);
+      return;
+    }
+    _applySchema(schema);
+  }
+
+  static void _applySchema(PacketSchema schema) {
+    if (!schema.applyLayout(_packetSchemaRegister)) {
+      print('[ServerNetwork] Packet schema ${schema.id} was rejected');
+    }
+  }
+
   /// Remove a packet handler.
   static void removePacketHandler(
       void Function(int playerId, ModPacket packet) handler) {
@@ -130,31 +211,62 @@ class ServerNetwork {
 
   /// Send a packet to a specific player.
   ///
+  /// Packets are queued and sent from a network thread. A [PacketPriority.bulk]
+  /// packet with a non-zero [mergeKey] replaces a still-queued bulk packet
+  /// with the same key for that player. Returns false if the packet was
+  /// dropped because the player's queue is full.
+  ///
   /// ```dart
   /// ServerNetwork.sendToPlayer(playerId, BlockUpdatePacket(
   ///   x: 100, y: 64, z: 100,
   ///   blockId: 'minecraft:diamond_block',
   /// ));
   /// ```
-  static void sendToPlayer(int playerId, ModPacket packet) {
+  static bool sendToPlayer(int playerId, ModPacket packet,
+      {PacketPriority priority = PacketPriority.gameplay, int mergeKey = 0}) {
     if (!_initialized) {
       print('[ServerNetwork] Not initialized');
-      return;
+      return false;
     }
 
     final bytes = packet.encodePayload();
     final nativeBytes = calloc<Uint8>(bytes.length);
 
     try {
-      for (var i = 0; i < bytes.length; i++) {
-        nativeBytes[i] = bytes[i];
-      }
-      _serverSendPacketToClient(playerId, packet.typeId, nativeBytes, bytes.length);
+      nativeBytes.asTypedList(bytes.length).setAll(0, bytes);
+      return _serverQueuePacketToClient(playerId, packet.typeId, priority.index,
+          mergeKey, nativeBytes, bytes.length);
     } finally {
       calloc.free(nativeBytes);
     }
   }
 
+  /// Outbound queue counters for [playerId], or totals for all players when
+  /// [playerId] is omitted.
+  static OutboundQueueStats queueStats([int playerId = -1]) {
+    if (!_initialized) {
+      return const OutboundQueueStats(queuedPackets: 0, queuedBytes: 0,
+          sentPackets: 0, sentBytes: 0, droppedPackets: 0, droppedBytes: 0,
+          mergedPackets: 0);
+    }
+
+    final out = calloc<Int64>(_outboundStatCount);
+    try {
+      _outboundQueueStats(playerId, out, _outboundStatCount);
+      return OutboundQueueStats(
+        queuedPackets: out[0],
+        queuedBytes: out[1],
+        sentPackets: out[2],
+        sentBytes: out[3],
+        droppedPackets: out[4],
+        droppedBytes: out[5],
+        mergedPackets: out[6],
+      );
+    } finally {
+      calloc.free(out);
+    }
+  }
+
   /// Send a block update packet to a player.
   static void sendBlockUpdate(int playerId, int x, int y, int z, String blockId,
       {Map<String, dynamic>? stateData}) {
@@ -235,3 +347,9 @@ typedef _ServerSetSendPacketToClientCallback = void Function(
     Pointer<NativeFunction<_SendPacketToClientCallbackNative>>);
 typedef _ServerSendPacketToClient = void Function(
     int, int, Pointer<Uint8>, int);
+typedef _ServerQueuePacketToClient = bool Function(
+    int, int, int, int, Pointer<Uint8>, int);
+typedef _OutboundQueueStats = int Function(int, Pointer<Int64>, int);
+
+/// Number of OUTBOUND_STAT_* slots in outbound_queue.h.
+const _outboundStatCount = 7;
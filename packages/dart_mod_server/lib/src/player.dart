@@ -4,9 +4,6 @@ library;
 import 'package:dart_mod_common/dart_mod_common.dart';
 import 'package:dart_mod_common/src/jni/jni_internal.dart';
 
-/// The Java class name for DartBridge.
-const _dartBridge = 'com/redstone/DartBridge';
-
 /// Game mode for players.
 enum GameMode {
   survival(0),
@@ -54,45 +51,20 @@ class Player {
   }
 
   List<double>? _getPositionArray() {
-    final x = GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getPlayerX',
-      '(I)D',
-      [id],
-    );
-    final y = GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getPlayerY',
-      '(I)D',
-      [id],
-    );
-    final z = GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getPlayerZ',
-      '(I)D',
-      [id],
-    );
+    final x = DartBridgeBindings.getPlayerX(id);
+    final y = DartBridgeBindings.getPlayerY(id);
+    final z = DartBridgeBindings.getPlayerZ(id);
     return [x, y, z];
   }
 
   /// Get the player's yaw (horizontal rotation, 0-360).
   double get yaw {
-    return GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getPlayerYaw',
-      '(I)D',
-      [id],
-    );
+    return DartBridgeBindings.getPlayerYaw(id);
   }
 
   /// Get the player's pitch (vertical rotation, -90 to 90).
   double get pitch {
-    return GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getPlayerPitch',
-      '(I)D',
-      [id],
-    );
+    return DartBridgeBindings.getPlayerPitch(id);
   }
 
   /// Teleport the player to a block position.
@@ -102,32 +74,32 @@ class Player {
 
   /// Teleport the player to precise coordinates.
   void teleportPrecise(Vec3 pos, {double? yaw, double? pitch}) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'teleportPlayer',
-      '(IDDDFF)V',
-      [id, pos.x, pos.y, pos.z, yaw ?? this.yaw, pitch ?? this.pitch],
+    DartBridgeBindings.teleportPlayer(
+      id,
+      pos.x,
+      pos.y,
+      pos.z,
+      yaw ?? this.yaw,
+      pitch ?? this.pitch,
     );
   }
 
   /// Get the dimension/world this player is in.
   World get dimension {
-    final dimensionId = GenericJniBridge.callStaticStringMethod(
-      _dartBridge,
-      'getPlayerDimension',
-      '(I)Ljava/lang/String;',
-      [id],
-    );
+    final dimensionId = DartBridgeBindings.getPlayerDimension(id);
     return World(dimensionId ?? 'minecraft:overworld');
   }
 
   /// Teleport the player to a position in a specific dimension.
   void teleportToDimension(String dimension, Vec3 pos, {double? yaw, double? pitch}) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'teleportPlayerToDimension',
-      '(ILjava/lang/String;DDDFF)V',
-      [id, dimension, pos.x, pos.y, pos.z, (yaw ?? this.yaw).toDouble(), (pitch ?? this.pitch).toDouble()],
+    DartBridgeBindings.teleportPlayerToDimension(
+      id,
+      dimension,
+      pos.x,
+      pos.y,
+      pos.z,
+      (yaw ?? this.yaw).toDouble(),
+      (pitch ?? this.pitch).toDouble(),
     );
   }
 
@@ -137,72 +109,37 @@ class Player {
 
   /// Get the player's current health (0-20 by default).
   double get health {
-    return GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getPlayerHealth',
-      '(I)D',
-      [id],
-    );
+    return DartBridgeBindings.getPlayerHealth(id);
   }
 
   /// Set the player's health.
   set health(double value) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setPlayerHealth',
-      '(IF)V',
-      [id, value],
-    );
+    DartBridgeBindings.setPlayerHealth(id, value);
   }
 
   /// Get the player's max health.
   double get maxHealth {
-    return GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getPlayerMaxHealth',
-      '(I)D',
-      [id],
-    );
+    return DartBridgeBindings.getPlayerMaxHealth(id);
   }
 
   /// Get the player's food level (0-20).
   int get foodLevel {
-    return GenericJniBridge.callStaticIntMethod(
-      _dartBridge,
-      'getPlayerFoodLevel',
-      '(I)I',
-      [id],
-    );
+    return DartBridgeBindings.getPlayerFoodLevel(id);
   }
 
   /// Set the player's food level.
   set foodLevel(int value) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setPlayerFoodLevel',
-      '(II)V',
-      [id, value],
-    );
+    DartBridgeBindings.setPlayerFoodLevel(id, value);
   }
 
   /// Get the player's saturation level.
   double get saturation {
-    return GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getPlayerSaturation',
-      '(I)D',
-      [id],
-    );
+    return DartBridgeBindings.getPlayerSaturation(id);
   }
 
   /// Set the player's saturation level.
   set saturation(double value) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setPlayerSaturation',
-      '(IF)V',
-      [id, value],
-    );
+    DartBridgeBindings.setPlayerSaturation(id, value);
   }
 
   // ==========================================================================
@@ -211,23 +148,13 @@ class Player {
 
   /// Get the player's game mode.
   GameMode get gameMode {
-    final mode = GenericJniBridge.callStaticIntMethod(
-      _dartBridge,
-      'getPlayerGameMode',
-      '(I)I',
-      [id],
-    );
+    final mode = DartBridgeBindings.getPlayerGameMode(id);
     return GameMode.fromValue(mode);
   }
 
   /// Set the player's game mode.
   set gameMode(GameMode mode) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setPlayerGameMode',
-      '(II)V',
-      [id, mode.value],
-    );
+    DartBridgeBindings.setPlayerGameMode(id, mode.value);
   }
 
   /// Check if player is in creative mode.
@@ -248,42 +175,22 @@ class Player {
 
   /// Get the player's experience level.
   int get experienceLevel {
-    return GenericJniBridge.callStaticIntMethod(
-      _dartBridge,
-      'getPlayerExperienceLevel',
-      '(I)I',
-      [id],
-    );
+    return DartBridgeBindings.getPlayerExperienceLevel(id);
   }
 
   /// Set the player's experience level.
   set experienceLevel(int level) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setPlayerExperienceLevel',
-      '(II)V',
-      [id, level],
-    );
+    DartBridgeBindings.setPlayerExperienceLevel(id, level);
   }
 
   /// Get the player's total experience points.
   int get totalExperience {
-    return GenericJniBridge.callStaticIntMethod(
-      _dartBridge,
-      'getPlayerTotalExperience',
-      '(I)I',
-      [id],
-    );
+    return DartBridgeBindings.getPlayerTotalExperience(id);
   }
 
   /// Give experience points to the player.
   void giveExperience(int amount) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'givePlayerExperience',
-      '(II)V',
-      [id, amount],
-    );
+    DartBridgeBindings.givePlayerExperience(id, amount);
   }
 
   // ==========================================================================
@@ -292,22 +199,12 @@ class Player {
 
   /// Send a chat message to the player.
   void sendMessage(String message) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'sendPlayerMessage',
-      '(ILjava/lang/String;)V',
-      [id, message],
-    );
+    DartBridgeBindings.sendPlayerMessage(id, message);
   }
 
   /// Send an action bar message to the player.
   void sendActionBar(String message) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'sendPlayerActionBar',
-      '(ILjava/lang/String;)V',
-      [id, message],
-    );
+    DartBridgeBindings.sendPlayerActionBar(id, message);
   }
 
   /// Send a title and optional subtitle to the player.
@@ -318,11 +215,13 @@ class Player {
     int stay = 70,
     int fadeOut = 20,
   }) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'sendPlayerTitle',
-      '(ILjava/lang/String;Ljava/lang/String;III)V',
-      [id, title, subtitle ?? '', fadeIn, stay, fadeOut],
+    DartBridgeBindings.sendPlayerTitle(
+      id,
+      title,
+      subtitle ?? '',
+      fadeIn,
+      stay,
+      fadeOut,
     );
   }
 
@@ -332,74 +231,39 @@ class Player {
 
   /// Get the player's display name.
   String get name {
-    return GenericJniBridge.callStaticStringMethod(
-          _dartBridge,
-          'getPlayerName',
-          '(I)Ljava/lang/String;',
-          [id],
-        ) ??
+    return DartBridgeBindings.getPlayerName(id) ??
         '';
   }
 
   /// Get the player's UUID string.
   String get uuid {
-    return GenericJniBridge.callStaticStringMethod(
-          _dartBridge,
-          'getPlayerUuid',
-          '(I)Ljava/lang/String;',
-          [id],
-        ) ??
+    return DartBridgeBindings.getPlayerUuid(id) ??
         '';
   }
 
   /// Check if the player is on the ground.
   bool get isOnGround {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isPlayerOnGround',
-      '(I)Z',
-      [id],
-    );
+    return DartBridgeBindings.isPlayerOnGround(id);
   }
 
   /// Check if the player is sneaking.
   bool get isSneaking {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isPlayerSneaking',
-      '(I)Z',
-      [id],
-    );
+    return DartBridgeBindings.isPlayerSneaking(id);
   }
 
   /// Check if the player is sprinting.
   bool get isSprinting {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isPlayerSprinting',
-      '(I)Z',
-      [id],
-    );
+    return DartBridgeBindings.isPlayerSprinting(id);
   }
 
   /// Check if the player is swimming.
   bool get isSwimming {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isPlayerSwimming',
-      '(I)Z',
-      [id],
-    );
+    return DartBridgeBindings.isPlayerSwimming(id);
   }
 
   /// Check if the player is flying (creative/spectator flight).
   bool get isFlying {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isPlayerFlying',
-      '(I)Z',
-      [id],
-    );
+    return DartBridgeBindings.isPlayerFlying(id);
   }
 
   @override
@@ -420,12 +284,7 @@ class Players {
   /// Returns null if no player with that ID exists.
   static Player? getPlayer(int id) {
     // Check if player exists by trying to get their name
-    final name = GenericJniBridge.callStaticStringMethod(
-      _dartBridge,
-      'getPlayerName',
-      '(I)Ljava/lang/String;',
-      [id],
-    );
+    final name = DartBridgeBindings.getPlayerName(id);
     if (name == null || name.isEmpty) return null;
     return Player(id);
   }
@@ -433,12 +292,7 @@ class Players {
   /// Get a player by their name.
   /// Returns null if no player with that name is online.
   static Player? getPlayerByName(String name) {
-    final id = GenericJniBridge.callStaticIntMethod(
-      _dartBridge,
-      'getPlayerIdByName',
-      '(Ljava/lang/String;)I',
-      [name],
-    );
+    final id = DartBridgeBindings.getPlayerIdByName(name);
     if (id < 0) return null;
     return Player(id);
   }
@@ -446,12 +300,7 @@ class Players {
   /// Get a player by their UUID.
   /// Returns null if no player with that UUID is online.
   static Player? getPlayerByUuid(String uuid) {
-    final id = GenericJniBridge.callStaticIntMethod(
-      _dartBridge,
-      'getPlayerIdByUuid',
-      '(Ljava/lang/String;)I',
-      [uuid],
-    );
+    final id = DartBridgeBindings.getPlayerIdByUuid(uuid);
     if (id < 0) return null;
     return Player(id);
   }
@@ -463,12 +312,7 @@ class Players {
 
     // Get all player IDs
     for (var i = 0; i < count; i++) {
-      final id = GenericJniBridge.callStaticIntMethod(
-        _dartBridge,
-        'getPlayerIdByIndex',
-        '(I)I',
-        [i],
-      );
+      final id = DartBridgeBindings.getPlayerIdByIndex(i);
       if (id >= 0) {
         players.add(Player(id));
       }
@@ -479,12 +323,7 @@ class Players {
 
   /// Get the number of online players.
   static int get playerCount {
-    return GenericJniBridge.callStaticIntMethod(
-      _dartBridge,
-      'getPlayerCount',
-      '()I',
-      [],
-    );
+    return DartBridgeBindings.getPlayerCount();
   }
 }
 
@@ -9,11 +9,9 @@ import 'dart:convert';
 import 'package:dart_mod_common/dart_mod_common.dart';
 import 'package:dart_mod_common/src/jni/jni_internal.dart';
 
-import 'entity.dart' show Entity;
+import 'entity.dart' show Entity, LivingEntity, MobEntity;
 import 'player.dart';
-
-/// The Java class name for DartBridge.
-const _dartBridge = 'com/redstone/DartBridge';
+import 'world_query.dart';
 
 /// Server-side world with live Minecraft access.
 ///
@@ -36,12 +34,7 @@ class ServerWorld extends World {
 
   /// Get all loaded dimension IDs.
   static List<String> get loadedDimensions {
-    final result = GenericJniBridge.callStaticStringMethod(
-      _dartBridge,
-      'getLoadedDimensions',
-      '()Ljava/lang/String;',
-      [],
-    );
+    final result = DartBridgeBindings.getLoadedDimensions();
     if (result == null || result.isEmpty) return [];
     return result.split(',');
   }
@@ -53,12 +46,7 @@ class ServerWorld extends World {
 
   /// Get the dimension type properties for this world.
   DimensionProperties get properties {
-    final result = GenericJniBridge.callStaticStringMethod(
-      _dartBridge,
-      'getDimensionProperties',
-      '(Ljava/lang/String;)Ljava/lang/String;',
-      [dimensionId],
-    );
+    final result = DartBridgeBindings.getDimensionProperties(dimensionId);
     if (result == null || result.isEmpty) return const DimensionProperties();
     return DimensionProperties.fromJson(
       jsonDecode(result) as Map<String, dynamic>,
@@ -72,11 +60,11 @@ class ServerWorld extends World {
   /// Get the block at a position in this world.
   /// Returns the block, or [Block.air] if the position is invalid/unloaded.
   Block getBlock(BlockPos pos) {
-    final blockId = GenericJniBridge.callStaticStringMethod(
-      _dartBridge,
-      'getBlockId',
-      '(Ljava/lang/String;III)Ljava/lang/String;',
-      [dimensionId, pos.x, pos.y, pos.z],
+    final blockId = DartBridgeBindings.getBlockId(
+      dimensionId,
+      pos.x,
+      pos.y,
+      pos.z,
     );
     if (blockId == null) return Block.air;
     return Block(blockId);
@@ -85,22 +73,18 @@ class ServerWorld extends World {
   /// Set a block at a position in this world.
   /// Returns true if successful.
   bool setBlock(BlockPos pos, Block block) {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'setBlock',
-      '(Ljava/lang/String;IIILjava/lang/String;)Z',
-      [dimensionId, pos.x, pos.y, pos.z, block.id],
+    return DartBridgeBindings.setBlock(
+      dimensionId,
+      pos.x,
+      pos.y,
+      pos.z,
+      block.id,
     );
   }
 
   /// Check if a position contains air.
   bool isAir(BlockPos pos) {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isAirBlock',
-      '(Ljava/lang/String;III)Z',
-      [dimensionId, pos.x, pos.y, pos.z],
-    );
+    return DartBridgeBindings.isAirBlock(dimensionId, pos.x, pos.y, pos.z);
   }
 
   /// Get the redstone signal strength at a position.
@@ -108,56 +92,132 @@ class ServerWorld extends World {
   /// Returns the strongest signal received from any neighboring block,
   /// from 0 (no signal) to 15 (full signal).
   int getRedstoneSignal(BlockPos pos) {
-    return GenericJniBridge.callStaticIntMethod(
-      _dartBridge,
-      'getRedstoneSignal',
-      '(Ljava/lang/String;III)I',
-      [dimensionId, pos.x, pos.y, pos.z],
+    return DartBridgeBindings.getRedstoneSignal(
+      dimensionId,
+      pos.x,
+      pos.y,
+      pos.z,
+    );
+  }
+
+  // ==========================================================================
+  // Async Query APIs
+  // ==========================================================================
+  //
+  // These are answered on the server thread at the end of the current tick
+  // instead of through a blocking JNI call. Use them from async code that does
+  // not need the answer immediately.
+
+  /// Get the block at a position, answered at the end of the tick.
+  Future<Block> getBlockAsync(BlockPos pos) async {
+    final reply = await WorldQueries.submit(
+      worldQueryBlockId,
+      dimensionId,
+      [pos.x.toDouble(), pos.y.toDouble(), pos.z.toDouble()],
+    );
+    final blockId = reply.text;
+    return blockId == null ? Block.air : Block(blockId);
+  }
+
+  /// Check if a position contains air, answered at the end of the tick.
+  Future<bool> isAirAsync(BlockPos pos) async {
+    final reply = await WorldQueries.submit(
+      worldQueryIsAir,
+      dimensionId,
+      [pos.x.toDouble(), pos.y.toDouble(), pos.z.toDouble()],
+    );
+    return reply.values[0] != 0;
+  }
+
+  /// Get the redstone signal strength at a position, answered at the end of the tick.
+  Future<int> getRedstoneSignalAsync(BlockPos pos) async {
+    final reply = await WorldQueries.submit(
+      worldQueryRedstoneSignal,
+      dimensionId,
+      [pos.x.toDouble(), pos.y.toDouble(), pos.z.toDouble()],
+    );
+    return reply.values[0].toInt();
+  }
+
+  /// Get entities in an axis-aligned box, answered at the end of the tick.
+  ///
+  /// If [type] is given (e.g. "minecraft:zombie"), only entities of that type
+  /// are returned.
+  Future<List<Entity>> getEntitiesInBoxAsync(Vec3 min, Vec3 max, {String? type}) async {
+    final reply = await WorldQueries.submit(
+      worldQueryEntitiesInBox,
+      dimensionId,
+      [min.x, min.y, min.z, max.x, max.y, max.z],
+      text: type,
+    );
+    return _entitiesFromReply(reply);
+  }
+
+  /// Get entities within [radius] of [center], answered at the end of the tick.
+  Future<List<Entity>> getEntitiesInRadiusAsync(Vec3 center, double radius, {String? type}) async {
+    final reply = await WorldQueries.submit(
+      worldQueryEntitiesInRadius,
+      dimensionId,
+      [center.x, center.y, center.z, radius],
+      text: type,
+    );
+    return _entitiesFromReply(reply);
+  }
+
+  /// Cast a ray against block outlines from [from] to [to].
+  /// Returns null if nothing was hit.
+  Future<BlockRaycastHit?> raycastBlocksAsync(Vec3 from, Vec3 to) async {
+    final reply = await WorldQueries.submit(
+      worldQueryRaycast,
+      dimensionId,
+      [from.x, from.y, from.z, to.x, to.y, to.z],
+    );
+    final v = reply.values;
+    if (v.isEmpty || v[0] == 0) return null;
+    return BlockRaycastHit(
+      BlockPos(v[1].toInt(), v[2].toInt(), v[3].toInt()),
+      Direction.values[v[4].toInt()],
+      Vec3(v[5], v[6], v[7]),
     );
   }
 
+  /// Entity results are (id, class) pairs: 0 = entity, 1 = living, 2 = mob.
+  static List<Entity> _entitiesFromReply(WorldQueryReply reply) {
+    final v = reply.values;
+    final entities = <Entity>[];
+    for (var i = 0; i + 1 < v.length; i += 2) {
+      final id = v[i].toInt();
+      entities.add(switch (v[i + 1].toInt()) {
+        2 => MobEntity(id),
+        1 => LivingEntity(id),
+        _ => Entity(id),
+      });
+    }
+    return entities;
+  }
+
   // ==========================================================================
   // Time APIs
   // ==========================================================================
 
   /// Time of day (0-24000, 0=dawn, 6000=noon, 12000=dusk, 18000=midnight).
   int get timeOfDay {
-    return GenericJniBridge.callStaticLongMethod(
-      _dartBridge,
-      'getTimeOfDay',
-      '(Ljava/lang/String;)J',
-      [dimensionId],
-    ).toInt();
+    return DartBridgeBindings.getTimeOfDay(dimensionId).toInt();
   }
 
   /// Set the time of day (0-24000).
   set timeOfDay(int time) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setTimeOfDay',
-      '(Ljava/lang/String;J)V',
-      [dimensionId, time],
-    );
+    DartBridgeBindings.setTimeOfDay(dimensionId, time);
   }
 
   /// Full world time (total ticks since world creation).
   int get gameTime {
-    return GenericJniBridge.callStaticLongMethod(
-      _dartBridge,
-      'getGameTime',
-      '(Ljava/lang/String;)J',
-      [dimensionId],
-    ).toInt();
+    return DartBridgeBindings.getGameTime(dimensionId).toInt();
   }
 
   /// Current day count.
   int get dayCount {
-    return GenericJniBridge.callStaticLongMethod(
-      _dartBridge,
-      'getDayCount',
-      '(Ljava/lang/String;)J',
-      [dimensionId],
-    ).toInt();
+    return DartBridgeBindings.getDayCount(dimensionId).toInt();
   }
 
   /// Is it daytime (roughly 6000-18000 ticks, when sun is up).
@@ -175,12 +235,7 @@ class ServerWorld extends World {
 
   /// Get current weather.
   Weather get weather {
-    final weatherInt = GenericJniBridge.callStaticIntMethod(
-      _dartBridge,
-      'getWeather',
-      '(Ljava/lang/String;)I',
-      [dimensionId],
-    );
+    final weatherInt = DartBridgeBindings.getWeather(dimensionId);
     return switch (weatherInt) {
       1 => Weather.rain,
       2 => Weather.thunder,
@@ -200,32 +255,17 @@ class ServerWorld extends World {
       Weather.rain => 1,
       Weather.thunder => 2,
     };
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setWeather',
-      '(Ljava/lang/String;II)V',
-      [dimensionId, weatherInt, durationTicks],
-    );
+    DartBridgeBindings.setWeather(dimensionId, weatherInt, durationTicks);
   }
 
   /// Is it currently raining.
   bool get isRaining {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isRaining',
-      '(Ljava/lang/String;)Z',
-      [dimensionId],
-    );
+    return DartBridgeBindings.isRaining(dimensionId);
   }
 
   /// Is it currently thundering.
   bool get isThundering {
-    return GenericJniBridge.callStaticBoolMethod(
-      _dartBridge,
-      'isThundering',
-      '(Ljava/lang/String;)Z',
-      [dimensionId],
-    );
+    return DartBridgeBindings.isThundering(dimensionId);
   }
 
   // ==========================================================================
@@ -240,20 +280,15 @@ class ServerWorld extends World {
     double volume = 1.0,
     double pitch = 1.0,
   }) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'playSound',
-      '(Ljava/lang/String;DDDLjava/lang/String;Ljava/lang/String;FF)V',
-      [
-        dimensionId,
-        position.x,
-        position.y,
-        position.z,
-        sound,
-        category.id,
-        volume,
-        pitch,
-      ],
+    DartBridgeBindings.playSound(
+      dimensionId,
+      position.x,
+      position.y,
+      position.z,
+      sound,
+      category.id,
+      volume,
+      pitch,
     );
   }
 
@@ -265,11 +300,12 @@ class ServerWorld extends World {
     double volume = 1.0,
     double pitch = 1.0,
   }) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'playSoundToPlayer',
-      '(ILjava/lang/String;Ljava/lang/String;FF)V',
-      [player.id, sound, category.id, volume, pitch],
+    DartBridgeBindings.playSoundToPlayer(
+      player.id,
+      sound,
+      category.id,
+      volume,
+      pitch,
     );
   }
 
@@ -285,22 +321,17 @@ class ServerWorld extends World {
     Vec3 delta = Vec3.zero,
     double speed = 0.0,
   }) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'spawnParticles',
-      '(Ljava/lang/String;Ljava/lang/String;DDDIDDDD)V',
-      [
-        dimensionId,
-        particle,
-        position.x,
-        position.y,
-        position.z,
-        count,
-        delta.x,
-        delta.y,
-        delta.z,
-        speed,
-      ],
+    DartBridgeBindings.spawnParticles(
+      dimensionId,
+      particle,
+      position.x,
+      position.y,
+      position.z,
+      count,
+      delta.x,
+      delta.y,
+      delta.z,
+      speed,
     );
   }
 
@@ -313,22 +344,17 @@ class ServerWorld extends World {
     Vec3 delta = Vec3.zero,
     double speed = 0.0,
   }) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'spawnParticlesToPlayer',
-      '(ILjava/lang/String;DDDIDDDD)V',
-      [
-        player.id,
-        particle,
-        position.x,
-        position.y,
-        position.z,
-        count,
-        delta.x,
-        delta.y,
-        delta.z,
-        speed,
-      ],
+    DartBridgeBindings.spawnParticlesToPlayer(
+      player.id,
+      particle,
+      position.x,
+      position.y,
+      position.z,
+      count,
+      delta.x,
+      delta.y,
+      delta.z,
+      speed,
     );
   }
 
@@ -344,20 +370,15 @@ class ServerWorld extends World {
     ExplosionMode mode = ExplosionMode.destroy,
     Entity? source,
   }) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'createExplosion',
-      '(Ljava/lang/String;DDDFZII)V',
-      [
-        dimensionId,
-        position.x,
-        position.y,
-        position.z,
-        power,
-        fire,
-        mode.value,
-        source?.id ?? -1,
-      ],
+    DartBridgeBindings.createExplosion(
+      dimensionId,
+      position.x,
+      position.y,
+      position.z,
+      power,
+      fire,
+      mode.value,
+      source?.id ?? -1,
     );
   }
 
@@ -368,11 +389,12 @@ class ServerWorld extends World {
   /// Spawn a lightning bolt at a position.
   /// Returns the lightning entity.
   Entity? spawnLightning(Vec3 position, {bool damageOnly = false}) {
-    final entityId = GenericJniBridge.callStaticIntMethod(
-      _dartBridge,
-      'spawnLightning',
-      '(Ljava/lang/String;DDDZ)I',
-      [dimensionId, position.x, position.y, position.z, damageOnly],
+    final entityId = DartBridgeBindings.spawnLightning(
+      dimensionId,
+      position.x,
+      position.y,
+      position.z,
+      damageOnly,
     );
     if (entityId < 0) return null;
     return Entity(entityId);
@@ -384,12 +406,7 @@ class ServerWorld extends World {
 
   /// Get the world border center.
   Vec3 get worldBorderCenter {
-    final result = GenericJniBridge.callStaticStringMethod(
-      _dartBridge,
-      'getWorldBorderCenter',
-      '(Ljava/lang/String;)Ljava/lang/String;',
-      [dimensionId],
-    );
+    final result = DartBridgeBindings.getWorldBorderCenter(dimensionId);
     if (result == null || result.isEmpty) return Vec3.zero;
     final parts = result.split(',');
     if (parts.length < 2) return Vec3.zero;
@@ -402,22 +419,12 @@ class ServerWorld extends World {
 
   /// Set the world border center.
   set worldBorderCenter(Vec3 center) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setWorldBorderCenter',
-      '(Ljava/lang/String;DD)V',
-      [dimensionId, center.x, center.z],
-    );
+    DartBridgeBindings.setWorldBorderCenter(dimensionId, center.x, center.z);
   }
 
   /// Get the world border size (diameter).
   double get worldBorderSize {
-    return GenericJniBridge.callStaticDoubleMethod(
-      _dartBridge,
-      'getWorldBorderSize',
-      '(Ljava/lang/String;)D',
-      [dimensionId],
-    );
+    return DartBridgeBindings.getWorldBorderSize(dimensionId);
   }
 
   /// Set the world border size instantly.
@@ -427,12 +434,7 @@ class ServerWorld extends World {
 
   /// Set the world border size with transition time in milliseconds.
   void setWorldBorderSize(double size, int transitionMillis) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setWorldBorderSize',
-      '(Ljava/lang/String;DJ)V',
-      [dimensionId, size, transitionMillis],
-    );
+    DartBridgeBindings.setWorldBorderSize(dimensionId, size, transitionMillis);
   }
 
   // ==========================================================================
@@ -441,12 +443,7 @@ class ServerWorld extends World {
 
   /// Get the world spawn point.
   BlockPos get spawnPoint {
-    final result = GenericJniBridge.callStaticStringMethod(
-      _dartBridge,
-      'getSpawnPoint',
-      '(Ljava/lang/String;)Ljava/lang/String;',
-      [dimensionId],
-    );
+    final result = DartBridgeBindings.getSpawnPoint(dimensionId);
     if (result == null || result.isEmpty) return const BlockPos(0, 64, 0);
     final parts = result.split(',');
     if (parts.length < 3) return const BlockPos(0, 64, 0);
@@ -459,12 +456,7 @@ class ServerWorld extends World {
 
   /// Set the world spawn point.
   set spawnPoint(BlockPos pos) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setSpawnPoint',
-      '(Ljava/lang/String;III)V',
-      [dimensionId, pos.x, pos.y, pos.z],
-    );
+    DartBridgeBindings.setSpawnPoint(dimensionId, pos.x, pos.y, pos.z);
   }
 
   // ==========================================================================
@@ -473,23 +465,13 @@ class ServerWorld extends World {
 
   /// Get current game difficulty.
   Difficulty get difficulty {
-    final diffInt = GenericJniBridge.callStaticIntMethod(
-      _dartBridge,
-      'getDifficulty',
-      '()I',
-      [],
-    );
+    final diffInt = DartBridgeBindings.getDifficulty();
     return Difficulty.fromValue(diffInt);
   }
 
   /// Set game difficulty.
   set difficulty(Difficulty diff) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setDifficulty',
-      '(I)V',
-      [diff.value],
-    );
+    DartBridgeBindings.setDifficulty(diff.value);
   }
 
   // ==========================================================================
@@ -498,23 +480,13 @@ class ServerWorld extends World {
 
   /// Get a game rule value as a string.
   String getGameRule(String rule) {
-    return GenericJniBridge.callStaticStringMethod(
-          _dartBridge,
-          'getGameRule',
-          '(Ljava/lang/String;Ljava/lang/String;)Ljava/lang/String;',
-          [dimensionId, rule],
-        ) ??
+    return DartBridgeBindings.getGameRule(dimensionId, rule) ??
         '';
   }
 
   /// Set a game rule value.
   void setGameRule(String rule, String value) {
-    GenericJniBridge.callStaticVoidMethod(
-      _dartBridge,
-      'setGameRule',
-      '(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)V',
-      [dimensionId, rule, value],
-    );
+    DartBridgeBindings.setGameRule(dimensionId, rule, value);
   }
 
   // Common game rules as typed getters/setters
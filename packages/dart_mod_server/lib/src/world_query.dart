@@ -0,0 +1,134 @@
+/// Asynchronous world queries serviced once per server tick.
+///
+/// Queries are queued in native code and answered by Java in one batch at
+/// the end of the tick. The result is posted back to this isolate, so async
+/// mod code never blocks on a synchronous JNI call.
+library;
+
+import 'dart:async';
+import 'dart:ffi';
+import 'dart:isolate';
+import 'dart:typed_data';
+
+import 'package:dart_mod_common/dart_mod_common.dart';
+import 'package:ffi/ffi.dart';
+
+import 'bridge.dart';
+
+// Query kinds - must match world_query.h
+const int worldQueryBlockId = 0;
+const int worldQueryIsAir = 1;
+const int worldQueryRedstoneSignal = 2;
+const int worldQueryEntitiesInBox = 3;
+const int worldQueryEntitiesInRadius = 4;
+const int worldQueryRaycast = 5;
+
+const int _maxArgs = 8;
+const int _statusOk = 0;
+const int _statusCancelled = 2;
+
+typedef _SubmitNative = Int64 Function(
+    Int64, Int32, Pointer<Utf8>, Pointer<Utf8>, Pointer<Double>, Int32);
+typedef _Submit = int Function(
+    int, int, Pointer<Utf8>, Pointer<Utf8>, Pointer<Double>, int);
+
+/// The answer to a world query.
+class WorldQueryReply {
+  /// Text result (e.g. a block id), if the query produces one.
+  final String? text;
+
+  /// Numeric results.
+  final Float64List values;
+
+  const WorldQueryReply(this.text, this.values);
+}
+
+/// Thrown when a world query could not be answered.
+class WorldQueryException implements Exception {
+  final String message;
+
+  const WorldQueryException(this.message);
+
+  @override
+  String toString() => 'WorldQueryException: $message';
+}
+
+/// Result of a block raycast that hit something.
+class BlockRaycastHit {
+  /// The block that was hit.
+  final BlockPos pos;
+
+  /// The face of the block that was hit.
+  final Direction face;
+
+  /// The exact hit location.
+  final Vec3 location;
+
+  const BlockRaycastHit(this.pos, this.face, this.location);
+
+  @override
+  String toString() => 'BlockRaycastHit($pos, $face, $location)';
+}
+
+/// Low-level submission of asynchronous world queries.
+///
+/// Prefer the `*Async` methods on [ServerWorld].
+class WorldQueries {
+  WorldQueries._();
+
+  static final _Submit _submit = ServerBridge.library
+      .lookupFunction<_SubmitNative, _Submit>('world_query_submit');
+
+  static ReceivePort? _port;
+  static final Map<int, Completer<WorldQueryReply>> _pending = {};
+
+  /// Number of queries waiting for a reply.
+  static int get pendingCount => _pending.length;
+
+  /// Queue a query of [kind] against [dimension] with up to 8 numeric [args].
+  static Future<WorldQueryReply> submit(
+    int kind,
+    String dimension,
+    List<double> args, {
+    String? text,
+  }) {
+    final port = _port ??= (ReceivePort()..listen(_onReply));
+
+    final argPtr = calloc<Double>(_maxArgs);
+    final dimensionPtr = dimension.toNativeUtf8();
+    final textPtr = text?.toNativeUtf8() ?? nullptr;
+    final int id;
+    try {
+      final count = args.length < _maxArgs ? args.length : _maxArgs;
+      for (var i = 0; i < count; i++) {
+        argPtr[i] = args[i];
+      }
+      id = _submit(port.sendPort.nativePort, kind, dimensionPtr, textPtr, argPtr, count);
+    } finally {
+      calloc.free(argPtr);
+      calloc.free(dimensionPtr);
+      if (textPtr != nullptr) calloc.free(textPtr);
+    }
+
+    if (id < 0) {
+      return Future.error(WorldQueryException('Invalid query kind $kind'));
+    }
+    final completer = Completer<WorldQueryReply>();
+    _pending[id] = completer;
+    return completer.future;
+  }
+
+  static void _onReply(dynamic message) {
+    final reply = message as List;
+    final completer = _pending.remove(reply[0] as int);
+    if (completer == null) return;
+
+    final status = reply[1] as int;
+    if (status == _statusOk) {
+      completer.complete(WorldQueryReply(reply[2] as String?, reply[3] as Float64List));
+    } else {
+      completer.completeError(WorldQueryException(
+          status == _statusCancelled ? 'Query cancelled (server stopping)' : 'Query failed'));
+    }
+  }
+}
@@ -0,0 +1,115 @@
+/// Unit tests for the binary item component encoding.
+///
+/// Tests ItemComponentCodec round trips and the blob layout from
+/// item_components.h.
+import 'dart:typed_data';
+
+import 'package:dart_mod_server/src/item_components.dart';
+import 'package:test/test.dart';
+
+void main() {
+  group('ItemComponentCodec', () {
+    test('round-trips lore and namespaced enchantments', () {
+      final values = <ItemComponent, Object?>{
+        ItemComponent.lore: ['First line', 'Second line', 'Ünïcode line'],
+        ItemComponent.enchantments: {
+          'minecraft:sharpness': 5,
+          'minecraft:looting': 3,
+          'mymod:vampiric': 1,
+        },
+      };
+
+      final decoded = ItemComponentCodec.decode(ItemComponentCodec.encode(values));
+
+      expect(decoded[ItemComponent.lore], equals(values[ItemComponent.lore]));
+      expect(decoded[ItemComponent.enchantments], equals(values[ItemComponent.enchantments]));
+    });
+
+    test('round-trips scalar components and removals', () {
+      final values = <ItemComponent, Object?>{
+        ItemComponent.damage: 12,
+        ItemComponent.maxDamage: -1,
+        ItemComponent.customName: 'Excalibur',
+        ItemComponent.unbreakable: true,
+        ItemComponent.fireResistant: false,
+        ItemComponent.maxStackSize: null,
+      };
+
+      final decoded = ItemComponentCodec.decode(ItemComponentCodec.encode(values));
+
+      expect(decoded, equals(values));
+    });
+
+    test('encodes each int32 with its own value', () {
+      final blob = ItemComponentCodec.encode({
+        ItemComponent.enchantments: {'minecraft:sharpness': 5},
+      });
+      final view = ByteData.sublistView(blob);
+
+      // version, count, component, tag
+      expect(blob.sublist(0, 4), equals([1, 1, ItemComponent.enchantments.code, 5]));
+      expect(view.getUint32(4, Endian.little), equals(1)); // map count
+      expect(view.getUint32(8, Endian.little), equals('minecraft:sharpness'.length));
+      expect(view.getInt32(8 + 4 + 19, Endian.little), equals(5)); // level
+      expect(blob.length, equals(8 + 4 + 19 + 4));
+    });
+
+    test('rejects values of the wrong type', () {
+      expect(
+        () => ItemComponentCodec.encode({ItemComponent.lore: 'not a list'}),
+        throwsArgumentError,
+      );
+      expect(
+        () => ItemComponentCodec.encode({ItemComponent.enchantments: {'minecraft:sharpness': '5'}}),
+        throwsArgumentError,
+      );
+    });
+  });
+
+  group('ItemComponentCodec.readGrowing', () {
+    test('never starts below the minimum buffer size', () {
+      final capacities = <int>[];
+      final length = ItemComponentCodec.readGrowing(0, (capacity) {
+        capacities.add(capacity);
+        return 10;
+      });
+
+      expect(length, equals(10));
+      expect(capacities, equals([minComponentBufferSize]));
+    });
+
+    test('doubles the buffer until the blob fits', () {
+      final capacities = <int>[];
+      final length = ItemComponentCodec.readGrowing(minComponentBufferSize, (capacity) {
+        capacities.add(capacity);
+        return capacity < 5000 ? itemComponentsOverflow : 5000;
+      });
+
+      expect(length, equals(5000));
+      expect(capacities, equals([1024, 2048, 4096, 8192]));
+    });
+
+    test('gives up at the maximum buffer size', () {
+      var calls = 0;
+      final length = ItemComponentCodec.readGrowing(0, (capacity) {
+        calls++;
+        expect(capacity, lessThanOrEqualTo(maxComponentBufferSize));
+        return itemComponentsOverflow;
+      });
+
+      expect(length, equals(itemComponentsOverflow));
+      expect(calls, equals(15)); // 1 KiB .. 16 MiB
+    });
+
+    test('returns errors without retrying', () {
+      var calls = 0;
+      final length = ItemComponentCodec.readGrowing(0, (capacity) {
+        calls++;
+        return -1;
+      });
+
+      expect(length, equals(-1));
+      expect(calls, equals(1));
+    });
+  });
+}
@@ -54,6 +54,14 @@ public class DartBridgeClient {
     // Flag indicating if the client runtime is initialized (thread-safe)
     private static final AtomicBoolean clientInitialized = new AtomicBoolean(false);
 
+    // Lazy start: {assetsPath, icuDataPath, aotLibraryPath} recorded by
+    // configureLazyClientRuntime(), null when the engine starts eagerly
+    private static volatile String[] lazyClientConfig = null;
+    private static final AtomicBoolean clientPrespawnStarted = new AtomicBoolean(false);
+    private static volatile Thread clientPrespawnThread = null;
+    // Set once the client runtime has been shut down; it is never restarted
+    private static volatile boolean clientShutDown = false;
+
     // Cached container menu ID (updated on render thread, read from any thread)
     private static volatile int cachedContainerMenuId = -1;
 
@@ -79,6 +87,14 @@ public class DartBridgeClient {
     private static native boolean initClient(String assetsPath, String icuDataPath,
                                              String aotLibraryPath, boolean enableRendering);
 
+    /**
+     * Load the AOT snapshot and map the assets ahead of initClient().
+     * Does not start the engine, so it may run on a background thread.
+     *
+     * @return true if the startup data was loaded
+     */
+    private static native boolean prepareClient(String assetsPath, String icuDataPath, String aotLibraryPath);
+
     /**
      * Shutdown the Flutter client runtime and clean up resources.
      */
@@ -131,6 +147,42 @@ public class DartBridgeClient {
      */
     public static native void scheduleFrame();
 
+    /**
+     * Hibernate the client: release the Flutter texture/FBO and frame buffers,
+     * trim the engine's caches and stop producing frames. Reading frames,
+     * input, screen init or showing a HUD wakes it again. Render thread only.
+     */
+    public static native void hibernateClient();
+
+    /**
+     * Wake the client from hibernation (no-op if awake). Render thread only.
+     */
+    public static native void wakeClient();
+
+    /**
+     * Check if the client is hibernating.
+     */
+    public static native boolean isClientHibernating();
+
+    /**
+     * Set how long nothing may read Flutter frames before the client
+     * hibernates on its own (default 30000 ms, 0 disables).
+     */
+    public static native void setHibernateTimeout(int timeoutMs);
+
+    /**
+     * Configure dynamic resolution scaling: Flutter renders at between
+     * minScale and maxScale of the window resolution so that a frame costs
+     * the render thread at most budgetMs. The texture is upscaled when drawn;
+     * an idle overlay returns to maxScale. Render thread only.
+     */
+    public static native void setDynamicResolution(boolean enabled, double minScale, double maxScale, double budgetMs);
+
+    /**
+     * Current Flutter resolution scale (1.0 = native).
+     */
+    public static native double getResolutionScale();
+
     // ==========================================================================
     // Container Frame Ready Signal
     // ==========================================================================
@@ -440,6 +492,11 @@ public class DartBridgeClient {
                     LOGGER.info("Sending initial window metrics: {}x{}, scale={}", fbWidth, fbHeight, guiScale);
                     sendWindowMetrics(fbWidth, fbHeight, (double) guiScale);
                 }
+
+                // -DDYNAMIC_RESOLUTION=true: keep overlay frames within ~8ms
+                if ("true".equals(System.getProperty("DYNAMIC_RESOLUTION"))) {
+                    setDynamicResolution(true, 0.5, 1.0, 8.0);
+                }
             } else {
                 LOGGER.error("Flutter client runtime initialization returned false");
             }
@@ -450,11 +507,112 @@ public class DartBridgeClient {
         }
     }
 
+    /**
+     * Whether the client engine should start lazily (-DLAZY_CLIENT_ENGINE=true).
+     */
+    public static boolean isLazyClientStart() {
+        return "true".equals(System.getProperty("LAZY_CLIENT_ENGINE"));
+    }
+
+    /**
+     * Record the client runtime configuration without starting the engine.
+     *
+     * The engine is then started by prespawnClientRuntime() after world join,
+     * or synchronously by ensureClientRuntime() on the first screen, HUD or
+     * server packet that needs it - whichever comes first. Players who never
+     * see Dart UI never pay for the engine.
+     */
+    public static void configureLazyClientRuntime(String assetsPath, String icuDataPath, String aotLibraryPath) {
+        lazyClientConfig = new String[] {
+            assetsPath,
+            icuDataPath,
+            aotLibraryPath != null ? aotLibraryPath : ""
+        };
+        LOGGER.info("Flutter client runtime configured for lazy start");
+    }
+
+    /**
+     * Pre-spawn the lazily configured engine (call after world join).
+     *
+     * The AOT snapshot and assets load on a background thread; the engine
+     * itself must run on the render thread, so it is started there once
+     * loading finishes. No-op if already started or not in lazy mode.
+     */
+    public static void prespawnClientRuntime() {
+        String[] config = lazyClientConfig;
+        if (config == null || clientInitialized.get() || !clientPrespawnStarted.compareAndSet(false, true)) {
+            return;
+        }
+
+        Thread prespawn = new Thread(() -> {
+            try {
+                DartBridge.applyThreadRole(DartBridge.THREAD_ROLE_BRIDGE_BACKGROUND);
+                if (!prepareClient(config[0], config[1], config[2])) {
+                    LOGGER.warn("Flutter client startup data could not be prepared; engine will load it on start");
+                }
+            } catch (Exception e) {
+                LOGGER.error("Exception preparing Flutter client runtime: {}", e.getMessage());
+            }
+            if (!clientShutDown) {
+                Minecraft.getInstance().execute(DartBridgeClient::ensureClientRuntime);
+            }
+        }, "Flutter-Client-Prespawn");
+        prespawn.setDaemon(true);
+        clientPrespawnThread = prespawn;
+        prespawn.start();
+    }
+
+    /**
+     * Make sure the client runtime is running, starting a lazily configured
+     * engine synchronously if needed. Must be called on the render thread.
+     *
+     * The first frame after a synchronous start is gated like any other
+     * through the screen/container frame-ready signals.
+     *
+     * @return true if the client runtime is initialized
+     */
+    public static boolean ensureClientRuntime() {
+        if (clientInitialized.get()) return true;
+        String[] config = lazyClientConfig;
+        if (config == null || clientShutDown) return false;
+
+        long start = System.nanoTime();
+        boolean success = safeInitClientRuntime(config[0], config[1], config[2]);
+        if (success) {
+            lazyClientConfig = null;
+            LOGGER.info("Flutter client runtime started lazily in {}ms", (System.nanoTime() - start) / 1_000_000.0);
+        }
+        return success;
+    }
+
     /**
      * Shutdown the Flutter client runtime and clean up resources.
      */
     public static void safeShutdownClientRuntime() {
-        if (!clientInitialized.get()) return;
+        // A queued ensureClientRuntime() must not start the engine afterwards
+        clientShutDown = true;
+        lazyClientConfig = null;
+
+        if (!clientInitialized.get()) {
+            // Lazy start: release startup data prepared for an engine that never
+            // ran, once the prespawn thread is done preparing it
+            if (clientPrespawnStarted.get()) {
+                Thread prespawn = clientPrespawnThread;
+                if (prespawn != null) {
+                    try {
+                        prespawn.join();
+                    } catch (InterruptedException e) {
+                        Thread.currentThread().interrupt();
+                    }
+                }
+                try {
+                    shutdownClient();
+                } catch (Exception e) {
+                    LOGGER.error("Exception during client runtime shutdown: {}", e.getMessage());
+                }
+            }
+            return;
+        }
 
         try {
             shutdownClient();
@@ -592,6 +750,18 @@ public class DartBridgeClient {
      */
     public static void dispatchServerPacket(int packetType, byte[] data) {
         if (!clientInitialized.get()) {
+            if (lazyClientConfig != null) {
+                // Client Dart code handles this packet: start the engine for it
+                Minecraft mc = Minecraft.getInstance();
+                if (!mc.isSameThread()) {
+                    mc.execute(() -> dispatchServerPacket(packetType, data));
+                    return;
+                }
+                if (ensureClientRuntime()) {
+                    dispatchServerPacket(packetType, data);
+                    return;
+                }
+            }
             LOGGER.warn("Cannot dispatch server packet: Client runtime not initialized");
             return;
         }
@@ -1093,9 +1263,26 @@ public class DartBridgeClient {
         if (activeHudOverlays.remove(overlayId)) {
             LOGGER.info("Hiding HUD overlay: {}", overlayId);
             dispatchHudHideNative(overlayId);
+            hibernateIfNothingShown();
         }
     }
 
+    /**
+     * Hibernate the client once no Flutter screen or HUD overlay is shown.
+     * Checked on the next task so a screen replacing a closing one counts.
+     */
+    public static void hibernateIfNothingShown() {
+        if (!clientInitialized.get()) return;
+        Minecraft mc = Minecraft.getInstance();
+        mc.execute(() -> {
+            if (clientInitialized.get()
+                && activeHudOverlays.isEmpty()
+                && !(mc.screen instanceof com.redstone.flutter.FlutterScreen)) {
+                hibernateClient();
+            }
+        });
+    }
+
     /**
      * Toggle a HUD overlay.
      * @param overlayId The overlay identifier
@@ -361,6 +361,8 @@ public class DartModClientLoader implements ClientModInitializer {
             client.execute(() -> {
                 DartBridgeClient.onClientReady();
             });
+            // Lazy mode: start the client engine in the background now
+            DartBridgeClient.prespawnClientRuntime();
         });
 
         LOGGER.info("[DartModClientLoader] Client tick and ready events registered!");
@@ -720,6 +722,14 @@ public class DartModClientLoader implements ClientModInitializer {
             return;
         }
 
+        // Lazy mode: record the configuration; the engine starts after world
+        // join or on the first screen/HUD/packet that needs it
+        if (DartBridgeClient.isLazyClientStart()) {
+            DartBridgeClient.configureLazyClientRuntime(assetsPath, icuDataPath, aotLibraryPath);
+            registerClientPacketHandlers();
+            return;
+        }
+
         // Initialize Flutter client runtime
         boolean initResult = DartBridgeClient.safeInitClientRuntime(assetsPath, icuDataPath, aotLibraryPath);
 
@@ -65,6 +65,8 @@ public class FlutterContainerScreen<T extends AbstractContainerMenu> extends Flu
         long checkpointTime = initStartTime;
 
         super.init();
+        // Lazy start: the first container screen starts the engine
+        DartBridgeClient.ensureClientRuntime();
         long superInitTime = System.nanoTime();
         LOGGER.info("[PERF] FlutterContainerScreen.super.init() took {}ms", (superInitTime - checkpointTime) / 1_000_000.0);
         checkpointTime = superInitTime;
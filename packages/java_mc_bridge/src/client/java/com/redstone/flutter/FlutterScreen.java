@@ -1019,7 +1019,8 @@ public class FlutterScreen extends Screen {
 
         // In dual-runtime mode, Flutter is initialized separately by DartModClientLoader.
         // Check the client runtime, not the server runtime.
-        flutterInitialized = DartBridgeClient.isClientInitialized();
+        // Starts the engine here if it is configured for lazy start.
+        flutterInitialized = DartBridgeClient.ensureClientRuntime();
 
         LOGGER.info("[FlutterScreen] init() - Flutter client initialized: {}", flutterInitialized);
 
@@ -1550,6 +1551,11 @@ public class FlutterScreen extends Screen {
 
         // Clean up texture
         cleanupTexture();
+
+        // Release Flutter frame memory if nothing else shows Flutter UI
+        if (flutterInitialized) {
+            DartBridgeClient.hibernateIfNothingShown();
+        }
     }
 
     @Override
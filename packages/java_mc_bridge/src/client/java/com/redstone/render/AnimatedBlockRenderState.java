@@ -56,6 +56,9 @@ public class AnimatedBlockRenderState extends BlockEntityRenderState {
     // Handler ID for the Dart-side block entity
     public int handlerId;
 
+    // Slot in this frame's AnimationBatch, or -1 to use the values above
+    public int animationSlot = -1;
+
     // Block ID for looking up element animation info (e.g., "mymod:animated_chest")
     public String blockId;
 }
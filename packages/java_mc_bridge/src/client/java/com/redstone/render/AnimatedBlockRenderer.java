@@ -38,6 +38,7 @@ import net.minecraft.util.Mth;
 import net.minecraft.util.RandomSource;
 import net.minecraft.world.level.block.state.BlockState;
 import net.minecraft.world.phys.Vec3;
+import org.joml.Matrix4f;
 import org.joml.Vector3f;
 import org.joml.Vector3fc;
 import org.jspecify.annotations.Nullable;
@@ -134,6 +135,14 @@ public class AnimatedBlockRenderer implements BlockEntityRenderer<AnimatedBlockE
         // Store handler ID for potential future use
         state.handlerId = entity.getHandlerId();
 
+        // Compiled spin/bob/pulse tracks are evaluated natively for the whole frame.
+        // The time matches the lerp between the previous and current tick values,
+        // offset per block position.
+        state.animationSlot = AnimationBatch.hasTrack(state.handlerId)
+            ? AnimationBatch.add(state.handlerId, (entity.getTickCount() - 1 + partialTick) / 20.0f,
+                AnimationBatch.posSeed(entity.getBlockPos().asLong()))
+            : -1;
+
         // Store block ID for element animation info lookup
         if (entity.getBlockState() != null) {
             state.blockId = BuiltInRegistries.BLOCK.getKey(entity.getBlockState().getBlock()).toString();
@@ -164,9 +173,13 @@ public class AnimatedBlockRenderer implements BlockEntityRenderer<AnimatedBlockE
             elementInfo = AnimationRegistry.getElementAnimationInfo(state.blockId);
         }
 
+        Matrix4f batchTransform = loadBatchTransform(state);
+
         // For per-element animation, DON'T apply transforms to poseStack here
         // Instead, transforms are applied only to animated elements inside renderBlockModel()
-        if (elementInfo == null) {
+        if (elementInfo == null && batchTransform != null) {
+            poseStack.mulPose(batchTransform);
+        } else if (elementInfo == null) {
             // No per-element animation: apply transforms to entire model (legacy behavior)
             float rotX = Mth.lerp(state.partialTick, state.oRotationX, state.rotationX);
             float rotY = Mth.lerp(state.partialTick, state.oRotationY, state.rotationY);
@@ -207,11 +220,23 @@ public class AnimatedBlockRenderer implements BlockEntityRenderer<AnimatedBlockE
         // renderBlockModel() will handle applying transforms only to animated parts
 
         // Render the block model
-        renderBlockModel(state, poseStack, submitNodeCollector);
+        renderBlockModel(state, poseStack, submitNodeCollector, batchTransform);
 
         poseStack.popPose();
     }
 
+    /**
+     * Get this instance's transform from the frame's native animation batch.
+     *
+     * @return the transform, or null if the block is animated from its render state values
+     */
+    @Nullable
+    private static Matrix4f loadBatchTransform(AnimatedBlockRenderState state) {
+        if (state.animationSlot < 0) return null;
+        Matrix4f transform = new Matrix4f();
+        return AnimationBatch.load(state.animationSlot, transform) ? transform : null;
+    }
+
     /**
      * Directions used for quad rendering (matches Minecraft's DIRECTIONS array).
      */
@@ -230,7 +255,8 @@ public class AnimatedBlockRenderer implements BlockEntityRenderer<AnimatedBlockE
     private void renderBlockModel(
         AnimatedBlockRenderState state,
         PoseStack poseStack,
-        SubmitNodeCollector submitNodeCollector
+        SubmitNodeCollector submitNodeCollector,
+        @Nullable Matrix4f batchTransform
     ) {
         Minecraft minecraft = Minecraft.getInstance();
         BlockRenderDispatcher blockRenderer = minecraft.getBlockRenderer();
@@ -283,9 +309,13 @@ public class AnimatedBlockRenderer implements BlockEntityRenderer<AnimatedBlockE
                 poseStack,
                 renderType,
                 (pose, vertexConsumer) -> {
-                    applyAnimationTransforms(pose, finalTransX, finalTransY, finalTransZ,
-                        finalRotX, finalRotY, finalRotZ, finalScaleX, finalScaleY, finalScaleZ,
-                        pivX, pivY, pivZ);
+                    if (batchTransform != null) {
+                        pose.mulPose(batchTransform);
+                    } else {
+                        applyAnimationTransforms(pose, finalTransX, finalTransY, finalTransZ,
+                            finalRotX, finalRotY, finalRotZ, finalScaleX, finalScaleY, finalScaleZ,
+                            pivX, pivY, pivZ);
+                    }
                     renderAllParts(pose, vertexConsumer, staticParts, r, g, b,
                         state.lightCoords, OverlayTexture.NO_OVERLAY);
                 }
@@ -313,9 +343,13 @@ public class AnimatedBlockRenderer implements BlockEntityRenderer<AnimatedBlockE
                     poseStack,
                     renderType,
                     (pose, vertexConsumer) -> {
-                        applyAnimationTransforms(pose, finalTransX, finalTransY, finalTransZ,
-                            finalRotX, finalRotY, finalRotZ, finalScaleX, finalScaleY, finalScaleZ,
-                            pivX, pivY, pivZ);
+                        if (batchTransform != null) {
+                            pose.mulPose(batchTransform);
+                        } else {
+                            applyAnimationTransforms(pose, finalTransX, finalTransY, finalTransZ,
+                                finalRotX, finalRotY, finalRotZ, finalScaleX, finalScaleY, finalScaleZ,
+                                pivX, pivY, pivZ);
+                        }
                         renderBakedAnimatedModel(pose, vertexConsumer, animatedModel, r, g, b,
                             state.lightCoords, OverlayTexture.NO_OVERLAY);
                     }
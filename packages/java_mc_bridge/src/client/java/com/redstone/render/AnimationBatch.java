@@ -0,0 +1,137 @@
+package com.redstone.render;
+
+import com.redstone.DartBridge;
+import net.fabricmc.api.EnvType;
+import net.fabricmc.api.Environment;
+import net.minecraft.util.Mth;
+import org.joml.Matrix4f;
+import org.slf4j.Logger;
+import org.slf4j.LoggerFactory;
+
+import java.util.Arrays;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+
+/**
+ * Per-frame batch of animated block instances evaluated natively in one call.
+ *
+ * Block entity render states are all extracted before any of them is
+ * submitted. AnimatedBlockRenderer adds each instance with a compiled
+ * animation track while extracting. The first submit of the frame then
+ * evaluates the whole batch, grouped by handler ID, through
+ * {@link DartBridge#evaluateAnimationTracks}. The next extract starts a new
+ * batch. Everything runs on the render thread.
+ */
+@Environment(EnvType.CLIENT)
+public final class AnimationBatch {
+    private static final Logger LOGGER = LoggerFactory.getLogger("AnimationBatch");
+    private static final int MATRIX_FLOATS = 16;
+
+    /** Handler ID -> whether it has a compiled track (registrations are fixed after startup). */
+    private static final Map<Integer, Boolean> compiledTracks = new ConcurrentHashMap<>();
+    private static boolean nativeAvailable = true;
+
+    private static int[] handlerIds = new int[256];
+    private static float[] times = new float[256];
+    private static float[] seeds = new float[256];
+    private static long[] sortKeys = new long[256];
+    private static int[] sortedIds = new int[256];
+    private static float[] sortedTimes = new float[256];
+    private static float[] sortedSeeds = new float[256];
+    private static int[] sortedIndex = new int[256];
+    private static float[] matrices = new float[256 * MATRIX_FLOATS];
+    private static int count = 0;
+    private static boolean evaluated = false;
+
+    private AnimationBatch() {}
+
+    /**
+     * Whether instances of this block handler can use the batched path.
+     */
+    public static boolean hasTrack(int handlerId) {
+        if (!nativeAvailable) return false;
+        try {
+            return compiledTracks.computeIfAbsent(handlerId, DartBridge::hasCompiledAnimation);
+        } catch (UnsatisfiedLinkError e) {
+            LOGGER.warn("Native animation tracks unavailable, using Java animation transforms");
+            nativeAvailable = false;
+            return false;
+        }
+    }
+
+    /**
+     * Per-block time offset in [0, 1) seconds, so neighbouring blocks with the
+     * same animation do not move in lockstep.
+     *
+     * @param packedPos {@code BlockPos.asLong()}
+     */
+    public static float posSeed(long packedPos) {
+        return (Mth.murmurHash3Mixer(packedPos) >>> 40) / (float) (1 << 24);
+    }
+
+    /**
+     * Add an instance to the current frame's batch.
+     *
+     * @param time animation time in seconds
+     * @param posSeed time offset in seconds, see {@link #posSeed}
+     * @return the slot to pass to {@link #load}
+     */
+    public static int add(int handlerId, float time, float posSeed) {
+        if (evaluated) {
+            count = 0;
+            evaluated = false;
+        }
+        if (count == handlerIds.length) grow(count * 2);
+        handlerIds[count] = handlerId;
+        times[count] = time;
+        seeds[count] = posSeed;
+        return count++;
+    }
+
+    /**
+     * Copy a slot's transform into dest, evaluating the batch on first use.
+     *
+     * @return false if the slot is not part of the evaluated batch
+     */
+    public static boolean load(int slot, Matrix4f dest) {
+        if (!evaluated) evaluate();
+        if (slot < 0 || slot >= count) return false;
+        dest.set(matrices, sortedIndex[slot] * MATRIX_FLOATS);
+        return true;
+    }
+
+    private static void evaluate() {
+        evaluated = true;
+        if (count == 0) return;
+
+        // Sort by handler so each native run shares one track
+        for (int i = 0; i < count; i++) {
+            sortKeys[i] = ((long) handlerIds[i] << 32) | i;
+        }
+        Arrays.sort(sortKeys, 0, count);
+        for (int i = 0; i < count; i++) {
+            int slot = (int) sortKeys[i];
+            sortedIds[i] = handlerIds[slot];
+            sortedTimes[i] = times[slot];
+            sortedSeeds[i] = seeds[slot];
+            sortedIndex[slot] = i;
+        }
+
+        if (DartBridge.evaluateAnimationTracks(sortedIds, sortedTimes, sortedSeeds, count, matrices) < 0) {
+            LOGGER.warn("Animation batch of {} instances was rejected", count);
+            count = 0;
+        }
+    }
+
+    private static void grow(int capacity) {
+        handlerIds = Arrays.copyOf(handlerIds, capacity);
+        times = Arrays.copyOf(times, capacity);
+        seeds = Arrays.copyOf(seeds, capacity);
+        sortKeys = new long[capacity];
+        sortedIds = new int[capacity];
+        sortedTimes = new float[capacity];
+        sortedSeeds = new float[capacity];
+        sortedIndex = new int[capacity];
+        matrices = new float[capacity * MATRIX_FLOATS];
+    }
+}
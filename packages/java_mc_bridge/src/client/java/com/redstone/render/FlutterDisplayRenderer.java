@@ -274,6 +274,8 @@ public class FlutterDisplayRenderer extends DisplayRenderer<
     private Identifier getFlutterTexture(long surfaceId) {
         // Check if Flutter client is initialized
         if (!DartBridgeClient.isClientInitialized()) {
+            // Lazy start: kick off the engine outside of the render pass
+            DartBridgeClient.prespawnClientRuntime();
             return PLACEHOLDER_TEXTURE;
         }
 
@@ -40,6 +40,7 @@ import net.minecraft.world.entity.EquipmentSlot;
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
 import java.io.File;
+import java.nio.ByteBuffer;
 import java.util.ArrayList;
 import java.util.HashMap;
 import java.util.List;
@@ -61,6 +62,7 @@ import net.minecraft.world.item.component.ItemLore;
 import net.minecraft.world.item.enchantment.ItemEnchantments;
 import net.minecraft.tags.DamageTypeTags;
 
+import com.redstone.util.ItemComponentCodec;
 import com.redstone.util.ItemStackSerializer;
 
 /**
@@ -163,7 +165,34 @@ public class DartBridge {
      */
     private static native void tickServer();
 
-    private static native int onBlockBreak(int x, int y, int z, long playerId);
+    /**
+     * Mark the start of a server tick. The background pump only drains the
+     * isolate between ticks.
+     */
+    private static native void beginServerTick();
+
+    // Thread roles - see thread_roles.h. Policies come from REDSTONE_THREAD_ROLES
+    // or configureThreadRole(); niceValue is -20..19 or NICE_UNSET.
+    public static final int THREAD_ROLE_SERVER_TICK = 0;
+    public static final int THREAD_ROLE_RENDER = 1;
+    public static final int THREAD_ROLE_DART_WORKER = 2;
+    public static final int THREAD_ROLE_FLUTTER_RASTER = 3;
+    public static final int THREAD_ROLE_BRIDGE_BACKGROUND = 4;
+    public static final int NICE_UNSET = Integer.MIN_VALUE;
+
+    public static native boolean applyThreadRole(int role);
+    public static native boolean configureThreadRole(int role, int niceValue, long affinityMask);
+
+    // Native event filters - see event_filter.h. Callers only build the id
+    // strings an event filter needs while one is set for the event.
+    public static final int EVENT_FILTER_BLOCK_BREAK = 0;
+    public static final int EVENT_FILTER_ITEM_USE = 1;
+    public static final int EVENT_FILTER_ENTITY_DAMAGE = 2;
+    public static final int EVENT_FILTER_PLAYER_PICKUP_ITEM = 3;
+
+    public static native boolean isEventFilterActive(int event);
+
+    private static native int onBlockBreak(int x, int y, int z, long playerId, String blockId, String dimension);
     private static native int onBlockInteract(int x, int y, int z, long playerId, int hand);
     private static native void onTick(long tick);
     private static native void setSendChatCallback();
@@ -252,6 +281,60 @@ public class DartBridge {
     public static native void onBlockEntityContainerOpen(int handlerId, long blockPosHash);
     public static native void onBlockEntityContainerClose(int handlerId, long blockPosHash);
 
+    // Chunk-batched block entity natives - called by BlockEntityChunkBatch.
+    // Entry i of data spans [offsets[i], offsets[i + 1]) as UTF-8 JSON.
+    public static native void onBlockEntityLoadChunk(int[] handlerIds, long[] blockPosHashes, byte[] data, int[] offsets);
+    public static native byte[] onBlockEntitySaveChunk(int[] handlerIds, long[] blockPosHashes, int[] outOffsets);
+
+    // Chunk snapshot natives - called by ChunkSnapshotService.
+    // Snapshots are published into native memory and read by Dart off-thread.
+    public static native int getChunkSnapshotWorldId(String dimension);
+    // Returns (worldId, chunkX, chunkZ, mode) tuples, or null if nothing is pending
+    public static native int[] pollChunkSnapshotRequests();
+    // paletteSizes has one entry per section from minSectionY up; indices holds
+    // 4096 entries for each section whose palette size is greater than 1
+    public static native void publishChunkSnapshot(int worldId, int chunkX, int chunkZ, int minSectionY,
+                                                   int[] paletteSizes, int[] palettes, short[] indices,
+                                                   short[] heightmaps, int heightmapTypes);
+    public static native void evictChunkSnapshot(int worldId, int chunkX, int chunkZ);
+
+    // Async world query natives - called by WorldQueryService.
+    // Returns [ids(long[]), kinds(int[]), dimensions(String[]), texts(String[]), args(double[])]
+    // with 8 args per query, or null if nothing is pending
+    public static native Object[] pollWorldQueries(int maxQueries);
+    // Values of query i span [valueOffsets[i], valueOffsets[i + 1]); texts entries may be null
+    public static native void completeWorldQueries(long[] ids, int[] statuses, String[] texts,
+                                                   double[] values, int[] valueOffsets);
+
+    // Server isolate heap/GC statistics - see DartHeapStats.
+    // Returns null if the server runtime is not running
+    public static native long[] getServerHeapStats();
+    // Log a warning when a single GC pause exceeds this many milliseconds (0 disables)
+    public static native void setGcPauseWarningMs(double thresholdMs);
+
+    // Drain the server isolate on a background thread as soon as the VM posts
+    // a message between ticks, instead of once per tick. Async Dart code then runs off the
+    // server thread. Returns false if the server runtime is not running.
+    public static native boolean setServerBackgroundPump(boolean enabled);
+    // Returns [ticksDrained, ticksSkipped, backgroundDrains]
+    public static native long[] getServerPumpStats();
+
+    // Outbound S2C packet queue natives - called by OutboundPacketSender.
+    public static native void setOutboundQueueEnabled(boolean enabled);
+    public static native void setOutboundQueueLimits(long tickBudgetBytes, long maxQueuedBytes);
+    public static native boolean waitOutboundPackets(int timeoutMs);
+    // Returns [playerIds(int[]), types(int[]), offsets(int[]), data(byte[])] where packet i
+    // spans data[offsets[i], offsets[i + 1]), or null if nothing is sendable
+    public static native Object[] pollOutboundPackets(int maxBytes);
+    public static native long[] getOutboundQueueStats(int playerId);
+
+    // Chunk data store natives - called by ChunkDataService.
+    public static native void setChunkDataRoot(String path);
+    public static native void onChunkDataLoad(int worldId, int chunkX, int chunkZ);
+    public static native void onChunkDataUnload(int worldId, int chunkX, int chunkZ);
+    // Returns the number of pages written
+    public static native int flushChunkData();
+
     // Item proxy native methods - called by DartItemProxy
     public static native boolean onProxyItemAttackEntity(long handlerId, int worldId, int attackerId, int targetId);
     public static native int onProxyItemUse(long handlerId, long worldId, int playerId, int hand);
@@ -259,7 +342,8 @@ public class DartBridge {
     public static native int onProxyItemUseOnEntity(long handlerId, long worldId, int entityId, int playerId, int hand);
 
     // Command system native methods - called by CommandRegistry
-    public static native int onCommandExecute(long commandId, int playerId, String argsJson);
+    // args is a direct buffer in the command_args.h layout, see CommandArgsWriter
+    public static native int onCommandExecute(long commandId, int playerId, ByteBuffer args, int argsLength);
 
     // Registry ready signal - tells Dart it's safe to register items/blocks
     public static native void signalRegistryReady();
@@ -420,6 +504,25 @@ public class DartBridge {
      */
     public static native Object[] getNextAnimationRegistration();
 
+    /**
+     * Check if a block handler's animation (spin, bob, pulse or combined) was
+     * compiled into a native track at registration.
+     */
+    public static native boolean hasCompiledAnimation(int handlerId);
+
+    /**
+     * Evaluate compiled animation tracks for a batch of block instances.
+     * Writes one column-major 4x4 matrix (16 floats) per instance into
+     * outMatrices; instances without a track get the identity. Group instances
+     * by handler ID for the fastest path.
+     *
+     * @param times animation time of each instance in seconds
+     * @param posSeeds per-instance time offsets in seconds, or null
+     * @return number of instances with a compiled track, or -1 if an array is too short
+     */
+    public static native int evaluateAnimationTracks(int[] handlerIds, float[] times, float[] posSeeds,
+                                                     int count, float[] outMatrices);
+
     /**
      * Check if there are pending ore feature registrations in the queue.
      */
@@ -518,6 +621,9 @@ public class DartBridge {
             initialized = initServer(scriptPath, packageConfigPath != null ? packageConfigPath : "", servicePort);
             if (initialized) {
                 LOGGER.info("Server Dart runtime initialized successfully");
+                if ("true".equals(System.getProperty("DART_BACKGROUND_PUMP"))) {
+                    setServerBackgroundPump(true);
+                }
             } else {
                 LOGGER.error("Server Dart runtime initialization returned false");
             }
@@ -543,6 +649,19 @@ public class DartBridge {
         }
     }
 
+    /**
+     * Mark the start of a server tick - should be called at the start of
+     * each server tick. Package-private to keep it out of the Dart bindings.
+     */
+    static void safeBeginServerTick() {
+        if (!initialized) return;
+        try {
+            beginServerTick();
+        } catch (Exception e) {
+            LOGGER.error("Exception during server tick start: {}", e.getMessage());
+        }
+    }
+
     /**
      * Tick the server runtime - processes async Dart tasks.
      * Should be called each server tick.
@@ -587,13 +706,15 @@ public class DartBridge {
 
     /**
      * Dispatch a block break event to Dart handlers.
+     * The block and dimension IDs are checked against the native event filter;
+     * both may be null when no filter is set (see isEventFilterActive).
      *
      * @return 1 to allow the break, 0 to cancel
      */
-    public static int dispatchBlockBreak(int x, int y, int z, long playerId) {
+    public static int dispatchBlockBreak(int x, int y, int z, long playerId, String blockId, String dimension) {
         if (!initialized) return 1;
         try {
-            return onBlockBreak(x, y, z, playerId);
+            return onBlockBreak(x, y, z, playerId, blockId, dimension);
         } catch (Exception e) {
             LOGGER.error("Exception during block break dispatch: {}", e.getMessage());
             return 1;
@@ -646,16 +767,19 @@ public class DartBridge {
     private static native void onPlayerChangeDimension(int playerId, String fromDimension, String toDimension);
     private static native void onEntityChangeDimension(int entityId, String fromDimension, String toDimension);
     private static native String onPlayerDeath(int playerId, String damageSource);
-    private static native boolean onEntityDamage(int entityId, String damageSource, double amount);
+    private static native boolean onEntityDamage(int entityId, String damageSource, double amount,
+                                                 String entityType, String dimension, int x, int y, int z);
     private static native void onEntityDeath(int entityId, String damageSource);
     private static native boolean onPlayerAttackEntity(int playerId, int targetId);
     private static native String onPlayerChat(int playerId, String message);
     private static native boolean onPlayerCommand(int playerId, String command);
-    private static native boolean onItemUse(int playerId, String itemId, int count, int hand);
+    private static native boolean onItemUse(int playerId, String itemId, int count, int hand,
+                                            String dimension, int x, int y, int z);
     private static native int onItemUseOnBlock(int playerId, String itemId, int count, int hand, int x, int y, int z, int face);
     private static native int onItemUseOnEntity(int playerId, String itemId, int count, int hand, int targetId);
     private static native boolean onBlockPlace(int playerId, int x, int y, int z, String blockId);
-    private static native boolean onPlayerPickupItem(int playerId, int itemEntityId);
+    private static native boolean onPlayerPickupItem(int playerId, int itemEntityId,
+                                                     String itemId, String dimension, int x, int y, int z);
     private static native boolean onPlayerDropItem(int playerId, String itemId, int count);
     private static native void onServerStarting();
     private static native void onServerStarted();
@@ -741,12 +865,14 @@ public class DartBridge {
 
     /**
      * Dispatch an entity damage event to Dart handlers.
+     * The entity type, dimension and position are checked against the native event filter.
      * @return true to allow damage, false to cancel
      */
-    public static boolean dispatchEntityDamage(int entityId, String damageSource, double amount) {
+    public static boolean dispatchEntityDamage(int entityId, String damageSource, double amount,
+                                               String entityType, String dimension, int x, int y, int z) {
         if (!initialized) return true;
         try {
-            return onEntityDamage(entityId, damageSource, amount);
+            return onEntityDamage(entityId, damageSource, amount, entityType, dimension, x, y, z);
         } catch (Exception e) {
             LOGGER.error("Exception during entity damage dispatch: {}", e.getMessage());
             return true;
@@ -809,12 +935,14 @@ public class DartBridge {
 
     /**
      * Dispatch an item use event to Dart handlers.
+     * The item, dimension and player position are checked against the native event filter.
      * @return true to allow use, false to cancel
      */
-    public static boolean dispatchItemUse(int playerId, String itemId, int count, int hand) {
+    public static boolean dispatchItemUse(int playerId, String itemId, int count, int hand,
+                                          String dimension, int x, int y, int z) {
         if (!initialized) return true;
         try {
-            return onItemUse(playerId, itemId, count, hand);
+            return onItemUse(playerId, itemId, count, hand, dimension, x, y, z);
         } catch (Exception e) {
             LOGGER.error("Exception during item use dispatch: {}", e.getMessage());
             return true;
@@ -865,12 +993,14 @@ public class DartBridge {
 
     /**
      * Dispatch a player pickup item event to Dart handlers.
+     * The item, dimension and player position are checked against the native event filter.
      * @return true to allow pickup, false to cancel
      */
-    public static boolean dispatchPlayerPickupItem(int playerId, int itemEntityId) {
+    public static boolean dispatchPlayerPickupItem(int playerId, int itemEntityId,
+                                                   String itemId, String dimension, int x, int y, int z) {
         if (!initialized) return true;
         try {
-            return onPlayerPickupItem(playerId, itemEntityId);
+            return onPlayerPickupItem(playerId, itemEntityId, itemId, dimension, x, y, z);
         } catch (Exception e) {
             LOGGER.error("Exception during player pickup item dispatch: {}", e.getMessage());
             return true;
@@ -4556,6 +4686,24 @@ public class DartBridge {
         setItemEnchantmentsFromJson(stack, enchantmentsJson);
     }
 
+    /**
+     * Encode the requested components into a native buffer (item_components.h).
+     * Called from native code through the upcall table.
+     */
+    public static int readItemComponents(long handle, ByteBuffer request, ByteBuffer out) {
+        return ItemComponentCodec.read(getItemStackFromHandle(handle), request, out);
+    }
+
+    /**
+     * Apply an encoded component blob from a native buffer (item_components.h).
+     * Called from native code through the upcall table.
+     */
+    public static boolean writeItemComponents(long handle, ByteBuffer data) {
+        ItemStack stack = getItemStackFromHandle(handle);
+        if (stack.isEmpty()) return false;
+        return ItemComponentCodec.write(stack, data, serverInstance != null ? serverInstance.registryAccess() : null);
+    }
+
     // ==========================================================================
     // Helper Methods for Component Serialization
     // ==========================================================================
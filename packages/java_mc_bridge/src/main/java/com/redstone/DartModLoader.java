@@ -3,6 +3,7 @@ package com.redstone;
 import net.fabricmc.api.EnvType;
 import net.fabricmc.api.ModInitializer;
 import net.fabricmc.fabric.api.command.v2.CommandRegistrationCallback;
+import net.fabricmc.fabric.api.event.lifecycle.v1.ServerChunkEvents;
 import net.fabricmc.fabric.api.event.lifecycle.v1.ServerLifecycleEvents;
 import net.fabricmc.fabric.api.event.lifecycle.v1.ServerTickEvents;
 import net.fabricmc.fabric.api.event.player.AttackEntityCallback;
@@ -11,6 +12,7 @@ import net.fabricmc.fabric.api.event.player.UseBlockCallback;
 import net.fabricmc.fabric.api.event.player.UseEntityCallback;
 import net.fabricmc.fabric.api.event.player.UseItemCallback;
 import net.fabricmc.fabric.api.entity.event.v1.ServerEntityWorldChangeEvents;
+import net.fabricmc.fabric.api.entity.event.v1.ServerLivingEntityEvents;
 import net.fabricmc.fabric.api.networking.v1.ServerPlayConnectionEvents;
 import net.fabricmc.loader.api.FabricLoader;
 import com.mojang.brigadier.arguments.FloatArgumentType;
@@ -27,9 +29,14 @@ import net.minecraft.world.InteractionResult;
 import net.minecraft.world.InteractionHand;
 import net.minecraft.world.entity.LivingEntity;
 import net.minecraft.world.item.ItemStack;
+import com.redstone.blockentity.BlockEntityChunkBatch;
+import com.redstone.world.ChunkDataService;
+import com.redstone.world.ChunkSnapshotService;
+import com.redstone.world.WorldQueryService;
 import com.redstone.entity.FlutterDisplayEntityTypes;
 import com.redstone.proxy.DartBlockProxy;
 import com.redstone.proxy.RecipeRegistry;
+import com.redstone.network.OutboundPacketSender;
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
 
@@ -501,6 +508,7 @@ public class DartModLoader implements ModInitializer {
         ServerLifecycleEvents.SERVER_STOPPED.register(server -> {
             LOGGER.info("[{}] Server stopped, shutting down server Dart runtime...", MOD_ID);
             DartBridge.safeShutdownServerRuntime();
+            ChunkSnapshotService.clear();
             DartBridge.setServerInstance(null);
             serverInstance = null;
         });
@@ -546,6 +554,7 @@ public class DartModLoader implements ModInitializer {
 
             // Dispatch to Dart
             if (DartBridge.isInitialized()) {
+                OutboundPacketSender.onPlayerJoin(player);
                 DartBridge.dispatchPlayerJoin(player.getId());
 
                 // Send welcome message
@@ -574,6 +583,7 @@ public class DartModLoader implements ModInitializer {
 
         // Player leave event
         ServerPlayConnectionEvents.DISCONNECT.register((handler, server) -> {
+            OutboundPacketSender.onPlayerLeave(handler.getPlayer().getId());
             if (DartBridge.isInitialized()) {
                 DartBridge.dispatchPlayerLeave(handler.getPlayer().getId());
             }
@@ -597,16 +607,42 @@ public class DartModLoader implements ModInitializer {
             }
         });
 
+        // Keep the background pump (if enabled) out of the tick
+        ServerTickEvents.START_SERVER_TICK.register(server -> DartBridge.safeBeginServerTick());
+
         // Register tick event - process server Dart async tasks and dispatch tick
         ServerTickEvents.END_SERVER_TICK.register(server -> {
             if (DartBridge.isInitialized()) {
+                // Answer queued async world queries so their results are
+                // delivered when the runtime drains its queue below
+                WorldQueryService.tick(server);
                 // First tick the server runtime to process pending async tasks
                 DartBridge.safeTickServer();
+                // Flush block entities loaded this tick that were not touched yet
+                BlockEntityChunkBatch.flushAll();
+                // Publish requested and dirty chunk snapshots for off-thread readers
+                ChunkSnapshotService.tick(server);
                 // Then dispatch the tick event to Dart handlers
                 DartBridge.dispatchTick(tickCounter++);
             }
         });
 
+        // Make per-chunk Dart data available while a chunk is loaded
+        ServerChunkEvents.CHUNK_LOAD.register((world, chunk) -> {
+            ChunkDataService.onChunkLoad(world, chunk);
+        });
+
+        // Drop chunk snapshots and write back chunk data when a chunk unloads
+        ServerChunkEvents.CHUNK_UNLOAD.register((world, chunk) -> {
+            ChunkSnapshotService.onChunkUnload(world, chunk);
+            ChunkDataService.onChunkUnload(world, chunk);
+        });
+
+        // Flush dirty chunk data pages with the world
+        ServerLifecycleEvents.AFTER_SAVE.register((server, flush, force) -> {
+            ChunkDataService.onSave();
+        });
+
         // Register block break event
         PlayerBlockBreakEvents.BEFORE.register((world, player, pos, state, blockEntity) -> {
             if (!DartBridge.isInitialized()) return true;
@@ -625,12 +661,16 @@ public class DartModLoader implements ModInitializer {
                 return allowBreak;
             }
 
-            // For non-proxy blocks, use the generic dispatch
+            // For non-proxy blocks, use the generic dispatch. The ids are only
+            // needed by a native event filter.
+            boolean filtered = DartBridge.isEventFilterActive(DartBridge.EVENT_FILTER_BLOCK_BREAK);
             int result = DartBridge.dispatchBlockBreak(
                 pos.getX(),
                 pos.getY(),
                 pos.getZ(),
-                player.getId()
+                player.getId(),
+                filtered ? BuiltInRegistries.BLOCK.getKey(state.getBlock()).toString() : null,
+                filtered ? world.dimension().identifier().toString() : null
             );
 
             // Return true to allow break, false to cancel
@@ -675,6 +715,25 @@ public class DartModLoader implements ModInitializer {
             return allow ? InteractionResult.PASS : InteractionResult.FAIL;
         });
 
+        // Register entity damage event. The entity type and dimension are only
+        // needed by a native event filter.
+        ServerLivingEntityEvents.ALLOW_DAMAGE.register((entity, source, amount) -> {
+            if (!DartBridge.isInitialized()) return true;
+
+            boolean filtered = DartBridge.isEventFilterActive(DartBridge.EVENT_FILTER_ENTITY_DAMAGE);
+            var entityPos = entity.blockPosition();
+            return DartBridge.dispatchEntityDamage(
+                entity.getId(),
+                source.getMsgId(),
+                amount,
+                filtered ? BuiltInRegistries.ENTITY_TYPE.getKey(entity.getType()).toString() : null,
+                filtered ? entity.level().dimension().identifier().toString() : null,
+                entityPos.getX(),
+                entityPos.getY(),
+                entityPos.getZ()
+            );
+        });
+
         // Register item use event (right-click with item in air)
         UseItemCallback.EVENT.register((player, world, hand) -> {
             if (!DartBridge.isInitialized()) return InteractionResult.PASS;
@@ -685,7 +744,9 @@ public class DartModLoader implements ModInitializer {
             String itemId = BuiltInRegistries.ITEM.getKey(stack.getItem()).toString();
             int handValue = (hand == InteractionHand.MAIN_HAND) ? 0 : 1;
 
-            boolean allow = DartBridge.dispatchItemUse(player.getId(), itemId, stack.getCount(), handValue);
+            var playerPos = player.blockPosition();
+            boolean allow = DartBridge.dispatchItemUse(player.getId(), itemId, stack.getCount(), handValue,
+                world.dimension().identifier().toString(), playerPos.getX(), playerPos.getY(), playerPos.getZ());
             if (allow) {
                 return InteractionResult.PASS;
             } else {
@@ -707,6 +768,8 @@ public class DartModLoader implements ModInitializer {
 
         // Register server lifecycle events
         ServerLifecycleEvents.SERVER_STARTING.register(server -> {
+            // Chunk data lives in the world folder; set before any chunk loads
+            ChunkDataService.onServerStarting(server);
             if (DartBridge.isInitialized()) {
                 DartBridge.dispatchServerStarting();
             }
@@ -714,6 +777,8 @@ public class DartModLoader implements ModInitializer {
 
         ServerLifecycleEvents.SERVER_STARTED.register(server -> {
             if (DartBridge.isInitialized()) {
+                // Send Dart's S2C packets from a dedicated thread
+                OutboundPacketSender.start();
                 DartBridge.dispatchServerStarted();
             }
 
@@ -745,6 +810,7 @@ public class DartModLoader implements ModInitializer {
             if (DartBridge.isInitialized()) {
                 DartBridge.dispatchServerStopping();
             }
+            OutboundPacketSender.stop();
         });
 
         LOGGER.info("[{}] Dart Bridge mod initialized!", MOD_ID);
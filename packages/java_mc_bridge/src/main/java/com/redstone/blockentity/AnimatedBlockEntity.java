@@ -553,6 +553,10 @@ public class AnimatedBlockEntity extends BlockEntity {
         super.setLevel(level);
 
         // Notify Dart that this block entity was added to a level
+        // Blocks loaded from a chunk are batched with the rest of the chunk.
+        if (BlockEntityChunkBatch.deferSetLevel(this, level)) {
+            return;
+        }
         if (DartBridge.isInitialized()) {
             try {
                 DartBridge.onBlockEntitySetLevel(handlerId, blockPosHash);
@@ -571,6 +575,12 @@ public class AnimatedBlockEntity extends BlockEntity {
         ValueInput animStateInput = valueInput.childOrEmpty("AnimState");
         loadAnimationStateFromInput(animStateInput);
 
+        // Detached block entities come from chunk loading - batch them per chunk
+        if (this.level == null) {
+            BlockEntityChunkBatch.queueLoad(this, handlerId, blockPosHash, "{}");
+            return;
+        }
+
         // Notify Dart that this block entity was loaded
         if (DartBridge.isInitialized()) {
             try {
@@ -678,6 +688,7 @@ public class AnimatedBlockEntity extends BlockEntity {
     @Override
     public void setRemoved() {
         super.setRemoved();
+        BlockEntityChunkBatch.flush(this);
 
         // Notify Dart that this block entity was removed
         if (DartBridge.isInitialized()) {
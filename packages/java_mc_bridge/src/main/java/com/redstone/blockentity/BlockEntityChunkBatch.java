@@ -0,0 +1,337 @@
+package com.redstone.blockentity;
+
+import com.redstone.DartBridge;
+import net.minecraft.core.BlockPos;
+import net.minecraft.core.SectionPos;
+import net.minecraft.world.level.Level;
+import net.minecraft.world.level.block.entity.BlockEntity;
+import net.minecraft.world.level.chunk.LevelChunk;
+import org.slf4j.Logger;
+import org.slf4j.LoggerFactory;
+
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.Iterator;
+import java.util.List;
+import java.util.Map;
+import java.util.WeakHashMap;
+
+/**
+ * Batches Dart block entity load/save calls per chunk.
+ *
+ * Loading or saving a chunk with many Dart block entities used to cost one
+ * isolate entry (and one JNI string round trip) per entity. This class
+ * collects them so each chunk is handled with a single native call:
+ *
+ * - Load: block entities deserialized while detached from a level (the
+ *   chunk-load path) are queued in loadAdditional and their setLevel is
+ *   deferred. The chunk is flushed lazily before any other Dart dispatch
+ *   for one of its entities, and at the end of every server tick.
+ * - Save: the first saveAdditional of a chunk save saves every Dart block
+ *   entity in that chunk at once; the remaining entities pick up their
+ *   cached result. A cached result is dropped when its entity changes
+ *   (setChanged), before any other Dart dispatch for it, and at the end of
+ *   the server tick.
+ */
+public final class BlockEntityChunkBatch {
+    private static final Logger LOGGER = LoggerFactory.getLogger("BlockEntityChunkBatch");
+
+    private BlockEntityChunkBatch() {}
+
+    /** A block entity waiting for its load + setLevel dispatch. */
+    private static final class PendingLoad {
+        final BlockEntity blockEntity;
+        final int handlerId;
+        final long blockPosHash;
+        final byte[] data;
+        boolean levelSet;
+
+        PendingLoad(BlockEntity blockEntity, int handlerId, long blockPosHash, byte[] data) {
+            this.blockEntity = blockEntity;
+            this.handlerId = handlerId;
+            this.blockPosHash = blockPosHash;
+            this.data = data;
+        }
+    }
+
+    private static final Object LOCK = new Object();
+    private static final Map<Long, List<PendingLoad>> pendingByChunk = new HashMap<>();
+    private static final Map<BlockEntity, PendingLoad> pendingByEntity = new WeakHashMap<>();
+    private static final Map<BlockEntity, String> savedByEntity = new WeakHashMap<>();
+
+    private static long chunkKey(BlockPos pos) {
+        long chunkX = pos.getX() >> 4;
+        long chunkZ = pos.getZ() >> 4;
+        return (chunkX & 0xFFFFFFFFL) | ((chunkZ & 0xFFFFFFFFL) << 32);
+    }
+
+    // ========================================================================
+    // Load batching
+    // ========================================================================
+
+    /**
+     * Queue a load for a block entity that is not attached to a level yet.
+     * The Dart load and setLevel calls are deferred until its chunk is flushed.
+     */
+    public static void queueLoad(BlockEntity blockEntity, int handlerId, long blockPosHash, String nbtJson) {
+        PendingLoad pending = new PendingLoad(blockEntity, handlerId, blockPosHash,
+            nbtJson.getBytes(StandardCharsets.UTF_8));
+        synchronized (LOCK) {
+            PendingLoad previous = pendingByEntity.put(blockEntity, pending);
+            List<PendingLoad> chunk = pendingByChunk.computeIfAbsent(chunkKey(blockEntity.getBlockPos()), k -> new ArrayList<>());
+            if (previous != null) {
+                chunk.remove(previous);
+            }
+            chunk.add(pending);
+        }
+    }
+
+    /**
+     * Mark a queued block entity as added to a level.
+     *
+     * @return true if the block entity has a queued load and its setLevel
+     *         dispatch will be batched with the chunk; false if the caller
+     *         should dispatch setLevel itself.
+     */
+    public static boolean deferSetLevel(BlockEntity blockEntity, Level level) {
+        PendingLoad pending;
+        synchronized (LOCK) {
+            pending = pendingByEntity.get(blockEntity);
+            if (pending == null) {
+                return false;
+            }
+            if (!level.isClientSide()) {
+                pending.levelSet = true;
+                return true;
+            }
+            // Client levels are not batched - dispatch this entity on its own
+            removePending(pending);
+        }
+        dispatchSingle(pending, true);
+        return true;
+    }
+
+    /**
+     * Flush the chunk of this block entity if it still has a queued load.
+     * Called before any other Dart dispatch for the block entity so Dart
+     * never sees a tick/save/removal before the load.
+     */
+    public static void flush(BlockEntity blockEntity) {
+        List<PendingLoad> batch;
+        synchronized (LOCK) {
+            // Dart may change the entity during the dispatch that follows
+            if (!savedByEntity.isEmpty()) {
+                savedByEntity.remove(blockEntity);
+            }
+            if (pendingByEntity.isEmpty() || !pendingByEntity.containsKey(blockEntity)) {
+                return;
+            }
+            batch = takeChunk(chunkKey(blockEntity.getBlockPos()));
+        }
+        dispatchBatch(batch);
+    }
+
+    /**
+     * Flush every queued chunk and drop cached save results. Called at the
+     * end of each server tick. Block entities that were never added to a
+     * level only receive their load.
+     */
+    public static void flushAll() {
+        List<List<PendingLoad>> batches = new ArrayList<>();
+        synchronized (LOCK) {
+            savedByEntity.clear();
+            if (pendingByChunk.isEmpty()) {
+                return;
+            }
+            Iterator<List<PendingLoad>> it = pendingByChunk.values().iterator();
+            while (it.hasNext()) {
+                List<PendingLoad> chunk = it.next();
+                for (PendingLoad pending : chunk) {
+                    pendingByEntity.remove(pending.blockEntity);
+                }
+                batches.add(chunk);
+                it.remove();
+            }
+        }
+        for (List<PendingLoad> batch : batches) {
+            dispatchBatch(batch);
+        }
+    }
+
+    private static List<PendingLoad> takeChunk(long key) {
+        List<PendingLoad> chunk = pendingByChunk.remove(key);
+        if (chunk == null) {
+            return List.of();
+        }
+        for (PendingLoad pending : chunk) {
+            pendingByEntity.remove(pending.blockEntity);
+        }
+        return chunk;
+    }
+
+    private static void removePending(PendingLoad pending) {
+        pendingByEntity.remove(pending.blockEntity);
+        long key = chunkKey(pending.blockEntity.getBlockPos());
+        List<PendingLoad> chunk = pendingByChunk.get(key);
+        if (chunk != null) {
+            chunk.remove(pending);
+            if (chunk.isEmpty()) {
+                pendingByChunk.remove(key);
+            }
+        }
+    }
+
+    private static void dispatchBatch(List<PendingLoad> batch) {
+        if (batch.isEmpty() || !DartBridge.isInitialized()) {
+            return;
+        }
+
+        // Entities never added to a level must not receive setLevel
+        List<PendingLoad> placed = new ArrayList<>(batch.size());
+        for (PendingLoad pending : batch) {
+            if (pending.levelSet) {
+                placed.add(pending);
+            } else {
+                dispatchSingle(pending, false);
+            }
+        }
+        if (placed.isEmpty()) {
+            return;
+        }
+
+        int count = placed.size();
+        int[] handlerIds = new int[count];
+        long[] posHashes = new long[count];
+        int[] offsets = new int[count + 1];
+        int total = 0;
+        for (int i = 0; i < count; i++) {
+            PendingLoad pending = placed.get(i);
+            handlerIds[i] = pending.handlerId;
+            posHashes[i] = pending.blockPosHash;
+            offsets[i] = total;
+            total += pending.data.length;
+        }
+        offsets[count] = total;
+
+        byte[] data = new byte[total];
+        for (int i = 0; i < count; i++) {
+            byte[] entry = placed.get(i).data;
+            System.arraycopy(entry, 0, data, offsets[i], entry.length);
+        }
+
+        try {
+            DartBridge.onBlockEntityLoadChunk(handlerIds, posHashes, data, offsets);
+        } catch (Exception e) {
+            LOGGER.error("Error notifying Dart of block entity chunk load: {}", e.getMessage());
+        }
+    }
+
+    private static void dispatchSingle(PendingLoad pending, boolean setLevel) {
+        if (!DartBridge.isInitialized()) {
+            return;
+        }
+        try {
+            if (pending.data.length > 0) {
+                DartBridge.onBlockEntityLoad(pending.handlerId, pending.blockPosHash,
+                    new String(pending.data, StandardCharsets.UTF_8));
+            }
+            if (setLevel) {
+                DartBridge.onBlockEntitySetLevel(pending.handlerId, pending.blockPosHash);
+            }
+        } catch (Exception e) {
+            LOGGER.error("Error notifying Dart of block entity load: {}", e.getMessage());
+        }
+    }
+
+    // ========================================================================
+    // Save batching
+    // ========================================================================
+
+    /**
+     * Drop the cached save result of a block entity. Called from setChanged.
+     */
+    public static void invalidateSaved(BlockEntity blockEntity) {
+        synchronized (LOCK) {
+            if (!savedByEntity.isEmpty()) {
+                savedByEntity.remove(blockEntity);
+            }
+        }
+    }
+
+    /**
+     * Get the saved Dart data for a block entity, saving its whole chunk in
+     * one native call when the chunk holds more than one Dart block entity.
+     *
+     * @return the JSON data, or null if the caller should flush and save on
+     *         its own
+     */
+    public static String saveWithChunk(DartBlockEntity blockEntity) {
+        Level level = blockEntity.getLevel();
+        if (level == null || level.isClientSide() || !DartBridge.isInitialized()) {
+            return null;
+        }
+
+        synchronized (LOCK) {
+            String cached = savedByEntity.remove(blockEntity);
+            if (cached != null) {
+                return cached;
+            }
+        }
+
+        // Never load a chunk from here: saves also run while chunks unload.
+        // A chunk that is no longer reachable is saved one entity at a time.
+        BlockPos pos = blockEntity.getBlockPos();
+        LevelChunk chunk = level.getChunkSource().getChunkNow(
+            SectionPos.blockToSectionCoord(pos.getX()), SectionPos.blockToSectionCoord(pos.getZ()));
+        if (chunk == null) {
+            return null;
+        }
+
+        List<DartBlockEntity> entities = new ArrayList<>();
+        for (BlockEntity be : chunk.getBlockEntities().values()) {
+            if (be instanceof DartBlockEntity dartBe && !dartBe.isRemoved()) {
+                entities.add(dartBe);
+            }
+        }
+        if (entities.size() < 2 || !entities.contains(blockEntity)) {
+            return null;
+        }
+
+        int count = entities.size();
+        int[] handlerIds = new int[count];
+        long[] posHashes = new long[count];
+        int[] offsets = new int[count + 1];
+        for (int i = 0; i < count; i++) {
+            DartBlockEntity be = entities.get(i);
+            flush(be);
+            handlerIds[i] = be.getHandlerId();
+            posHashes[i] = be.getBlockPosHash();
+        }
+
+        byte[] data;
+        try {
+            data = DartBridge.onBlockEntitySaveChunk(handlerIds, posHashes, offsets);
+        } catch (Exception e) {
+            LOGGER.error("Error getting block entity chunk data from Dart: {}", e.getMessage());
+            return null;
+        }
+        if (data == null) {
+            return null;
+        }
+
+        String result = null;
+        synchronized (LOCK) {
+            for (int i = 0; i < count; i++) {
+                String json = new String(data, offsets[i], offsets[i + 1] - offsets[i], StandardCharsets.UTF_8);
+                DartBlockEntity be = entities.get(i);
+                if (be == blockEntity) {
+                    result = json;
+                } else {
+                    savedByEntity.put(be, json);
+                }
+            }
+        }
+        return result;
+    }
+}
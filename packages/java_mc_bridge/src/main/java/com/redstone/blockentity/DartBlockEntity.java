@@ -45,6 +45,10 @@ public class DartBlockEntity extends BlockEntity {
 
         // Notify Dart that this block entity was added to a level.
         // This is called for both newly placed blocks and blocks loaded from save.
+        // Blocks loaded from a chunk are batched with the rest of the chunk.
+        if (BlockEntityChunkBatch.deferSetLevel(this, level)) {
+            return;
+        }
         if (DartBridge.isInitialized()) {
             try {
                 DartBridge.onBlockEntitySetLevel(handlerId, blockPosHash);
@@ -94,6 +98,12 @@ public class DartBlockEntity extends BlockEntity {
         // Load custom data from NBT
         this.customDataJson = valueInput.getStringOr("DartData", "{}");
 
+        // Detached block entities come from chunk loading - batch them per chunk
+        if (this.level == null) {
+            BlockEntityChunkBatch.queueLoad(this, handlerId, blockPosHash, customDataJson);
+            return;
+        }
+
         // Notify Dart that this block entity was loaded
         if (DartBridge.isInitialized()) {
             try {
@@ -108,10 +118,14 @@ public class DartBlockEntity extends BlockEntity {
     protected void saveAdditional(ValueOutput valueOutput) {
         super.saveAdditional(valueOutput);
 
-        // Get custom data from Dart before saving
+        // Get custom data from Dart before saving (batched per chunk when possible)
         if (DartBridge.isInitialized()) {
             try {
-                String dartData = DartBridge.onBlockEntitySave(handlerId, blockPosHash);
+                String dartData = BlockEntityChunkBatch.saveWithChunk(this);
+                if (dartData == null) {
+                    BlockEntityChunkBatch.flush(this);
+                    dartData = DartBridge.onBlockEntitySave(handlerId, blockPosHash);
+                }
                 if (dartData != null && !dartData.isEmpty()) {
                     this.customDataJson = dartData;
                 }
@@ -124,6 +138,12 @@ public class DartBlockEntity extends BlockEntity {
         valueOutput.putString("DartData", customDataJson);
     }
 
+    @Override
+    public void setChanged() {
+        super.setChanged();
+        BlockEntityChunkBatch.invalidateSaved(this);
+    }
+
     @Override
     public CompoundTag getUpdateTag(HolderLookup.Provider registries) {
         // Include custom data in the update tag for client sync
@@ -141,6 +161,7 @@ public class DartBlockEntity extends BlockEntity {
     @Override
     public void setRemoved() {
         super.setRemoved();
+        BlockEntityChunkBatch.flush(this);
 
         // Notify Dart that this block entity was removed
         if (DartBridge.isInitialized()) {
@@ -73,6 +73,7 @@ public class DartBlockEntityWithInventory extends AnimatedBlockEntity implements
             public int get(int index) {
                 if (DartBridge.isInitialized()) {
                     try {
+                        BlockEntityChunkBatch.flush(DartBlockEntityWithInventory.this);
                         return DartBridge.getBlockEntityDataSlot(
                             DartBlockEntityWithInventory.this.handlerId,
                             DartBlockEntityWithInventory.this.blockPosHash,
@@ -88,6 +89,7 @@ public class DartBlockEntityWithInventory extends AnimatedBlockEntity implements
             public void set(int index, int value) {
                 if (DartBridge.isInitialized()) {
                     try {
+                        BlockEntityChunkBatch.flush(DartBlockEntityWithInventory.this);
                         DartBridge.setBlockEntityDataSlot(
                             DartBlockEntityWithInventory.this.handlerId,
                             DartBlockEntityWithInventory.this.blockPosHash,
@@ -178,6 +180,7 @@ public class DartBlockEntityWithInventory extends AnimatedBlockEntity implements
             if (!this.isRemoved() && !player.isSpectator()) {
                 if (DartBridge.isInitialized()) {
                     try {
+                        BlockEntityChunkBatch.flush(this);
                         DartBridge.onBlockEntityContainerOpen(handlerId, blockPosHash);
                     } catch (Exception e) {
                         LOGGER.error("Error notifying Dart of container open: {}", e.getMessage());
@@ -303,6 +306,7 @@ public class DartBlockEntityWithInventory extends AnimatedBlockEntity implements
 
         if (DartBridge.isInitialized()) {
             try {
+                BlockEntityChunkBatch.flush(blockEntity);
                 DartBridge.onBlockEntityTick(blockEntity.handlerId, blockEntity.blockPosHash);
             } catch (Exception e) {
                 LOGGER.error("Error during block entity tick: {}", e.getMessage());
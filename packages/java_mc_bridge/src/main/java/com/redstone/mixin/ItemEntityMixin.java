@@ -0,0 +1,41 @@
+package com.redstone.mixin;
+
+import com.redstone.DartBridge;
+import net.minecraft.core.registries.BuiltInRegistries;
+import net.minecraft.world.entity.item.ItemEntity;
+import net.minecraft.world.entity.player.Player;
+import org.spongepowered.asm.mixin.Mixin;
+import org.spongepowered.asm.mixin.injection.At;
+import org.spongepowered.asm.mixin.injection.Inject;
+import org.spongepowered.asm.mixin.injection.callback.CallbackInfo;
+
+/**
+ * Mixin to dispatch player item pickups to Dart.
+ *
+ * Fabric has no pickup event, so the touch is intercepted before the item is
+ * added to the player's inventory. Cancelling leaves the item on the ground.
+ */
+@Mixin(ItemEntity.class)
+public abstract class ItemEntityMixin {
+
+    @Inject(method = "playerTouch", at = @At("HEAD"), cancellable = true, require = 0)
+    private void redstone$dispatchPickup(Player player, CallbackInfo ci) {
+        ItemEntity item = (ItemEntity) (Object) this;
+        // Touches during the pickup delay never pick the item up
+        if (item.level().isClientSide() || item.hasPickUpDelay() || !DartBridge.isInitialized()) return;
+
+        // The item id and dimension are only needed by a native event filter
+        boolean filtered = DartBridge.isEventFilterActive(DartBridge.EVENT_FILTER_PLAYER_PICKUP_ITEM);
+        var playerPos = player.blockPosition();
+        boolean allow = DartBridge.dispatchPlayerPickupItem(
+            player.getId(),
+            item.getId(),
+            filtered ? BuiltInRegistries.ITEM.getKey(item.getItem().getItem()).toString() : null,
+            filtered ? item.level().dimension().identifier().toString() : null,
+            playerPos.getX(),
+            playerPos.getY(),
+            playerPos.getZ()
+        );
+        if (!allow) ci.cancel();
+    }
+}
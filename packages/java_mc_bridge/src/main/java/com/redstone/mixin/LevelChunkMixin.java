@@ -0,0 +1,26 @@
+package com.redstone.mixin;
+
+import com.redstone.world.ChunkSnapshotService;
+import net.minecraft.world.level.block.state.BlockState;
+import net.minecraft.world.level.chunk.LevelChunk;
+import org.spongepowered.asm.mixin.Mixin;
+import org.spongepowered.asm.mixin.injection.At;
+import org.spongepowered.asm.mixin.injection.Inject;
+import org.spongepowered.asm.mixin.injection.callback.CallbackInfoReturnable;
+
+/**
+ * Mixin to mark watched chunk snapshots dirty when a block changes.
+ *
+ * ChunkSnapshotService republishes dirty watched chunks on the next tick.
+ */
+@Mixin(LevelChunk.class)
+public abstract class LevelChunkMixin {
+
+    @Inject(method = "setBlockState", at = @At("RETURN"), require = 0)
+    private void redstone$markSnapshotDirty(CallbackInfoReturnable<BlockState> cir) {
+        // A null return means the state did not change
+        if (cir.getReturnValue() == null || !ChunkSnapshotService.hasWatchedChunks()) return;
+        LevelChunk chunk = (LevelChunk) (Object) this;
+        ChunkSnapshotService.markDirty(chunk.getLevel(), chunk.getPos());
+    }
+}
@@ -104,12 +104,14 @@ public class C2SPacketHandler {
         public static final int SCREEN_DATA = 0x03;
         public static final int SYNC_STATE = 0x04;
         public static final int SERVER_EVENT = 0x05;
+        public static final int SCHEMA_S2C = 0x7F;
 
         // Client-to-Server (C2S): 0x80 - 0xFF
         public static final int UI_ACTION = 0x80;
         public static final int REQUEST_DATA = 0x81;
         public static final int CLIENT_EVENT = 0x82;
         public static final int CONTAINER_DATA_UPDATE = 0x83;
+        public static final int SCHEMA_C2S = 0xFF;
 
         public static boolean isS2C(int typeId) {
             return typeId >= 0x00 && typeId < 0x80;
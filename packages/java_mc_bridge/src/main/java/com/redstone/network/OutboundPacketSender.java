@@ -0,0 +1,138 @@
+package com.redstone.network;
+
+import com.redstone.DartBridge;
+import net.minecraft.server.level.ServerPlayer;
+import org.slf4j.Logger;
+import org.slf4j.LoggerFactory;
+
+import java.util.Arrays;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+
+/**
+ * Sends S2C packets queued by Dart from a dedicated thread.
+ *
+ * Dart queues packets natively with a priority class (control, gameplay,
+ * bulk) instead of calling into Java on the server thread. This thread waits
+ * on the native queue and hands each batch to the network layer, so a burst
+ * of large packets no longer stalls the tick. Per-tick byte budgets, drop and
+ * merge policies live in outbound_queue.cpp.
+ *
+ * Set -DDART_SYNC_PACKETS=true to keep sending synchronously.
+ */
+public final class OutboundPacketSender {
+    private static final Logger LOGGER = LoggerFactory.getLogger("OutboundPacketSender");
+
+    /** Must match OUTBOUND_PRIORITY_* in outbound_queue.h. */
+    public static final int PRIORITY_CONTROL = 0;
+    public static final int PRIORITY_GAMEPLAY = 1;
+    public static final int PRIORITY_BULK = 2;
+
+    /** Indices into DartBridge.getOutboundQueueStats(). */
+    public static final int STAT_QUEUED_PACKETS = 0;
+    public static final int STAT_QUEUED_BYTES = 1;
+    public static final int STAT_SENT_PACKETS = 2;
+    public static final int STAT_SENT_BYTES = 3;
+    public static final int STAT_DROPPED_PACKETS = 4;
+    public static final int STAT_DROPPED_BYTES = 5;
+    public static final int STAT_MERGED_PACKETS = 6;
+
+    private static final long TICK_BUDGET_BYTES = 256 * 1024;
+    private static final long MAX_QUEUED_BYTES = 4 * 1024 * 1024;
+    /** Upper bound on bytes taken per native call. */
+    private static final int MAX_BATCH_BYTES = 512 * 1024;
+    private static final int WAIT_TIMEOUT_MS = 100;
+
+    /** Connected players by entity ID; ServerPlayer lookups off the server thread go through here. */
+    private static final Map<Integer, ServerPlayer> players = new ConcurrentHashMap<>();
+    private static volatile Thread senderThread;
+    private static volatile boolean running = false;
+
+    private OutboundPacketSender() {}
+
+    /**
+     * Enable the native queue and start the sender thread. Called once the server has started.
+     */
+    public static synchronized void start() {
+        if (running || "true".equals(System.getProperty("DART_SYNC_PACKETS"))) return;
+
+        try {
+            DartBridge.setOutboundQueueLimits(TICK_BUDGET_BYTES, MAX_QUEUED_BYTES);
+            DartBridge.setOutboundQueueEnabled(true);
+        } catch (UnsatisfiedLinkError e) {
+            LOGGER.warn("Outbound packet queue unavailable: {}", e.getMessage());
+            return;
+        }
+
+        running = true;
+        Thread thread = new Thread(OutboundPacketSender::run, "Dart-Packet-Sender");
+        thread.setDaemon(true);
+        senderThread = thread;
+        thread.start();
+    }
+
+    /**
+     * Disable the queue (discarding unsent packets) and stop the sender thread.
+     */
+    public static synchronized void stop() {
+        if (!running) return;
+        running = false;
+        DartBridge.setOutboundQueueEnabled(false);
+
+        Thread thread = senderThread;
+        senderThread = null;
+        if (thread != null) {
+            try {
+                thread.join(1000);
+            } catch (InterruptedException e) {
+                Thread.currentThread().interrupt();
+            }
+        }
+        players.clear();
+    }
+
+    public static void onPlayerJoin(ServerPlayer player) {
+        players.put(player.getId(), player);
+    }
+
+    public static void onPlayerLeave(int playerId) {
+        players.remove(playerId);
+    }
+
+    /**
+     * Queue counters for a player, or totals across all players for playerId < 0.
+     * Indexed by the STAT_* constants.
+     */
+    public static long[] getStats(int playerId) {
+        return DartBridge.getOutboundQueueStats(playerId);
+    }
+
+    private static void run() {
+        DartBridge.applyThreadRole(DartBridge.THREAD_ROLE_BRIDGE_BACKGROUND);
+        while (running) {
+            try {
+                if (!DartBridge.waitOutboundPackets(WAIT_TIMEOUT_MS)) continue;
+                Object[] batch;
+                while (running && (batch = DartBridge.pollOutboundPackets(MAX_BATCH_BYTES)) != null) {
+                    send(batch);
+                }
+            } catch (Exception e) {
+                LOGGER.error("Error sending queued packets: {}", e.getMessage());
+            }
+        }
+    }
+
+    private static void send(Object[] batch) {
+        int[] playerIds = (int[]) batch[0];
+        int[] types = (int[]) batch[1];
+        int[] offsets = (int[]) batch[2];
+        byte[] data = (byte[]) batch[3];
+
+        for (int i = 0; i < playerIds.length; i++) {
+            ServerPlayer player = players.get(playerIds[i]);
+            if (player == null) continue;  // Disconnected after the packet was queued
+            byte[] payload = Arrays.copyOfRange(data, offsets[i], offsets[i + 1]);
+            S2CPacketHandler.sendToPlayer(player, types[i], payload);
+        }
+    }
+}
@@ -0,0 +1,108 @@
+package com.redstone.proxy;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.StandardCharsets;
+
+/**
+ * Encodes parsed command arguments into the bridge's binary argument buffer
+ * (layout in native command_args.h). The buffer is direct, so the native side
+ * and Dart read it in place.
+ *
+ * One writer is reused per thread. Dart decodes the buffer before running the
+ * command, so a command that runs another command on the same thread can
+ * safely reuse it.
+ */
+final class CommandArgsWriter {
+    // Must match command_args.h
+    static final byte VERSION = 1;
+    static final byte TAG_INT = 1;
+    static final byte TAG_DOUBLE = 2;
+    static final byte TAG_BOOL = 3;
+    static final byte TAG_STRING = 4;
+    static final byte TAG_ENTITY = 5;
+    static final byte TAG_BLOCK_POS = 6;
+
+    private static final int HEADER_SIZE = 2;
+    private static final int MAX_ARGUMENTS = 255;
+    private static final ThreadLocal<CommandArgsWriter> WRITERS = ThreadLocal.withInitial(CommandArgsWriter::new);
+
+    private ByteBuffer buffer = allocate(256);
+    private int count;
+
+    private CommandArgsWriter() {}
+
+    /**
+     * Get this thread's writer, reset to an empty argument list.
+     */
+    static CommandArgsWriter begin() {
+        CommandArgsWriter writer = WRITERS.get();
+        writer.buffer.clear();
+        writer.buffer.put(VERSION).put((byte) 0);
+        writer.count = 0;
+        return writer;
+    }
+
+    void putInt(int index, int value) {
+        header(index, TAG_INT, 4);
+        buffer.putInt(value);
+    }
+
+    void putDouble(int index, double value) {
+        header(index, TAG_DOUBLE, 8);
+        buffer.putDouble(value);
+    }
+
+    void putBool(int index, boolean value) {
+        header(index, TAG_BOOL, 1);
+        buffer.put(value ? (byte) 1 : (byte) 0);
+    }
+
+    void putString(int index, String value) {
+        byte[] bytes = value.getBytes(StandardCharsets.UTF_8);
+        header(index, TAG_STRING, 4 + bytes.length);
+        buffer.putInt(bytes.length).put(bytes);
+    }
+
+    void putEntity(int index, int entityId) {
+        header(index, TAG_ENTITY, 4);
+        buffer.putInt(entityId);
+    }
+
+    void putBlockPos(int index, int x, int y, int z) {
+        header(index, TAG_BLOCK_POS, 12);
+        buffer.putInt(x).putInt(y).putInt(z);
+    }
+
+    /** The encoded buffer; valid until the next {@link #begin()} on this thread. */
+    ByteBuffer buffer() {
+        buffer.put(1, (byte) count);
+        return buffer;
+    }
+
+    /** Encoded length in bytes. */
+    int length() {
+        return buffer.position();
+    }
+
+    private void header(int index, byte tag, int payloadSize) {
+        if (index < 0 || index > MAX_ARGUMENTS || count == MAX_ARGUMENTS) {
+            throw new IllegalArgumentException("Too many command arguments");
+        }
+        ensureCapacity(2 + payloadSize);
+        buffer.put((byte) index).put(tag);
+        count++;
+    }
+
+    private void ensureCapacity(int bytes) {
+        if (buffer.remaining() >= bytes) return;
+        ByteBuffer grown = allocate(Math.max(buffer.capacity() * 2, buffer.position() + bytes));
+        buffer.flip();
+        grown.put(buffer);
+        buffer = grown;
+    }
+
+    private static ByteBuffer allocate(int capacity) {
+        return ByteBuffer.allocateDirect(Math.max(capacity, HEADER_SIZE)).order(ByteOrder.LITTLE_ENDIAN);
+    }
+}
@@ -2,7 +2,6 @@ package com.redstone.proxy;
 
 import com.google.gson.Gson;
 import com.google.gson.JsonArray;
-import com.google.gson.JsonElement;
 import com.google.gson.JsonObject;
 import com.mojang.brigadier.CommandDispatcher;
 import com.mojang.brigadier.arguments.*;
@@ -226,20 +225,18 @@ public class CommandRegistry {
             ServerPlayer player = source.getPlayer();
             int playerId = player != null ? player.getId() : 0;
 
-            // Collect arguments
-            JsonObject argsJson = new JsonObject();
+            // Encode arguments by their index in the command definition
+            CommandArgsWriter args = CommandArgsWriter.begin();
             CommandDef cmd = commands.get(commandId);
             if (cmd != null && cmd.arguments() != null) {
-                for (JsonElement elem : cmd.arguments()) {
-                    JsonObject argDef = elem.getAsJsonObject();
+                JsonArray argDefs = cmd.arguments();
+                for (int i = 0; i < argDefs.size(); i++) {
+                    JsonObject argDef = argDefs.get(i).getAsJsonObject();
                     String argName = argDef.get("name").getAsString();
                     String argType = argDef.get("type").getAsString();
 
                     try {
-                        Object value = getArgumentValue(context, argName, argType);
-                        if (value != null) {
-                            argsJson.addProperty(argName, value.toString());
-                        }
+                        writeArgument(context, args, i, argName, argType);
                     } catch (IllegalArgumentException e) {
                         // Argument not provided (optional)
                     }
@@ -247,7 +244,7 @@ public class CommandRegistry {
             }
 
             // Dispatch to Dart via native bridge
-            return DartBridge.onCommandExecute(commandId, playerId, GSON.toJson(argsJson));
+            return DartBridge.onCommandExecute(commandId, playerId, args.buffer(), args.length());
         } catch (Exception e) {
             LOGGER.error("Error executing command {}: {}", commandId, e.getMessage());
             return 0;
@@ -255,56 +252,66 @@ public class CommandRegistry {
     }
 
     /**
-     * Get an argument value from the context.
+     * Encode one argument from the context. Arguments that fail to resolve are left out.
      */
-    private static Object getArgumentValue(CommandContext<CommandSourceStack> context, String name, String type) {
-        return switch (type) {
-            case "string", "greedyString" -> StringArgumentType.getString(context, name);
+    private static void writeArgument(
+            CommandContext<CommandSourceStack> context,
+            CommandArgsWriter args,
+            int index,
+            String name,
+            String type) {
+        switch (type) {
+            case "string", "greedyString" -> args.putString(index, StringArgumentType.getString(context, name));
             case "block" -> {
                 if (buildContext != null) {
                     try {
                         var blockInput = BlockStateArgument.getBlock(context, name);
-                        yield BuiltInRegistries.BLOCK.getKey(blockInput.getState().getBlock()).toString();
+                        args.putString(index, BuiltInRegistries.BLOCK.getKey(blockInput.getState().getBlock()).toString());
                     } catch (Exception e) {
-                        yield null;
+                        // Unresolvable block
                     }
                 } else {
-                    yield StringArgumentType.getString(context, name);
+                    args.putString(index, StringArgumentType.getString(context, name));
                 }
             }
             case "item" -> {
                 if (buildContext != null) {
                     try {
                         var itemInput = ItemArgument.getItem(context, name);
-                        yield BuiltInRegistries.ITEM.getKey(itemInput.getItem()).toString();
+                        args.putString(index, BuiltInRegistries.ITEM.getKey(itemInput.getItem()).toString());
                     } catch (Exception e) {
-                        yield null;
+                        // Unresolvable item
                     }
                 } else {
-                    yield StringArgumentType.getString(context, name);
+                    args.putString(index, StringArgumentType.getString(context, name));
                 }
             }
-            case "integer" -> IntegerArgumentType.getInteger(context, name);
-            case "double_" -> DoubleArgumentType.getDouble(context, name);
-            case "bool_" -> BoolArgumentType.getBool(context, name);
+            case "integer" -> args.putInt(index, IntegerArgumentType.getInteger(context, name));
+            case "double_" -> args.putDouble(index, DoubleArgumentType.getDouble(context, name));
+            case "bool_" -> args.putBool(index, BoolArgumentType.getBool(context, name));
             case "player" -> {
                 try {
                     ServerPlayer p = EntityArgument.getPlayer(context, name);
-                    yield p.getId();
+                    args.putEntity(index, p.getId());
+                } catch (IllegalArgumentException e) {
+                    throw e;
                 } catch (Exception e) {
-                    yield null;
+                    // Selector matched no player
                 }
             }
             case "position" -> {
                 try {
                     var pos = BlockPosArgument.getBlockPos(context, name);
-                    yield pos.getX() + "," + pos.getY() + "," + pos.getZ();
+                    args.putBlockPos(index, pos.getX(), pos.getY(), pos.getZ());
+                } catch (IllegalArgumentException e) {
+                    throw e;
                 } catch (Exception e) {
-                    yield null;
+                    // Position not loaded or out of the world
                 }
             }
-            default -> null;
-        };
+            default -> {
+            }
+        }
     }
 
     /**
@@ -0,0 +1,46 @@
+package com.redstone.util;
+
+import com.redstone.DartBridge;
+
+/**
+ * One sample of the server Dart isolate's heap and GC counters, for metrics
+ * exporters. Sizes are in bytes and pauses in microseconds. GC counters and
+ * pauses are cumulative since the server runtime started. They are only
+ * collected in AOT mode; in JIT mode they stay at zero.
+ */
+public record DartHeapStats(
+    long newUsed,
+    long newCapacity,
+    long newExternal,
+    long oldUsed,
+    long oldCapacity,
+    long oldExternal,
+    long newGcCount,
+    long oldGcCount,
+    long gcPauseTotalMicros,
+    long gcPauseMaxMicros,
+    long gcPauseLastMicros
+) {
+    /** Number of values in the native sample (HEAP_STAT_COUNT in isolate_stats.h). */
+    private static final int STAT_COUNT = 11;
+
+    /**
+     * Sample the server isolate.
+     *
+     * @return the sample, or null if the server runtime is not running
+     */
+    public static DartHeapStats sample() {
+        if (!DartBridge.isInitialized()) return null;
+        long[] s = DartBridge.getServerHeapStats();
+        if (s == null || s.length < STAT_COUNT) return null;
+        return new DartHeapStats(s[0], s[1], s[2], s[3], s[4], s[5], s[6], s[7], s[8], s[9], s[10]);
+    }
+
+    public long totalUsed() {
+        return newUsed + oldUsed;
+    }
+
+    public long totalCapacity() {
+        return newCapacity + oldCapacity;
+    }
+}
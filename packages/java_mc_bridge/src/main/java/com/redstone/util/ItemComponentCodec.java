@@ -0,0 +1,274 @@
+package com.redstone.util;
+
+import net.minecraft.core.RegistryAccess;
+import net.minecraft.core.component.DataComponents;
+import net.minecraft.core.registries.Registries;
+import net.minecraft.network.chat.Component;
+import net.minecraft.network.chat.Style;
+import net.minecraft.resources.Identifier;
+import net.minecraft.tags.DamageTypeTags;
+import net.minecraft.util.Unit;
+import net.minecraft.world.item.ItemStack;
+import net.minecraft.world.item.component.DamageResistant;
+import net.minecraft.world.item.component.ItemLore;
+import net.minecraft.world.item.enchantment.ItemEnchantments;
+
+import java.nio.BufferOverflowException;
+import java.nio.BufferUnderflowException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+
+/**
+ * Binary encoding of item stack data components for bulk get/set from Dart
+ * (layout in native item_components.h). Buffers are direct and wrap native
+ * memory owned by the caller, so nothing is copied into Java strings other
+ * than the component text itself.
+ */
+public final class ItemComponentCodec {
+    // Must match item_components.h
+    public static final byte VERSION = 1;
+    public static final int OVERFLOW = -2;
+
+    static final int MAX_STACK_SIZE = 1;
+    static final int DAMAGE = 2;
+    static final int MAX_DAMAGE = 3;
+    static final int CUSTOM_NAME = 4;
+    static final int LORE = 5;
+    static final int ENCHANTMENTS = 6;
+    static final int UNBREAKABLE = 7;
+    static final int DAMAGE_RESISTANT = 8;
+
+    static final byte TAG_ABSENT = 0;
+    static final byte TAG_INT = 1;
+    static final byte TAG_BOOL = 2;
+    static final byte TAG_STRING = 3;
+    static final byte TAG_STRING_LIST = 4;
+    static final byte TAG_INT_MAP = 5;
+
+    private ItemComponentCodec() {}
+
+    /**
+     * Encode the requested components of a stack into out. Components of an
+     * empty stack are written as absent.
+     *
+     * @param request one component code per byte
+     * @return bytes written, or {@link #OVERFLOW} if out is too small
+     */
+    public static int read(ItemStack stack, ByteBuffer request, ByteBuffer out) {
+        out.order(ByteOrder.LITTLE_ENDIAN);
+        int count = Math.min(request.remaining(), 255);
+        try {
+            out.put(VERSION).put((byte) count);
+            for (int i = 0; i < count; i++) {
+                int component = request.get(request.position() + i) & 0xFF;
+                out.put((byte) component);
+                if (stack.isEmpty()) {
+                    out.put(TAG_ABSENT);
+                } else {
+                    putValue(stack, component, out);
+                }
+            }
+        } catch (BufferOverflowException e) {
+            return OVERFLOW;
+        }
+        return out.position();
+    }
+
+    /**
+     * Apply every component in a blob to a stack.
+     *
+     * @return false if a component had an unexpected tag or unknown code
+     */
+    public static boolean write(ItemStack stack, ByteBuffer data, RegistryAccess registries) {
+        data.order(ByteOrder.LITTLE_ENDIAN);
+        try {
+            if (data.get() != VERSION) return false;
+            int count = data.get() & 0xFF;
+            boolean applied = true;
+            for (int i = 0; i < count; i++) {
+                int component = data.get() & 0xFF;
+                byte tag = data.get();
+                Object value = getValue(tag, data);
+                if (!stack.isEmpty()) {
+                    applied &= apply(stack, component, tag, value, registries);
+                }
+            }
+            return applied;
+        } catch (BufferUnderflowException | IllegalArgumentException e) {
+            return false;
+        }
+    }
+
+    private static void putValue(ItemStack stack, int component, ByteBuffer out) {
+        switch (component) {
+            case MAX_STACK_SIZE -> out.put(TAG_INT).putInt(stack.getMaxStackSize());
+            case DAMAGE -> out.put(TAG_INT).putInt(stack.getDamageValue());
+            case MAX_DAMAGE -> out.put(TAG_INT).putInt(stack.getMaxDamage());
+            case CUSTOM_NAME -> {
+                Component name = stack.get(DataComponents.CUSTOM_NAME);
+                if (name == null) {
+                    out.put(TAG_ABSENT);
+                } else {
+                    putString(out.put(TAG_STRING), name.getString());
+                }
+            }
+            case LORE -> {
+                ItemLore lore = stack.get(DataComponents.LORE);
+                if (lore == null) {
+                    out.put(TAG_ABSENT);
+                } else {
+                    List<Component> lines = lore.lines();
+                    out.put(TAG_STRING_LIST).putInt(lines.size());
+                    for (Component line : lines) {
+                        putString(out, line.getString());
+                    }
+                }
+            }
+            case ENCHANTMENTS -> {
+                ItemEnchantments enchants = stack.get(DataComponents.ENCHANTMENTS);
+                if (enchants == null || enchants.isEmpty()) {
+                    out.put(TAG_ABSENT);
+                } else {
+                    out.put(TAG_INT_MAP).putInt(enchants.size());
+                    for (var entry : enchants.entrySet()) {
+                        String enchantId = entry.getKey().unwrapKey()
+                            .map(key -> key.identifier().toString()).orElse("unknown");
+                        putString(out, enchantId);
+                        out.putInt(entry.getIntValue());
+                    }
+                }
+            }
+            case UNBREAKABLE -> out.put(TAG_BOOL).put(bool(stack.has(DataComponents.UNBREAKABLE)));
+            case DAMAGE_RESISTANT -> out.put(TAG_BOOL).put(bool(stack.has(DataComponents.DAMAGE_RESISTANT)));
+            default -> out.put(TAG_ABSENT);
+        }
+    }
+
+    private static Object getValue(byte tag, ByteBuffer data) {
+        return switch (tag) {
+            case TAG_ABSENT -> null;
+            case TAG_INT -> data.getInt();
+            case TAG_BOOL -> data.get() != 0;
+            case TAG_STRING -> getString(data);
+            case TAG_STRING_LIST -> {
+                int count = data.getInt();
+                List<String> lines = new ArrayList<>();
+                for (int i = 0; i < count; i++) lines.add(getString(data));
+                yield lines;
+            }
+            case TAG_INT_MAP -> {
+                int count = data.getInt();
+                Map<String, Integer> map = new LinkedHashMap<>();
+                for (int i = 0; i < count; i++) {
+                    String key = getString(data);
+                    map.put(key, data.getInt());
+                }
+                yield map;
+            }
+            default -> throw new IllegalArgumentException("Unknown component tag " + tag);
+        };
+    }
+
+    @SuppressWarnings("unchecked")
+    private static boolean apply(ItemStack stack, int component, byte tag, Object value, RegistryAccess registries) {
+        boolean absent = tag == TAG_ABSENT;
+        switch (component) {
+            case MAX_STACK_SIZE -> {
+                if (absent) stack.remove(DataComponents.MAX_STACK_SIZE);
+                else if (value instanceof Integer size) stack.set(DataComponents.MAX_STACK_SIZE, size);
+                else return false;
+            }
+            case DAMAGE -> {
+                if (absent) stack.remove(DataComponents.DAMAGE);
+                else if (value instanceof Integer damage) stack.setDamageValue(damage);
+                else return false;
+            }
+            case MAX_DAMAGE -> {
+                if (absent) stack.remove(DataComponents.MAX_DAMAGE);
+                else if (value instanceof Integer maxDamage) stack.set(DataComponents.MAX_DAMAGE, maxDamage);
+                else return false;
+            }
+            case CUSTOM_NAME -> {
+                if (absent || "".equals(value)) stack.remove(DataComponents.CUSTOM_NAME);
+                else if (value instanceof String name) stack.set(DataComponents.CUSTOM_NAME, Component.literal(name));
+                else return false;
+            }
+            case LORE -> {
+                if (absent) {
+                    stack.remove(DataComponents.LORE);
+                } else if (value instanceof List<?> list) {
+                    List<Component> lines = new ArrayList<>(list.size());
+                    for (Object line : list) {
+                        lines.add(Component.literal((String) line).withStyle(Style.EMPTY.withItalic(false)));
+                    }
+                    if (lines.isEmpty()) stack.remove(DataComponents.LORE);
+                    else stack.set(DataComponents.LORE, new ItemLore(lines));
+                } else {
+                    return false;
+                }
+            }
+            case ENCHANTMENTS -> {
+                if (absent) {
+                    stack.remove(DataComponents.ENCHANTMENTS);
+                } else if (value instanceof Map<?, ?> map) {
+                    if (registries == null) return false;
+                    var enchantRegistry = registries.lookup(Registries.ENCHANTMENT);
+                    if (enchantRegistry.isEmpty()) return false;
+                    ItemEnchantments.Mutable builder = new ItemEnchantments.Mutable(ItemEnchantments.EMPTY);
+                    boolean allKnown = true;
+                    for (var entry : ((Map<String, Integer>) map).entrySet()) {
+                        var enchantOpt = enchantRegistry.get().get(Identifier.parse(entry.getKey()));
+                        if (enchantOpt.isPresent()) builder.set(enchantOpt.get(), entry.getValue());
+                        else allKnown = false;
+                    }
+                    if (builder.keySet().isEmpty()) stack.remove(DataComponents.ENCHANTMENTS);
+                    else stack.set(DataComponents.ENCHANTMENTS, builder.toImmutable());
+                    // Known enchantments are still applied
+                    if (!allKnown) return false;
+                } else {
+                    return false;
+                }
+            }
+            case UNBREAKABLE -> {
+                if (Boolean.TRUE.equals(value)) stack.set(DataComponents.UNBREAKABLE, Unit.INSTANCE);
+                else if (absent || Boolean.FALSE.equals(value)) stack.remove(DataComponents.UNBREAKABLE);
+                else return false;
+            }
+            case DAMAGE_RESISTANT -> {
+                if (Boolean.TRUE.equals(value)) {
+                    stack.set(DataComponents.DAMAGE_RESISTANT, new DamageResistant(DamageTypeTags.IS_FIRE));
+                } else if (absent || Boolean.FALSE.equals(value)) {
+                    stack.remove(DataComponents.DAMAGE_RESISTANT);
+                } else {
+                    return false;
+                }
+            }
+            default -> {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    private static void putString(ByteBuffer out, String value) {
+        byte[] bytes = value.getBytes(StandardCharsets.UTF_8);
+        out.putInt(bytes.length).put(bytes);
+    }
+
+    private static String getString(ByteBuffer data) {
+        int length = data.getInt();
+        if (length < 0 || length > data.remaining()) throw new BufferUnderflowException();
+        byte[] bytes = new byte[length];
+        data.get(bytes);
+        return new String(bytes, StandardCharsets.UTF_8);
+    }
+
+    private static byte bool(boolean value) {
+        return value ? (byte) 1 : (byte) 0;
+    }
+}
@@ -0,0 +1,62 @@
+package com.redstone.world;
+
+import com.redstone.DartBridge;
+import net.minecraft.server.MinecraftServer;
+import net.minecraft.server.level.ServerLevel;
+import net.minecraft.world.level.chunk.LevelChunk;
+import net.minecraft.world.level.storage.LevelResource;
+import org.slf4j.Logger;
+import org.slf4j.LoggerFactory;
+
+/**
+ * Drives the native per-chunk data store used for Dart mod state.
+ *
+ * The store lives in the world folder under redstone_data/. Pages are
+ * prefetched when a chunk loads, written back and dropped from memory when
+ * it unloads, and dirty pages are flushed whenever the world saves.
+ */
+public final class ChunkDataService {
+    private static final Logger LOGGER = LoggerFactory.getLogger("ChunkDataService");
+
+    private ChunkDataService() {}
+
+    public static void onServerStarting(MinecraftServer server) {
+        if (!DartBridge.isInitialized()) return;
+        try {
+            String root = server.getWorldPath(LevelResource.ROOT).resolve("redstone_data").normalize().toString();
+            DartBridge.setChunkDataRoot(root);
+        } catch (Exception e) {
+            LOGGER.error("Error setting chunk data root: {}", e.getMessage());
+        }
+    }
+
+    public static void onChunkLoad(ServerLevel level, LevelChunk chunk) {
+        if (!DartBridge.isInitialized()) return;
+        try {
+            DartBridge.onChunkDataLoad(ChunkSnapshotService.worldId(level), chunk.getPos().x, chunk.getPos().z);
+        } catch (Exception e) {
+            LOGGER.error("Error loading chunk data: {}", e.getMessage());
+        }
+    }
+
+    public static void onChunkUnload(ServerLevel level, LevelChunk chunk) {
+        if (!DartBridge.isInitialized()) return;
+        try {
+            DartBridge.onChunkDataUnload(ChunkSnapshotService.worldId(level), chunk.getPos().x, chunk.getPos().z);
+        } catch (Exception e) {
+            LOGGER.error("Error unloading chunk data: {}", e.getMessage());
+        }
+    }
+
+    public static void onSave() {
+        if (!DartBridge.isInitialized()) return;
+        try {
+            int written = DartBridge.flushChunkData();
+            if (written > 0) {
+                LOGGER.debug("Saved {} chunk data pages", written);
+            }
+        } catch (Exception e) {
+            LOGGER.error("Error saving chunk data: {}", e.getMessage());
+        }
+    }
+}
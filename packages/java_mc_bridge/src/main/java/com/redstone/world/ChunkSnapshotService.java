@@ -0,0 +1,233 @@
+package com.redstone.world;
+
+import com.redstone.DartBridge;
+import net.minecraft.server.MinecraftServer;
+import net.minecraft.server.level.ServerLevel;
+import net.minecraft.world.level.ChunkPos;
+import net.minecraft.world.level.Level;
+import net.minecraft.world.level.block.Block;
+import net.minecraft.world.level.block.Blocks;
+import net.minecraft.world.level.block.state.BlockState;
+import net.minecraft.world.level.chunk.LevelChunk;
+import net.minecraft.world.level.chunk.LevelChunkSection;
+import net.minecraft.world.level.levelgen.Heightmap;
+import org.slf4j.Logger;
+import org.slf4j.LoggerFactory;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.IdentityHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+
+/**
+ * Publishes immutable chunk snapshots into native memory for off-thread Dart reads.
+ *
+ * Dart requests snapshots through the native chunk snapshot queue (once or
+ * watched). Once per server tick this service drains the queue, packs the
+ * requested chunks (block state palette + indices per section, heightmaps)
+ * and publishes them. Watched chunks are republished on the tick after a
+ * block in them changes. Dart worker isolates then read the snapshots via
+ * FFI without JNI or the server thread.
+ */
+public final class ChunkSnapshotService {
+    private static final Logger LOGGER = LoggerFactory.getLogger("ChunkSnapshotService");
+
+    /** Must match CHUNK_SNAPSHOT_* modes in chunk_snapshot.h. */
+    private static final int MODE_ONCE = 0;
+    private static final int MODE_WATCH = 1;
+    private static final int MODE_UNWATCH = 2;
+
+    private static final int SECTION_VOLUME = 4096;
+    private static final int HEIGHTMAP_AREA = 256;
+
+    /** Heightmaps published per chunk, in snapshot order. */
+    private static final Heightmap.Types[] HEIGHTMAP_TYPES = {
+        Heightmap.Types.WORLD_SURFACE,
+        Heightmap.Types.MOTION_BLOCKING,
+        Heightmap.Types.MOTION_BLOCKING_NO_LEAVES,
+        Heightmap.Types.OCEAN_FLOOR,
+    };
+
+    private record ChunkKey(int worldId, int chunkX, int chunkZ) {}
+
+    private static final Map<Level, Integer> worldIds = new ConcurrentHashMap<>();
+    private static final Set<ChunkKey> watched = ConcurrentHashMap.newKeySet();
+    private static final Set<ChunkKey> dirty = ConcurrentHashMap.newKeySet();
+
+    private ChunkSnapshotService() {}
+
+    /** Cheap check used by the block change hook. */
+    public static boolean hasWatchedChunks() {
+        return !watched.isEmpty();
+    }
+
+    /**
+     * Mark a chunk as changed. Watched chunks are republished next tick.
+     */
+    public static void markDirty(Level level, ChunkPos pos) {
+        if (!(level instanceof ServerLevel)) return;
+        ChunkKey key = new ChunkKey(worldId(level), pos.x, pos.z);
+        if (watched.contains(key)) {
+            dirty.add(key);
+        }
+    }
+
+    /**
+     * Drop snapshots of an unloaded chunk.
+     */
+    public static void onChunkUnload(ServerLevel level, LevelChunk chunk) {
+        if (!DartBridge.isInitialized()) return;
+        ChunkKey key = new ChunkKey(worldId(level), chunk.getPos().x, chunk.getPos().z);
+        if (watched.remove(key)) {
+            dirty.remove(key);
+        }
+        try {
+            DartBridge.evictChunkSnapshot(key.worldId(), key.chunkX(), key.chunkZ());
+        } catch (Exception e) {
+            LOGGER.error("Error evicting chunk snapshot: {}", e.getMessage());
+        }
+    }
+
+    /**
+     * Service snapshot requests and republish dirty watched chunks.
+     * Called once per server tick on the server thread.
+     */
+    public static void tick(MinecraftServer server) {
+        int[] requests;
+        try {
+            requests = DartBridge.pollChunkSnapshotRequests();
+        } catch (Exception e) {
+            LOGGER.error("Error polling chunk snapshot requests: {}", e.getMessage());
+            return;
+        }
+        if (requests == null && dirty.isEmpty()) return;
+
+        Map<Integer, ServerLevel> levels = new HashMap<>();
+        for (ServerLevel level : server.getAllLevels()) {
+            levels.put(worldId(level), level);
+        }
+
+        List<ChunkKey> toPublish = new ArrayList<>();
+        if (requests != null) {
+            for (int i = 0; i + 3 < requests.length; i += 4) {
+                ChunkKey key = new ChunkKey(requests[i], requests[i + 1], requests[i + 2]);
+                switch (requests[i + 3]) {
+                    case MODE_WATCH -> {
+                        watched.add(key);
+                        toPublish.add(key);
+                    }
+                    case MODE_UNWATCH -> {
+                        watched.remove(key);
+                        dirty.remove(key);
+                    }
+                    default -> toPublish.add(key);
+                }
+            }
+        }
+        for (ChunkKey key : dirty) {
+            dirty.remove(key);
+            toPublish.add(key);
+        }
+
+        for (ChunkKey key : toPublish) {
+            ServerLevel level = levels.get(key.worldId());
+            if (level == null) continue;
+            // Never force-load: only chunks that are already loaded are published
+            LevelChunk chunk = level.getChunkSource().getChunkNow(key.chunkX(), key.chunkZ());
+            if (chunk != null) {
+                publish(level, key.worldId(), chunk);
+            }
+        }
+    }
+
+    /** Forget all state (server stopped). Native snapshots are cleared on shutdown. */
+    public static void clear() {
+        worldIds.clear();
+        watched.clear();
+        dirty.clear();
+    }
+
+    /** Snapshot world id of a level (shared with the chunk data store). */
+    static int worldId(Level level) {
+        return worldIds.computeIfAbsent(level,
+            l -> DartBridge.getChunkSnapshotWorldId(l.dimension().identifier().toString()));
+    }
+
+    /**
+     * Pack every section of a chunk and publish it in a single native call.
+     */
+    private static void publish(ServerLevel level, int worldId, LevelChunk chunk) {
+        LevelChunkSection[] sections = chunk.getSections();
+        int[] paletteSizes = new int[sections.length];
+        int[] palettes = new int[sections.length * 16];
+        int paletteLength = 0;
+        short[] indices = new short[0];
+        int indexLength = 0;
+
+        Map<BlockState, Integer> palette = new IdentityHashMap<>();
+        short[] sectionIndices = new short[SECTION_VOLUME];
+
+        for (int s = 0; s < sections.length; s++) {
+            LevelChunkSection section = sections[s];
+            palette.clear();
+
+            if (section.hasOnlyAir()) {
+                palette.put(Blocks.AIR.defaultBlockState(), 0);
+            } else {
+                for (int y = 0; y < 16; y++) {
+                    for (int z = 0; z < 16; z++) {
+                        for (int x = 0; x < 16; x++) {
+                            BlockState state = section.getBlockState(x, y, z);
+                            Integer index = palette.get(state);
+                            if (index == null) {
+                                index = palette.size();
+                                palette.put(state, index);
+                            }
+                            sectionIndices[(y << 8) | (z << 4) | x] = (short) (int) index;
+                        }
+                    }
+                }
+            }
+
+            // Append this section's palette in index order
+            int size = palette.size();
+            if (paletteLength + size > palettes.length) {
+                palettes = Arrays.copyOf(palettes, Math.max(palettes.length * 2, paletteLength + size));
+            }
+            for (Map.Entry<BlockState, Integer> entry : palette.entrySet()) {
+                palettes[paletteLength + entry.getValue()] = Block.getId(entry.getKey());
+            }
+            paletteLength += size;
+            paletteSizes[s] = size;
+
+            if (size > 1) {
+                if (indexLength + SECTION_VOLUME > indices.length) {
+                    indices = Arrays.copyOf(indices, Math.max(indices.length * 2, indexLength + SECTION_VOLUME));
+                }
+                System.arraycopy(sectionIndices, 0, indices, indexLength, SECTION_VOLUME);
+                indexLength += SECTION_VOLUME;
+            }
+        }
+
+        short[] heightmaps = new short[HEIGHTMAP_TYPES.length * HEIGHTMAP_AREA];
+        for (int t = 0; t < HEIGHTMAP_TYPES.length; t++) {
+            for (int z = 0; z < 16; z++) {
+                for (int x = 0; x < 16; x++) {
+                    heightmaps[t * HEIGHTMAP_AREA + ((z << 4) | x)] = (short) chunk.getHeight(HEIGHTMAP_TYPES[t], x, z);
+                }
+            }
+        }
+
+        try {
+            DartBridge.publishChunkSnapshot(worldId, chunk.getPos().x, chunk.getPos().z, level.getMinSectionY(),
+                paletteSizes, Arrays.copyOf(palettes, paletteLength),
+                Arrays.copyOf(indices, indexLength), heightmaps, HEIGHTMAP_TYPES.length);
+        } catch (Exception e) {
+            LOGGER.error("Error publishing chunk snapshot: {}", e.getMessage());
+        }
+    }
+}
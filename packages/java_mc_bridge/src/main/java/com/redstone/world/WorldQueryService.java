@@ -0,0 +1,192 @@
+package com.redstone.world;
+
+import com.redstone.DartBridge;
+import net.minecraft.core.BlockPos;
+import net.minecraft.core.registries.BuiltInRegistries;
+import net.minecraft.server.MinecraftServer;
+import net.minecraft.server.level.ServerLevel;
+import net.minecraft.world.entity.Entity;
+import net.minecraft.world.entity.LivingEntity;
+import net.minecraft.world.entity.Mob;
+import net.minecraft.world.level.ClipContext;
+import net.minecraft.world.phys.AABB;
+import net.minecraft.world.phys.BlockHitResult;
+import net.minecraft.world.phys.HitResult;
+import net.minecraft.world.phys.Vec3;
+import net.minecraft.world.phys.shapes.CollisionContext;
+import org.slf4j.Logger;
+import org.slf4j.LoggerFactory;
+
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+/**
+ * Services asynchronous world queries submitted by Dart.
+ *
+ * Dart queues read-only queries (block reads, entity searches, raycasts) in
+ * native code and receives a Future. Once per server tick, before the Dart
+ * runtime drains its message queue, this service takes a batch of queries,
+ * answers them on the server thread and posts all results back in a single
+ * native call.
+ */
+public final class WorldQueryService {
+    private static final Logger LOGGER = LoggerFactory.getLogger("WorldQueryService");
+
+    /** Must match WORLD_QUERY_* in world_query.h. */
+    private static final int QUERY_BLOCK_ID = 0;
+    private static final int QUERY_IS_AIR = 1;
+    private static final int QUERY_REDSTONE_SIGNAL = 2;
+    private static final int QUERY_ENTITIES_IN_BOX = 3;
+    private static final int QUERY_ENTITIES_IN_RADIUS = 4;
+    private static final int QUERY_RAYCAST = 5;
+    private static final int MAX_ARGS = 8;
+
+    private static final int STATUS_OK = 0;
+    private static final int STATUS_FAILED = 1;
+
+    /** Entity class codes in entity search results. */
+    private static final int ENTITY_PLAIN = 0;
+    private static final int ENTITY_LIVING = 1;
+    private static final int ENTITY_MOB = 2;
+
+    /** Upper bound on queries answered per tick; the rest wait for the next tick. */
+    private static final int MAX_QUERIES_PER_TICK = 4096;
+
+    private WorldQueryService() {}
+
+    /**
+     * Answer pending queries. Called once per server tick on the server thread.
+     */
+    public static void tick(MinecraftServer server) {
+        Object[] batch;
+        try {
+            batch = DartBridge.pollWorldQueries(MAX_QUERIES_PER_TICK);
+        } catch (Exception e) {
+            LOGGER.error("Error polling world queries: {}", e.getMessage());
+            return;
+        }
+        if (batch == null) return;
+
+        long[] ids = (long[]) batch[0];
+        int[] kinds = (int[]) batch[1];
+        String[] dimensions = (String[]) batch[2];
+        String[] texts = (String[]) batch[3];
+        double[] args = (double[]) batch[4];
+
+        Map<String, ServerLevel> levels = new HashMap<>();
+        for (ServerLevel level : server.getAllLevels()) {
+            levels.put(level.dimension().identifier().toString(), level);
+        }
+
+        int count = ids.length;
+        int[] statuses = new int[count];
+        String[] resultTexts = new String[count];
+        int[] valueOffsets = new int[count + 1];
+        double[] values = new double[count * 4];
+        int valueLength = 0;
+
+        for (int i = 0; i < count; i++) {
+            valueOffsets[i] = valueLength;
+            ServerLevel level = levels.get(dimensions[i]);
+            if (level == null) {
+                statuses[i] = STATUS_FAILED;
+                continue;
+            }
+
+            double[] result;
+            try {
+                int base = i * MAX_ARGS;
+                if (kinds[i] == QUERY_BLOCK_ID) {
+                    BlockPos pos = blockPos(args, base);
+                    resultTexts[i] = level.getBlockState(pos).getBlock()
+                        .builtInRegistryHolder().key().identifier().toString();
+                    result = null;
+                } else {
+                    result = answer(level, kinds[i], texts[i], args, base);
+                }
+                statuses[i] = STATUS_OK;
+            } catch (Exception e) {
+                LOGGER.error("Error answering world query {}: {}", kinds[i], e.getMessage());
+                statuses[i] = STATUS_FAILED;
+                result = null;
+            }
+
+            if (result != null) {
+                if (valueLength + result.length > values.length) {
+                    values = Arrays.copyOf(values, Math.max(values.length * 2, valueLength + result.length));
+                }
+                System.arraycopy(result, 0, values, valueLength, result.length);
+                valueLength += result.length;
+            }
+        }
+        valueOffsets[count] = valueLength;
+
+        try {
+            DartBridge.completeWorldQueries(ids, statuses, resultTexts, values, valueOffsets);
+        } catch (Exception e) {
+            LOGGER.error("Error completing world queries: {}", e.getMessage());
+        }
+    }
+
+    private static double[] answer(ServerLevel level, int kind, String text, double[] args, int base) {
+        switch (kind) {
+            case QUERY_IS_AIR:
+                return new double[] { level.getBlockState(blockPos(args, base)).isAir() ? 1 : 0 };
+            case QUERY_REDSTONE_SIGNAL:
+                return new double[] { level.getBestNeighborSignal(blockPos(args, base)) };
+            case QUERY_ENTITIES_IN_BOX: {
+                AABB box = new AABB(args[base], args[base + 1], args[base + 2],
+                                    args[base + 3], args[base + 4], args[base + 5]);
+                return entities(level.getEntities((Entity) null, box, e -> matchesType(e, text)));
+            }
+            case QUERY_ENTITIES_IN_RADIUS: {
+                double radius = args[base + 3];
+                Vec3 center = new Vec3(args[base], args[base + 1], args[base + 2]);
+                AABB box = new AABB(center.x - radius, center.y - radius, center.z - radius,
+                                    center.x + radius, center.y + radius, center.z + radius);
+                double radiusSq = radius * radius;
+                return entities(level.getEntities((Entity) null, box,
+                    e -> e.distanceToSqr(center) <= radiusSq && matchesType(e, text)));
+            }
+            case QUERY_RAYCAST: {
+                Vec3 from = new Vec3(args[base], args[base + 1], args[base + 2]);
+                Vec3 to = new Vec3(args[base + 3], args[base + 4], args[base + 5]);
+                BlockHitResult hit = level.clip(new ClipContext(from, to,
+                    ClipContext.Block.OUTLINE, ClipContext.Fluid.NONE, CollisionContext.empty()));
+                if (hit.getType() != HitResult.Type.BLOCK) {
+                    return new double[] { 0 };
+                }
+                BlockPos pos = hit.getBlockPos();
+                Vec3 location = hit.getLocation();
+                return new double[] {
+                    1, pos.getX(), pos.getY(), pos.getZ(), hit.getDirection().get3DDataValue(),
+                    location.x, location.y, location.z,
+                };
+            }
+            default:
+                throw new IllegalArgumentException("unknown query kind " + kind);
+        }
+    }
+
+    private static BlockPos blockPos(double[] args, int base) {
+        return new BlockPos((int) args[base], (int) args[base + 1], (int) args[base + 2]);
+    }
+
+    private static boolean matchesType(Entity entity, String type) {
+        return type == null || BuiltInRegistries.ENTITY_TYPE.getKey(entity.getType()).toString().equals(type);
+    }
+
+    /** Flatten entities as (id, class code) pairs so Dart needs no follow-up type calls. */
+    private static double[] entities(List<Entity> entities) {
+        double[] result = new double[entities.size() * 2];
+        for (int i = 0; i < entities.size(); i++) {
+            Entity entity = entities.get(i);
+            result[i * 2] = entity.getId();
+            result[i * 2 + 1] = entity instanceof Mob ? ENTITY_MOB
+                : entity instanceof LivingEntity ? ENTITY_LIVING : ENTITY_PLAIN;
+        }
+        return result;
+    }
+}
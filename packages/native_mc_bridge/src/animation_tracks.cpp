@@ -0,0 +1,475 @@
+#include "animation_tracks.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ANIMATION_SIMD_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define ANIMATION_SIMD_NEON 1
+#endif
+
+namespace {
+
+// ==========================================================================
+// Minimal JSON reader (animation configs only)
+// ==========================================================================
+
+struct JsonValue {
+    enum Kind { NUL, BOOLEAN, NUMBER, STRING, ARRAY, OBJECT };
+    Kind kind = NUL;
+    bool boolean = false;
+    double number = 0.0;
+    std::string string;
+    std::vector<JsonValue> items;
+    std::vector<std::pair<std::string, JsonValue>> members;
+
+    const JsonValue* get(const char* key) const {
+        if (kind != OBJECT) return nullptr;
+        for (const auto& member : members) {
+            if (member.first == key) return &member.second;
+        }
+        return nullptr;
+    }
+
+    double number_or(const char* key, double fallback) const {
+        const JsonValue* value = get(key);
+        return value != nullptr && value->kind == NUMBER ? value->number : fallback;
+    }
+
+    std::string string_or(const char* key, const char* fallback) const {
+        const JsonValue* value = get(key);
+        return value != nullptr && value->kind == STRING ? value->string : fallback;
+    }
+};
+
+class JsonReader {
+public:
+    explicit JsonReader(const char* text) : p_(text) {}
+
+    bool parse(JsonValue& out) {
+        if (!value(out, 0)) return false;
+        skip_ws();
+        return *p_ == '\0';
+    }
+
+private:
+    static constexpr int kMaxDepth = 32;
+    const char* p_;
+
+    void skip_ws() {
+        while (*p_ == ' ' || *p_ == '\t' || *p_ == '\n' || *p_ == '\r') p_++;
+    }
+
+    bool literal(const char* word) {
+        size_t len = std::strlen(word);
+        if (std::strncmp(p_, word, len) != 0) return false;
+        p_ += len;
+        return true;
+    }
+
+    bool string(std::string& out) {
+        if (*p_ != '"') return false;
+        p_++;
+        while (*p_ != '"') {
+            char c = *p_++;
+            if (c == '\0') return false;
+            if (c != '\\') {
+                out += c;
+                continue;
+            }
+            char escaped = *p_++;
+            switch (escaped) {
+                case '"': case '\\': case '/': out += escaped; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'n': out += '\n'; break;
+                case 'r': out += '\r'; break;
+                case 't': out += '\t'; break;
+                case 'u':
+                    // Keys and values we read are ASCII; keep the parse going
+                    for (int i = 0; i < 4; i++) {
+                        if (!std::isxdigit(static_cast<unsigned char>(*p_))) return false;
+                        p_++;
+                    }
+                    out += '?';
+                    break;
+                default:
+                    return false;
+            }
+        }
+        p_++;
+        return true;
+    }
+
+    bool value(JsonValue& out, int depth) {
+        if (depth > kMaxDepth) return false;
+        skip_ws();
+        switch (*p_) {
+            case '{': {
+                p_++;
+                out.kind = JsonValue::OBJECT;
+                skip_ws();
+                if (*p_ == '}') { p_++; return true; }
+                while (true) {
+                    skip_ws();
+                    std::pair<std::string, JsonValue> member;
+                    if (!string(member.first)) return false;
+                    skip_ws();
+                    if (*p_++ != ':') return false;
+                    if (!value(member.second, depth + 1)) return false;
+                    out.members.push_back(std::move(member));
+                    skip_ws();
+                    if (*p_ == ',') { p_++; continue; }
+                    if (*p_ == '}') { p_++; return true; }
+                    return false;
+                }
+            }
+            case '[': {
+                p_++;
+                out.kind = JsonValue::ARRAY;
+                skip_ws();
+                if (*p_ == ']') { p_++; return true; }
+                while (true) {
+                    out.items.emplace_back();
+                    if (!value(out.items.back(), depth + 1)) return false;
+                    skip_ws();
+                    if (*p_ == ',') { p_++; continue; }
+                    if (*p_ == ']') { p_++; return true; }
+                    return false;
+                }
+            }
+            case '"':
+                out.kind = JsonValue::STRING;
+                return string(out.string);
+            case 't':
+                out.kind = JsonValue::BOOLEAN;
+                out.boolean = true;
+                return literal("true");
+            case 'f':
+                out.kind = JsonValue::BOOLEAN;
+                return literal("false");
+            case 'n':
+                return literal("null");
+            default: {
+                char* end = nullptr;
+                out.number = std::strtod(p_, &end);
+                if (end == p_) return false;
+                out.kind = JsonValue::NUMBER;
+                p_ = end;
+                return true;
+            }
+        }
+    }
+};
+
+// ==========================================================================
+// Compiled tracks
+// ==========================================================================
+
+// base + amplitude * sin(2 * pi * frequency * t)
+struct WaveTerm {
+    float frequency;
+    float base;
+    float amplitude;
+};
+
+struct CompiledAnimation {
+    float spin_turns_per_second[3] = {0.0f, 0.0f, 0.0f};  // x, y, z
+    float pivot[3] = {0.5f, 0.5f, 0.5f};
+    std::vector<WaveTerm> bob;    // Summed into translate Y
+    std::vector<WaveTerm> pulse;  // Multiplied into the uniform scale
+};
+
+std::mutex g_tracks_mutex;
+std::unordered_map<int64_t, CompiledAnimation> g_tracks;
+
+void read_pivot(const JsonValue& anim, CompiledAnimation& out) {
+    const JsonValue* pivot = anim.get("pivot");
+    if (pivot == nullptr || pivot->kind != JsonValue::ARRAY || pivot->items.size() < 3) return;
+    for (int i = 0; i < 3; i++) {
+        if (pivot->items[i].kind == JsonValue::NUMBER) out.pivot[i] = static_cast<float>(pivot->items[i].number);
+    }
+}
+
+// Defaults match AnimatedBlockEntity's JSON interpretation
+bool compile_node(const JsonValue& anim, CompiledAnimation& out, int depth) {
+    if (anim.kind != JsonValue::OBJECT || depth > 8) return false;
+    std::string type = anim.string_or("type", "");
+
+    if (type == "spin") {
+        std::string axis = anim.string_or("axis", "y");
+        double speed = anim.number_or("speed", 1.0);
+        read_pivot(anim, out);
+        int index = axis == "x" ? 0 : axis == "z" ? 2 : axis == "y" ? 1 : -1;
+        if (index >= 0) out.spin_turns_per_second[index] += static_cast<float>(speed);
+        return true;
+    }
+    if (type == "bob") {
+        double amplitude = anim.number_or("amplitude", 0.1);
+        double frequency = anim.number_or("frequency", 1.0);
+        out.bob.push_back({static_cast<float>(frequency), 0.0f, static_cast<float>(amplitude)});
+        return true;
+    }
+    if (type == "pulse") {
+        double min_scale = anim.number_or("minScale", 0.9);
+        double max_scale = anim.number_or("maxScale", 1.1);
+        double frequency = anim.number_or("frequency", 1.0);
+        read_pivot(anim, out);
+        // min + (max - min) * (sin + 1) / 2
+        out.pulse.push_back({static_cast<float>(frequency),
+                             static_cast<float>((min_scale + max_scale) * 0.5),
+                             static_cast<float>((max_scale - min_scale) * 0.5)});
+        return true;
+    }
+    if (type == "combined") {
+        const JsonValue* animations = anim.get("animations");
+        if (animations == nullptr || animations->kind != JsonValue::ARRAY) return true;
+        for (const auto& child : animations->items) {
+            if (!compile_node(child, out, depth + 1)) return false;
+        }
+        return true;
+    }
+    // custom/stateful animations are driven from Dart
+    return false;
+}
+
+// ==========================================================================
+// 4-lane float vectors
+// ==========================================================================
+
+#if defined(ANIMATION_SIMD_SSE2)
+
+typedef __m128 V4;
+inline V4 v_set1(float x) { return _mm_set1_ps(x); }
+inline V4 v_load(const float* p) { return _mm_loadu_ps(p); }
+inline void v_store(float* p, V4 a) { _mm_storeu_ps(p, a); }
+inline V4 v_add(V4 a, V4 b) { return _mm_add_ps(a, b); }
+inline V4 v_sub(V4 a, V4 b) { return _mm_sub_ps(a, b); }
+inline V4 v_mul(V4 a, V4 b) { return _mm_mul_ps(a, b); }
+inline V4 v_min(V4 a, V4 b) { return _mm_min_ps(a, b); }
+inline V4 v_abs(V4 a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+inline V4 v_floor(V4 a) {
+    V4 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+    return _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, a), _mm_set1_ps(1.0f)));
+}
+inline V4 v_copysign(V4 magnitude, V4 sign) {
+    V4 mask = _mm_set1_ps(-0.0f);
+    return _mm_or_ps(_mm_andnot_ps(mask, magnitude), _mm_and_ps(mask, sign));
+}
+
+#elif defined(ANIMATION_SIMD_NEON)
+
+typedef float32x4_t V4;
+inline V4 v_set1(float x) { return vdupq_n_f32(x); }
+inline V4 v_load(const float* p) { return vld1q_f32(p); }
+inline void v_store(float* p, V4 a) { vst1q_f32(p, a); }
+inline V4 v_add(V4 a, V4 b) { return vaddq_f32(a, b); }
+inline V4 v_sub(V4 a, V4 b) { return vsubq_f32(a, b); }
+inline V4 v_mul(V4 a, V4 b) { return vmulq_f32(a, b); }
+inline V4 v_min(V4 a, V4 b) { return vminq_f32(a, b); }
+inline V4 v_abs(V4 a) { return vabsq_f32(a); }
+inline V4 v_floor(V4 a) { return vrndmq_f32(a); }
+inline V4 v_copysign(V4 magnitude, V4 sign) {
+    return vbslq_f32(vdupq_n_u32(0x80000000u), sign, magnitude);
+}
+
+#else
+
+struct V4 { float v[4]; };
+#define ANIMATION_LANES(expr) V4 r; for (int i = 0; i < 4; i++) r.v[i] = (expr); return r
+inline V4 v_set1(float x) { ANIMATION_LANES(x); }
+inline V4 v_load(const float* p) { ANIMATION_LANES(p[i]); }
+inline void v_store(float* p, V4 a) { for (int i = 0; i < 4; i++) p[i] = a.v[i]; }
+inline V4 v_add(V4 a, V4 b) { ANIMATION_LANES(a.v[i] + b.v[i]); }
+inline V4 v_sub(V4 a, V4 b) { ANIMATION_LANES(a.v[i] - b.v[i]); }
+inline V4 v_mul(V4 a, V4 b) { ANIMATION_LANES(a.v[i] * b.v[i]); }
+inline V4 v_min(V4 a, V4 b) { ANIMATION_LANES(std::min(a.v[i], b.v[i])); }
+inline V4 v_abs(V4 a) { ANIMATION_LANES(std::fabs(a.v[i])); }
+inline V4 v_floor(V4 a) { ANIMATION_LANES(std::floor(a.v[i])); }
+inline V4 v_copysign(V4 magnitude, V4 sign) { ANIMATION_LANES(std::copysign(magnitude.v[i], sign.v[i])); }
+#undef ANIMATION_LANES
+
+#endif
+
+// sin(2 * pi * turns), max error ~4e-6
+inline V4 v_sin_turns(V4 turns) {
+    // Reduce to [-0.5, 0.5], then fold onto [0, 0.25] using sin(pi - x) = sin(x)
+    V4 y = v_sub(turns, v_floor(v_add(turns, v_set1(0.5f))));
+    V4 a = v_abs(y);
+    a = v_min(a, v_sub(v_set1(0.5f), a));
+
+    V4 x = v_mul(a, v_set1(6.28318530718f));
+    V4 x2 = v_mul(x, x);
+    V4 p = v_set1(1.0f / 362880.0f);
+    p = v_add(v_mul(p, x2), v_set1(-1.0f / 5040.0f));
+    p = v_add(v_mul(p, x2), v_set1(1.0f / 120.0f));
+    p = v_add(v_mul(p, x2), v_set1(-1.0f / 6.0f));
+    p = v_add(v_mul(p, x2), v_set1(1.0f));
+    return v_copysign(v_mul(p, x), y);
+}
+
+// Evaluate four instances of one track. t holds four times in seconds.
+void evaluate4(const CompiledAnimation& anim, const float* t, float out[4][ANIMATION_MATRIX_FLOATS]) {
+    V4 time = v_load(t);
+    V4 zero = v_set1(0.0f);
+    V4 one = v_set1(1.0f);
+
+    V4 s[3], c[3];
+    for (int axis = 0; axis < 3; axis++) {
+        float rate = anim.spin_turns_per_second[axis];
+        if (rate == 0.0f) {
+            s[axis] = zero;
+            c[axis] = one;
+            continue;
+        }
+        V4 turns = v_mul(time, v_set1(rate));
+        s[axis] = v_sin_turns(turns);
+        c[axis] = v_sin_turns(v_add(turns, v_set1(0.25f)));
+    }
+
+    V4 bob = zero;
+    for (const WaveTerm& term : anim.bob) {
+        V4 wave = v_sin_turns(v_mul(time, v_set1(term.frequency)));
+        bob = v_add(bob, v_add(v_set1(term.base), v_mul(v_set1(term.amplitude), wave)));
+    }
+
+    V4 scale = one;
+    for (const WaveTerm& term : anim.pulse) {
+        V4 wave = v_sin_turns(v_mul(time, v_set1(term.frequency)));
+        scale = v_mul(scale, v_add(v_set1(term.base), v_mul(v_set1(term.amplitude), wave)));
+    }
+
+    // R = Ry * Rx * Rz, scaled uniformly
+    const V4& sx = s[0]; const V4& cx = c[0];
+    const V4& sy = s[1]; const V4& cy = c[1];
+    const V4& sz = s[2]; const V4& cz = c[2];
+    V4 sysx = v_mul(sy, sx);
+    V4 cysx = v_mul(cy, sx);
+
+    V4 m[3][3];
+    m[0][0] = v_add(v_mul(cy, cz), v_mul(sysx, sz));
+    m[0][1] = v_sub(v_mul(sysx, cz), v_mul(cy, sz));
+    m[0][2] = v_mul(sy, cx);
+    m[1][0] = v_mul(cx, sz);
+    m[1][1] = v_mul(cx, cz);
+    m[1][2] = v_sub(zero, sx);
+    m[2][0] = v_sub(v_mul(cysx, sz), v_mul(sy, cz));
+    m[2][1] = v_add(v_mul(sy, sz), v_mul(cysx, cz));
+    m[2][2] = v_mul(cy, cx);
+    for (int row = 0; row < 3; row++) {
+        for (int col = 0; col < 3; col++) m[row][col] = v_mul(m[row][col], scale);
+    }
+
+    // Translation: t + pivot - M * pivot
+    V4 pivot[3] = {v_set1(anim.pivot[0]), v_set1(anim.pivot[1]), v_set1(anim.pivot[2])};
+    V4 translation[3];
+    for (int row = 0; row < 3; row++) {
+        V4 rotated = v_add(v_add(v_mul(m[row][0], pivot[0]), v_mul(m[row][1], pivot[1])), v_mul(m[row][2], pivot[2]));
+        translation[row] = v_sub(pivot[row], rotated);
+    }
+    translation[1] = v_add(translation[1], bob);
+
+    // Transpose lanes into column-major matrices
+    float lanes[12][4];
+    for (int col = 0; col < 3; col++) {
+        for (int row = 0; row < 3; row++) v_store(lanes[col * 3 + row], m[row][col]);
+    }
+    for (int row = 0; row < 3; row++) v_store(lanes[9 + row], translation[row]);
+
+    for (int lane = 0; lane < 4; lane++) {
+        float* matrix = out[lane];
+        for (int col = 0; col < 3; col++) {
+            matrix[col * 4 + 0] = lanes[col * 3 + 0][lane];
+            matrix[col * 4 + 1] = lanes[col * 3 + 1][lane];
+            matrix[col * 4 + 2] = lanes[col * 3 + 2][lane];
+            matrix[col * 4 + 3] = 0.0f;
+        }
+        matrix[12] = lanes[9][lane];
+        matrix[13] = lanes[10][lane];
+        matrix[14] = lanes[11][lane];
+        matrix[15] = 1.0f;
+    }
+}
+
+void write_identity(float* matrix) {
+    std::memset(matrix, 0, sizeof(float) * ANIMATION_MATRIX_FLOATS);
+    matrix[0] = matrix[5] = matrix[10] = matrix[15] = 1.0f;
+}
+
+} // namespace
+
+extern "C" {
+
+bool animation_compile(int64_t handler_id, const char* animation_json) {
+    JsonValue root;
+    CompiledAnimation compiled;
+    bool ok = animation_json != nullptr && JsonReader(animation_json).parse(root) &&
+              compile_node(root, compiled, 0);
+
+    std::lock_guard<std::mutex> lock(g_tracks_mutex);
+    if (!ok) {
+        g_tracks.erase(handler_id);
+        return false;
+    }
+    std::cout << "Compiled animation track for handler " << handler_id
+              << ": spin=(" << compiled.spin_turns_per_second[0] << ", " << compiled.spin_turns_per_second[1]
+              << ", " << compiled.spin_turns_per_second[2] << ") bob=" << compiled.bob.size()
+              << " pulse=" << compiled.pulse.size() << std::endl;
+    g_tracks[handler_id] = std::move(compiled);
+    return true;
+}
+
+bool animation_has_track(int64_t handler_id) {
+    std::lock_guard<std::mutex> lock(g_tracks_mutex);
+    return g_tracks.find(handler_id) != g_tracks.end();
+}
+
+int32_t animation_evaluate_batch(const int32_t* handler_ids, const float* times,
+                                 const float* pos_seeds, int32_t count, float* out_matrices) {
+    if (handler_ids == nullptr || times == nullptr || out_matrices == nullptr || count <= 0) return 0;
+
+    std::lock_guard<std::mutex> lock(g_tracks_mutex);
+    int32_t evaluated = 0;
+    int32_t start = 0;
+    while (start < count) {
+        // Run of instances sharing a handler
+        int32_t end = start + 1;
+        while (end < count && handler_ids[end] == handler_ids[start]) end++;
+
+        auto it = g_tracks.find(handler_ids[start]);
+        if (it == g_tracks.end()) {
+            for (int32_t i = start; i < end; i++) write_identity(out_matrices + static_cast<size_t>(i) * ANIMATION_MATRIX_FLOATS);
+        } else {
+            for (int32_t i = start; i < end; i += 4) {
+                int32_t lanes = std::min<int32_t>(4, end - i);
+                float t[4];
+                for (int32_t lane = 0; lane < 4; lane++) {
+                    // Pad a short tail with its last instance
+                    int32_t index = i + std::min(lane, lanes - 1);
+                    t[lane] = times[index] + (pos_seeds != nullptr ? pos_seeds[index] : 0.0f);
+                }
+                float matrices[4][ANIMATION_MATRIX_FLOATS];
+                evaluate4(it->second, t, matrices);
+                std::memcpy(out_matrices + static_cast<size_t>(i) * ANIMATION_MATRIX_FLOATS, matrices,
+                            sizeof(float) * ANIMATION_MATRIX_FLOATS * static_cast<size_t>(lanes));
+            }
+            evaluated += end - start;
+        }
+        start = end;
+    }
+    return evaluated;
+}
+
+} // extern "C"
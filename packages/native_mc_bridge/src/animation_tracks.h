@@ -0,0 +1,49 @@
+#ifndef ANIMATION_TRACKS_H
+#define ANIMATION_TRACKS_H
+
+#include <cstdint>
+
+// ==========================================================================
+// Compiled Block Animation Tracks
+// ==========================================================================
+// Block animations are registered as free-form JSON (see
+// server_queue_animation_registration). The time-based types - spin, bob,
+// pulse and combined - are compiled once at registration into a compact
+// track per handler ID. Spin rates are summed per axis, bobs become sine
+// terms added to translate Y, and pulses become sine terms multiplied into a
+// uniform scale. The track keeps the last pivot the JSON set.
+//
+// animation_evaluate_batch() turns N (handler_id, time, pos_seed) instances
+// into 4x4 transform matrices, four instances at a time with SSE2/NEON (or
+// scalar lanes elsewhere). Each matrix is the same transform that
+// AnimatedBlockEntity/AnimatedBlockRenderer build from the JSON:
+//   translate(t) * translate(pivot) * rotY * rotX * rotZ * scale * translate(-pivot)
+//
+// Stateful and custom animations are driven from Dart and are not compiled.
+// ==========================================================================
+
+// Floats per output matrix (column-major, as read by JOML Matrix4f.set(float[]))
+#define ANIMATION_MATRIX_FLOATS 16
+
+extern "C" {
+
+// Compile animation JSON for a handler, replacing any previous track.
+// Returns false (and drops the old track) if the JSON is not a time-based
+// animation.
+bool animation_compile(int64_t handler_id, const char* animation_json);
+
+// Whether a compiled track exists for this handler
+bool animation_has_track(int64_t handler_id);
+
+// Evaluate count instances into out_matrices (count * ANIMATION_MATRIX_FLOATS).
+// times are in seconds; pos_seeds (may be null) are per-instance offsets in
+// seconds added to the time, e.g. to desynchronize neighbouring blocks.
+// Instances without a track get the identity matrix. Consecutive instances
+// with the same handler are evaluated together, so callers should group them.
+// Returns the number of instances that had a track.
+int32_t animation_evaluate_batch(const int32_t* handler_ids, const float* times,
+                                 const float* pos_seeds, int32_t count, float* out_matrices);
+
+} // extern "C"
+
+#endif // ANIMATION_TRACKS_H
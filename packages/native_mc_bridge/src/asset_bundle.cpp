@@ -0,0 +1,263 @@
+#include "asset_bundle.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// One read-only file mapping
+struct Mapping {
+    const uint8_t* base = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#endif
+};
+
+struct Asset {
+    const uint8_t* data;
+    size_t size;
+};
+
+struct Bundle {
+    std::string assets_path;
+    int32_t refs = 0;
+    std::vector<uint8_t> arena;          // Packed small files
+    std::vector<Mapping> mappings;       // Large files and the ICU data
+    std::unordered_map<std::string, Asset> assets;
+    Mapping icu;
+    std::thread loader;                  // Fills arena/mappings/assets; joined before use
+};
+
+// Backing for zero-length assets: never null, even when the arena is empty
+const uint8_t kEmptyAsset[1] = {0};
+
+std::mutex g_bundle_mutex;
+std::vector<std::unique_ptr<Bundle>> g_bundles;  // Index = handle; released slots are null
+
+void unmap_file(Mapping& mapping) {
+    if (mapping.base == nullptr) return;
+#ifdef _WIN32
+    UnmapViewOfFile(mapping.base);
+    CloseHandle(mapping.mapping);
+    CloseHandle(mapping.file);
+#else
+    ::munmap(const_cast<uint8_t*>(mapping.base), mapping.size);
+#endif
+    mapping.base = nullptr;
+}
+
+// Map a whole file read-only, optionally starting readahead on it. Writers
+// and deleters are not blocked, so assets can be hot-reloaded.
+bool map_file(Mapping& mapping, const std::filesystem::path& path, bool readahead) {
+#ifdef _WIN32
+    mapping.file = CreateFileW(path.wstring().c_str(), GENERIC_READ,
+                               FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                               OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (mapping.file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(mapping.file, &file_size) || file_size.QuadPart == 0) {
+        CloseHandle(mapping.file);
+        return false;
+    }
+    mapping.mapping = CreateFileMappingW(mapping.file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping.mapping == nullptr) {
+        CloseHandle(mapping.file);
+        return false;
+    }
+    void* base = MapViewOfFile(mapping.mapping, FILE_MAP_READ, 0, 0, 0);
+    if (base == nullptr) {
+        CloseHandle(mapping.mapping);
+        CloseHandle(mapping.file);
+        return false;
+    }
+    mapping.base = static_cast<const uint8_t*>(base);
+    mapping.size = static_cast<size_t>(file_size.QuadPart);
+#if _WIN32_WINNT >= 0x0602
+    if (readahead) {
+        WIN32_MEMORY_RANGE_ENTRY range = {base, mapping.size};
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+#endif
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+    void* base = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps the file referenced
+    ::close(fd);
+    if (base == MAP_FAILED) return false;
+    mapping.base = static_cast<const uint8_t*>(base);
+    mapping.size = static_cast<size_t>(st.st_size);
+    // Asynchronous: the kernel reads ahead while the engine starts up
+    if (readahead) ::madvise(base, mapping.size, MADV_WILLNEED);
+#endif
+    return true;
+}
+
+// Index the assets directory (runs on the bundle's loader thread)
+void load_assets(Bundle& bundle) {
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    fs::path root(bundle.assets_path);
+
+    // First pass: size the arena so packed pointers never move
+    struct Entry {
+        fs::path path;
+        std::string name;
+        size_t size;
+    };
+    std::vector<Entry> entries;
+    size_t arena_size = 0;
+    for (auto it = fs::recursive_directory_iterator(root, ec); !ec && it != fs::recursive_directory_iterator();
+         it.increment(ec)) {
+        if (!it->is_regular_file(ec)) continue;
+        size_t size = static_cast<size_t>(it->file_size(ec));
+        if (ec) continue;
+        std::string name = fs::relative(it->path(), root, ec).generic_string();
+        if (ec) continue;
+        if (size <= ASSET_BUNDLE_PACK_LIMIT) arena_size += size;
+        entries.push_back({it->path(), std::move(name), size});
+    }
+    if (ec) {
+        std::cerr << "Asset bundle: failed to list " << bundle.assets_path << ": " << ec.message() << std::endl;
+        return;
+    }
+
+    bundle.arena.resize(arena_size);
+    size_t arena_offset = 0;
+    for (Entry& entry : entries) {
+        if (entry.size == 0) {
+            bundle.assets[entry.name] = {kEmptyAsset, 0};
+        } else if (entry.size <= ASSET_BUNDLE_PACK_LIMIT) {
+            std::ifstream in(entry.path, std::ios::binary);
+            uint8_t* dest = bundle.arena.data() + arena_offset;
+            if (!in.read(reinterpret_cast<char*>(dest), static_cast<std::streamsize>(entry.size))) continue;
+            bundle.assets[entry.name] = {dest, entry.size};
+            arena_offset += entry.size;
+        } else {
+            Mapping mapping;
+            if (!map_file(mapping, entry.path, false)) continue;
+            bundle.assets[entry.name] = {mapping.base, mapping.size};
+            bundle.mappings.push_back(mapping);
+        }
+    }
+
+    std::cout << "Asset bundle: " << bundle.assets.size() << " assets (" << bundle.arena.size()
+              << " bytes packed, " << bundle.mappings.size() << " mapped)" << std::endl;
+}
+
+void map_icu_data(Bundle& bundle, const char* icu_data_path) {
+    if (icu_data_path == nullptr || icu_data_path[0] == '\0') return;
+    if (!map_file(bundle.icu, icu_data_path, true)) {
+        std::cerr << "Asset bundle: failed to map ICU data " << icu_data_path << std::endl;
+    }
+}
+
+// Bundle for a handle with its assets indexed (caller holds g_bundle_mutex)
+Bundle* bundle_for(int32_t handle) {
+    if (handle < 0 || handle >= static_cast<int32_t>(g_bundles.size())) return nullptr;
+    Bundle* bundle = g_bundles[handle].get();
+    if (bundle != nullptr && bundle->loader.joinable()) bundle->loader.join();
+    return bundle;
+}
+
+} // namespace
+
+extern "C" {
+
+int32_t asset_bundle_open(const char* assets_path, const char* icu_data_path) {
+    if (assets_path == nullptr || assets_path[0] == '\0') return -1;
+    std::lock_guard<std::mutex> lock(g_bundle_mutex);
+
+    for (size_t i = 0; i < g_bundles.size(); i++) {
+        if (g_bundles[i] && g_bundles[i]->assets_path == assets_path) {
+            Bundle& bundle = *g_bundles[i];
+            if (bundle.icu.base == nullptr) map_icu_data(bundle, icu_data_path);
+            bundle.refs++;
+            return static_cast<int32_t>(i);
+        }
+    }
+
+    std::error_code ec;
+    if (!std::filesystem::is_directory(assets_path, ec)) {
+        std::cerr << "Asset bundle: " << assets_path << " is not a directory" << std::endl;
+        return -1;
+    }
+
+    auto bundle = std::make_unique<Bundle>();
+    bundle->assets_path = assets_path;
+    bundle->refs = 1;
+    // ICU data is read by the engine right away; the directory walk is not
+    // needed until Dart asks for an asset, so keep it off the startup path
+    map_icu_data(*bundle, icu_data_path);
+    Bundle* loading = bundle.get();
+    bundle->loader = std::thread([loading] { load_assets(*loading); });
+
+    for (size_t i = 0; i < g_bundles.size(); i++) {
+        if (!g_bundles[i]) {
+            g_bundles[i] = std::move(bundle);
+            return static_cast<int32_t>(i);
+        }
+    }
+    g_bundles.push_back(std::move(bundle));
+    return static_cast<int32_t>(g_bundles.size() - 1);
+}
+
+const uint8_t* asset_bundle_find(int32_t bundle, const char* name, int64_t* size_out) {
+    if (name == nullptr) return nullptr;
+    std::lock_guard<std::mutex> lock(g_bundle_mutex);
+    Bundle* b = bundle_for(bundle);
+    if (b == nullptr) return nullptr;
+    auto it = b->assets.find(name);
+    if (it == b->assets.end()) return nullptr;
+    if (size_out) *size_out = static_cast<int64_t>(it->second.size);
+    return it->second.data;
+}
+
+const uint8_t* asset_bundle_icu_data(int32_t bundle, int64_t* size_out) {
+    std::lock_guard<std::mutex> lock(g_bundle_mutex);
+    Bundle* b = bundle_for(bundle);
+    if (b == nullptr || b->icu.base == nullptr) return nullptr;
+    if (size_out) *size_out = static_cast<int64_t>(b->icu.size);
+    return b->icu.base;
+}
+
+int32_t asset_bundle_count(int32_t bundle) {
+    std::lock_guard<std::mutex> lock(g_bundle_mutex);
+    Bundle* b = bundle_for(bundle);
+    return b ? static_cast<int32_t>(b->assets.size()) : 0;
+}
+
+void asset_bundle_release(int32_t bundle) {
+    std::lock_guard<std::mutex> lock(g_bundle_mutex);
+    Bundle* b = bundle_for(bundle);
+    if (b == nullptr || --b->refs > 0) return;
+    for (Mapping& mapping : b->mappings) unmap_file(mapping);
+    unmap_file(b->icu);
+    g_bundles[bundle].reset();
+}
+
+} // extern "C"
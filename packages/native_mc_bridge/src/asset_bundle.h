@@ -0,0 +1,52 @@
+#ifndef ASSET_BUNDLE_H
+#define ASSET_BUNDLE_H
+
+#include <cstdint>
+
+// ==========================================================================
+// Mapped Asset Bundle
+// ==========================================================================
+// Read-only, memory-mapped view of a flutter_assets directory and its ICU
+// data file, opened before the Flutter engine starts.
+//
+// The embedder API only takes assets_path / icu_data_path and has no hook
+// for supplying assets from memory, so the engine still opens the files
+// itself. Opening the bundle maps the ICU data and starts kernel readahead
+// on it, so the engine's own read hits the page cache on cold start.
+//
+// The assets directory is indexed on a background thread, off the startup
+// path; the first lookup waits for it. The bundle serves assets to Dart
+// without copying:
+//   - files up to ASSET_BUNDLE_PACK_LIMIT bytes are packed into one arena
+//     (manifests, small images), one allocation instead of a mapping each
+//   - larger files (fonts, atlases) are mapped individually
+// Asset names are paths relative to the assets directory using '/'
+// ("fonts/MaterialIcons-Regular.otf"). Pointers stay valid until the last
+// asset_bundle_release() for the bundle.
+// ==========================================================================
+
+#define ASSET_BUNDLE_PACK_LIMIT (16 * 1024)
+
+extern "C" {
+
+// Open the bundle for assets_path (icu_data_path may be null). Opening the
+// same assets_path again returns the same handle with its reference count
+// bumped. Returns a handle >= 0, or -1 if assets_path is not a directory.
+int32_t asset_bundle_open(const char* assets_path, const char* icu_data_path);
+
+// Contents of an asset, or nullptr if the bundle has no such file. Empty files
+// return a non-null pointer with *size_out == 0.
+const uint8_t* asset_bundle_find(int32_t bundle, const char* name, int64_t* size_out);
+
+// Mapped ICU data, or nullptr if the bundle was opened without it.
+const uint8_t* asset_bundle_icu_data(int32_t bundle, int64_t* size_out);
+
+// Number of assets in the bundle (0 if the handle is invalid)
+int32_t asset_bundle_count(int32_t bundle);
+
+// Drop a reference; the mappings are released with the last one.
+void asset_bundle_release(int32_t bundle);
+
+} // extern "C"
+
+#endif // ASSET_BUNDLE_H
@@ -921,10 +921,10 @@ public:
     }
 
     // Command dispatch
-    int32_t dispatchCommandExecute(int64_t command_id, int32_t player_id, const char* args_json) {
+    int32_t dispatchCommandExecute(int64_t command_id, int32_t player_id, const uint8_t* args, int32_t args_length) {
         std::lock_guard<std::recursive_mutex> lock(mutex_);
         if (command_execute_handler_) {
-            return command_execute_handler_(command_id, player_id, args_json);
+            return command_execute_handler_(command_id, player_id, args, args_length);
         }
         return 0; // Default: failure
     }
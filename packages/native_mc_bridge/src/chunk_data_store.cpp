@@ -0,0 +1,374 @@
+#include "chunk_data_store.h"
+#include "chunk_snapshot.h"
+
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <winioctl.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr char kRegionMagic[8] = {'R', 'S', 'D', 'C', 'H', 'K', '0', '1'};
+constexpr uint32_t kRegionVersion = 1;
+constexpr size_t kPresentOffset = 16;
+constexpr int32_t kPageAlignment = 4096;
+
+struct RegionHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t page_size;
+};
+
+// Floor division by 32 (chunk -> region), correct for negative coordinates
+int32_t region_of(int32_t chunk) {
+    return chunk >= 0 ? chunk / 32 : -((-chunk + 31) / 32);
+}
+
+int32_t slot_of(int32_t chunk_x, int32_t chunk_z) {
+    return ((chunk_z & 31) << 5) | (chunk_x & 31);
+}
+
+struct ChunkKey {
+    int32_t world_id;
+    int32_t x;
+    int32_t z;
+
+    bool operator==(const ChunkKey& other) const {
+        return world_id == other.world_id && x == other.x && z == other.z;
+    }
+};
+
+struct ChunkKeyHash {
+    size_t operator()(const ChunkKey& key) const {
+        uint64_t packed = (static_cast<uint64_t>(static_cast<uint32_t>(key.x)) << 32) |
+                          static_cast<uint32_t>(key.z);
+        return std::hash<uint64_t>()(packed) ^ (static_cast<size_t>(key.world_id) * 0x9E3779B97F4A7C15ULL);
+    }
+};
+
+// One memory-mapped region file
+struct Region {
+    uint8_t* base = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#else
+    int fd = -1;
+#endif
+    bool failed = false;  // Do not retry a region that could not be mapped
+};
+
+struct Store {
+    std::string name;
+    int32_t page_size = 0;
+    std::unordered_map<ChunkKey, Region, ChunkKeyHash> regions;  // Keyed by region coordinates
+    std::unordered_set<ChunkKey, ChunkKeyHash> dirty;            // Keyed by chunk coordinates
+};
+
+std::mutex g_store_mutex;
+std::string g_root;
+std::vector<std::unique_ptr<Store>> g_stores;
+std::unordered_set<ChunkKey, ChunkKeyHash> g_loaded_chunks;
+
+void unmap_region(Region& region) {
+    if (region.base == nullptr) return;
+#ifdef _WIN32
+    FlushViewOfFile(region.base, region.size);
+    UnmapViewOfFile(region.base);
+    CloseHandle(region.mapping);
+    CloseHandle(region.file);
+#else
+    ::msync(region.base, region.size, MS_SYNC);
+    ::munmap(region.base, region.size);
+    ::close(region.fd);
+#endif
+    region.base = nullptr;
+}
+
+bool map_region(Region& region, const std::filesystem::path& path, int32_t page_size) {
+    size_t size = CHUNK_DATA_HEADER_SIZE + static_cast<size_t>(CHUNK_DATA_REGION_CHUNKS) * page_size;
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+
+#ifdef _WIN32
+    region.file = CreateFileW(path.wstring().c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                              OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (region.file == INVALID_HANDLE_VALUE) return false;
+    // NTFS allocates the whole extension unless the file is marked sparse
+    // first; grow it explicitly so unwritten pages stay holes. Volumes
+    // without sparse support (FAT) fall back to a fully allocated file.
+    DWORD returned = 0;
+    DeviceIoControl(region.file, FSCTL_SET_SPARSE, nullptr, 0, nullptr, 0, &returned, nullptr);
+    LARGE_INTEGER file_size;
+    file_size.QuadPart = static_cast<LONGLONG>(size);
+    LARGE_INTEGER current_size;
+    if (GetFileSizeEx(region.file, &current_size) && current_size.QuadPart < file_size.QuadPart) {
+        if (!SetFilePointerEx(region.file, file_size, nullptr, FILE_BEGIN) || !SetEndOfFile(region.file)) {
+            CloseHandle(region.file);
+            return false;
+        }
+    }
+    region.mapping = CreateFileMappingW(region.file, nullptr, PAGE_READWRITE,
+                                        file_size.HighPart, file_size.LowPart, nullptr);
+    if (region.mapping == nullptr) {
+        CloseHandle(region.file);
+        return false;
+    }
+    region.base = static_cast<uint8_t*>(MapViewOfFile(region.mapping, FILE_MAP_ALL_ACCESS, 0, 0, size));
+    if (region.base == nullptr) {
+        CloseHandle(region.mapping);
+        CloseHandle(region.file);
+        return false;
+    }
+#else
+    region.fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (region.fd < 0) return false;
+    // Grow to full size; unwritten pages stay holes in the sparse file
+    off_t current = ::lseek(region.fd, 0, SEEK_END);
+    if (current < static_cast<off_t>(size) && ::ftruncate(region.fd, static_cast<off_t>(size)) != 0) {
+        ::close(region.fd);
+        return false;
+    }
+    void* base = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, region.fd, 0);
+    if (base == MAP_FAILED) {
+        ::close(region.fd);
+        return false;
+    }
+    region.base = static_cast<uint8_t*>(base);
+#endif
+    region.size = size;
+
+    auto* header = reinterpret_cast<RegionHeader*>(region.base);
+    if (std::memcmp(header->magic, kRegionMagic, sizeof(kRegionMagic)) != 0) {
+        // New file: write the header
+        std::memcpy(header->magic, kRegionMagic, sizeof(kRegionMagic));
+        header->version = kRegionVersion;
+        header->page_size = static_cast<uint32_t>(page_size);
+    } else if (header->page_size != static_cast<uint32_t>(page_size)) {
+        std::cerr << "Chunk data region " << path.string() << " has page size " << header->page_size
+                  << ", expected " << page_size << std::endl;
+        unmap_region(region);
+        return false;
+    }
+    return true;
+}
+
+void sync_range(Region& region, size_t offset, size_t length) {
+#ifdef _WIN32
+    FlushViewOfFile(region.base + offset, length);
+#else
+    ::msync(region.base + offset, length, MS_SYNC);
+#endif
+}
+
+void drop_range(Region& region, size_t offset, size_t length) {
+#ifndef _WIN32
+    // Data is in the file; release the resident pages (they fault back in on access)
+    ::madvise(region.base + offset, length, MADV_DONTNEED);
+#else
+    (void)region;
+    (void)offset;
+    (void)length;
+#endif
+}
+
+void prefetch_range(Region& region, size_t offset, size_t length) {
+#ifndef _WIN32
+    ::madvise(region.base + offset, length, MADV_WILLNEED);
+#else
+    (void)region;
+    (void)offset;
+    (void)length;
+#endif
+}
+
+std::string dimension_dir(int32_t world_id) {
+    char name[256];
+    if (chunk_snapshot_world_name(world_id, name, sizeof(name)) < 0) return std::string();
+    // "minecraft:overworld" -> "minecraft_overworld"
+    std::string dir(name);
+    for (char& c : dir) {
+        if (c == ':' || c == '/' || c == '\\') c = '_';
+    }
+    return dir;
+}
+
+// Caller holds g_store_mutex. Returns nullptr if the region cannot be mapped,
+// or if it has no file yet and create_file is false.
+Region* region_for(Store& store, int32_t world_id, int32_t chunk_x, int32_t chunk_z, bool create_file) {
+    if (g_root.empty()) return nullptr;
+    int32_t region_x = region_of(chunk_x);
+    int32_t region_z = region_of(chunk_z);
+    Region& region = store.regions[{world_id, region_x, region_z}];
+    if (region.base != nullptr) return &region;
+    if (region.failed) return nullptr;
+
+    std::string dir = dimension_dir(world_id);
+    if (dir.empty()) {
+        region.failed = true;
+        return nullptr;
+    }
+    std::filesystem::path path = std::filesystem::path(g_root) / store.name / dir /
+        ("r." + std::to_string(region_x) + "." + std::to_string(region_z) + ".rsd");
+    std::error_code ec;
+    if (!create_file && !std::filesystem::exists(path, ec)) return nullptr;
+    if (!map_region(region, path, store.page_size)) {
+        std::cerr << "Failed to map chunk data region " << path.string() << std::endl;
+        region.failed = true;
+        return nullptr;
+    }
+    return &region;
+}
+
+size_t page_offset(const Store& store, int32_t chunk_x, int32_t chunk_z) {
+    return CHUNK_DATA_HEADER_SIZE + static_cast<size_t>(slot_of(chunk_x, chunk_z)) * store.page_size;
+}
+
+// Store names become directory names: letters, digits, '_' and '-' only
+bool valid_store_name(const char* name) {
+    if (name == nullptr || *name == '\0') return false;
+    for (const char* c = name; *c; c++) {
+        bool ok = (*c >= 'a' && *c <= 'z') || (*c >= 'A' && *c <= 'Z') || (*c >= '0' && *c <= '9') ||
+                  *c == '_' || *c == '-';
+        if (!ok) return false;
+    }
+    return true;
+}
+
+Store* store_for(int32_t handle) {
+    if (handle < 0 || handle >= static_cast<int32_t>(g_stores.size())) return nullptr;
+    return g_stores[handle].get();
+}
+
+} // namespace
+
+extern "C" {
+
+void chunk_data_set_root(const char* path) {
+    std::lock_guard<std::mutex> lock(g_store_mutex);
+    g_root = path ? path : "";
+}
+
+int32_t chunk_data_open(const char* name, int32_t page_size) {
+    if (!valid_store_name(name)) return -1;
+    if (page_size <= 0 || page_size > CHUNK_DATA_MAX_PAGE_SIZE) return -1;
+    page_size = (page_size + kPageAlignment - 1) / kPageAlignment * kPageAlignment;
+
+    std::lock_guard<std::mutex> lock(g_store_mutex);
+    for (size_t i = 0; i < g_stores.size(); i++) {
+        if (g_stores[i]->name == name) {
+            return g_stores[i]->page_size == page_size ? static_cast<int32_t>(i) : -1;
+        }
+    }
+    auto store = std::make_unique<Store>();
+    store->name = name;
+    store->page_size = page_size;
+    g_stores.push_back(std::move(store));
+    return static_cast<int32_t>(g_stores.size() - 1);
+}
+
+int32_t chunk_data_page_size(int32_t store) {
+    std::lock_guard<std::mutex> lock(g_store_mutex);
+    Store* s = store_for(store);
+    return s ? s->page_size : 0;
+}
+
+uint8_t* chunk_data_page(int32_t store, int32_t world_id, int32_t chunk_x, int32_t chunk_z, bool create) {
+    std::lock_guard<std::mutex> lock(g_store_mutex);
+    Store* s = store_for(store);
+    if (s == nullptr || g_loaded_chunks.count({world_id, chunk_x, chunk_z}) == 0) return nullptr;
+
+    Region* region = region_for(*s, world_id, chunk_x, chunk_z, create);
+    if (region == nullptr) return nullptr;
+
+    uint8_t& present = region->base[kPresentOffset + slot_of(chunk_x, chunk_z)];
+    if (!present) {
+        if (!create) return nullptr;
+        present = 1;
+        s->dirty.insert({world_id, chunk_x, chunk_z});
+    }
+    return region->base + page_offset(*s, chunk_x, chunk_z);
+}
+
+void chunk_data_mark_dirty(int32_t store, int32_t world_id, int32_t chunk_x, int32_t chunk_z) {
+    std::lock_guard<std::mutex> lock(g_store_mutex);
+    Store* s = store_for(store);
+    if (s != nullptr) s->dirty.insert({world_id, chunk_x, chunk_z});
+}
+
+void chunk_data_chunk_loaded(int32_t world_id, int32_t chunk_x, int32_t chunk_z) {
+    std::lock_guard<std::mutex> lock(g_store_mutex);
+    g_loaded_chunks.insert({world_id, chunk_x, chunk_z});
+    for (auto& store : g_stores) {
+        Region* region = region_for(*store, world_id, chunk_x, chunk_z, false);
+        if (region != nullptr && region->base[kPresentOffset + slot_of(chunk_x, chunk_z)]) {
+            prefetch_range(*region, page_offset(*store, chunk_x, chunk_z), store->page_size);
+        }
+    }
+}
+
+void chunk_data_chunk_unloaded(int32_t world_id, int32_t chunk_x, int32_t chunk_z) {
+    std::lock_guard<std::mutex> lock(g_store_mutex);
+    ChunkKey chunk{world_id, chunk_x, chunk_z};
+    if (g_loaded_chunks.erase(chunk) == 0) return;
+
+    for (auto& store : g_stores) {
+        auto region_it = store->regions.find({world_id, region_of(chunk_x), region_of(chunk_z)});
+        if (region_it == store->regions.end() || region_it->second.base == nullptr) continue;
+        Region& region = region_it->second;
+        size_t offset = page_offset(*store, chunk_x, chunk_z);
+        if (store->dirty.erase(chunk) > 0) {
+            sync_range(region, offset, store->page_size);
+            sync_range(region, 0, CHUNK_DATA_HEADER_SIZE);
+        }
+        drop_range(region, offset, store->page_size);
+    }
+}
+
+int32_t chunk_data_flush() {
+    std::lock_guard<std::mutex> lock(g_store_mutex);
+    int32_t written = 0;
+    for (auto& store : g_stores) {
+        std::unordered_set<ChunkKey, ChunkKeyHash> synced_headers;
+        for (const ChunkKey& chunk : store->dirty) {
+            ChunkKey region_key{chunk.world_id, region_of(chunk.x), region_of(chunk.z)};
+            auto region_it = store->regions.find(region_key);
+            if (region_it == store->regions.end() || region_it->second.base == nullptr) continue;
+            sync_range(region_it->second, page_offset(*store, chunk.x, chunk.z), store->page_size);
+            if (synced_headers.insert(region_key).second) {
+                sync_range(region_it->second, 0, CHUNK_DATA_HEADER_SIZE);
+            }
+            written++;
+        }
+        store->dirty.clear();
+    }
+    return written;
+}
+
+void chunk_data_close_all() {
+    std::lock_guard<std::mutex> lock(g_store_mutex);
+    for (auto& store : g_stores) {
+        for (auto& region : store->regions) {
+            unmap_region(region.second);
+        }
+    }
+    g_stores.clear();
+    g_loaded_chunks.clear();
+}
+
+} // extern "C"
@@ -0,0 +1,72 @@
+#ifndef CHUNK_DATA_STORE_H
+#define CHUNK_DATA_STORE_H
+
+#include <cstdint>
+
+// ==========================================================================
+// Chunk Data Store
+// ==========================================================================
+// Persistent per-chunk pages for Dart mod state (machine state, claims,
+// custom ores...), keyed by (world_id, chunk_x, chunk_z). World ids are the
+// ones interned by chunk_snapshot_world_id().
+//
+// Each named store keeps one fixed-size page per chunk in region files laid
+// out like vanilla region files: 32x32 chunks per file at
+//   <root>/<store>/<dimension>/r.<region_x>.<region_z>.rsd
+// Region files are sparse (on filesystems that support it; on Windows the
+// file is marked sparse with FSCTL_SET_SPARSE) and memory-mapped, so only
+// pages that are touched cost memory or disk. Dart reads and writes the mapped page directly.
+//
+// Region file layout:
+//   header (CHUNK_DATA_HEADER_SIZE bytes):
+//     char magic[8] = "RSDCHK01", uint32 version, uint32 page_size,
+//     uint8 present[1024]   (1 once the chunk's page has been created)
+//   pages: 1024 * page_size bytes, slot = ((chunk_z & 31) << 5) | (chunk_x & 31)
+//
+// Lifecycle (driven by Java):
+//   - chunk load:   the page is prefetched if it exists
+//   - chunk unload: the page is written back if dirty and dropped from memory
+//   - world save:   only dirty pages are written back
+// Region mappings stay valid until chunk_data_close_all(), so a page pointer
+// never dangles while the server runs; after unload it just faults back in.
+// ==========================================================================
+
+#define CHUNK_DATA_HEADER_SIZE 4096
+#define CHUNK_DATA_REGION_CHUNKS 1024
+#define CHUNK_DATA_MAX_PAGE_SIZE (1024 * 1024)
+
+extern "C" {
+
+// Set the directory that holds all stores (the world save folder).
+// Must be called before pages can be accessed.
+void chunk_data_set_root(const char* path);
+
+// Open (or return the already open) store named name. page_size is rounded
+// up to a multiple of 4096. Returns a store handle >= 0, or -1 on error
+// (invalid name, or page_size differs from the existing open store).
+int32_t chunk_data_open(const char* name, int32_t page_size);
+
+// Page size of an open store (0 if the handle is invalid)
+int32_t chunk_data_page_size(int32_t store);
+
+// Pointer to the chunk's page, or nullptr if the chunk is not loaded, the
+// root is not set or the region file cannot be mapped. With create == false,
+// returns nullptr for chunks that never had a page. Pages start zeroed.
+uint8_t* chunk_data_page(int32_t store, int32_t world_id, int32_t chunk_x, int32_t chunk_z, bool create);
+
+// Mark a page as modified so the next save writes it back.
+void chunk_data_mark_dirty(int32_t store, int32_t world_id, int32_t chunk_x, int32_t chunk_z);
+
+// Chunk lifecycle notifications (server thread)
+void chunk_data_chunk_loaded(int32_t world_id, int32_t chunk_x, int32_t chunk_z);
+void chunk_data_chunk_unloaded(int32_t world_id, int32_t chunk_x, int32_t chunk_z);
+
+// Write back all dirty pages (world save). Returns the number of pages written.
+int32_t chunk_data_flush();
+
+// Flush and unmap everything (server shutdown). Handles become invalid.
+void chunk_data_close_all();
+
+} // extern "C"
+
+#endif // CHUNK_DATA_STORE_H
@@ -0,0 +1,262 @@
+#include "chunk_snapshot.h"
+
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// Reference count header placed in front of every published snapshot.
+// The snapshot pointer handed to readers is header + sizeof(SnapshotBuffer).
+struct alignas(8) SnapshotBuffer {
+    std::atomic<int32_t> refs;
+    int32_t size;
+};
+
+uint8_t* allocate_snapshot(size_t size) {
+    void* memory = ::operator new(sizeof(SnapshotBuffer) + size);
+    auto* buffer = new (memory) SnapshotBuffer();
+    buffer->refs.store(1, std::memory_order_relaxed);  // Reference owned by the store
+    buffer->size = static_cast<int32_t>(size);
+    return reinterpret_cast<uint8_t*>(buffer + 1);
+}
+
+SnapshotBuffer* buffer_of(const void* snapshot) {
+    return reinterpret_cast<SnapshotBuffer*>(const_cast<uint8_t*>(static_cast<const uint8_t*>(snapshot))) - 1;
+}
+
+void retain_snapshot(const void* snapshot) {
+    buffer_of(snapshot)->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+void release_snapshot(const void* snapshot) {
+    if (snapshot == nullptr) return;
+    SnapshotBuffer* buffer = buffer_of(snapshot);
+    if (buffer->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        buffer->~SnapshotBuffer();
+        ::operator delete(buffer);
+    }
+}
+
+struct ChunkKey {
+    int32_t world_id;
+    int32_t chunk_x;
+    int32_t chunk_z;
+
+    bool operator==(const ChunkKey& other) const {
+        return world_id == other.world_id && chunk_x == other.chunk_x && chunk_z == other.chunk_z;
+    }
+};
+
+struct ChunkKeyHash {
+    size_t operator()(const ChunkKey& key) const {
+        uint64_t packed = (static_cast<uint64_t>(static_cast<uint32_t>(key.chunk_x)) << 32) |
+                          static_cast<uint32_t>(key.chunk_z);
+        return std::hash<uint64_t>()(packed) ^ (static_cast<size_t>(key.world_id) * 0x9E3779B97F4A7C15ULL);
+    }
+};
+
+struct ChunkEntry {
+    std::map<int32_t, const ChunkSectionSnapshot*> sections;
+    const ChunkHeightmapSnapshot* heightmaps = nullptr;
+};
+
+std::shared_mutex g_snapshot_mutex;
+std::unordered_map<ChunkKey, ChunkEntry, ChunkKeyHash> g_snapshots;
+std::atomic<uint64_t> g_snapshot_version{0};
+std::atomic<int64_t> g_snapshot_count{0};
+std::atomic<int64_t> g_snapshot_bytes{0};
+
+std::mutex g_request_mutex;
+std::vector<int32_t> g_requests;
+
+std::mutex g_world_mutex;
+std::unordered_map<std::string, int32_t> g_world_ids;
+std::vector<std::string> g_world_names;  // Indexed by world id
+
+void account(const void* snapshot, int64_t sign) {
+    if (snapshot == nullptr) return;
+    g_snapshot_count.fetch_add(sign, std::memory_order_relaxed);
+    g_snapshot_bytes.fetch_add(sign * buffer_of(snapshot)->size, std::memory_order_relaxed);
+}
+
+// Swap in a new snapshot; returns the one it replaced (still owned by the store's reference)
+template <typename T>
+const T* replace_snapshot(const T*& slot, const T* snapshot) {
+    const T* previous = slot;
+    slot = snapshot;
+    account(snapshot, 1);
+    account(previous, -1);
+    return previous;
+}
+
+} // namespace
+
+extern "C" {
+
+int32_t chunk_snapshot_world_id(const char* dimension) {
+    if (dimension == nullptr) return -1;
+    std::lock_guard<std::mutex> lock(g_world_mutex);
+    auto it = g_world_ids.find(dimension);
+    if (it != g_world_ids.end()) return it->second;
+    int32_t id = static_cast<int32_t>(g_world_ids.size());
+    g_world_ids.emplace(dimension, id);
+    g_world_names.emplace_back(dimension);
+    return id;
+}
+
+int32_t chunk_snapshot_world_name(int32_t world_id, char* out, int32_t capacity) {
+    std::lock_guard<std::mutex> lock(g_world_mutex);
+    if (world_id < 0 || world_id >= static_cast<int32_t>(g_world_names.size())) return -1;
+    const std::string& name = g_world_names[world_id];
+    if (out != nullptr && capacity > 0) {
+        size_t count = name.size() < static_cast<size_t>(capacity - 1) ? name.size() : static_cast<size_t>(capacity - 1);
+        std::memcpy(out, name.data(), count);
+        out[count] = '\0';
+    }
+    return static_cast<int32_t>(name.size());
+}
+
+void chunk_snapshot_request(int32_t world_id, int32_t chunk_x, int32_t chunk_z, int32_t mode) {
+    std::lock_guard<std::mutex> lock(g_request_mutex);
+    g_requests.insert(g_requests.end(), {world_id, chunk_x, chunk_z, mode});
+}
+
+int32_t chunk_snapshot_poll_requests(int32_t* out, int32_t max_requests) {
+    std::lock_guard<std::mutex> lock(g_request_mutex);
+    int32_t available = static_cast<int32_t>(g_requests.size() / 4);
+    int32_t count = available < max_requests ? available : max_requests;
+    if (count <= 0) return 0;
+    std::memcpy(out, g_requests.data(), sizeof(int32_t) * 4 * count);
+    g_requests.erase(g_requests.begin(), g_requests.begin() + 4 * count);
+    return count;
+}
+
+void chunk_snapshot_publish_section(int32_t world_id, int32_t chunk_x, int32_t section_y, int32_t chunk_z,
+                                    const int32_t* palette, int32_t palette_size, const uint16_t* indices) {
+    if (palette == nullptr || palette_size <= 0) return;
+    bool uniform = palette_size == 1 || indices == nullptr;
+    if (uniform) palette_size = 1;
+
+    size_t palette_bytes = sizeof(int32_t) * static_cast<size_t>(palette_size);
+    size_t index_bytes = uniform ? 0 : sizeof(uint16_t) * CHUNK_SECTION_VOLUME;
+    uint8_t* data = allocate_snapshot(sizeof(ChunkSectionSnapshot) + palette_bytes + index_bytes);
+
+    auto* header = reinterpret_cast<ChunkSectionSnapshot*>(data);
+    header->version = g_snapshot_version.fetch_add(1, std::memory_order_relaxed) + 1;
+    header->world_id = world_id;
+    header->chunk_x = chunk_x;
+    header->section_y = section_y;
+    header->chunk_z = chunk_z;
+    header->palette_size = palette_size;
+    header->reserved = 0;
+    std::memcpy(data + sizeof(ChunkSectionSnapshot), palette, palette_bytes);
+    if (!uniform) {
+        std::memcpy(data + sizeof(ChunkSectionSnapshot) + palette_bytes, indices, index_bytes);
+    }
+
+    const ChunkSectionSnapshot* previous = nullptr;
+    {
+        std::unique_lock<std::shared_mutex> lock(g_snapshot_mutex);
+        ChunkEntry& entry = g_snapshots[{world_id, chunk_x, chunk_z}];
+        const ChunkSectionSnapshot*& slot = entry.sections[section_y];
+        previous = replace_snapshot(slot, static_cast<const ChunkSectionSnapshot*>(header));
+    }
+    release_snapshot(previous);
+}
+
+void chunk_snapshot_publish_heightmaps(int32_t world_id, int32_t chunk_x, int32_t chunk_z,
+                                       const int16_t* heights, int32_t type_count) {
+    if (heights == nullptr || type_count <= 0) return;
+
+    size_t height_bytes = sizeof(int16_t) * CHUNK_HEIGHTMAP_AREA * static_cast<size_t>(type_count);
+    uint8_t* data = allocate_snapshot(sizeof(ChunkHeightmapSnapshot) + height_bytes);
+
+    auto* header = reinterpret_cast<ChunkHeightmapSnapshot*>(data);
+    header->version = g_snapshot_version.fetch_add(1, std::memory_order_relaxed) + 1;
+    header->world_id = world_id;
+    header->chunk_x = chunk_x;
+    header->chunk_z = chunk_z;
+    header->type_count = type_count;
+    std::memcpy(data + sizeof(ChunkHeightmapSnapshot), heights, height_bytes);
+
+    const ChunkHeightmapSnapshot* previous = nullptr;
+    {
+        std::unique_lock<std::shared_mutex> lock(g_snapshot_mutex);
+        ChunkEntry& entry = g_snapshots[{world_id, chunk_x, chunk_z}];
+        previous = replace_snapshot(entry.heightmaps, static_cast<const ChunkHeightmapSnapshot*>(header));
+    }
+    release_snapshot(previous);
+}
+
+void chunk_snapshot_evict_chunk(int32_t world_id, int32_t chunk_x, int32_t chunk_z) {
+    ChunkEntry evicted;
+    {
+        std::unique_lock<std::shared_mutex> lock(g_snapshot_mutex);
+        auto it = g_snapshots.find({world_id, chunk_x, chunk_z});
+        if (it == g_snapshots.end()) return;
+        evicted = std::move(it->second);
+        g_snapshots.erase(it);
+    }
+    for (auto& section : evicted.sections) {
+        account(section.second, -1);
+        release_snapshot(section.second);
+    }
+    account(evicted.heightmaps, -1);
+    release_snapshot(evicted.heightmaps);
+}
+
+void chunk_snapshot_clear() {
+    std::unordered_map<ChunkKey, ChunkEntry, ChunkKeyHash> snapshots;
+    {
+        std::unique_lock<std::shared_mutex> lock(g_snapshot_mutex);
+        snapshots.swap(g_snapshots);
+    }
+    for (auto& chunk : snapshots) {
+        for (auto& section : chunk.second.sections) {
+            release_snapshot(section.second);
+        }
+        release_snapshot(chunk.second.heightmaps);
+    }
+    g_snapshot_count.store(0, std::memory_order_relaxed);
+    g_snapshot_bytes.store(0, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(g_request_mutex);
+    g_requests.clear();
+}
+
+const ChunkSectionSnapshot* chunk_snapshot_acquire_section(int32_t world_id, int32_t chunk_x,
+                                                           int32_t section_y, int32_t chunk_z) {
+    std::shared_lock<std::shared_mutex> lock(g_snapshot_mutex);
+    auto it = g_snapshots.find({world_id, chunk_x, chunk_z});
+    if (it == g_snapshots.end()) return nullptr;
+    auto section = it->second.sections.find(section_y);
+    if (section == it->second.sections.end() || section->second == nullptr) return nullptr;
+    retain_snapshot(section->second);
+    return section->second;
+}
+
+const ChunkHeightmapSnapshot* chunk_snapshot_acquire_heightmaps(int32_t world_id, int32_t chunk_x, int32_t chunk_z) {
+    std::shared_lock<std::shared_mutex> lock(g_snapshot_mutex);
+    auto it = g_snapshots.find({world_id, chunk_x, chunk_z});
+    if (it == g_snapshots.end() || it->second.heightmaps == nullptr) return nullptr;
+    retain_snapshot(it->second.heightmaps);
+    return it->second.heightmaps;
+}
+
+void chunk_snapshot_release(const void* snapshot) {
+    release_snapshot(snapshot);
+}
+
+void chunk_snapshot_stats(int64_t* out_count, int64_t* out_bytes) {
+    if (out_count) *out_count = g_snapshot_count.load(std::memory_order_relaxed);
+    if (out_bytes) *out_bytes = g_snapshot_bytes.load(std::memory_order_relaxed);
+}
+
+} // extern "C"
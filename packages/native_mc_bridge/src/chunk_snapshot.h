@@ -0,0 +1,115 @@
+#ifndef CHUNK_SNAPSHOT_H
+#define CHUNK_SNAPSHOT_H
+
+#include <cstdint>
+
+// ==========================================================================
+// Chunk Snapshot Store
+// ==========================================================================
+// Immutable, reference-counted copies of chunk sections and heightmaps that
+// Java publishes from the server thread. Dart code on any isolate or thread
+// can read them concurrently through FFI - no JNI, no isolate entry and no
+// server-thread involvement.
+//
+// Publishing a section replaces the stored buffer (copy-on-write): readers
+// that already acquired the previous version keep a valid buffer until they
+// release it.
+//
+// Every acquire must be paired with chunk_snapshot_release().
+// ==========================================================================
+
+// Snapshot modes for chunk_snapshot_request()
+#define CHUNK_SNAPSHOT_ONCE 0     // Publish the chunk once at the next tick
+#define CHUNK_SNAPSHOT_WATCH 1    // Publish now and republish whenever it is dirtied
+#define CHUNK_SNAPSHOT_UNWATCH 2  // Stop republishing the chunk
+
+#define CHUNK_SECTION_VOLUME 4096
+#define CHUNK_HEIGHTMAP_AREA 256
+
+/**
+ * Header of a published chunk section. Followed by:
+ *   int32_t palette[palette_size]            global block state ids
+ *   uint16_t indices[CHUNK_SECTION_VOLUME]   only when palette_size > 1,
+ *                                            index = (y << 8) | (z << 4) | x
+ * A section with palette_size == 1 is uniform (e.g. all air).
+ */
+struct ChunkSectionSnapshot {
+    uint64_t version;       // Publish sequence number (higher = newer)
+    int32_t world_id;
+    int32_t chunk_x;
+    int32_t section_y;
+    int32_t chunk_z;
+    int32_t palette_size;
+    int32_t reserved;
+};
+
+/**
+ * Header of published chunk heightmaps. Followed by:
+ *   int16_t heights[type_count][CHUNK_HEIGHTMAP_AREA], index = (z << 4) | x
+ * Types are in Heightmap.Types order as sent by Java (WORLD_SURFACE,
+ * MOTION_BLOCKING, MOTION_BLOCKING_NO_LEAVES, OCEAN_FLOOR).
+ */
+struct ChunkHeightmapSnapshot {
+    uint64_t version;
+    int32_t world_id;
+    int32_t chunk_x;
+    int32_t chunk_z;
+    int32_t type_count;
+};
+
+extern "C" {
+
+// Map a dimension id (e.g. "minecraft:overworld") to a stable small world id.
+int32_t chunk_snapshot_world_id(const char* dimension);
+
+// Copy the dimension id of an interned world id into out (NUL-terminated).
+// Returns the full name length, or -1 if the id is unknown.
+int32_t chunk_snapshot_world_name(int32_t world_id, char* out, int32_t capacity);
+
+// --------------------------------------------------------------------------
+// Requests (Dart -> Java, serviced once per server tick)
+// --------------------------------------------------------------------------
+
+void chunk_snapshot_request(int32_t world_id, int32_t chunk_x, int32_t chunk_z, int32_t mode);
+
+// Drain pending requests into out as (world_id, chunk_x, chunk_z, mode) tuples.
+// Returns the number of requests written (at most max_requests).
+int32_t chunk_snapshot_poll_requests(int32_t* out, int32_t max_requests);
+
+// --------------------------------------------------------------------------
+// Publishing (Java side)
+// --------------------------------------------------------------------------
+
+// indices may be null when palette_size == 1
+void chunk_snapshot_publish_section(int32_t world_id, int32_t chunk_x, int32_t section_y, int32_t chunk_z,
+                                    const int32_t* palette, int32_t palette_size, const uint16_t* indices);
+
+void chunk_snapshot_publish_heightmaps(int32_t world_id, int32_t chunk_x, int32_t chunk_z,
+                                       const int16_t* heights, int32_t type_count);
+
+// Drop every snapshot of a chunk (chunk unloaded)
+void chunk_snapshot_evict_chunk(int32_t world_id, int32_t chunk_x, int32_t chunk_z);
+
+// Drop all snapshots and pending requests (server shutdown)
+void chunk_snapshot_clear();
+
+// --------------------------------------------------------------------------
+// Reading (any thread / isolate)
+// --------------------------------------------------------------------------
+
+// Returns a retained snapshot or nullptr if the section was never published.
+const ChunkSectionSnapshot* chunk_snapshot_acquire_section(int32_t world_id, int32_t chunk_x,
+                                                           int32_t section_y, int32_t chunk_z);
+
+// Returns retained heightmaps or nullptr if the chunk was never published.
+const ChunkHeightmapSnapshot* chunk_snapshot_acquire_heightmaps(int32_t world_id, int32_t chunk_x, int32_t chunk_z);
+
+// Release a snapshot returned by either acquire function.
+void chunk_snapshot_release(const void* snapshot);
+
+// Number of stored snapshots and their total size in bytes (for debugging)
+void chunk_snapshot_stats(int64_t* out_count, int64_t* out_bytes);
+
+} // extern "C"
+
+#endif // CHUNK_SNAPSHOT_H
@@ -0,0 +1,50 @@
+#include "command_args.h"
+
+#include <cstring>
+
+namespace {
+
+// Payload size of a fixed-size tag, 0 for COMMAND_ARG_STRING, -1 if unknown
+int32_t fixed_payload_size(uint8_t tag) {
+    switch (tag) {
+        case COMMAND_ARG_INT: return 4;
+        case COMMAND_ARG_DOUBLE: return 8;
+        case COMMAND_ARG_BOOL: return 1;
+        case COMMAND_ARG_STRING: return 0;
+        case COMMAND_ARG_ENTITY: return 4;
+        case COMMAND_ARG_BLOCK_POS: return 12;
+        default: return -1;
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+int32_t command_args_validate(const uint8_t* data, int32_t length) {
+    if (data == nullptr || length < COMMAND_ARGS_HEADER_SIZE) return -1;
+    if (data[0] != COMMAND_ARGS_VERSION) return -1;
+
+    int32_t count = data[1];
+    int64_t offset = COMMAND_ARGS_HEADER_SIZE;
+    for (int32_t i = 0; i < count; i++) {
+        if (offset + 2 > length) return -1;
+        uint8_t tag = data[offset + 1];
+        offset += 2;
+
+        int32_t size = fixed_payload_size(tag);
+        if (size < 0) return -1;
+        if (tag == COMMAND_ARG_STRING) {
+            if (offset + 4 > length) return -1;
+            uint32_t string_length;
+            std::memcpy(&string_length, data + offset, sizeof(string_length));
+            offset += 4;
+            size = static_cast<int32_t>(string_length > static_cast<uint32_t>(length) ? length + 1 : string_length);
+        }
+        offset += size;
+        if (offset > length) return -1;
+    }
+    return offset == length ? count : -1;
+}
+
+} // extern "C"
@@ -0,0 +1,50 @@
+#ifndef COMMAND_ARGS_H
+#define COMMAND_ARGS_H
+
+#include <cstdint>
+
+// ==========================================================================
+// Binary Command Argument Buffer
+// ==========================================================================
+// Parsed Brigadier arguments for server_dispatch_command_execute. Java
+// (CommandArgsWriter) encodes them into a reusable direct ByteBuffer. The
+// bridge validates the buffer and passes the pointer to Dart, which reads it
+// in place (CommandArguments in commands.dart). No JSON is built or parsed
+// per invocation.
+//
+// Layout, little-endian, no padding:
+//   u8 version (COMMAND_ARGS_VERSION)
+//   u8 count
+//   count x { u8 index, u8 tag, payload }
+//
+// index is the argument's position in the command's registered argument
+// list. Optional arguments that were not given are left out.
+//
+//   tag                     payload
+//   COMMAND_ARG_INT         i32
+//   COMMAND_ARG_DOUBLE      f64
+//   COMMAND_ARG_BOOL        u8 (0 or 1)
+//   COMMAND_ARG_STRING      u32 byte length + UTF-8 bytes (strings, block/item ids)
+//   COMMAND_ARG_ENTITY      i32 entity id
+//   COMMAND_ARG_BLOCK_POS   i32 x, i32 y, i32 z
+// ==========================================================================
+
+#define COMMAND_ARGS_VERSION 1
+#define COMMAND_ARGS_HEADER_SIZE 2
+
+#define COMMAND_ARG_INT 1
+#define COMMAND_ARG_DOUBLE 2
+#define COMMAND_ARG_BOOL 3
+#define COMMAND_ARG_STRING 4
+#define COMMAND_ARG_ENTITY 5
+#define COMMAND_ARG_BLOCK_POS 6
+
+extern "C" {
+
+// Check that a buffer is well formed: known version and tags, payloads
+// within bounds, no trailing bytes. Returns the argument count, or -1.
+int32_t command_args_validate(const uint8_t* data, int32_t length);
+
+} // extern "C"
+
+#endif // COMMAND_ARGS_H
@@ -3,6 +3,9 @@
 #include "callback_registry.h"
 #include "object_registry.h"
 #include "generic_jni.h"
+#include "asset_bundle.h"
+#include "thread_roles.h"
+#include "upcall_table.h"
 #include <flutter_embedder.h>
 
 #include <jni.h>
@@ -22,6 +25,7 @@
 
 static FlutterEngine g_engine = nullptr;
 static FlutterEngineAOTData g_aot_data = nullptr;
+static int32_t g_asset_bundle = -1;
 static bool g_initialized = false;
 static bool g_rendering_enabled = false;
 static std::mutex g_engine_mutex;
@@ -193,6 +197,11 @@ static void OnVsync(void* user_data, intptr_t baton) {
     FlutterEngineOnVsync(g_engine, baton, now, now + frame_interval);
 }
 
+// Engine-created threads (raster, IO, workers) report their priority here
+static void OnThreadPriority(FlutterThreadPriority priority) {
+    thread_role_apply(thread_role_for_flutter_priority(static_cast<int32_t>(priority)));
+}
+
 // Root isolate create callback - called when root isolate is created
 static void OnRootIsolateCreate(void* user_data) {
     std::cout << "Flutter root isolate created" << std::endl;
@@ -234,6 +243,9 @@ bool dart_bridge_init(const char* assets_path, const char* icu_data_path,
     args.assets_path = assets_path;
     args.icu_data_path = icu_data_path;
 
+    // Map the assets and ICU data first so the engine's reads hit the page cache
+    g_asset_bundle = asset_bundle_open(assets_path, icu_data_path);
+
     // Detect AOT vs JIT mode based on whether aot_library_path is provided
     bool is_aot_mode = (aot_library_path != nullptr && strlen(aot_library_path) > 0);
 
@@ -304,7 +316,7 @@ bool dart_bridge_init(const char* assets_path, const char* icu_data_path,
     custom_task_runners.platform_task_runner = &platform_task_runner;
     custom_task_runners.render_task_runner = &platform_task_runner;  // Same as platform
     custom_task_runners.ui_task_runner = &platform_task_runner;      // Run UI on platform thread
-    custom_task_runners.thread_priority_setter = nullptr;
+    custom_task_runners.thread_priority_setter = OnThreadPriority;
 
     args.custom_task_runners = &custom_task_runners;
 
@@ -321,6 +333,8 @@ bool dart_bridge_init(const char* assets_path, const char* icu_data_path,
 
     if (result != kSuccess) {
         std::cerr << "Failed to start Flutter engine, error code: " << result << std::endl;
+        asset_bundle_release(g_asset_bundle);
+        g_asset_bundle = -1;
         return false;
     }
 
@@ -389,6 +403,9 @@ void dart_bridge_shutdown() {
         g_aot_data = nullptr;
     }
 
+    asset_bundle_release(g_asset_bundle);
+    g_asset_bundle = -1;
+
     g_initialized = false;
     g_jvm_ref = nullptr;
     g_frame_callback = nullptr;
@@ -1113,52 +1130,26 @@ static JNIEnv* get_jni_env_for_container() {
     return env;
 }
 
-// Cached method IDs for container item access
-static jclass g_dart_container_menu_class = nullptr;
-static jmethodID g_get_container_item_impl = nullptr;
-static jmethodID g_set_container_item_impl = nullptr;
-static jmethodID g_get_container_slot_count_impl = nullptr;
-static jmethodID g_clear_container_slot_impl = nullptr;
-
-static bool init_container_jni_cache(JNIEnv* env) {
-    if (g_dart_container_menu_class != nullptr) return true;
-
-    jclass localClass = env->FindClass("com/redstone/DartContainerMenu");
-    if (localClass == nullptr) {
-        std::cerr << "Failed to find DartContainerMenu class" << std::endl;
-        env->ExceptionClear();
-        return false;
+// Container item access goes through DartContainerMenu's static *Impl methods,
+// resolved in the upcall table. Null if they could not be resolved.
+static const dart_mc_bridge::UpcallTable* container_upcalls() {
+    const auto& upcalls = dart_mc_bridge::upcalls();
+    if (!upcalls.core_ready) {
+        std::cerr << "Container upcalls are not resolved" << std::endl;
+        return nullptr;
     }
-    g_dart_container_menu_class = static_cast<jclass>(env->NewGlobalRef(localClass));
-    env->DeleteLocalRef(localClass);
-
-    g_get_container_item_impl = env->GetStaticMethodID(g_dart_container_menu_class,
-        "getContainerItemImpl", "(JI)Ljava/lang/String;");
-    g_set_container_item_impl = env->GetStaticMethodID(g_dart_container_menu_class,
-        "setContainerItemImpl", "(JILjava/lang/String;I)V");
-    g_get_container_slot_count_impl = env->GetStaticMethodID(g_dart_container_menu_class,
-        "getContainerSlotCountImpl", "(J)I");
-    g_clear_container_slot_impl = env->GetStaticMethodID(g_dart_container_menu_class,
-        "clearContainerSlotImpl", "(JI)V");
-
-    if (g_get_container_item_impl == nullptr || g_set_container_item_impl == nullptr ||
-        g_get_container_slot_count_impl == nullptr || g_clear_container_slot_impl == nullptr) {
-        std::cerr << "Failed to find container item methods" << std::endl;
-        env->ExceptionClear();
-        return false;
-    }
-
-    return true;
+    return &upcalls;
 }
 
 const char* dart_get_container_item(int64_t menu_id, int32_t slot_index) {
     JNIEnv* env = get_jni_env_for_container();
     if (env == nullptr) return strdup("");
 
-    if (!init_container_jni_cache(env)) return strdup("");
+    const auto* upcalls = container_upcalls();
+    if (upcalls == nullptr) return strdup("");
 
-    jstring result = (jstring)env->CallStaticObjectMethod(g_dart_container_menu_class,
-        g_get_container_item_impl, static_cast<jlong>(menu_id), static_cast<jint>(slot_index));
+    jstring result = (jstring)env->CallStaticObjectMethod(upcalls->container_menu_class,
+        upcalls->get_container_item, static_cast<jlong>(menu_id), static_cast<jint>(slot_index));
 
     if (env->ExceptionCheck()) {
         env->ExceptionDescribe();
@@ -1180,10 +1171,11 @@ void dart_set_container_item(int64_t menu_id, int32_t slot_index, const char* it
     JNIEnv* env = get_jni_env_for_container();
     if (env == nullptr) return;
 
-    if (!init_container_jni_cache(env)) return;
+    const auto* upcalls = container_upcalls();
+    if (upcalls == nullptr) return;
 
     jstring jItemId = env->NewStringUTF(item_id);
-    env->CallStaticVoidMethod(g_dart_container_menu_class, g_set_container_item_impl,
+    env->CallStaticVoidMethod(upcalls->container_menu_class, upcalls->set_container_item,
         static_cast<jlong>(menu_id), static_cast<jint>(slot_index), jItemId, static_cast<jint>(count));
     env->DeleteLocalRef(jItemId);
 
@@ -1197,10 +1189,11 @@ int32_t dart_get_container_slot_count(int64_t menu_id) {
     JNIEnv* env = get_jni_env_for_container();
     if (env == nullptr) return 0;
 
-    if (!init_container_jni_cache(env)) return 0;
+    const auto* upcalls = container_upcalls();
+    if (upcalls == nullptr) return 0;
 
-    jint result = env->CallStaticIntMethod(g_dart_container_menu_class,
-        g_get_container_slot_count_impl, static_cast<jlong>(menu_id));
+    jint result = env->CallStaticIntMethod(upcalls->container_menu_class,
+        upcalls->get_container_slot_count, static_cast<jlong>(menu_id));
 
     if (env->ExceptionCheck()) {
         env->ExceptionDescribe();
@@ -1215,9 +1208,10 @@ void dart_clear_container_slot(int64_t menu_id, int32_t slot_index) {
     JNIEnv* env = get_jni_env_for_container();
     if (env == nullptr) return;
 
-    if (!init_container_jni_cache(env)) return;
+    const auto* upcalls = container_upcalls();
+    if (upcalls == nullptr) return;
 
-    env->CallStaticVoidMethod(g_dart_container_menu_class, g_clear_container_slot_impl,
+    env->CallStaticVoidMethod(upcalls->container_menu_class, upcalls->clear_container_slot,
         static_cast<jlong>(menu_id), static_cast<jint>(slot_index));
 
     if (env->ExceptionCheck()) {
@@ -1237,9 +1231,6 @@ void dart_free_string(const char* str) {
 // Container Opening API (Dart -> Java via C++)
 // ==========================================================================
 
-// Cached method ID for openContainerForPlayer
-static jmethodID g_open_container_for_player = nullptr;
-
 bool dart_open_container_for_player(int32_t player_id, const char* container_id) {
     JNIEnv* env = get_jni_env_for_container();
     if (env == nullptr) {
@@ -1247,28 +1238,10 @@ bool dart_open_container_for_player(int32_t player_id, const char* container_id)
         return false;
     }
 
-    // Find DartBridge class if not cached
-    static jclass dart_bridge_class = nullptr;
-    if (dart_bridge_class == nullptr) {
-        jclass localClass = env->FindClass("com/redstone/DartBridge");
-        if (localClass == nullptr) {
-            std::cerr << "dart_open_container_for_player: Failed to find DartBridge class" << std::endl;
-            env->ExceptionClear();
-            return false;
-        }
-        dart_bridge_class = static_cast<jclass>(env->NewGlobalRef(localClass));
-        env->DeleteLocalRef(localClass);
-    }
-
-    // Get method ID if not cached
-    if (g_open_container_for_player == nullptr) {
-        g_open_container_for_player = env->GetStaticMethodID(
-            dart_bridge_class, "openContainerForPlayer", "(ILjava/lang/String;)Z");
-        if (g_open_container_for_player == nullptr) {
-            std::cerr << "dart_open_container_for_player: Failed to find openContainerForPlayer method" << std::endl;
-            env->ExceptionClear();
-            return false;
-        }
+    const auto& upcalls = dart_mc_bridge::upcalls();
+    if (upcalls.open_container_for_player == nullptr) {
+        std::cerr << "dart_open_container_for_player: openContainerForPlayer is not resolved" << std::endl;
+        return false;
     }
 
     // Create Java string for container ID
@@ -1280,7 +1253,7 @@ bool dart_open_container_for_player(int32_t player_id, const char* container_id)
 
     // Call the Java method
     jboolean result = env->CallStaticBooleanMethod(
-        dart_bridge_class, g_open_container_for_player,
+        upcalls.dart_bridge_class, upcalls.open_container_for_player,
         static_cast<jint>(player_id), jContainerId);
 
     env->DeleteLocalRef(jContainerId);
@@ -1424,10 +1397,10 @@ void register_command_execute_handler(CommandExecuteCallback cb) {
     dart_mc_bridge::CallbackRegistry::instance().setCommandExecuteHandler(cb);
 }
 
-int32_t dispatch_command_execute(int64_t command_id, int32_t player_id, const char* args_json) {
+int32_t dispatch_command_execute(int64_t command_id, int32_t player_id, const uint8_t* args, int32_t args_length) {
     if (!g_initialized || g_engine == nullptr) return 0; // Failure if not initialized
     return dart_mc_bridge::CallbackRegistry::instance().dispatchCommandExecute(
-        command_id, player_id, args_json);
+        command_id, player_id, args, args_length);
 }
 
 // ==========================================================================
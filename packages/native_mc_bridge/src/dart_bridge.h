@@ -430,14 +430,15 @@ extern "C" {
     // ==========================================================================
 
     // Command execute callback (called from Dart via FFI)
-    // Returns the command result (0 = failure, positive = success)
-    typedef int32_t (*CommandExecuteCallback)(int64_t command_id, int32_t player_id, const char* args_json);
+    // Returns the command result (0 = failure, positive = success).
+    // args is a command_args.h buffer, valid only for the duration of the call.
+    typedef int32_t (*CommandExecuteCallback)(int64_t command_id, int32_t player_id, const uint8_t* args, int32_t args_length);
 
     // Command callback registration (called from Dart via FFI)
     void register_command_execute_handler(CommandExecuteCallback cb);
 
     // Command dispatch function (called from Java via JNI)
-    int32_t dispatch_command_execute(int64_t command_id, int32_t player_id, const char* args_json);
+    int32_t dispatch_command_execute(int64_t command_id, int32_t player_id, const uint8_t* args, int32_t args_length);
 
     // ==========================================================================
     // Registry Ready Callback (for Flutter embedder timing)
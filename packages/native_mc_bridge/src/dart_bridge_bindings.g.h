@@ -0,0 +1,298 @@
+// GENERATED CODE - DO NOT MODIFY BY HAND
+// Generated by tools/generate_bridge_bindings.dart from DartBridge.java
+
+#ifndef DART_BRIDGE_BINDINGS_G_H
+#define DART_BRIDGE_BINDINGS_G_H
+
+#define DART_BRIDGE_CLASS "com/redstone/DartBridge"
+#define DART_BRIDGE_BINDING_COUNT 279
+#define DART_BRIDGE_BINDINGS_HASH 0x90d011dbu
+
+struct DartBridgeBinding {
+    const char* name;
+    const char* sig;
+};
+
+static const DartBridgeBinding kDartBridgeBindings[DART_BRIDGE_BINDING_COUNT] = {
+    {"dispatchClientPacket", "(II[B)V"},  // 0
+    {"safeInitServerRuntime", "(Ljava/lang/String;Ljava/lang/String;)Z"},  // 1
+    {"safeShutdownServerRuntime", "()V"},  // 2
+    {"safeTickServer", "()V"},  // 3
+    {"isInitialized", "()Z"},  // 4
+    {"isLibraryLoaded", "()Z"},  // 5
+    {"getServiceUrl", "()Ljava/lang/String;"},  // 6
+    {"dispatchBlockBreak", "(IIIJLjava/lang/String;Ljava/lang/String;)I"},  // 7
+    {"dispatchBlockInteract", "(IIIJI)I"},  // 8
+    {"dispatchTick", "(J)V"},  // 9
+    {"dispatchPlayerJoin", "(I)V"},  // 10
+    {"dispatchPlayerLeave", "(I)V"},  // 11
+    {"dispatchPlayerRespawn", "(IZ)V"},  // 12
+    {"dispatchPlayerChangeDimension", "(ILjava/lang/String;Ljava/lang/String;)V"},  // 13
+    {"dispatchEntityChangeDimension", "(ILjava/lang/String;Ljava/lang/String;)V"},  // 14
+    {"dispatchPlayerDeath", "(ILjava/lang/String;)Ljava/lang/String;"},  // 15
+    {"dispatchEntityDamage", "(ILjava/lang/String;DLjava/lang/String;Ljava/lang/String;III)Z"},  // 16
+    {"dispatchEntityDeath", "(ILjava/lang/String;)V"},  // 17
+    {"dispatchPlayerAttackEntity", "(II)Z"},  // 18
+    {"dispatchPlayerChat", "(ILjava/lang/String;)Ljava/lang/String;"},  // 19
+    {"dispatchPlayerCommand", "(ILjava/lang/String;)Z"},  // 20
+    {"dispatchItemUse", "(ILjava/lang/String;IILjava/lang/String;III)Z"},  // 21
+    {"dispatchItemUseOnBlock", "(ILjava/lang/String;IIIIII)I"},  // 22
+    {"dispatchItemUseOnEntity", "(ILjava/lang/String;III)I"},  // 23
+    {"dispatchBlockPlace", "(IIIILjava/lang/String;)Z"},  // 24
+    {"dispatchPlayerPickupItem", "(IILjava/lang/String;Ljava/lang/String;III)Z"},  // 25
+    {"dispatchPlayerDropItem", "(ILjava/lang/String;I)Z"},  // 26
+    {"dispatchServerStarting", "()V"},  // 27
+    {"dispatchServerStarted", "()V"},  // 28
+    {"dispatchServerStopping", "()V"},  // 29
+    {"saveWorld", "()Z"},  // 30
+    {"stopServer", "()V"},  // 31
+    {"isServerRunning", "()Z"},  // 32
+    {"getServerUptime", "()J"},  // 33
+    {"getAverageTickTime", "()D"},  // 34
+    {"sendS2CPacket", "(IILjava/lang/String;)V"},  // 35
+    {"executeCommand", "(Ljava/lang/String;)V"},  // 36
+    {"executeCommandAsPlayer", "(ILjava/lang/String;)V"},  // 37
+    {"isMcpModeEnabled", "()Z"},  // 38
+    {"getMcpServerPort", "()I"},  // 39
+    {"registerContainerType", "(Ljava/lang/String;Ljava/lang/String;II)V"},  // 40
+    {"openContainerForPlayer", "(ILjava/lang/String;)Z"},  // 41
+    {"hasContainerType", "(Ljava/lang/String;)Z"},  // 42
+    {"getContainerIdByTitle", "(Ljava/lang/String;)Ljava/lang/String;"},  // 43
+    {"getBlockId", "(Ljava/lang/String;III)Ljava/lang/String;"},  // 44
+    {"setBlock", "(Ljava/lang/String;IIILjava/lang/String;)Z"},  // 45
+    {"isAirBlock", "(Ljava/lang/String;III)Z"},  // 46
+    {"getRedstoneSignal", "(Ljava/lang/String;III)I"},  // 47
+    {"setProxyBlockState", "(JIIII)Z"},  // 48
+    {"setChunkForceLoaded", "(Ljava/lang/String;IIZ)Z"},  // 49
+    {"blockToChunk", "(I)I"},  // 50
+    {"getPlayerX", "(I)D"},  // 51
+    {"getPlayerY", "(I)D"},  // 52
+    {"getPlayerZ", "(I)D"},  // 53
+    {"getPlayerYaw", "(I)D"},  // 54
+    {"getPlayerPitch", "(I)D"},  // 55
+    {"teleportPlayer", "(IDDDFF)V"},  // 56
+    {"getPlayerDimension", "(I)Ljava/lang/String;"},  // 57
+    {"teleportPlayerToDimension", "(ILjava/lang/String;DDDFF)V"},  // 58
+    {"getPlayerHealth", "(I)D"},  // 59
+    {"setPlayerHealth", "(IF)V"},  // 60
+    {"getPlayerMaxHealth", "(I)D"},  // 61
+    {"getPlayerFoodLevel", "(I)I"},  // 62
+    {"setPlayerFoodLevel", "(II)V"},  // 63
+    {"getPlayerSaturation", "(I)D"},  // 64
+    {"setPlayerSaturation", "(IF)V"},  // 65
+    {"getPlayerGameMode", "(I)I"},  // 66
+    {"setPlayerGameMode", "(II)V"},  // 67
+    {"getPlayerExperienceLevel", "(I)I"},  // 68
+    {"setPlayerExperienceLevel", "(II)V"},  // 69
+    {"getPlayerTotalExperience", "(I)I"},  // 70
+    {"givePlayerExperience", "(II)V"},  // 71
+    {"sendPlayerMessage", "(ILjava/lang/String;)V"},  // 72
+    {"sendPlayerActionBar", "(ILjava/lang/String;)V"},  // 73
+    {"sendPlayerTitle", "(ILjava/lang/String;Ljava/lang/String;III)V"},  // 74
+    {"getPlayerName", "(I)Ljava/lang/String;"},  // 75
+    {"getPlayerUuid", "(I)Ljava/lang/String;"},  // 76
+    {"isPlayerOnGround", "(I)Z"},  // 77
+    {"isPlayerSneaking", "(I)Z"},  // 78
+    {"isPlayerSprinting", "(I)Z"},  // 79
+    {"isPlayerSwimming", "(I)Z"},  // 80
+    {"isPlayerFlying", "(I)Z"},  // 81
+    {"getPlayerCount", "()I"},  // 82
+    {"getPlayerIdByIndex", "(I)I"},  // 83
+    {"getPlayerIdByName", "(Ljava/lang/String;)I"},  // 84
+    {"getPlayerIdByUuid", "(Ljava/lang/String;)I"},  // 85
+    {"getEntityType", "(I)Ljava/lang/String;"},  // 86
+    {"isLivingEntity", "(I)Z"},  // 87
+    {"isMobEntity", "(I)Z"},  // 88
+    {"isPlayerEntity", "(I)Z"},  // 89
+    {"getEntityDimension", "(I)Ljava/lang/String;"},  // 90
+    {"getEntityX", "(I)D"},  // 91
+    {"getEntityY", "(I)D"},  // 92
+    {"getEntityZ", "(I)D"},  // 93
+    {"setEntityPosition", "(IDDD)V"},  // 94
+    {"getEntityVelocityX", "(I)D"},  // 95
+    {"getEntityVelocityY", "(I)D"},  // 96
+    {"getEntityVelocityZ", "(I)D"},  // 97
+    {"setEntityVelocity", "(IDDD)V"},  // 98
+    {"getEntityYaw", "(I)D"},  // 99
+    {"getEntityPitch", "(I)D"},  // 100
+    {"teleportEntity", "(IDDDFF)V"},  // 101
+    {"teleportEntityToDimension", "(ILjava/lang/String;DDDFF)V"},  // 102
+    {"isEntityOnGround", "(I)Z"},  // 103
+    {"isEntityInWater", "(I)Z"},  // 104
+    {"isEntityOnFire", "(I)Z"},  // 105
+    {"setEntityOnFire", "(II)V"},  // 106
+    {"extinguishEntity", "(I)V"},  // 107
+    {"isEntitySneaking", "(I)Z"},  // 108
+    {"isEntitySprinting", "(I)Z"},  // 109
+    {"isEntityInvisible", "(I)Z"},  // 110
+    {"setEntityInvisible", "(IZ)V"},  // 111
+    {"isEntityGlowing", "(I)Z"},  // 112
+    {"setEntityGlowing", "(IZ)V"},  // 113
+    {"entityHasNoGravity", "(I)Z"},  // 114
+    {"setEntityNoGravity", "(IZ)V"},  // 115
+    {"getEntityCustomName", "(I)Ljava/lang/String;"},  // 116
+    {"setEntityCustomName", "(ILjava/lang/String;)V"},  // 117
+    {"isEntityCustomNameVisible", "(I)Z"},  // 118
+    {"setEntityCustomNameVisible", "(IZ)V"},  // 119
+    {"getEntityTicksExisted", "(I)I"},  // 120
+    {"removeEntity", "(I)V"},  // 121
+    {"discardEntity", "(I)V"},  // 122
+    {"getEntityTags", "(I)Ljava/lang/String;"},  // 123
+    {"addEntityTag", "(ILjava/lang/String;)Z"},  // 124
+    {"removeEntityTag", "(ILjava/lang/String;)Z"},  // 125
+    {"getLivingEntityHealth", "(I)D"},  // 126
+    {"setLivingEntityHealth", "(IF)V"},  // 127
+    {"getLivingEntityMaxHealth", "(I)D"},  // 128
+    {"isLivingEntityDead", "(I)Z"},  // 129
+    {"getLivingEntityArmor", "(I)D"},  // 130
+    {"hurtEntity", "(ID)V"},  // 131
+    {"addEntityEffect", "(ILjava/lang/String;IIZZ)V"},  // 132
+    {"removeEntityEffect", "(ILjava/lang/String;)V"},  // 133
+    {"entityHasEffect", "(ILjava/lang/String;)Z"},  // 134
+    {"clearEntityEffects", "(I)V"},  // 135
+    {"getLivingEntityLookingAt", "(I)I"},  // 136
+    {"mobHasAI", "(I)Z"},  // 137
+    {"setMobAI", "(IZ)V"},  // 138
+    {"getMobTarget", "(I)I"},  // 139
+    {"setMobTarget", "(II)V"},  // 140
+    {"isMobPersistent", "(I)Z"},  // 141
+    {"setMobPersistent", "(IZ)V"},  // 142
+    {"spawnEntity", "(Ljava/lang/String;Ljava/lang/String;DDD)I"},  // 143
+    {"spawnDartEntity", "(Ljava/lang/String;JDDD)I"},  // 144
+    {"spawnFlutterDisplay", "(Ljava/lang/String;DDDFFIFFLjava/lang/String;)I"},  // 145
+    {"getFlutterDisplayWidth", "(I)D"},  // 146
+    {"setFlutterDisplayWidth", "(IF)V"},  // 147
+    {"getFlutterDisplayHeight", "(I)D"},  // 148
+    {"setFlutterDisplayHeight", "(IF)V"},  // 149
+    {"getFlutterDisplayBillboardMode", "(I)I"},  // 150
+    {"setFlutterDisplayBillboardMode", "(II)V"},  // 151
+    {"getFlutterDisplayRoute", "(I)Ljava/lang/String;"},  // 152
+    {"setEntityRotation", "(IFF)V"},  // 153
+    {"getEntitiesInBox", "(Ljava/lang/String;DDDDDD)Ljava/lang/String;"},  // 154
+    {"getEntitiesInRadius", "(Ljava/lang/String;DDDD)Ljava/lang/String;"},  // 155
+    {"getEntitiesByType", "(Ljava/lang/String;Ljava/lang/String;)Ljava/lang/String;"},  // 156
+    {"getItemMaxStackSize", "(Ljava/lang/String;)I"},  // 157
+    {"getItemDisplayName", "(Ljava/lang/String;)Ljava/lang/String;"},  // 158
+    {"getItemStackDamage", "(II)I"},  // 159
+    {"getItemStackMaxDamage", "(II)I"},  // 160
+    {"isItemStackDamageable", "(II)Z"},  // 161
+    {"getItemStackDisplayName", "(II)Ljava/lang/String;"},  // 162
+    {"getPlayerInventoryItem", "(II)Ljava/lang/String;"},  // 163
+    {"setPlayerInventoryItem", "(IILjava/lang/String;I)V"},  // 164
+    {"clearPlayerInventorySlot", "(II)V"},  // 165
+    {"getPlayerSelectedSlot", "(I)I"},  // 166
+    {"setPlayerSelectedSlot", "(II)V"},  // 167
+    {"findPlayerInventoryItem", "(ILjava/lang/String;)I"},  // 168
+    {"findPlayerEmptySlot", "(I)I"},  // 169
+    {"countPlayerInventoryItem", "(ILjava/lang/String;)I"},  // 170
+    {"givePlayerItem", "(ILjava/lang/String;I)Z"},  // 171
+    {"removePlayerItem", "(ILjava/lang/String;I)I"},  // 172
+    {"clearPlayerInventory", "(I)V"},  // 173
+    {"dropItem", "(Ljava/lang/String;DDDLjava/lang/String;IDDD)I"},  // 174
+    {"getItemEntityStack", "(I)Ljava/lang/String;"},  // 175
+    {"setItemEntityStack", "(ILjava/lang/String;I)V"},  // 176
+    {"getItemEntityPickupDelay", "(I)I"},  // 177
+    {"setItemEntityPickupDelay", "(II)V"},  // 178
+    {"getItemEntityAge", "(I)I"},  // 179
+    {"setItemEntityAge", "(II)V"},  // 180
+    {"getTimeOfDay", "(Ljava/lang/String;)J"},  // 181
+    {"setTimeOfDay", "(Ljava/lang/String;J)V"},  // 182
+    {"getGameTime", "(Ljava/lang/String;)J"},  // 183
+    {"getDayCount", "(Ljava/lang/String;)J"},  // 184
+    {"getWeather", "(Ljava/lang/String;)I"},  // 185
+    {"setWeather", "(Ljava/lang/String;II)V"},  // 186
+    {"isRaining", "(Ljava/lang/String;)Z"},  // 187
+    {"isThundering", "(Ljava/lang/String;)Z"},  // 188
+    {"freezeTicks", "()V"},  // 189
+    {"unfreezeTicks", "()V"},  // 190
+    {"stepTicks", "(I)V"},  // 191
+    {"setTickRate", "(D)V"},  // 192
+    {"sprintTicks", "(I)V"},  // 193
+    {"getTickState", "()Ljava/lang/String;"},  // 194
+    {"playSound", "(Ljava/lang/String;DDDLjava/lang/String;Ljava/lang/String;FF)V"},  // 195
+    {"playSoundToPlayer", "(ILjava/lang/String;Ljava/lang/String;FF)V"},  // 196
+    {"spawnParticles", "(Ljava/lang/String;Ljava/lang/String;DDDIDDDD)V"},  // 197
+    {"spawnParticlesToPlayer", "(ILjava/lang/String;DDDIDDDD)V"},  // 198
+    {"createExplosion", "(Ljava/lang/String;DDDFZII)V"},  // 199
+    {"spawnLightning", "(Ljava/lang/String;DDDZ)I"},  // 200
+    {"getWorldBorderCenter", "(Ljava/lang/String;)Ljava/lang/String;"},  // 201
+    {"setWorldBorderCenter", "(Ljava/lang/String;DD)V"},  // 202
+    {"getWorldBorderSize", "(Ljava/lang/String;)D"},  // 203
+    {"setWorldBorderSize", "(Ljava/lang/String;DJ)V"},  // 204
+    {"getSpawnPoint", "(Ljava/lang/String;)Ljava/lang/String;"},  // 205
+    {"setSpawnPoint", "(Ljava/lang/String;III)V"},  // 206
+    {"getDifficulty", "()I"},  // 207
+    {"setDifficulty", "(I)V"},  // 208
+    {"getGameRule", "(Ljava/lang/String;Ljava/lang/String;)Ljava/lang/String;"},  // 209
+    {"setGameRule", "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)V"},  // 210
+    {"dispatchScreenInit", "(JII)V"},  // 211
+    {"dispatchScreenTick", "(J)V"},  // 212
+    {"dispatchScreenRender", "(JIIF)V"},  // 213
+    {"dispatchScreenClose", "(J)V"},  // 214
+    {"dispatchScreenKeyPressed", "(JIII)Z"},  // 215
+    {"dispatchScreenKeyReleased", "(JIII)Z"},  // 216
+    {"dispatchScreenCharTyped", "(JII)Z"},  // 217
+    {"dispatchScreenMouseClicked", "(JDDI)Z"},  // 218
+    {"dispatchScreenMouseReleased", "(JDDI)Z"},  // 219
+    {"dispatchScreenMouseDragged", "(JDDIDD)Z"},  // 220
+    {"dispatchScreenMouseScrolled", "(JDDDD)Z"},  // 221
+    {"dispatchWidgetPressed", "(JJ)V"},  // 222
+    {"dispatchWidgetTextChanged", "(JJLjava/lang/String;)V"},  // 223
+    {"dispatchContainerScreenInit", "(JIIIIII)V"},  // 224
+    {"dispatchContainerScreenRenderBg", "(JIIFII)V"},  // 225
+    {"dispatchContainerScreenClose", "(J)V"},  // 226
+    {"dispatchContainerSlotClick", "(JIIILjava/lang/String;)I"},  // 227
+    {"dispatchContainerQuickMove", "(JI)Ljava/lang/String;"},  // 228
+    {"dispatchContainerMayPlace", "(JILjava/lang/String;)Z"},  // 229
+    {"dispatchContainerMayPickup", "(JI)Z"},  // 230
+    {"onCustomGoalCanUse", "(Ljava/lang/String;I)Z"},  // 231
+    {"onCustomGoalCanContinueToUse", "(Ljava/lang/String;I)Z"},  // 232
+    {"onCustomGoalStart", "(Ljava/lang/String;I)V"},  // 233
+    {"onCustomGoalTick", "(Ljava/lang/String;I)V"},  // 234
+    {"onCustomGoalStop", "(Ljava/lang/String;I)V"},  // 235
+    {"entityMoveTo", "(IDDDD)V"},  // 236
+    {"entityLookAt", "(IDDD)V"},  // 237
+    {"entityLookAtEntity", "(II)V"},  // 238
+    {"entityStopMoving", "(I)V"},  // 239
+    {"entityDistanceTo", "(II)D"},  // 240
+    {"entityDistanceToSqr", "(IDDD)D"},  // 241
+    {"entityHasNearbyPlayer", "(ID)Z"},  // 242
+    {"entityGetNearestPlayer", "(ID)I"},  // 243
+    {"entityGetTarget", "(I)I"},  // 244
+    {"entitySetTarget", "(II)V"},  // 245
+    {"entityGetX", "(I)D"},  // 246
+    {"entityGetY", "(I)D"},  // 247
+    {"entityGetZ", "(I)D"},  // 248
+    {"entityCanSee", "(II)Z"},  // 249
+    {"entityJump", "(I)V"},  // 250
+    {"entitySetSpeed", "(ID)V"},  // 251
+    {"getBlockEntitySlot", "(Ljava/lang/String;IIII)Ljava/lang/String;"},  // 252
+    {"setBlockEntitySlot", "(Ljava/lang/String;IIIILjava/lang/String;I)V"},  // 253
+    {"setAnimationState", "(JLjava/lang/String;DD)V"},  // 254
+    {"storePlayerItemStackHandle", "(II)J"},  // 255
+    {"releaseItemStackHandle", "(J)V"},  // 256
+    {"getItemStackComponent", "(JLjava/lang/String;)Ljava/lang/String;"},  // 257
+    {"setItemStackComponent", "(JLjava/lang/String;Ljava/lang/String;)V"},  // 258
+    {"hasItemStackComponent", "(JLjava/lang/String;)Z"},  // 259
+    {"removeItemStackComponent", "(JLjava/lang/String;)V"},  // 260
+    {"getItemMaxStackSize", "(J)I"},  // 261
+    {"setItemMaxStackSize", "(JI)V"},  // 262
+    {"getItemDamage", "(J)I"},  // 263
+    {"setItemDamage", "(JI)V"},  // 264
+    {"getItemMaxDamage", "(J)I"},  // 265
+    {"setItemMaxDamage", "(JI)V"},  // 266
+    {"getItemCustomName", "(J)Ljava/lang/String;"},  // 267
+    {"setItemCustomName", "(JLjava/lang/String;)V"},  // 268
+    {"getItemLore", "(J)Ljava/lang/String;"},  // 269
+    {"setItemLore", "(JLjava/lang/String;)V"},  // 270
+    {"isItemUnbreakable", "(J)Z"},  // 271
+    {"setItemUnbreakable", "(JZ)V"},  // 272
+    {"isItemDamageResistant", "(J)Z"},  // 273
+    {"setItemFireResistant", "(JZ)V"},  // 274
+    {"getItemEnchantments", "(J)Ljava/lang/String;"},  // 275
+    {"setItemEnchantments", "(JLjava/lang/String;)V"},  // 276
+    {"getLoadedDimensions", "()Ljava/lang/String;"},  // 277
+    {"getDimensionProperties", "(Ljava/lang/String;)Ljava/lang/String;"},  // 278
+};
+
+#endif // DART_BRIDGE_BINDINGS_G_H
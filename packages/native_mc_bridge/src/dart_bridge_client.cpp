@@ -2,6 +2,10 @@
 #include "callback_registry.h"
 #include "object_registry.h"
 #include "generic_jni.h"
+#include "asset_bundle.h"
+#include "thread_roles.h"
+#include "upcall_table.h"
+#include "packet_schema.h"
 #include <flutter_embedder.h>
 
 #include <iostream>
@@ -12,6 +16,8 @@
 #include <queue>
 #include <chrono>
 #include <atomic>
+#include <algorithm>
+#include <cmath>
 
 // ==========================================================================
 // Renderer Headers and Platform Detection
@@ -74,6 +80,7 @@ static bool g_use_hardware_renderer = true;
 
 static FlutterEngine g_client_engine = nullptr;
 static FlutterEngineAOTData g_client_aot_data = nullptr;
+static int32_t g_client_asset_bundle = -1;
 static bool g_client_initialized = false;
 static bool g_client_shutdown_requested = false;
 static std::mutex g_client_engine_mutex;
@@ -127,6 +134,38 @@ static int32_t g_metal_frame_width = 0;
 static int32_t g_metal_frame_height = 0;
 #endif // METAL_SUPPORTED
 
+// ==========================================================================
+// Hibernation State
+// ==========================================================================
+// While no Dart screen or HUD is shown the client hibernates: frame memory is
+// released, the engine trims its caches and no frames are produced. Anything
+// that shows Flutter content again (texture/pixel reads, input, screen init,
+// HUD show) wakes it; the engine itself keeps running.
+static std::atomic<bool> g_client_hibernating{false};
+// Vsync held back while hibernating. Stored on the vsync thread, consumed with
+// exchange(0) by whichever of the vsync and render threads gets it first.
+static std::atomic<intptr_t> g_client_deferred_vsync_baton{0};
+static uint64_t g_client_last_activity = 0;         // FlutterEngineGetCurrentTime() (ns)
+static uint64_t g_client_hibernate_timeout = 30ull * 1000000000ull;  // ns, 0 = no idle timeout
+static FrameReleaseCallback g_client_frame_release_callback = nullptr;
+
+// ==========================================================================
+// Dynamic Resolution State
+// ==========================================================================
+// Scales the resolution Flutter renders at (window metrics and GL FBO) to
+// keep the frame cost on the render thread within a budget. The logical size
+// is unchanged; the smaller texture is upscaled when Java draws it. Returns to
+// the maximum scale once the overlay stops producing frames.
+static bool g_drs_enabled = false;
+static double g_drs_min_scale = 0.5;
+static double g_drs_max_scale = 1.0;
+static double g_drs_budget_ms = 8.0;
+static double g_drs_scale = 1.0;          // Currently applied scale
+static double g_drs_frame_ms = 0.0;       // Moving average of task time per presented frame
+static int g_drs_frames_since_change = 0;
+static uint64_t g_drs_last_frame = 0;     // FlutterEngineGetCurrentTime() of the last present (ns)
+static bool g_drs_frame_presented = false;  // Set by the present callbacks (render thread)
+
 // ==========================================================================
 // Container Frame Ready Signal
 // ==========================================================================
@@ -593,8 +632,9 @@ static bool OnGLClearCurrent(void* user_data) {
 static uint32_t OnGLFboCallback(void* user_data) {
     // Ensure FBO exists with current dimensions
     if (g_flutter_fbo == 0) {
-        int width = static_cast<int>(g_client_window_width * g_client_pixel_ratio);
-        int height = static_cast<int>(g_client_window_height * g_client_pixel_ratio);
+        // Sized by the dynamic resolution scale like the window metrics
+        int width = static_cast<int>(g_client_window_width * g_client_pixel_ratio * g_drs_scale);
+        int height = static_cast<int>(g_client_window_height * g_client_pixel_ratio * g_drs_scale);
         if (!CreateOrResizeFlutterFBO(width, height)) {
             std::cerr << "Failed to create Flutter FBO in fbo_callback" << std::endl;
             return 0;
@@ -606,6 +646,7 @@ static uint32_t OnGLFboCallback(void* user_data) {
 static bool OnGLPresent(void* user_data) {
     // Signal that a new frame is ready
     g_frame_ready = true;
+    g_drs_frame_presented = true;
     return true;
 }
 
@@ -638,6 +679,7 @@ static bool OnClientSoftwareSurfacePresent(void* user_data,
                                             const void* allocation,
                                             size_t row_bytes,
                                             size_t height) {
+    g_drs_frame_presented = true;
     if (g_client_frame_callback) {
         size_t width = row_bytes / 4;  // RGBA = 4 bytes per pixel
         g_client_frame_callback(allocation, width, height, row_bytes);
@@ -645,6 +687,13 @@ static bool OnClientSoftwareSurfacePresent(void* user_data,
     return true;
 }
 
+#if METAL_SUPPORTED
+static bool OnClientMetalPresent(void* user_data, const FlutterMetalTexture* texture) {
+    g_drs_frame_presented = true;
+    return metal_renderer_present_drawable(user_data, texture);
+}
+#endif
+
 static void OnClientPlatformMessage(const FlutterPlatformMessage* message, void* user_data) {
     // Handle platform channel messages if needed
 }
@@ -654,22 +703,204 @@ static void OnClientVsync(void* user_data, intptr_t baton) {
     if (g_client_shutdown_requested || g_client_engine == nullptr) {
         return;
     }
+    if (g_client_hibernating) {
+        // Answered on wake. A wake that ran after the check above may already
+        // have looked for the baton, so check again and reclaim it.
+        g_client_deferred_vsync_baton.store(baton);
+        if (g_client_hibernating) {
+            return;
+        }
+        baton = g_client_deferred_vsync_baton.exchange(0);
+        if (baton == 0) {
+            return;
+        }
+    }
     uint64_t now = FlutterEngineGetCurrentTime();
     // Render immediately - don't wait for vsync interval
     // This is appropriate for software rendering where we control the frame timing
     FlutterEngineOnVsync(g_client_engine, baton, now, now + 1);
 }
 
+// Engine-created threads (raster, IO, workers) report their priority here
+static void OnClientThreadPriority(FlutterThreadPriority priority) {
+    thread_role_apply(thread_role_for_flutter_priority(static_cast<int32_t>(priority)));
+}
+
 static void OnClientRootIsolateCreate(void* user_data) {
     std::cout << "Flutter client root isolate created" << std::endl;
 }
 
+// Load the AOT snapshot and map the assets (caller holds g_client_engine_mutex).
+// Neither touches the engine, so this may run on any thread ahead of
+// dart_client_init(); whatever is already loaded is kept.
+static void ClientLoadStartupData(const char* assets_path, const char* icu_data_path, const char* aot_library_path) {
+    if (g_client_asset_bundle < 0) {
+        g_client_asset_bundle = asset_bundle_open(assets_path, icu_data_path);
+    }
+
+    bool is_aot_mode = (aot_library_path != nullptr && strlen(aot_library_path) > 0);
+    if (is_aot_mode && g_client_aot_data == nullptr) {
+        FlutterEngineAOTDataSource aot_source = {};
+        aot_source.type = kFlutterEngineAOTDataSourceTypeElfPath;
+        aot_source.elf_path = aot_library_path;
+
+        FlutterEngineResult aot_result = FlutterEngineCreateAOTData(&aot_source, &g_client_aot_data);
+        if (aot_result != kSuccess) {
+            std::cerr << "Failed to create client AOT data from ELF: " << aot_result << std::endl;
+            g_client_aot_data = nullptr;
+        }
+    }
+}
+
+// Release the frame memory that is recreated on demand: the GL texture/FBO
+// (OpenGL) or IOSurface GL texture and readback buffer (Metal)
+static void ClientReleaseFrameMemory() {
+#if METAL_SUPPORTED
+    if (g_iosurface_gl_texture != 0) {
+        glDeleteTextures(1, &g_iosurface_gl_texture);
+        g_iosurface_gl_texture = 0;
+    }
+    g_iosurface_texture_width = 0;
+    g_iosurface_texture_height = 0;
+    g_cached_iosurface_id = 0;
+
+    if (g_metal_readback_buffer) {
+        free(g_metal_readback_buffer);
+        g_metal_readback_buffer = nullptr;
+        g_metal_readback_buffer_size = 0;
+    }
+    g_metal_frame_width = 0;
+    g_metal_frame_height = 0;
+#elif OPENGL_SUPPORTED
+    CleanupFlutterGL();
+#endif
+}
+
+static void ClientSendLifecycleState(const char* state) {
+    FlutterPlatformMessage message = {};
+    message.struct_size = sizeof(FlutterPlatformMessage);
+    message.channel = "flutter/lifecycle";
+    message.message = reinterpret_cast<const uint8_t*>(state);
+    message.message_size = strlen(state);
+    FlutterEngineSendPlatformMessage(g_client_engine, &message);
+}
+
+// Render thread only
+static void ClientHibernate() {
+    if (!g_client_initialized || g_client_engine == nullptr) return;
+    if (g_client_hibernating.exchange(true)) return;
+
+    // Paused: the framework stops scheduling frames
+    ClientSendLifecycleState("AppLifecycleState.paused");
+
+    ClientReleaseFrameMemory();
+    if (g_client_frame_release_callback) {
+        g_client_frame_release_callback();
+    }
+
+    // Drops the raster/image caches and runs a Dart GC
+    FlutterEngineNotifyLowMemoryWarning(g_client_engine);
+    std::cout << "Flutter client hibernating" << std::endl;
+}
+
+// Render thread only. Records activity, and restores frame production if
+// hibernating; frame memory is recreated by the next frame.
+static void ClientWake() {
+    if (!g_client_initialized || g_client_engine == nullptr) return;
+    g_client_last_activity = FlutterEngineGetCurrentTime();
+    if (!g_client_hibernating.exchange(false)) return;
+
+    ClientSendLifecycleState("AppLifecycleState.resumed");
+    intptr_t baton = g_client_deferred_vsync_baton.exchange(0);
+    if (baton != 0) {
+        uint64_t now = FlutterEngineGetCurrentTime();
+        FlutterEngineOnVsync(g_client_engine, baton, now, now + 1);
+    }
+    FlutterEngineScheduleFrame(g_client_engine);
+    std::cout << "Flutter client woke from hibernation" << std::endl;
+}
+
+// Send the window metrics at the current dynamic resolution scale, resizing
+// the GL FBO to match. The logical size (width / pixel_ratio) is unchanged.
+static void ClientApplyWindowMetrics() {
+    if (!g_client_initialized || g_client_engine == nullptr) return;
+
+    double scale = g_drs_scale;
+#if OPENGL_SUPPORTED
+    // Resize FBO if using OpenGL and dimensions changed (recreated on wake if hibernating)
+    if (g_use_hardware_renderer && !g_client_hibernating) {
+        int tex_width = static_cast<int>(g_client_window_width * g_client_pixel_ratio * scale);
+        int tex_height = static_cast<int>(g_client_window_height * g_client_pixel_ratio * scale);
+        if (tex_width != g_texture_width || tex_height != g_texture_height) {
+            CreateOrResizeFlutterFBO(tex_width, tex_height);
+        }
+    }
+#endif
+
+    FlutterWindowMetricsEvent metrics = {};
+    metrics.struct_size = sizeof(FlutterWindowMetricsEvent);
+    metrics.width = static_cast<size_t>(g_client_window_width * scale);
+    metrics.height = static_cast<size_t>(g_client_window_height * scale);
+    metrics.pixel_ratio = g_client_pixel_ratio * scale;
+
+    FlutterEngineSendWindowMetricsEvent(g_client_engine, &metrics);
+}
+
+static void DrsApplyScale(double scale) {
+    scale = std::clamp(scale, g_drs_min_scale, g_drs_max_scale);
+    g_drs_frames_since_change = 0;
+    if (std::fabs(scale - g_drs_scale) < 0.01) return;
+    g_drs_scale = scale;
+    ClientApplyWindowMetrics();
+}
+
+// Feed the controller the render-thread time one presented frame cost
+static void DrsOnFrame(double frame_ms, uint64_t now) {
+    g_drs_last_frame = now;
+    g_drs_frame_ms = g_drs_frame_ms == 0.0 ? frame_ms : g_drs_frame_ms * 0.8 + frame_ms * 0.2;
+
+    // Let the average settle after a change before adjusting again
+    if (++g_drs_frames_since_change < 10) return;
+
+    if (g_drs_frame_ms > g_drs_budget_ms && g_drs_scale > g_drs_min_scale) {
+        // Raster cost scales with pixel count, i.e. with scale^2
+        DrsApplyScale(g_drs_scale * std::max(0.75, std::sqrt(g_drs_budget_ms / g_drs_frame_ms)));
+    } else if (g_drs_frame_ms < g_drs_budget_ms * 0.5 && g_drs_scale < g_drs_max_scale) {
+        DrsApplyScale(g_drs_scale * 1.1);
+    }
+}
+
+// Release what ClientLoadStartupData() loaded (caller holds g_client_engine_mutex)
+static void ClientReleaseStartupData() {
+    if (g_client_aot_data != nullptr) {
+        FlutterEngineCollectAOTData(g_client_aot_data);
+        g_client_aot_data = nullptr;
+    }
+
+    asset_bundle_release(g_client_asset_bundle);
+    g_client_asset_bundle = -1;
+}
+
 // ==========================================================================
 // Lifecycle Functions
 // ==========================================================================
 
 extern "C" {
 
+bool dart_client_prepare(const char* assets_path, const char* icu_data_path, const char* aot_library_path) {
+    std::lock_guard<std::mutex> lock(g_client_engine_mutex);
+    if (g_client_initialized) return true;
+
+    auto start = std::chrono::steady_clock::now();
+    ClientLoadStartupData(assets_path, icu_data_path, aot_library_path);
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    std::cout << "Client startup data prepared in " << elapsed << " ms" << std::endl;
+
+    bool is_aot_mode = (aot_library_path != nullptr && strlen(aot_library_path) > 0);
+    return g_client_asset_bundle >= 0 && (!is_aot_mode || g_client_aot_data != nullptr);
+}
+
 bool dart_client_init(const char* assets_path, const char* icu_data_path, const char* aot_library_path) {
     std::lock_guard<std::mutex> lock(g_client_engine_mutex);
 
@@ -718,7 +949,7 @@ bool dart_client_init(const char* assets_path, const char* icu_data_path, const
         renderer.metal.device = metal_renderer_get_device();
         renderer.metal.present_command_queue = metal_renderer_get_command_queue();
         renderer.metal.get_next_drawable_callback = metal_renderer_get_next_drawable;
-        renderer.metal.present_drawable_callback = metal_renderer_present_drawable;
+        renderer.metal.present_drawable_callback = OnClientMetalPresent;
     } else
 #elif OPENGL_SUPPORTED
     // Windows/Linux: Use OpenGL renderer
@@ -756,23 +987,17 @@ bool dart_client_init(const char* assets_path, const char* icu_data_path, const
     args.assets_path = assets_path;
     args.icu_data_path = icu_data_path;
 
+    // Map the assets and ICU data first so the engine's reads hit the page
+    // cache, and load the AOT snapshot (both already done if prepared)
+    ClientLoadStartupData(assets_path, icu_data_path, aot_library_path);
+
     // Detect AOT vs JIT mode based on whether aot_library_path is provided
     bool is_aot_mode = (aot_library_path != nullptr && strlen(aot_library_path) > 0);
 
     if (is_aot_mode) {
-        // AOT mode: load precompiled snapshot from ELF file
+        // AOT mode: precompiled snapshot from ELF file
         std::cout << "  Mode: AOT (release)" << std::endl;
-
-        FlutterEngineAOTDataSource aot_source = {};
-        aot_source.type = kFlutterEngineAOTDataSourceTypeElfPath;
-        aot_source.elf_path = aot_library_path;
-
-        FlutterEngineResult aot_result = FlutterEngineCreateAOTData(&aot_source, &g_client_aot_data);
-        if (aot_result == kSuccess) {
-            args.aot_data = g_client_aot_data;
-        } else {
-            std::cerr << "Failed to create client AOT data from ELF: " << aot_result << std::endl;
-        }
+        args.aot_data = g_client_aot_data;
 
         // In AOT mode, we don't need VM service (hot reload not supported)
         // Use minimal flags for better performance
@@ -801,6 +1026,7 @@ bool dart_client_init(const char* assets_path, const char* icu_data_path, const
 
     // Set up custom task runners
     g_client_platform_thread_id = std::this_thread::get_id();
+    thread_role_apply(THREAD_ROLE_RENDER);
     std::cout << "Client platform thread ID captured" << std::endl;
 
     static FlutterTaskRunnerDescription client_task_runner = {};
@@ -816,7 +1042,7 @@ bool dart_client_init(const char* assets_path, const char* icu_data_path, const
     client_custom_task_runners.platform_task_runner = &client_task_runner;
     client_custom_task_runners.render_task_runner = &client_task_runner;
     client_custom_task_runners.ui_task_runner = &client_task_runner;
-    client_custom_task_runners.thread_priority_setter = nullptr;
+    client_custom_task_runners.thread_priority_setter = OnClientThreadPriority;
 
     args.custom_task_runners = &client_custom_task_runners;
 
@@ -833,6 +1059,7 @@ bool dart_client_init(const char* assets_path, const char* icu_data_path, const
 
     if (result != kSuccess) {
         std::cerr << "Failed to start Flutter client engine, error code: " << result << std::endl;
+        ClientReleaseStartupData();
         return false;
     }
 
@@ -846,6 +1073,7 @@ bool dart_client_init(const char* assets_path, const char* icu_data_path, const
     FlutterEngineSendWindowMetricsEvent(g_client_engine, &metrics);
 
     g_client_initialized = true;
+    g_client_last_activity = FlutterEngineGetCurrentTime();
     std::cout << "Flutter client engine initialized successfully" << std::endl;
 
 #if METAL_SUPPORTED
@@ -867,6 +1095,8 @@ void dart_client_shutdown() {
 
     if (!g_client_initialized) {
         std::cout << "Client shutdown: not initialized, returning" << std::endl;
+        // Lazy start: the engine never ran, but startup data may be prepared
+        ClientReleaseStartupData();
         g_client_shutdown_requested = false;
         return;
     }
@@ -897,6 +1127,11 @@ void dart_client_shutdown() {
         }
     }
 
+#if METAL_SUPPORTED
+    // Spawned surfaces share the main engine's AOT data; stop them first
+    multi_surface_shutdown();
+#endif
+
     std::cout << "Client shutdown: shutting down Flutter engine..." << std::endl;
     // Shutdown Flutter engine
     if (g_client_engine != nullptr) {
@@ -908,37 +1143,21 @@ void dart_client_shutdown() {
         g_client_engine = nullptr;
     }
 
-    // Cleanup AOT data
-    if (g_client_aot_data != nullptr) {
-        FlutterEngineCollectAOTData(g_client_aot_data);
-        g_client_aot_data = nullptr;
-    }
+    // Cleanup AOT data and the asset bundle
+    ClientReleaseStartupData();
 
 #if METAL_SUPPORTED
     // Cleanup Metal resources
     std::cout << "Client shutdown: cleaning up Metal resources..." << std::endl;
     metal_renderer_shutdown();
-    if (g_iosurface_gl_texture != 0) {
-        glDeleteTextures(1, &g_iosurface_gl_texture);
-        g_iosurface_gl_texture = 0;
-    }
-    g_iosurface_texture_width = 0;
-    g_iosurface_texture_height = 0;
-    g_cached_iosurface_id = 0;
-
-    // Cleanup Metal readback buffer
-    if (g_metal_readback_buffer) {
-        free(g_metal_readback_buffer);
-        g_metal_readback_buffer = nullptr;
-        g_metal_readback_buffer_size = 0;
-    }
-    g_metal_frame_width = 0;
-    g_metal_frame_height = 0;
+    ClientReleaseFrameMemory();
 #elif OPENGL_SUPPORTED
     // Cleanup OpenGL resources
     std::cout << "Client shutdown: cleaning up OpenGL resources..." << std::endl;
-    CleanupFlutterGL();
+    ClientReleaseFrameMemory();
 #endif
+    g_client_hibernating = false;
+    g_client_deferred_vsync_baton = 0;
 
     g_client_initialized = false;
     g_client_jvm_ref = nullptr;
@@ -958,6 +1177,7 @@ void dart_client_process_tasks() {
     }
 
     uint64_t current_time = FlutterEngineGetCurrentTime();
+    g_drs_frame_presented = false;
 
     while (!tasks_to_run.empty()) {
         auto& task_pair = tasks_to_run.front();
@@ -969,6 +1189,25 @@ void dart_client_process_tasks() {
         }
         tasks_to_run.pop();
     }
+
+    if (g_drs_enabled) {
+        // All runners share this thread, so the pump that presented a frame
+        // carries that frame's build and raster cost
+        uint64_t now = FlutterEngineGetCurrentTime();
+        if (g_drs_frame_presented) {
+            DrsOnFrame(static_cast<double>(now - current_time) / 1e6, now);
+        } else if (g_drs_scale < g_drs_max_scale && now - g_drs_last_frame > 500ull * 1000000ull) {
+            // Idle overlay: show it at full resolution
+            g_drs_frame_ms = 0.0;
+            DrsApplyScale(g_drs_max_scale);
+        }
+    }
+
+    // Nothing has shown Flutter content for a while: hibernate
+    if (g_client_hibernate_timeout > 0 && !g_client_hibernating &&
+        current_time - g_client_last_activity > g_client_hibernate_timeout) {
+        ClientHibernate();
+    }
 }
 
 void dart_client_set_jvm(JavaVM* jvm) {
@@ -983,6 +1222,54 @@ void dart_client_set_frame_callback(FrameCallback callback) {
     g_client_frame_callback = callback;
 }
 
+void dart_client_set_frame_release_callback(FrameReleaseCallback callback) {
+    g_client_frame_release_callback = callback;
+}
+
+// ==========================================================================
+// Hibernation
+// ==========================================================================
+
+void dart_client_hibernate() {
+    ClientHibernate();
+}
+
+void dart_client_wake() {
+    ClientWake();
+}
+
+bool dart_client_is_hibernating() {
+    return g_client_hibernating;
+}
+
+void dart_client_set_hibernate_timeout(int32_t timeout_ms) {
+    g_client_hibernate_timeout = timeout_ms > 0 ? static_cast<uint64_t>(timeout_ms) * 1000000ull : 0;
+}
+
+// ==========================================================================
+// Dynamic Resolution
+// ==========================================================================
+
+void dart_client_set_dynamic_resolution(bool enabled, double min_scale, double max_scale, double budget_ms) {
+    g_drs_max_scale = std::clamp(max_scale, 0.1, 1.0);
+    g_drs_min_scale = std::clamp(min_scale, 0.1, g_drs_max_scale);
+    g_drs_budget_ms = budget_ms > 0.0 ? budget_ms : 8.0;
+    g_drs_enabled = enabled;
+    g_drs_frame_ms = 0.0;
+    g_drs_frames_since_change = 0;
+
+    // Disabled: back to native resolution; enabled: start at the top of the range
+    double scale = enabled ? g_drs_max_scale : 1.0;
+    if (scale != g_drs_scale) {
+        g_drs_scale = scale;
+        ClientApplyWindowMetrics();
+    }
+}
+
+double dart_client_get_resolution_scale() {
+    return g_drs_scale;
+}
+
 const char* dart_client_get_service_url() {
     if (g_client_initialized) {
         return "flutter://vm-service-client";
@@ -990,6 +1277,52 @@ const char* dart_client_get_service_url() {
     return nullptr;
 }
 
+// ==========================================================================
+// Additional Surfaces
+// ==========================================================================
+
+int64_t dart_client_spawn_surface(int32_t width, int32_t height, const char* initial_route) {
+    if (!g_client_initialized || g_client_engine == nullptr) {
+        std::cerr << "dart_client_spawn_surface: main engine not running" << std::endl;
+        return 0;
+    }
+#if METAL_SUPPORTED
+    if (!multi_surface_init()) return 0;
+
+    auto start = std::chrono::steady_clock::now();
+    int64_t surface_id = multi_surface_create(width, height, initial_route);
+    if (surface_id != 0) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        std::cout << "Spawned Flutter surface " << surface_id << " in " << elapsed << " ms" << std::endl;
+    }
+    return surface_id;
+#else
+    std::cerr << "dart_client_spawn_surface: additional surfaces need the Metal renderer" << std::endl;
+    return 0;
+#endif
+}
+
+void dart_client_destroy_surface(int64_t surface_id) {
+#if METAL_SUPPORTED
+    multi_surface_destroy(surface_id);
+#else
+    (void)surface_id;
+#endif
+}
+
+void* dart_client_get_aot_data() {
+    return g_client_aot_data;
+}
+
+// ==========================================================================
+// Assets
+// ==========================================================================
+
+const uint8_t* dart_client_get_asset(const char* name, int64_t* size_out) {
+    return asset_bundle_find(g_client_asset_bundle, name, size_out);
+}
+
 // ==========================================================================
 // Window/Input Events
 // ==========================================================================
@@ -1001,28 +1334,12 @@ void dart_client_send_window_metrics(int32_t width, int32_t height, double pixel
     g_client_window_height = height;
     g_client_pixel_ratio = pixel_ratio;
 
-#if OPENGL_SUPPORTED
-    // Resize FBO if using OpenGL and dimensions changed
-    if (g_use_opengl_renderer) {
-        int tex_width = static_cast<int>(width * pixel_ratio);
-        int tex_height = static_cast<int>(height * pixel_ratio);
-        if (tex_width != g_texture_width || tex_height != g_texture_height) {
-            CreateOrResizeFlutterFBO(tex_width, tex_height);
-        }
-    }
-#endif
-
-    FlutterWindowMetricsEvent metrics = {};
-    metrics.struct_size = sizeof(FlutterWindowMetricsEvent);
-    metrics.width = width;
-    metrics.height = height;
-    metrics.pixel_ratio = pixel_ratio;
-
-    FlutterEngineSendWindowMetricsEvent(g_client_engine, &metrics);
+    ClientApplyWindowMetrics();
 }
 
 void dart_client_send_pointer_event(int32_t phase, double x, double y, int64_t buttons) {
     if (!g_client_initialized || g_client_engine == nullptr) return;
+    ClientWake();
 
     // Debug: log pointer events (phase 3 = MOVE)
     if (phase == 2 || phase == 3) { // DOWN or MOVE
@@ -1035,8 +1352,8 @@ void dart_client_send_pointer_event(int32_t phase, double x, double y, int64_t b
     event.struct_size = sizeof(FlutterPointerEvent);
     event.phase = static_cast<FlutterPointerPhase>(phase);
     event.timestamp = FlutterEngineGetCurrentTime() / 1000;
-    event.x = x * g_client_pixel_ratio;
-    event.y = y * g_client_pixel_ratio;
+    event.x = x * g_client_pixel_ratio * g_drs_scale;
+    event.y = y * g_client_pixel_ratio * g_drs_scale;
     event.buttons = buttons;
     event.device = 0;  // Use consistent device ID for all mouse events
     event.device_kind = kFlutterPointerDeviceKindMouse;
@@ -1047,6 +1364,7 @@ void dart_client_send_pointer_event(int32_t phase, double x, double y, int64_t b
 void dart_client_send_key_event(int32_t type, int64_t physical_key, int64_t logical_key,
                                   const char* character, int32_t modifiers) {
     if (!g_client_initialized || g_client_engine == nullptr) return;
+    ClientWake();
 
     FlutterKeyEvent event = {};
     event.struct_size = sizeof(FlutterKeyEvent);
@@ -1123,6 +1441,7 @@ void client_register_custom_screen_close_handler(CustomScreenCloseCallback cb) {
 
 void client_dispatch_screen_init(int64_t screen_id, int32_t width, int32_t height) {
     CLIENT_DISPATCH_CHECK();
+    ClientWake();
     dart_mc_bridge::ClientCallbackRegistry::instance().dispatchScreenInit(screen_id, width, height);
 }
 
@@ -1189,6 +1508,7 @@ void client_dispatch_widget_text_changed(int64_t screen_id, int64_t widget_id, c
 void client_dispatch_container_screen_init(int64_t screen_id, int32_t width, int32_t height,
                                             int32_t left_pos, int32_t top_pos, int32_t image_width, int32_t image_height) {
     CLIENT_DISPATCH_CHECK();
+    ClientWake();
     dart_mc_bridge::ClientCallbackRegistry::instance().dispatchContainerScreenInit(screen_id, width, height, left_pos, top_pos, image_width, image_height);
 }
 
@@ -1287,6 +1607,7 @@ void client_dispatch_container_prewarm(const char* container_id) {
 
 void client_dispatch_hud_show(const char* overlay_id) {
     CLIENT_DISPATCH_CHECK();
+    ClientWake();
 
     // Allocate persistent copy of string using malloc (Dart will free it)
     char* overlay_id_copy = nullptr;
@@ -1351,6 +1672,10 @@ void client_set_send_packet_to_server_callback(SendPacketToServerCallback cb) {
 
 void client_dispatch_server_packet(int32_t packet_type, const uint8_t* data, int32_t data_length) {
     CLIENT_DISPATCH_CHECK();
+    if (packet_type == PACKET_SCHEMA_S2C && packet_schema_validate(data, data_length) < 0) {
+        std::cerr << "[Native] Dropping malformed schema packet from server" << std::endl;
+        return;
+    }
     // IMPORTANT: When using NativeCallable.listener in Dart, the callback runs asynchronously
     // on the Dart event loop. By that time, the original data pointer may be freed (e.g., by JNI
     // ReleaseByteArrayElements). We must allocate a copy that Dart can free after processing.
@@ -1398,18 +1723,9 @@ void client_update_slot_positions(int32_t menu_id, const int32_t* data, int32_t
         return;
     }
 
-    // Find the DartBridgeClient class and method
-    jclass bridgeClass = env->FindClass("com/redstone/DartBridgeClient");
-    if (bridgeClass == nullptr) {
-        env->ExceptionClear();
-        if (needs_detach) g_client_jvm_ref->DetachCurrentThread();
-        return;
-    }
-
-    jmethodID method = env->GetStaticMethodID(bridgeClass, "onSlotPositionsUpdate", "(I[I)V");
-    if (method == nullptr) {
-        env->ExceptionClear();
-        env->DeleteLocalRef(bridgeClass);
+    // Resolved with the other client upcalls when the client runtime started
+    const auto& upcalls = dart_mc_bridge::upcalls();
+    if (!upcalls.client_ready) {
         if (needs_detach) g_client_jvm_ref->DetachCurrentThread();
         return;
     }
@@ -1418,11 +1734,10 @@ void client_update_slot_positions(int32_t menu_id, const int32_t* data, int32_t
     jintArray jdata = env->NewIntArray(data_length);
     if (jdata != nullptr) {
         env->SetIntArrayRegion(jdata, 0, data_length, reinterpret_cast<const jint*>(data));
-        env->CallStaticVoidMethod(bridgeClass, method, menu_id, jdata);
+        env->CallStaticVoidMethod(upcalls.dart_bridge_client_class, upcalls.on_slot_positions_update, menu_id, jdata);
         env->DeleteLocalRef(jdata);
     }
 
-    env->DeleteLocalRef(bridgeClass);
     if (needs_detach) g_client_jvm_ref->DetachCurrentThread();
 }
 
@@ -1696,6 +2011,7 @@ static bool UpdateIOSurfaceGLTexture() {
 #endif // METAL_SUPPORTED
 
 int32_t dart_client_get_flutter_texture_id() {
+    ClientWake();
 #if METAL_SUPPORTED
     if (g_use_hardware_renderer) {
         // Ensure IOSurface-backed GL texture exists
@@ -1893,6 +2209,7 @@ int32_t dart_client_get_frame_height() {
 
 void dart_client_schedule_frame() {
     if (!g_client_initialized || g_client_engine == nullptr) return;
+    ClientWake();
     FlutterEngineScheduleFrame(g_client_engine);
 }
 
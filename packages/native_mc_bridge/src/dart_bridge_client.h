@@ -15,6 +15,9 @@ extern "C" {
 // Frame callback type for receiving rendered frames
 typedef void (*FrameCallback)(const void* pixels, size_t width, size_t height, size_t row_bytes);
 
+// Callback to release frame memory held by the frame callback's owner (hibernation)
+typedef void (*FrameReleaseCallback)();
+
 // ==========================================================================
 // Lifecycle
 // ==========================================================================
@@ -25,6 +28,12 @@ typedef void (*FrameCallback)(const void* pixels, size_t width, size_t height, s
 // aot_library_path: Path to AOT compiled library (can be null for JIT mode)
 bool dart_client_init(const char* assets_path, const char* icu_data_path, const char* aot_library_path);
 
+// Load the AOT snapshot and map the assets ahead of dart_client_init() (same
+// paths), so a lazily started engine only pays for FlutterEngineRun. Does not
+// touch the engine and may be called from any thread. Released by
+// dart_client_shutdown() even if the engine was never started.
+bool dart_client_prepare(const char* assets_path, const char* icu_data_path, const char* aot_library_path);
+
 // Shutdown the Flutter engine
 void dart_client_shutdown();
 
@@ -38,9 +47,83 @@ void dart_client_set_jvm(JavaVM* jvm);
 // Set the callback for receiving rendered frames
 void dart_client_set_frame_callback(FrameCallback callback);
 
+// Set the callback that frees the copied software frame when hibernating
+void dart_client_set_frame_release_callback(FrameReleaseCallback callback);
+
+// ==========================================================================
+// Hibernation
+// ==========================================================================
+// While no Dart screen or HUD is shown, the client can hibernate: the GL
+// texture/FBO (or IOSurface texture and readback buffer) and the software
+// frame copy are released, the engine trims its raster/image caches and the
+// framework is paused so it stops producing frames. The engine keeps running.
+//
+// Hibernation starts on dart_client_hibernate() (Java: screen close, last HUD
+// hidden) or after the idle timeout with nothing reading Flutter frames. It
+// ends on dart_client_wake() or automatically on texture/pixel reads, input,
+// screen init or HUD show; frame memory is recreated by the next frame.
+// All functions must be called on the render thread.
+
+void dart_client_hibernate();
+void dart_client_wake();
+bool dart_client_is_hibernating();
+
+// Hibernate after timeout_ms without Flutter content being shown (default
+// 30000; 0 disables the idle timeout)
+void dart_client_set_hibernate_timeout(int32_t timeout_ms);
+
+// ==========================================================================
+// Dynamic Resolution
+// ==========================================================================
+// When enabled, the resolution Flutter renders at is scaled between
+// min_scale and max_scale (fractions of window size x pixel ratio) so the
+// render-thread cost of a frame stays within budget_ms. Frames render into a
+// smaller buffer that the GL path upscales; the logical size does not change.
+// An idle overlay (no frame for 500 ms) goes back to max_scale.
+// Render thread only.
+void dart_client_set_dynamic_resolution(bool enabled, double min_scale, double max_scale, double budget_ms);
+
+// Current resolution scale (1.0 = native)
+double dart_client_get_resolution_scale();
+
 // Get the Dart VM service URL for hot reload/debugging
 const char* dart_client_get_service_url();
 
+// ==========================================================================
+// Additional Surfaces
+// ==========================================================================
+// Extra Flutter surfaces (in-world displays, additional screens) each run a
+// separate engine with its own root isolate and render target. The embedder
+// API has no engine-spawn entry point. Surface engines are started with the
+// main engine's AOT data, so the snapshot's code pages are mapped once, and
+// with the same assets/ICU paths and Metal device. Nothing else is shared.
+// Only the Metal renderer (macOS) supports additional surfaces; elsewhere
+// spawning returns 0. All surfaces are destroyed by dart_client_shutdown().
+
+// Spawn a surface running the surfaceMain entry point with initial_route.
+// Returns the surface ID (> 0), or 0 on failure. Also returns 0 while the
+// main engine is not running, including before a lazily configured engine
+// (LAZY_CLIENT_ENGINE) has started; see DartBridgeClient.ensureClientRuntime.
+int64_t dart_client_spawn_surface(int32_t width, int32_t height, const char* initial_route);
+
+// Destroy a spawned surface
+void dart_client_destroy_surface(int64_t surface_id);
+
+// AOT data of the main engine (a FlutterEngineAOTData), or nullptr in JIT mode.
+// Valid until dart_client_shutdown().
+void* dart_client_get_aot_data();
+
+// ==========================================================================
+// Assets
+// ==========================================================================
+// The client's flutter_assets directory and ICU data are memory-mapped at
+// dart_client_init() (see asset_bundle.h).
+
+// Contents of a bundled asset by its path relative to flutter_assets
+// ("fonts/MyFont.ttf"), without copying. Returns nullptr if there is no
+// such asset. Valid until dart_client_shutdown().
+const uint8_t* dart_client_get_asset(const char* name, int64_t* size_out);
+
 // ==========================================================================
 // Window/Input Events (sent from Java to Flutter)
 // ==========================================================================
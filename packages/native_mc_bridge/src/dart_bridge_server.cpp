@@ -2,6 +2,16 @@
 #include "callback_registry.h"
 #include "object_registry.h"
 #include "generic_jni.h"
+#include "event_capture.h"
+#include "chunk_snapshot.h"
+#include "world_query.h"
+#include "chunk_data_store.h"
+#include "thread_roles.h"
+#include "outbound_queue.h"
+#include "isolate_stats.h"
+#include "animation_tracks.h"
+#include "command_args.h"
+#include "packet_schema.h"
 
 #include <dart_dll.h>
 #include <dart_api.h>
@@ -9,10 +19,14 @@
 #include <iostream>
 #include <string>
 #include <cstring>
+#include <cstdlib>
 #include <mutex>
 #include <thread>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <queue>
+#include <vector>
 
 // Platform-specific dynamic library loading for AOT support
 #ifdef _WIN32
@@ -37,6 +51,32 @@ static std::recursive_mutex g_server_isolate_mutex;
 static std::thread::id g_server_isolate_owner_thread;
 static int g_server_isolate_entry_count = 0;
 
+// Isolate lock contention counters (see server_get_isolate_contention)
+static std::atomic<int64_t> g_server_isolate_entries{0};
+static std::atomic<int64_t> g_server_isolate_contended{0};
+static std::atomic<int64_t> g_server_isolate_wait_ns{0};
+
+// Message-driven draining (see dart_server_tick and server_set_background_pump).
+// Set when the VM posts a message to the isolate and, in JIT mode, when a
+// dispatch leaves microtasks behind.
+static std::atomic<bool> g_server_drain_pending{true};
+// JIT only: dart:isolate and the name of its pending microtask callback,
+// which is non-null while the microtask queue has work
+static Dart_PersistentHandle g_server_isolate_library = nullptr;
+static Dart_PersistentHandle g_server_pending_microtask_name = nullptr;
+static thread_local bool t_server_draining = false;
+static std::atomic<int64_t> g_server_ticks_drained{0};
+static std::atomic<int64_t> g_server_ticks_skipped{0};
+static std::atomic<int64_t> g_server_background_drains{0};
+
+// Optional background pump thread. It only drains between server ticks
+// (after server_dispatch_tick until dart_server_begin_tick).
+static std::atomic<bool> g_server_between_ticks{false};
+static std::mutex g_server_pump_mutex;
+static std::condition_variable g_server_pump_cv;
+static std::thread g_server_pump_thread;
+static std::atomic<bool> g_server_pump_running{false};
+
 // JVM reference for cleanup operations
 static JavaVM* g_server_jvm_ref = nullptr;
 
@@ -59,26 +99,52 @@ static SendChatMessageCallback g_server_send_chat_callback = nullptr;
 // We need to enter the Dart isolate before calling FFI callbacks and
 // exit after. This is a recursive pattern to handle nested calls.
 
+// Lock the isolate mutex, counting how often and how long callers had to wait
+static void lock_server_isolate_mutex() {
+    if (g_server_isolate_mutex.try_lock()) return;
+
+    auto wait_start = std::chrono::steady_clock::now();
+    g_server_isolate_mutex.lock();
+    auto waited = std::chrono::steady_clock::now() - wait_start;
+    g_server_isolate_contended.fetch_add(1, std::memory_order_relaxed);
+    g_server_isolate_wait_ns.fetch_add(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(waited).count(), std::memory_order_relaxed);
+}
+
 static bool safe_enter_isolate() {
     std::thread::id this_thread = std::this_thread::get_id();
 
+    // Lock once. The owning thread re-locks the recursive mutex without
+    // waiting, so only a real wait for another thread counts as contention.
+    lock_server_isolate_mutex();
+
     // Check if we're already in the isolate on this thread (re-entrant call)
-    {
-        std::lock_guard<std::recursive_mutex> lock(g_server_isolate_mutex);
-        if (g_server_isolate_owner_thread == this_thread && g_server_isolate_entry_count > 0) {
-            g_server_isolate_entry_count++;
-            return false;  // Did not actually enter - already inside
-        }
+    if (g_server_isolate_owner_thread == this_thread && g_server_isolate_entry_count > 0) {
+        g_server_isolate_entry_count++;
+        g_server_isolate_mutex.unlock();  // Keep only the outer entry's lock
+        return false;  // Did not actually enter - already inside
     }
 
-    // Need to acquire the isolate
-    g_server_isolate_mutex.lock();
+    // Acquired the isolate
+    g_server_isolate_entries.fetch_add(1, std::memory_order_relaxed);
     Dart_EnterIsolate(g_server_isolate);
     g_server_isolate_owner_thread = this_thread;
     g_server_isolate_entry_count = 1;
     return true;  // Actually entered the isolate
 }
 
+// JIT mode: whether the current isolate has microtasks queued. Microtasks
+// are not announced by a message notification in JIT mode.
+static bool server_has_pending_microtasks() {
+    if (g_server_isolate_library == nullptr) return true;  // Not resolved; assume work
+    Dart_EnterScope();
+    Dart_Handle callback = Dart_GetField(Dart_HandleFromPersistent(g_server_isolate_library),
+                                         Dart_HandleFromPersistent(g_server_pending_microtask_name));
+    bool pending = Dart_IsError(callback) || !Dart_IsNull(callback);
+    Dart_ExitScope();
+    return pending;
+}
+
 static void safe_exit_isolate(bool did_enter) {
     if (!did_enter) {
         // This was a re-entrant call, just decrement the count
@@ -87,6 +153,10 @@ static void safe_exit_isolate(bool did_enter) {
         return;
     }
 
+    if (!g_server_aot_mode && !t_server_draining && server_has_pending_microtasks()) {
+        g_server_drain_pending.store(true, std::memory_order_release);
+    }
+
     // Actually exit the isolate
     Dart_ExitIsolate();
     g_server_isolate_owner_thread = std::thread::id();
@@ -108,6 +178,53 @@ static void drain_microtask_queue() {
     }
 }
 
+static void wake_server_pump() {
+    if (g_server_pump_running.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(g_server_pump_mutex);
+        g_server_pump_cv.notify_one();
+    }
+}
+
+// Dart_MessageNotifyCallback - the VM posted a message to the server isolate.
+// Runs on arbitrary VM threads, so it only flags the work and wakes the pump.
+static void OnServerMessageNotify(Dart_Isolate /* destination_isolate */) {
+    g_server_drain_pending.store(true, std::memory_order_release);
+    wake_server_pump();
+}
+
+// Enter the isolate and drain it, but only if something was posted since the
+// last drain. Returns false if the isolate was not entered.
+static bool drain_if_pending() {
+    if (!g_server_drain_pending.exchange(false, std::memory_order_acq_rel)) return false;
+
+    t_server_draining = true;
+    bool did_enter = safe_enter_isolate();
+    Dart_EnterScope();
+    drain_microtask_queue();
+    Dart_ExitScope();
+    safe_exit_isolate(did_enter);
+    t_server_draining = false;
+    return true;
+}
+
+static void server_pump_loop() {
+    thread_role_apply(THREAD_ROLE_BRIDGE_BACKGROUND);
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(g_server_pump_mutex);
+            g_server_pump_cv.wait(lock, [] {
+                return !g_server_pump_running.load(std::memory_order_acquire) ||
+                       (g_server_between_ticks.load(std::memory_order_acquire) &&
+                        g_server_drain_pending.load(std::memory_order_acquire));
+            });
+        }
+        if (!g_server_pump_running.load(std::memory_order_acquire)) break;
+        // A tick may have started while waking up; leave it to dart_server_tick
+        if (!g_server_between_ticks.load(std::memory_order_acquire)) continue;
+        if (drain_if_pending()) g_server_background_drains.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
 // ==========================================================================
 // Server Callback Registry (separate from client)
 // ==========================================================================
@@ -320,7 +437,7 @@ public:
     int32_t dispatchProxyItemUseOnBlock(int64_t handler_id, int64_t world_id, int32_t x, int32_t y, int32_t z, int32_t player_id, int32_t hand) { if (proxy_item_use_on_block_handler_) return proxy_item_use_on_block_handler_(handler_id, world_id, x, y, z, player_id, hand); return 4; }
     int32_t dispatchProxyItemUseOnEntity(int64_t handler_id, int64_t world_id, int32_t entity_id, int32_t player_id, int32_t hand) { if (proxy_item_use_on_entity_handler_) return proxy_item_use_on_entity_handler_(handler_id, world_id, entity_id, player_id, hand); return 4; }
 
-    int32_t dispatchCommandExecute(int64_t command_id, int32_t player_id, const char* args_json) { if (command_execute_handler_) return command_execute_handler_(command_id, player_id, args_json); return 0; }
+    int32_t dispatchCommandExecute(int64_t command_id, int32_t player_id, const uint8_t* args, int32_t args_length) { if (command_execute_handler_) return command_execute_handler_(command_id, player_id, args, args_length); return 0; }
 
     bool dispatchCustomGoalCanUse(const char* goal_id, int32_t entity_id) { if (custom_goal_can_use_handler_) return custom_goal_can_use_handler_(goal_id, entity_id); return false; }
     bool dispatchCustomGoalCanContinueToUse(const char* goal_id, int32_t entity_id) { if (custom_goal_can_continue_to_use_handler_) return custom_goal_can_continue_to_use_handler_(goal_id, entity_id); return false; }
@@ -472,6 +589,13 @@ static BlockEntitySetDataSlotCallback g_block_entity_set_data_slot_callback = nu
 static BlockEntityRemovedCallback g_block_entity_removed_callback = nullptr;
 static BlockEntityContainerOpenCallback g_block_entity_container_open_callback = nullptr;
 static BlockEntityContainerCloseCallback g_block_entity_container_close_callback = nullptr;
+static BlockEntityLoadChunkCallback g_block_entity_load_chunk_callback = nullptr;
+static BlockEntitySaveChunkCallback g_block_entity_save_chunk_callback = nullptr;
+
+// Per-thread output buffer for chunk saves. Chunk saves can run on Minecraft's
+// IO/worker threads, so each caller gets its own buffer to copy from after the
+// isolate lock has been released.
+static thread_local std::vector<uint8_t> t_block_entity_chunk_buffer;
 
 // ==========================================================================
 // Registration Queue System (for thread-safe registration from Dart)
@@ -562,6 +686,20 @@ static std::atomic<int64_t> g_server_next_ore_feature_id{1};
 
 extern "C" {
 
+// Start capturing dispatch events if REDSTONE_CAPTURE_PATH is set.
+// REDSTONE_CAPTURE_MAX_BYTES bounds the on-disk ring (default 256 MiB).
+static void start_capture_from_env() {
+    const char* capture_path = std::getenv("REDSTONE_CAPTURE_PATH");
+    if (capture_path == nullptr || capture_path[0] == '\0') return;
+
+    int64_t max_bytes = 256LL * 1024 * 1024;
+    if (const char* max_env = std::getenv("REDSTONE_CAPTURE_MAX_BYTES")) {
+        long long parsed = std::atoll(max_env);
+        if (parsed > 0) max_bytes = parsed;
+    }
+    dart_mc_bridge::EventCapture::instance().start(capture_path, max_bytes);
+}
+
 bool dart_server_init(const char* script_path, const char* package_config, int service_port) {
     if (g_server_initialized) {
         std::cerr << "Server Dart bridge already initialized" << std::endl;
@@ -619,10 +757,20 @@ bool dart_server_init(const char* script_path, const char* package_config, int s
     // Drain microtask queue to complete async initialization
     drain_microtask_queue();
 
+    Dart_Handle isolate_library = Dart_LookupLibrary(Dart_NewStringFromCString("dart:isolate"));
+    if (!Dart_IsError(isolate_library)) {
+        g_server_isolate_library = Dart_NewPersistentHandle(isolate_library);
+        g_server_pending_microtask_name =
+            Dart_NewPersistentHandle(Dart_NewStringFromCString("_pendingImmediateCallback"));
+    }
+
+    isolate_stats_attach(Dart_CurrentIsolateGroup());
+    Dart_SetMessageNotifyCallback(OnServerMessageNotify);
     Dart_ExitScope();
     Dart_ExitIsolate();
 
     g_server_initialized = true;
+    start_capture_from_env();
 
     // Build and print service URL in the format expected by the CLI for hot reload detection
     if (service_port > 0) {
@@ -695,6 +843,14 @@ bool dart_server_init_aot(const char* aot_library_path) {
     init_params.vm_snapshot_data = vm_snapshot_data;
     init_params.vm_snapshot_instructions = vm_snapshot_instructions;
 
+    // Route GC timeline events to isolate_stats (must precede Dart_Initialize)
+    int stats_flag_count = 0;
+    const char** stats_flags = isolate_stats_vm_flags(&stats_flag_count);
+    if (char* flags_error = Dart_SetVMFlags(stats_flag_count, stats_flags)) {
+        std::cerr << "  GC statistics unavailable: " << flags_error << std::endl;
+        free(flags_error);
+    }
+
     char* init_error = Dart_Initialize(&init_params);
     if (init_error != nullptr) {
         std::cerr << "Failed to initialize Dart VM: " << init_error << std::endl;
@@ -771,10 +927,13 @@ bool dart_server_init_aot(const char* aot_library_path) {
         drain_result = Dart_HandleMessage();
     }
 
+    isolate_stats_attach(Dart_CurrentIsolateGroup());
+    Dart_SetMessageNotifyCallback(OnServerMessageNotify);
     Dart_ExitScope();
     Dart_ExitIsolate();
 
     g_server_initialized = true;
+    start_capture_from_env();
     g_server_aot_mode = true;
 
     std::cout << "Server Dart VM initialized successfully (AOT mode)" << std::endl;
@@ -788,10 +947,37 @@ void dart_server_shutdown() {
 
     std::cout << "Shutting down Server Dart VM..." << std::endl;
 
+    // Flush any in-progress event capture before callbacks go away
+    dart_mc_bridge::EventCapture::instance().stop();
+
+    // Stop pumping messages from the background before the isolate goes away
+    server_set_background_pump(false);
+
+    // Drop published chunk snapshots (readers holding a reference keep theirs)
+    chunk_snapshot_clear();
+
+    // Fail outstanding async world queries so no Future waits on a dead server
+    world_query_cancel_all();
+
+    // Discard queued S2C packets and release the sender thread
+    outbound_queue_set_enabled(false);
+
+    // Write back and unmap per-chunk Dart data
+    chunk_data_close_all();
+
+#ifdef SERVER_ONLY_BUILD
+    // Forget cached static final field reads. In the full build the cache is
+    // shared with the client isolate and cleared by generic_jni_shutdown().
+    jni_static_field_cache_clear();
+#endif
+
     // Clear callbacks first to prevent any new callbacks from running
     std::cout << "  Clearing callbacks..." << std::endl;
     dart_mc_bridge::ServerCallbackRegistry::instance().clear();
 
+    // Stop heap sampling before the isolate group goes away
+    isolate_stats_detach();
+
     // Try to shutdown the isolate properly before full VM shutdown
     std::cout << "  Shutting down isolate..." << std::endl;
     if (g_server_isolate != nullptr) {
@@ -800,6 +986,12 @@ void dart_server_shutdown() {
         if (current != g_server_isolate) {
             Dart_EnterIsolate(g_server_isolate);
         }
+        if (g_server_isolate_library != nullptr) {
+            Dart_DeletePersistentHandle(g_server_isolate_library);
+            Dart_DeletePersistentHandle(g_server_pending_microtask_name);
+            g_server_isolate_library = nullptr;
+            g_server_pending_microtask_name = nullptr;
+        }
         // Shutdown the isolate - this should stop any pending async work
         Dart_ShutdownIsolate();
         g_server_isolate = nullptr;
@@ -826,21 +1018,71 @@ void dart_server_shutdown() {
     g_server_initialized = false;
     g_server_aot_mode = false;
     g_server_jvm_ref = nullptr;
+    g_server_drain_pending.store(true);
+    g_server_between_ticks.store(false);
 
     std::cout << "Server Dart VM shutdown complete" << std::endl;
 }
 
 void dart_server_tick() {
     if (!g_server_initialized || g_server_isolate == nullptr) return;
+    dart_mc_bridge::CaptureScope capture(__func__);
 
-    // Enter isolate and drain microtask queue
-    bool did_enter = safe_enter_isolate();
-    Dart_EnterScope();
+    // Only enter the isolate if a message or microtask is waiting
+    if (drain_if_pending()) {
+        g_server_ticks_drained.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        g_server_ticks_skipped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
 
-    drain_microtask_queue();
+void dart_server_begin_tick() {
+    g_server_between_ticks.store(false, std::memory_order_release);
+}
 
-    Dart_ExitScope();
-    safe_exit_isolate(did_enter);
+bool server_set_background_pump(bool enabled) {
+    if (enabled) {
+        if (!g_server_initialized || g_server_isolate == nullptr) return false;
+        if (g_server_pump_running.exchange(true)) return true;
+        g_server_pump_thread = std::thread(server_pump_loop);
+        std::cout << "Server isolate background message pump started" << std::endl;
+        return true;
+    }
+
+    if (!g_server_pump_running.exchange(false)) return true;
+    {
+        std::lock_guard<std::mutex> lock(g_server_pump_mutex);
+        g_server_pump_cv.notify_all();
+    }
+    if (g_server_pump_thread.joinable()) g_server_pump_thread.join();
+    std::cout << "Server isolate background message pump stopped" << std::endl;
+    return true;
+}
+
+void server_get_pump_stats(int64_t* out_ticks_drained, int64_t* out_ticks_skipped, int64_t* out_background_drains) {
+    if (out_ticks_drained) *out_ticks_drained = g_server_ticks_drained.load(std::memory_order_relaxed);
+    if (out_ticks_skipped) *out_ticks_skipped = g_server_ticks_skipped.load(std::memory_order_relaxed);
+    if (out_background_drains) *out_background_drains = g_server_background_drains.load(std::memory_order_relaxed);
+}
+
+void server_get_isolate_contention(int64_t* out_entries, int64_t* out_contended, int64_t* out_wait_ns) {
+    if (out_entries) *out_entries = g_server_isolate_entries.load(std::memory_order_relaxed);
+    if (out_contended) *out_contended = g_server_isolate_contended.load(std::memory_order_relaxed);
+    if (out_wait_ns) *out_wait_ns = g_server_isolate_wait_ns.load(std::memory_order_relaxed);
+}
+
+void server_reset_isolate_contention() {
+    g_server_isolate_entries.store(0, std::memory_order_relaxed);
+    g_server_isolate_contended.store(0, std::memory_order_relaxed);
+    g_server_isolate_wait_ns.store(0, std::memory_order_relaxed);
+}
+
+bool server_capture_start(const char* path, int64_t max_bytes) {
+    return dart_mc_bridge::EventCapture::instance().start(path, max_bytes);
+}
+
+void server_capture_stop() {
+    dart_mc_bridge::EventCapture::instance().stop();
 }
 
 void dart_server_set_jvm(JavaVM* jvm) {
@@ -962,6 +1204,19 @@ void server_register_block_entity_container_close_handler(BlockEntityContainerCl
     g_block_entity_container_close_callback = cb;
 }
 
+void server_register_block_entity_load_chunk_handler(BlockEntityLoadChunkCallback cb) {
+    g_block_entity_load_chunk_callback = cb;
+}
+
+void server_register_block_entity_save_chunk_handler(BlockEntitySaveChunkCallback cb) {
+    g_block_entity_save_chunk_callback = cb;
+}
+
+uint8_t* server_block_entity_chunk_reserve(int32_t length) {
+    t_block_entity_chunk_buffer.resize(length > 0 ? static_cast<size_t>(length) : 0);
+    return t_block_entity_chunk_buffer.data();
+}
+
 // ==========================================================================
 // Event Dispatch (called from Java via JNI)
 // All dispatch functions use safe_enter_isolate/safe_exit_isolate pattern
@@ -974,56 +1229,69 @@ void server_register_block_entity_container_close_handler(BlockEntityContainerCl
 
 int32_t server_dispatch_block_break(int32_t x, int32_t y, int32_t z, int64_t player_id) {
     SERVER_DISPATCH_BEGIN_RET(1);
+    dart_mc_bridge::CaptureScope capture(__func__, x, y, z, player_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     int32_t result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchBlockBreak(x, y, z, player_id);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 int32_t server_dispatch_block_interact(int32_t x, int32_t y, int32_t z, int64_t player_id, int32_t hand) {
     SERVER_DISPATCH_BEGIN_RET(1);
+    dart_mc_bridge::CaptureScope capture(__func__, x, y, z, player_id, hand);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     int32_t result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchBlockInteract(x, y, z, player_id, hand);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 void server_dispatch_tick(int64_t tick) {
     SERVER_DISPATCH_BEGIN();
+    thread_role_apply(THREAD_ROLE_SERVER_TICK);  // No-op once tagged
+    outbound_queue_begin_tick();
+    isolate_stats_check_tick(tick);
+    dart_mc_bridge::CaptureScope capture(__func__, tick);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchTick(tick);
     drain_microtask_queue();  // Also drain after tick
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
+
+    // The tick is over; the background pump may drain until the next one
+    g_server_between_ticks.store(true, std::memory_order_release);
+    if (g_server_drain_pending.load(std::memory_order_acquire)) wake_server_pump();
 }
 
 bool server_dispatch_proxy_block_break(int64_t handler_id, int64_t world_id, int32_t x, int32_t y, int32_t z, int64_t player_id) {
     SERVER_DISPATCH_BEGIN_RET(true);
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, world_id, x, y, z, player_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     bool result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyBlockBreak(handler_id, world_id, x, y, z, player_id);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 int32_t server_dispatch_proxy_block_use(int64_t handler_id, int64_t world_id, int32_t x, int32_t y, int32_t z, int64_t player_id, int32_t hand) {
     SERVER_DISPATCH_BEGIN_RET(3);
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, world_id, x, y, z, player_id, hand);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     int32_t result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyBlockUse(handler_id, world_id, x, y, z, player_id, hand);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 void server_dispatch_proxy_block_stepped_on(int64_t handler_id, int64_t world_id, int32_t x, int32_t y, int32_t z, int32_t entity_id) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, world_id, x, y, z, entity_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyBlockSteppedOn(handler_id, world_id, x, y, z, entity_id);
@@ -1033,6 +1301,7 @@ void server_dispatch_proxy_block_stepped_on(int64_t handler_id, int64_t world_id
 
 void server_dispatch_proxy_block_fallen_upon(int64_t handler_id, int64_t world_id, int32_t x, int32_t y, int32_t z, int32_t entity_id, float fall_distance) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, world_id, x, y, z, entity_id, fall_distance);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyBlockFallenUpon(handler_id, world_id, x, y, z, entity_id, fall_distance);
@@ -1042,6 +1311,7 @@ void server_dispatch_proxy_block_fallen_upon(int64_t handler_id, int64_t world_i
 
 void server_dispatch_proxy_block_random_tick(int64_t handler_id, int64_t world_id, int32_t x, int32_t y, int32_t z) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, world_id, x, y, z);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyBlockRandomTick(handler_id, world_id, x, y, z);
@@ -1051,6 +1321,7 @@ void server_dispatch_proxy_block_random_tick(int64_t handler_id, int64_t world_i
 
 void server_dispatch_proxy_block_placed(int64_t handler_id, int64_t world_id, int32_t x, int32_t y, int32_t z, int64_t player_id) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, world_id, x, y, z, player_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyBlockPlaced(handler_id, world_id, x, y, z, player_id);
@@ -1060,6 +1331,7 @@ void server_dispatch_proxy_block_placed(int64_t handler_id, int64_t world_id, in
 
 void server_dispatch_proxy_block_removed(int64_t handler_id, int64_t world_id, int32_t x, int32_t y, int32_t z) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, world_id, x, y, z);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyBlockRemoved(handler_id, world_id, x, y, z);
@@ -1069,6 +1341,7 @@ void server_dispatch_proxy_block_removed(int64_t handler_id, int64_t world_id, i
 
 void server_dispatch_proxy_block_neighbor_changed(int64_t handler_id, int64_t world_id, int32_t x, int32_t y, int32_t z, int32_t nx, int32_t ny, int32_t nz) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, world_id, x, y, z, nx, ny, nz);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyBlockNeighborChanged(handler_id, world_id, x, y, z, nx, ny, nz);
@@ -1078,6 +1351,7 @@ void server_dispatch_proxy_block_neighbor_changed(int64_t handler_id, int64_t wo
 
 void server_dispatch_proxy_block_entity_inside(int64_t handler_id, int64_t world_id, int32_t x, int32_t y, int32_t z, int32_t entity_id) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, world_id, x, y, z, entity_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyBlockEntityInside(handler_id, world_id, x, y, z, entity_id);
@@ -1091,36 +1365,40 @@ void server_dispatch_proxy_block_entity_inside(int64_t handler_id, int64_t world
 
 int32_t server_dispatch_proxy_block_get_signal(int64_t handler_id, int32_t state_data, int32_t direction) {
     SERVER_DISPATCH_BEGIN_RET(0);
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, state_data, direction);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     int32_t result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyBlockGetSignal(handler_id, state_data, direction);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 int32_t server_dispatch_proxy_block_get_direct_signal(int64_t handler_id, int32_t state_data, int32_t direction) {
     SERVER_DISPATCH_BEGIN_RET(0);
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, state_data, direction);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     int32_t result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyBlockGetDirectSignal(handler_id, state_data, direction);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 int32_t server_dispatch_proxy_block_get_analog_output(int64_t handler_id, int64_t world_id, int32_t x, int32_t y, int32_t z, int32_t state_data) {
     SERVER_DISPATCH_BEGIN_RET(0);
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, world_id, x, y, z, state_data);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     int32_t result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyBlockGetAnalogOutput(handler_id, world_id, x, y, z, state_data);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 void server_dispatch_proxy_block_set_state(int64_t handler_id, int64_t world_id, int32_t x, int32_t y, int32_t z, int32_t new_state_data) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, world_id, x, y, z, new_state_data);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyBlockSetState(handler_id, world_id, x, y, z, new_state_data);
@@ -1134,6 +1412,7 @@ void server_dispatch_proxy_block_set_state(int64_t handler_id, int64_t world_id,
 
 void server_dispatch_block_entity_set_level(int32_t handler_id, int64_t block_pos_hash) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, block_pos_hash);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     if (g_block_entity_set_level_callback) {
@@ -1145,6 +1424,7 @@ void server_dispatch_block_entity_set_level(int32_t handler_id, int64_t block_po
 
 void server_dispatch_block_entity_load(int32_t handler_id, int64_t block_pos_hash, const char* nbt_json) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, block_pos_hash, nbt_json);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     if (g_block_entity_load_callback) {
@@ -1156,6 +1436,7 @@ void server_dispatch_block_entity_load(int32_t handler_id, int64_t block_pos_has
 
 const char* server_dispatch_block_entity_save(int32_t handler_id, int64_t block_pos_hash) {
     SERVER_DISPATCH_BEGIN_RET("{}");
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, block_pos_hash);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     const char* result = "{}";
@@ -1164,11 +1445,12 @@ const char* server_dispatch_block_entity_save(int32_t handler_id, int64_t block_
     }
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result ? result : "{}";
+    return capture.ret(result ? result : "{}");
 }
 
 void server_dispatch_block_entity_tick(int32_t handler_id, int64_t block_pos_hash) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, block_pos_hash);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     if (g_block_entity_tick_callback) {
@@ -1180,6 +1462,7 @@ void server_dispatch_block_entity_tick(int32_t handler_id, int64_t block_pos_has
 
 int32_t server_dispatch_block_entity_get_data_slot(int32_t handler_id, int64_t block_pos_hash, int32_t index) {
     SERVER_DISPATCH_BEGIN_RET(0);
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, block_pos_hash, index);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     int32_t result = 0;
@@ -1188,11 +1471,12 @@ int32_t server_dispatch_block_entity_get_data_slot(int32_t handler_id, int64_t b
     }
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 void server_dispatch_block_entity_set_data_slot(int32_t handler_id, int64_t block_pos_hash, int32_t index, int32_t value) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, block_pos_hash, index, value);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     if (g_block_entity_set_data_slot_callback) {
@@ -1204,6 +1488,7 @@ void server_dispatch_block_entity_set_data_slot(int32_t handler_id, int64_t bloc
 
 void server_dispatch_block_entity_removed(int32_t handler_id, int64_t block_pos_hash) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, block_pos_hash);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     if (g_block_entity_removed_callback) {
@@ -1215,6 +1500,7 @@ void server_dispatch_block_entity_removed(int32_t handler_id, int64_t block_pos_
 
 void server_dispatch_block_entity_container_open(int32_t handler_id, int64_t block_pos_hash) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, block_pos_hash);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     if (g_block_entity_container_open_callback) {
@@ -1226,6 +1512,7 @@ void server_dispatch_block_entity_container_open(int32_t handler_id, int64_t blo
 
 void server_dispatch_block_entity_container_close(int32_t handler_id, int64_t block_pos_hash) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, block_pos_hash);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     if (g_block_entity_container_close_callback) {
@@ -1235,8 +1522,96 @@ void server_dispatch_block_entity_container_close(int32_t handler_id, int64_t bl
     safe_exit_isolate(did_enter);
 }
 
+void server_dispatch_block_entity_load_chunk(const int32_t* handler_ids, const int64_t* block_pos_hashes,
+                                             const uint8_t* data, int32_t data_length,
+                                             const int32_t* offsets, int32_t count) {
+    SERVER_DISPATCH_BEGIN();
+    if (count <= 0) return;
+    // Offsets must be ascending and stay within data
+    if (offsets[0] < 0 || offsets[count] > data_length) {
+        std::cerr << "server_dispatch_block_entity_load_chunk: Offsets out of range" << std::endl;
+        return;
+    }
+    for (int32_t i = 0; i < count; i++) {
+        if (offsets[i] > offsets[i + 1]) {
+            std::cerr << "server_dispatch_block_entity_load_chunk: Offsets not ascending" << std::endl;
+            return;
+        }
+    }
+    dart_mc_bridge::CaptureScope capture(__func__,
+        dart_mc_bridge::CaptureBlob{handler_ids, count * 4}, dart_mc_bridge::CaptureBlob{block_pos_hashes, count * 8},
+        dart_mc_bridge::CaptureBlob{data, data_length}, data_length,
+        dart_mc_bridge::CaptureBlob{offsets, (count + 1) * 4}, count);
+    bool did_enter = safe_enter_isolate();
+    Dart_EnterScope();
+    if (g_block_entity_load_chunk_callback) {
+        g_block_entity_load_chunk_callback(handler_ids, block_pos_hashes, data, offsets, count);
+    } else {
+        // Per-entity fallback, still a single isolate entry for the whole chunk
+        std::string nbt_json;
+        for (int32_t i = 0; i < count; i++) {
+            int32_t length = offsets[i + 1] - offsets[i];
+            if (length > 0 && g_block_entity_load_callback) {
+                nbt_json.assign(reinterpret_cast<const char*>(data + offsets[i]), static_cast<size_t>(length));
+                g_block_entity_load_callback(handler_ids[i], block_pos_hashes[i], nbt_json.c_str());
+            }
+            if (g_block_entity_set_level_callback) {
+                g_block_entity_set_level_callback(handler_ids[i], block_pos_hashes[i]);
+            }
+        }
+    }
+    Dart_ExitScope();
+    safe_exit_isolate(did_enter);
+}
+
+const uint8_t* server_dispatch_block_entity_save_chunk(const int32_t* handler_ids, const int64_t* block_pos_hashes,
+                                                       int32_t count, int32_t* out_offsets, int32_t* out_length) {
+    *out_length = 0;
+    for (int32_t i = 0; i <= count; i++) out_offsets[i] = 0;
+    SERVER_DISPATCH_BEGIN_RET(nullptr);
+    if (count <= 0) return nullptr;
+    // The out-parameters are recorded again below, once they are written
+    dart_mc_bridge::CaptureScope capture(__func__,
+        dart_mc_bridge::CaptureBlob{handler_ids, count * 4}, dart_mc_bridge::CaptureBlob{block_pos_hashes, count * 8}, count,
+        dart_mc_bridge::CaptureBlob{out_offsets, (count + 1) * 4}, dart_mc_bridge::CaptureBlob{out_length, 4});
+
+    bool did_enter = safe_enter_isolate();
+    Dart_EnterScope();
+    int32_t length = -1;
+    if (g_block_entity_save_chunk_callback) {
+        length = g_block_entity_save_chunk_callback(handler_ids, block_pos_hashes, count, out_offsets);
+    } else if (g_block_entity_save_callback) {
+        // Per-entity fallback: collect each JSON string into the chunk buffer
+        t_block_entity_chunk_buffer.clear();
+        for (int32_t i = 0; i < count; i++) {
+            out_offsets[i] = static_cast<int32_t>(t_block_entity_chunk_buffer.size());
+            const char* json = g_block_entity_save_callback(handler_ids[i], block_pos_hashes[i]);
+            if (json == nullptr) json = "{}";
+            t_block_entity_chunk_buffer.insert(t_block_entity_chunk_buffer.end(), json, json + strlen(json));
+        }
+        out_offsets[count] = static_cast<int32_t>(t_block_entity_chunk_buffer.size());
+        length = out_offsets[count];
+    }
+    Dart_ExitScope();
+    safe_exit_isolate(did_enter);
+
+    const uint8_t* result = nullptr;
+    if (length < 0 || static_cast<size_t>(length) > t_block_entity_chunk_buffer.size()) {
+        for (int32_t i = 0; i <= count; i++) out_offsets[i] = 0;
+    } else {
+        *out_length = length;
+        result = t_block_entity_chunk_buffer.data();
+    }
+    capture.updateArgs(
+        dart_mc_bridge::CaptureBlob{handler_ids, count * 4}, dart_mc_bridge::CaptureBlob{block_pos_hashes, count * 8}, count,
+        dart_mc_bridge::CaptureBlob{out_offsets, (count + 1) * 4}, dart_mc_bridge::CaptureBlob{out_length, 4});
+    return result;
+}
+
 void server_dispatch_player_join(int32_t player_id) {
     SERVER_DISPATCH_BEGIN();
+    outbound_queue_add_player(player_id);
+    dart_mc_bridge::CaptureScope capture(__func__, player_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchPlayerJoin(player_id);
@@ -1246,6 +1621,8 @@ void server_dispatch_player_join(int32_t player_id) {
 
 void server_dispatch_player_leave(int32_t player_id) {
     SERVER_DISPATCH_BEGIN();
+    outbound_queue_remove_player(player_id);
+    dart_mc_bridge::CaptureScope capture(__func__, player_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchPlayerLeave(player_id);
@@ -1255,6 +1632,7 @@ void server_dispatch_player_leave(int32_t player_id) {
 
 void server_dispatch_player_respawn(int32_t player_id, bool end_conquered) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, player_id, end_conquered);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchPlayerRespawn(player_id, end_conquered);
@@ -1264,6 +1642,7 @@ void server_dispatch_player_respawn(int32_t player_id, bool end_conquered) {
 
 void server_dispatch_player_change_dimension(int32_t player_id, const char* from_dimension, const char* to_dimension) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, player_id, from_dimension, to_dimension);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchPlayerChangeDimension(player_id, from_dimension, to_dimension);
@@ -1273,6 +1652,7 @@ void server_dispatch_player_change_dimension(int32_t player_id, const char* from
 
 void server_dispatch_entity_change_dimension(int32_t entity_id, const char* from_dimension, const char* to_dimension) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, entity_id, from_dimension, to_dimension);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchEntityChangeDimension(entity_id, from_dimension, to_dimension);
@@ -1282,26 +1662,29 @@ void server_dispatch_entity_change_dimension(int32_t entity_id, const char* from
 
 char* server_dispatch_player_death(int32_t player_id, const char* damage_source) {
     SERVER_DISPATCH_BEGIN_RET(nullptr);
+    dart_mc_bridge::CaptureScope capture(__func__, player_id, damage_source);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     char* result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchPlayerDeath(player_id, damage_source);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 bool server_dispatch_entity_damage(int32_t entity_id, const char* damage_source, double amount) {
     SERVER_DISPATCH_BEGIN_RET(true);
+    dart_mc_bridge::CaptureScope capture(__func__, entity_id, damage_source, amount);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     bool result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchEntityDamage(entity_id, damage_source, amount);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 void server_dispatch_entity_death(int32_t entity_id, const char* damage_source) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, entity_id, damage_source);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchEntityDeath(entity_id, damage_source);
@@ -1311,96 +1694,106 @@ void server_dispatch_entity_death(int32_t entity_id, const char* damage_source)
 
 bool server_dispatch_player_attack_entity(int32_t player_id, int32_t target_id) {
     SERVER_DISPATCH_BEGIN_RET(true);
+    dart_mc_bridge::CaptureScope capture(__func__, player_id, target_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     bool result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchPlayerAttackEntity(player_id, target_id);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 char* server_dispatch_player_chat(int32_t player_id, const char* message) {
     SERVER_DISPATCH_BEGIN_RET(nullptr);
+    dart_mc_bridge::CaptureScope capture(__func__, player_id, message);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     char* result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchPlayerChat(player_id, message);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 bool server_dispatch_player_command(int32_t player_id, const char* command) {
     SERVER_DISPATCH_BEGIN_RET(true);
+    dart_mc_bridge::CaptureScope capture(__func__, player_id, command);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     bool result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchPlayerCommand(player_id, command);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 bool server_dispatch_item_use(int32_t player_id, const char* item_id, int32_t count, int32_t hand) {
     SERVER_DISPATCH_BEGIN_RET(true);
+    dart_mc_bridge::CaptureScope capture(__func__, player_id, item_id, count, hand);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     bool result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchItemUse(player_id, item_id, count, hand);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 int32_t server_dispatch_item_use_on_block(int32_t player_id, const char* item_id, int32_t count, int32_t hand, int32_t x, int32_t y, int32_t z, int32_t face) {
     SERVER_DISPATCH_BEGIN_RET(1);
+    dart_mc_bridge::CaptureScope capture(__func__, player_id, item_id, count, hand, x, y, z, face);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     int32_t result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchItemUseOnBlock(player_id, item_id, count, hand, x, y, z, face);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 int32_t server_dispatch_item_use_on_entity(int32_t player_id, const char* item_id, int32_t count, int32_t hand, int32_t target_id) {
     SERVER_DISPATCH_BEGIN_RET(1);
+    dart_mc_bridge::CaptureScope capture(__func__, player_id, item_id, count, hand, target_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     int32_t result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchItemUseOnEntity(player_id, item_id, count, hand, target_id);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 bool server_dispatch_block_place(int32_t player_id, int32_t x, int32_t y, int32_t z, const char* block_id) {
     SERVER_DISPATCH_BEGIN_RET(true);
+    dart_mc_bridge::CaptureScope capture(__func__, player_id, x, y, z, block_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     bool result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchBlockPlace(player_id, x, y, z, block_id);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 bool server_dispatch_player_pickup_item(int32_t player_id, int32_t item_entity_id) {
     SERVER_DISPATCH_BEGIN_RET(true);
+    dart_mc_bridge::CaptureScope capture(__func__, player_id, item_entity_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     bool result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchPlayerPickupItem(player_id, item_entity_id);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 bool server_dispatch_player_drop_item(int32_t player_id, const char* item_id, int32_t count) {
     SERVER_DISPATCH_BEGIN_RET(true);
+    dart_mc_bridge::CaptureScope capture(__func__, player_id, item_id, count);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     bool result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchPlayerDropItem(player_id, item_id, count);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 void server_dispatch_server_starting() {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchServerStarting();
@@ -1410,6 +1803,7 @@ void server_dispatch_server_starting() {
 
 void server_dispatch_server_started() {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchServerStarted();
@@ -1420,6 +1814,7 @@ void server_dispatch_server_started() {
 
 void server_dispatch_server_stopping() {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchServerStopping();
@@ -1434,6 +1829,7 @@ void server_register_registry_ready_handler(RegistryReadyCallback cb) {
 
 void server_dispatch_registry_ready() {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__);
     std::cout << "Server registry ready signal received" << std::endl;
     if (g_server_registry_ready_callback) {
         bool did_enter = safe_enter_isolate();
@@ -1446,6 +1842,7 @@ void server_dispatch_registry_ready() {
 
 void server_dispatch_proxy_entity_spawn(int64_t handler_id, int32_t entity_id, int64_t world_id) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, entity_id, world_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyEntitySpawn(handler_id, entity_id, world_id);
@@ -1455,6 +1852,7 @@ void server_dispatch_proxy_entity_spawn(int64_t handler_id, int32_t entity_id, i
 
 void server_dispatch_proxy_entity_tick(int64_t handler_id, int32_t entity_id) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, entity_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyEntityTick(handler_id, entity_id);
@@ -1464,6 +1862,7 @@ void server_dispatch_proxy_entity_tick(int64_t handler_id, int32_t entity_id) {
 
 void server_dispatch_proxy_entity_death(int64_t handler_id, int32_t entity_id, const char* damage_source) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, entity_id, damage_source);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyEntityDeath(handler_id, entity_id, damage_source);
@@ -1473,16 +1872,18 @@ void server_dispatch_proxy_entity_death(int64_t handler_id, int32_t entity_id, c
 
 bool server_dispatch_proxy_entity_damage(int64_t handler_id, int32_t entity_id, const char* damage_source, double amount) {
     SERVER_DISPATCH_BEGIN_RET(true);
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, entity_id, damage_source, amount);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     bool result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyEntityDamage(handler_id, entity_id, damage_source, amount);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 void server_dispatch_proxy_entity_attack(int64_t handler_id, int32_t entity_id, int32_t target_id) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, entity_id, target_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyEntityAttack(handler_id, entity_id, target_id);
@@ -1492,6 +1893,7 @@ void server_dispatch_proxy_entity_attack(int64_t handler_id, int32_t entity_id,
 
 void server_dispatch_proxy_entity_target(int64_t handler_id, int32_t entity_id, int32_t target_id) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, entity_id, target_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyEntityTarget(handler_id, entity_id, target_id);
@@ -1501,6 +1903,7 @@ void server_dispatch_proxy_entity_target(int64_t handler_id, int32_t entity_id,
 
 void server_dispatch_proxy_projectile_hit_entity(int64_t handler_id, int32_t projectile_id, int32_t target_id) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, projectile_id, target_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyProjectileHitEntity(handler_id, projectile_id, target_id);
@@ -1510,6 +1913,7 @@ void server_dispatch_proxy_projectile_hit_entity(int64_t handler_id, int32_t pro
 
 void server_dispatch_proxy_projectile_hit_block(int64_t handler_id, int32_t projectile_id, int32_t x, int32_t y, int32_t z, const char* side) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, projectile_id, x, y, z, side);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyProjectileHitBlock(handler_id, projectile_id, x, y, z, side);
@@ -1519,6 +1923,7 @@ void server_dispatch_proxy_projectile_hit_block(int64_t handler_id, int32_t proj
 
 void server_dispatch_proxy_animal_breed(int64_t handler_id, int32_t entity_id, int32_t partner_id, int32_t baby_id) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, entity_id, partner_id, baby_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyAnimalBreed(handler_id, entity_id, partner_id, baby_id);
@@ -1528,76 +1933,89 @@ void server_dispatch_proxy_animal_breed(int64_t handler_id, int32_t entity_id, i
 
 bool server_dispatch_proxy_item_attack_entity(int64_t handler_id, int32_t world_id, int32_t attacker_id, int32_t target_id) {
     SERVER_DISPATCH_BEGIN_RET(true);
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, world_id, attacker_id, target_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     bool result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyItemAttackEntity(handler_id, world_id, attacker_id, target_id);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 int32_t server_dispatch_proxy_item_use(int64_t handler_id, int64_t world_id, int32_t player_id, int32_t hand) {
     SERVER_DISPATCH_BEGIN_RET(4);
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, world_id, player_id, hand);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     int32_t result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyItemUse(handler_id, world_id, player_id, hand);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 int32_t server_dispatch_proxy_item_use_on_block(int64_t handler_id, int64_t world_id, int32_t x, int32_t y, int32_t z, int32_t player_id, int32_t hand) {
     SERVER_DISPATCH_BEGIN_RET(4);
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, world_id, x, y, z, player_id, hand);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     int32_t result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyItemUseOnBlock(handler_id, world_id, x, y, z, player_id, hand);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 int32_t server_dispatch_proxy_item_use_on_entity(int64_t handler_id, int64_t world_id, int32_t entity_id, int32_t player_id, int32_t hand) {
     SERVER_DISPATCH_BEGIN_RET(4);
+    dart_mc_bridge::CaptureScope capture(__func__, handler_id, world_id, entity_id, player_id, hand);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     int32_t result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchProxyItemUseOnEntity(handler_id, world_id, entity_id, player_id, hand);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
-int32_t server_dispatch_command_execute(int64_t command_id, int32_t player_id, const char* args_json) {
+int32_t server_dispatch_command_execute(int64_t command_id, int32_t player_id, const uint8_t* args, int32_t args_length) {
     SERVER_DISPATCH_BEGIN_RET(0);
+    dart_mc_bridge::CaptureScope capture(__func__, command_id, player_id,
+        dart_mc_bridge::CaptureBlob{args, args_length}, args_length);
+    if (command_args_validate(args, args_length) < 0) {
+        std::cerr << "Rejected malformed argument buffer for command " << command_id << std::endl;
+        return capture.ret(0);
+    }
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
-    int32_t result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchCommandExecute(command_id, player_id, args_json);
+    int32_t result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchCommandExecute(command_id, player_id, args, args_length);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 bool server_dispatch_custom_goal_can_use(const char* goal_id, int32_t entity_id) {
     SERVER_DISPATCH_BEGIN_RET(false);
+    dart_mc_bridge::CaptureScope capture(__func__, goal_id, entity_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     bool result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchCustomGoalCanUse(goal_id, entity_id);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 bool server_dispatch_custom_goal_can_continue_to_use(const char* goal_id, int32_t entity_id) {
     SERVER_DISPATCH_BEGIN_RET(false);
+    dart_mc_bridge::CaptureScope capture(__func__, goal_id, entity_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     bool result = dart_mc_bridge::ServerCallbackRegistry::instance().dispatchCustomGoalCanContinueToUse(goal_id, entity_id);
     Dart_ExitScope();
     safe_exit_isolate(did_enter);
-    return result;
+    return capture.ret(result);
 }
 
 void server_dispatch_custom_goal_start(const char* goal_id, int32_t entity_id) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, goal_id, entity_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchCustomGoalStart(goal_id, entity_id);
@@ -1607,6 +2025,7 @@ void server_dispatch_custom_goal_start(const char* goal_id, int32_t entity_id) {
 
 void server_dispatch_custom_goal_tick(const char* goal_id, int32_t entity_id) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, goal_id, entity_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchCustomGoalTick(goal_id, entity_id);
@@ -1616,6 +2035,7 @@ void server_dispatch_custom_goal_tick(const char* goal_id, int32_t entity_id) {
 
 void server_dispatch_custom_goal_stop(const char* goal_id, int32_t entity_id) {
     SERVER_DISPATCH_BEGIN();
+    dart_mc_bridge::CaptureScope capture(__func__, goal_id, entity_id);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchCustomGoalStop(goal_id, entity_id);
@@ -1739,6 +2159,12 @@ void server_set_send_packet_to_client_callback(SendPacketToClientCallback cb) {
 
 void server_dispatch_client_packet(int32_t player_id, int32_t packet_type, const uint8_t* data, int32_t data_length) {
     SERVER_DISPATCH_BEGIN();
+    if (packet_type == PACKET_SCHEMA_C2S && packet_schema_validate(data, data_length) < 0) {
+        std::cerr << "[Native] Dropping malformed schema packet from player " << player_id << std::endl;
+        return;
+    }
+    dart_mc_bridge::CaptureScope capture(__func__, player_id, packet_type,
+        dart_mc_bridge::CaptureBlob{data, data_length}, data_length);
     bool did_enter = safe_enter_isolate();
     Dart_EnterScope();
     dart_mc_bridge::ServerCallbackRegistry::instance().dispatchPacketReceived(player_id, packet_type, data, data_length);
@@ -1747,9 +2173,19 @@ void server_dispatch_client_packet(int32_t player_id, int32_t packet_type, const
 }
 
 void server_send_packet_to_client(int32_t player_id, int32_t packet_type, const uint8_t* data, int32_t data_length) {
+    server_queue_packet_to_client(player_id, packet_type, OUTBOUND_PRIORITY_GAMEPLAY, 0, data, data_length);
+}
+
+bool server_queue_packet_to_client(int32_t player_id, int32_t packet_type, int32_t priority, int64_t merge_key,
+                                   const uint8_t* data, int32_t data_length) {
+    if (outbound_queue_is_enabled()) {
+        return outbound_queue_push(player_id, packet_type, priority, merge_key, data, data_length);
+    }
     if (g_server_send_packet_callback) {
         g_server_send_packet_callback(player_id, packet_type, data, data_length);
+        return true;
     }
+    return false;
 }
 
 // ==========================================================================
@@ -1973,6 +2409,9 @@ void server_queue_animation_registration(
     reg.animation_type = animation_type ? animation_type : "";
     reg.animation_json = animation_json ? animation_json : "{}";
 
+    // Time-based animations are also compiled for batched native evaluation
+    animation_compile(handler_id, reg.animation_json.c_str());
+
     g_server_animation_queue.push(reg);
 
     std::cout << "Queued animation registration: " << reg.block_id
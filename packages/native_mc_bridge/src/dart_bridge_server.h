@@ -31,15 +31,43 @@ bool dart_server_init_aot(const char* aot_library_path);
 // Shutdown the Dart VM
 void dart_server_shutdown();
 
-// Tick the Dart VM (drain microtask queue)
+// Tick the Dart VM (drain microtask queue). Skips entering the isolate when
+// no message was posted to it (and, in JIT mode, no dispatch left microtasks
+// queued) since the previous drain.
 void dart_server_tick();
 
+// Mark the start of a server tick. The background pump stops draining until
+// server_dispatch_tick ends the tick.
+void dart_server_begin_tick();
+
+// Drain the isolate from a background thread as soon as the VM posts a
+// message between server ticks, instead of waiting for the next tick. Timers, ports and
+// async completions then run off the server thread, so Dart code they reach
+// must not touch the world directly. Off by default. Returns false if the
+// server runtime is not running.
+bool server_set_background_pump(bool enabled);
+
+// Tick drain statistics: ticks that entered the isolate, ticks skipped
+// because nothing was pending, and drains done by the background pump.
+void server_get_pump_stats(int64_t* out_ticks_drained, int64_t* out_ticks_skipped, int64_t* out_background_drains);
+
 // Set JVM reference for JNI callbacks
 void dart_server_set_jvm(JavaVM* jvm);
 
 // Get the Dart VM service URL for hot reload/debugging
 const char* dart_server_get_service_url();
 
+// Isolate lock statistics: real (non re-entrant) isolate entries, how many
+// lock acquisitions had to wait for another thread, and the total wait time.
+void server_get_isolate_contention(int64_t* out_entries, int64_t* out_contended, int64_t* out_wait_ns);
+void server_reset_isolate_contention();
+
+// Record every server_dispatch_* call (and dart_server_tick) into a bounded
+// binary ring log at "<path>.0".."<path>.3" for offline replay with
+// tools/capture_replay. Also enabled at init via REDSTONE_CAPTURE_PATH.
+bool server_capture_start(const char* path, int64_t max_bytes);
+void server_capture_stop();
+
 // ==========================================================================
 // Callback Types (same as dart_bridge.h for server-side events)
 // ==========================================================================
@@ -90,6 +118,17 @@ typedef void (*BlockEntityRemovedCallback)(int32_t handler_id, int64_t block_pos
 typedef void (*BlockEntityContainerOpenCallback)(int32_t handler_id, int64_t block_pos_hash);
 typedef void (*BlockEntityContainerCloseCallback)(int32_t handler_id, int64_t block_pos_hash);
 
+// Chunk-batched block entity callbacks (one isolate entry per chunk).
+// Load: data is the concatenated UTF-8 JSON payloads, entry i spans
+// [offsets[i], offsets[i + 1]). An empty span means "no saved data" and the
+// entity only receives setLevel. Dart applies load then setLevel per entry.
+typedef void (*BlockEntityLoadChunkCallback)(const int32_t* handler_ids, const int64_t* block_pos_hashes,
+                                             const uint8_t* data, const int32_t* offsets, int32_t count);
+// Save: Dart reserves the payload buffer via server_block_entity_chunk_reserve(),
+// writes count + 1 offsets into out_offsets and returns the payload length (-1 on error).
+typedef int32_t (*BlockEntitySaveChunkCallback)(const int32_t* handler_ids, const int64_t* block_pos_hashes,
+                                                int32_t count, int32_t* out_offsets);
+
 // Player events
 typedef void (*PlayerJoinCallback)(int32_t player_id);
 typedef void (*PlayerLeaveCallback)(int32_t player_id);
@@ -151,7 +190,8 @@ typedef int32_t (*ProxyItemUseOnBlockCallback)(int64_t handler_id, int64_t world
 typedef int32_t (*ProxyItemUseOnEntityCallback)(int64_t handler_id, int64_t world_id, int32_t entity_id, int32_t player_id, int32_t hand);
 
 // Command callback
-typedef int32_t (*CommandExecuteCallback)(int64_t command_id, int32_t player_id, const char* args_json);
+// args is a command_args.h buffer, valid only for the duration of the call
+typedef int32_t (*CommandExecuteCallback)(int64_t command_id, int32_t player_id, const uint8_t* args, int32_t args_length);
 
 // Custom goal callbacks
 typedef bool (*CustomGoalCanUseCallback)(const char* goal_id, int32_t entity_id);
@@ -197,6 +237,12 @@ void server_register_block_entity_set_data_slot_handler(BlockEntitySetDataSlotCa
 void server_register_block_entity_removed_handler(BlockEntityRemovedCallback cb);
 void server_register_block_entity_container_open_handler(BlockEntityContainerOpenCallback cb);
 void server_register_block_entity_container_close_handler(BlockEntityContainerCloseCallback cb);
+void server_register_block_entity_load_chunk_handler(BlockEntityLoadChunkCallback cb);
+void server_register_block_entity_save_chunk_handler(BlockEntitySaveChunkCallback cb);
+
+// Reserve the calling thread's chunk save buffer (called from Dart inside a
+// BlockEntitySaveChunkCallback). Returns a pointer to at least `length` bytes.
+uint8_t* server_block_entity_chunk_reserve(int32_t length);
 
 void server_register_player_join_handler(PlayerJoinCallback cb);
 void server_register_player_leave_handler(PlayerLeaveCallback cb);
@@ -294,6 +340,18 @@ void server_dispatch_block_entity_removed(int32_t handler_id, int64_t block_pos_
 void server_dispatch_block_entity_container_open(int32_t handler_id, int64_t block_pos_hash);
 void server_dispatch_block_entity_container_close(int32_t handler_id, int64_t block_pos_hash);
 
+// Chunk-batched block entity dispatch: every entity of a chunk in one isolate entry.
+// Falls back to the per-entity callbacks (still inside a single isolate entry)
+// when Dart has not registered the chunk handlers. Entry i of data spans
+// [offsets[i], offsets[i + 1]); offsets outside data_length are rejected.
+void server_dispatch_block_entity_load_chunk(const int32_t* handler_ids, const int64_t* block_pos_hashes,
+                                             const uint8_t* data, int32_t data_length,
+                                             const int32_t* offsets, int32_t count);
+// Returns the concatenated JSON payloads; out_offsets receives count + 1 entries.
+// The buffer is thread-local and stays valid until the next call on this thread.
+const uint8_t* server_dispatch_block_entity_save_chunk(const int32_t* handler_ids, const int64_t* block_pos_hashes,
+                                                       int32_t count, int32_t* out_offsets, int32_t* out_length);
+
 void server_dispatch_player_join(int32_t player_id);
 void server_dispatch_player_leave(int32_t player_id);
 void server_dispatch_player_respawn(int32_t player_id, bool end_conquered);
@@ -339,7 +397,8 @@ int32_t server_dispatch_proxy_item_use(int64_t handler_id, int64_t world_id, int
 int32_t server_dispatch_proxy_item_use_on_block(int64_t handler_id, int64_t world_id, int32_t x, int32_t y, int32_t z, int32_t player_id, int32_t hand);
 int32_t server_dispatch_proxy_item_use_on_entity(int64_t handler_id, int64_t world_id, int32_t entity_id, int32_t player_id, int32_t hand);
 
-int32_t server_dispatch_command_execute(int64_t command_id, int32_t player_id, const char* args_json);
+// Returns 0 without dispatching if args is not a valid command_args.h buffer
+int32_t server_dispatch_command_execute(int64_t command_id, int32_t player_id, const uint8_t* args, int32_t args_length);
 
 bool server_dispatch_custom_goal_can_use(const char* goal_id, int32_t entity_id);
 bool server_dispatch_custom_goal_can_continue_to_use(const char* goal_id, int32_t entity_id);
@@ -368,9 +427,16 @@ void server_set_send_packet_to_client_callback(SendPacketToClientCallback cb);
 // Dispatch a packet from client to server Dart VM (called from Java via JNI)
 void server_dispatch_client_packet(int32_t player_id, int32_t packet_type, const uint8_t* data, int32_t data_length);
 
-// Send a packet from server to client - invokes the Java callback (called from Dart via FFI)
+// Send a packet from server to client at gameplay priority (called from Dart via FFI)
 void server_send_packet_to_client(int32_t player_id, int32_t packet_type, const uint8_t* data, int32_t data_length);
 
+// Send a packet with an OUTBOUND_PRIORITY_* class and merge key (0 = never
+// merged). Queued for the Java sender thread when the outbound queue is
+// enabled, otherwise the Java callback is invoked synchronously. Returns
+// false if the packet was dropped.
+bool server_queue_packet_to_client(int32_t player_id, int32_t packet_type, int32_t priority, int64_t merge_key,
+                                   const uint8_t* data, int32_t data_length);
+
 // ==========================================================================
 // Registration Queue Functions (thread-safe registration from Dart)
 // ==========================================================================
@@ -0,0 +1,351 @@
+#include "event_capture.h"
+#include <algorithm>
+#include <iostream>
+
+namespace dart_mc_bridge {
+
+namespace {
+
+constexpr size_t kSegmentHeaderSize = sizeof(kCaptureMagic) + sizeof(uint32_t) * 2 + sizeof(uint64_t);
+
+template <typename T>
+void appendRaw(std::string& out, T value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readRaw(const std::string& in, size_t& pos, T& value) {
+    if (pos + sizeof(T) > in.size()) return false;
+    std::memcpy(&value, in.data() + pos, sizeof(T));
+    pos += sizeof(T);
+    return true;
+}
+
+bool readValue(const std::string& in, size_t& pos, CaptureValue& value) {
+    uint8_t type = 0;
+    if (!readRaw(in, pos, type)) return false;
+    value.type = static_cast<CaptureType>(type);
+    switch (value.type) {
+        case CaptureType::None:
+            return true;
+        case CaptureType::Int32: {
+            int32_t v = 0;
+            if (!readRaw(in, pos, v)) return false;
+            value.i = v;
+            return true;
+        }
+        case CaptureType::Int64:
+            return readRaw(in, pos, value.i);
+        case CaptureType::Float: {
+            float v = 0.0f;
+            if (!readRaw(in, pos, v)) return false;
+            value.d = v;
+            return true;
+        }
+        case CaptureType::Double:
+            return readRaw(in, pos, value.d);
+        case CaptureType::Bool: {
+            uint8_t v = 0;
+            if (!readRaw(in, pos, v)) return false;
+            value.i = v;
+            return true;
+        }
+        case CaptureType::String:
+        case CaptureType::Blob: {
+            uint32_t length = 0;
+            if (!readRaw(in, pos, length) || pos + length > in.size()) return false;
+            value.bytes.assign(in.data() + pos, length);
+            pos += length;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string segmentPath(const std::string& path, int index) {
+    return path + "." + std::to_string(index);
+}
+
+} // namespace
+
+// ==========================================================================
+// Encoders
+// ==========================================================================
+
+void captureEncode(std::string& out, int32_t value) {
+    appendRaw(out, static_cast<uint8_t>(CaptureType::Int32));
+    appendRaw(out, value);
+}
+
+void captureEncode(std::string& out, int64_t value) {
+    appendRaw(out, static_cast<uint8_t>(CaptureType::Int64));
+    appendRaw(out, value);
+}
+
+void captureEncode(std::string& out, float value) {
+    appendRaw(out, static_cast<uint8_t>(CaptureType::Float));
+    appendRaw(out, value);
+}
+
+void captureEncode(std::string& out, double value) {
+    appendRaw(out, static_cast<uint8_t>(CaptureType::Double));
+    appendRaw(out, value);
+}
+
+void captureEncode(std::string& out, bool value) {
+    appendRaw(out, static_cast<uint8_t>(CaptureType::Bool));
+    appendRaw(out, static_cast<uint8_t>(value ? 1 : 0));
+}
+
+void captureEncode(std::string& out, const char* value) {
+    if (value == nullptr) {
+        appendRaw(out, static_cast<uint8_t>(CaptureType::None));
+        return;
+    }
+    uint32_t length = static_cast<uint32_t>(std::strlen(value));
+    appendRaw(out, static_cast<uint8_t>(CaptureType::String));
+    appendRaw(out, length);
+    out.append(value, length);
+}
+
+void captureEncode(std::string& out, const CaptureBlob& value) {
+    uint32_t length = (value.data != nullptr && value.size > 0) ? static_cast<uint32_t>(value.size) : 0;
+    appendRaw(out, static_cast<uint8_t>(CaptureType::Blob));
+    appendRaw(out, length);
+    if (length > 0) {
+        out.append(static_cast<const char*>(value.data), length);
+    }
+}
+
+// ==========================================================================
+// Writer
+// ==========================================================================
+
+bool EventCapture::start(const char* path, int64_t max_bytes) {
+    if (path == nullptr || path[0] == '\0') return false;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (file_ != nullptr) {
+        std::cerr << "EventCapture: Already capturing to " << path_ << std::endl;
+        return false;
+    }
+
+    path_ = path;
+    segment_capacity_ = std::max<int64_t>(max_bytes / kCaptureSegments, 64 * 1024);
+    segment_sequence_ = 0;
+    event_ids_.clear();
+    event_names_.clear();
+
+    // Remove stale segments from a previous capture so the reader never mixes runs
+    for (int i = 0; i < kCaptureSegments; i++) {
+        std::remove(segmentPath(path_, i).c_str());
+    }
+
+    if (!openSegment(0)) {
+        return false;
+    }
+
+    start_time_ = std::chrono::steady_clock::now();
+    enabled_.store(true, std::memory_order_release);
+    std::cout << "EventCapture: Capturing server dispatch events to " << path_
+              << ".[0-" << (kCaptureSegments - 1) << "] (max " << max_bytes << " bytes)" << std::endl;
+    return true;
+}
+
+void EventCapture::stop() {
+    enabled_.store(false, std::memory_order_release);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (file_ != nullptr) {
+        std::fclose(file_);
+        file_ = nullptr;
+        std::cout << "EventCapture: Stopped capturing to " << path_ << std::endl;
+    }
+}
+
+uint64_t EventCapture::nowNs() const {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start_time_).count());
+}
+
+bool EventCapture::openSegment(int index) {
+    if (file_ != nullptr) {
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+
+    std::string segment = segmentPath(path_, index);
+    file_ = std::fopen(segment.c_str(), "wb");
+    if (file_ == nullptr) {
+        std::cerr << "EventCapture: Failed to open " << segment << std::endl;
+        enabled_.store(false, std::memory_order_release);
+        return false;
+    }
+
+    segment_index_ = index;
+    segment_size_ = 0;
+
+    std::string header(kCaptureMagic, sizeof(kCaptureMagic));
+    appendRaw(header, kCaptureVersion);
+    appendRaw(header, static_cast<uint32_t>(index));
+    appendRaw(header, segment_sequence_++);
+    std::fwrite(header.data(), 1, header.size(), file_);
+    segment_size_ += static_cast<int64_t>(header.size());
+
+    // Each segment must be decodable without the ones before it
+    for (size_t id = 0; id < event_names_.size(); id++) {
+        writeNameRecord(static_cast<uint16_t>(id), event_names_[id]);
+    }
+    return true;
+}
+
+void EventCapture::writeNameRecord(uint16_t id, const std::string& name) {
+    std::string record;
+    appendRaw(record, static_cast<uint8_t>(CaptureRecordKind::Name));
+    appendRaw(record, id);
+    appendRaw(record, static_cast<uint16_t>(name.size()));
+    record.append(name);
+    std::fwrite(record.data(), 1, record.size(), file_);
+    segment_size_ += static_cast<int64_t>(record.size());
+}
+
+void EventCapture::write(const char* event_name, uint64_t timestamp_ns, uint64_t duration_ns,
+                         uint16_t arg_count, const std::string& args, const std::string& result) {
+    std::string body;
+    body.reserve(2 + 2 + 8 + 8 + args.size() + result.size() + 1);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (file_ == nullptr) return;
+
+    uint16_t event_id;
+    auto it = event_ids_.find(event_name);
+    bool new_name = it == event_ids_.end();
+    if (new_name) {
+        event_id = static_cast<uint16_t>(event_names_.size());
+        event_ids_.emplace(event_name, event_id);
+        event_names_.emplace_back(event_name);
+    } else {
+        event_id = it->second;
+    }
+
+    appendRaw(body, event_id);
+    appendRaw(body, arg_count);
+    appendRaw(body, timestamp_ns);
+    appendRaw(body, duration_ns);
+    body.append(args);
+    if (result.empty()) {
+        appendRaw(body, static_cast<uint8_t>(CaptureType::None));
+    } else {
+        body.append(result);
+    }
+
+    int64_t record_size = static_cast<int64_t>(1 + sizeof(uint32_t) + body.size());
+    if (segment_size_ + record_size > segment_capacity_ && segment_size_ > static_cast<int64_t>(kSegmentHeaderSize)) {
+        // Segment full - advance the ring, overwriting the oldest segment
+        if (!openSegment((segment_index_ + 1) % kCaptureSegments)) return;
+    } else if (new_name) {
+        writeNameRecord(event_id, event_names_[event_id]);
+    }
+
+    std::string header;
+    appendRaw(header, static_cast<uint8_t>(CaptureRecordKind::Event));
+    appendRaw(header, static_cast<uint32_t>(body.size()));
+    std::fwrite(header.data(), 1, header.size(), file_);
+    std::fwrite(body.data(), 1, body.size(), file_);
+    segment_size_ += record_size;
+}
+
+// ==========================================================================
+// Reader
+// ==========================================================================
+
+bool readCapture(const std::string& path, std::vector<CaptureRecord>& out_records) {
+    struct Segment {
+        uint64_t sequence;
+        std::string data;
+    };
+    std::vector<Segment> segments;
+
+    for (int i = 0; i < kCaptureSegments; i++) {
+        FILE* file = std::fopen(segmentPath(path, i).c_str(), "rb");
+        if (file == nullptr) continue;
+
+        std::string data;
+        char buffer[64 * 1024];
+        size_t n;
+        while ((n = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+            data.append(buffer, n);
+        }
+        std::fclose(file);
+
+        if (data.size() < kSegmentHeaderSize || std::memcmp(data.data(), kCaptureMagic, sizeof(kCaptureMagic)) != 0) {
+            std::cerr << "EventCapture: Skipping invalid segment " << segmentPath(path, i) << std::endl;
+            continue;
+        }
+        size_t pos = sizeof(kCaptureMagic);
+        uint32_t version = 0, index = 0;
+        uint64_t sequence = 0;
+        readRaw(data, pos, version);
+        readRaw(data, pos, index);
+        readRaw(data, pos, sequence);
+        if (version != kCaptureVersion) {
+            std::cerr << "EventCapture: Unsupported capture version " << version << std::endl;
+            continue;
+        }
+        segments.push_back({sequence, std::move(data)});
+    }
+
+    if (segments.empty()) return false;
+    std::sort(segments.begin(), segments.end(),
+              [](const Segment& a, const Segment& b) { return a.sequence < b.sequence; });
+
+    for (const Segment& segment : segments) {
+        std::vector<std::string> names;
+        const std::string& data = segment.data;
+        size_t pos = kSegmentHeaderSize;
+
+        while (pos < data.size()) {
+            uint8_t kind = 0;
+            if (!readRaw(data, pos, kind)) break;
+
+            if (kind == static_cast<uint8_t>(CaptureRecordKind::Name)) {
+                uint16_t id = 0, length = 0;
+                if (!readRaw(data, pos, id) || !readRaw(data, pos, length) || pos + length > data.size()) break;
+                if (names.size() <= id) names.resize(id + 1);
+                names[id].assign(data.data() + pos, length);
+                pos += length;
+                continue;
+            }
+
+            uint32_t size = 0;
+            if (kind != static_cast<uint8_t>(CaptureRecordKind::Event) ||
+                !readRaw(data, pos, size) || pos + size > data.size()) {
+                break;  // Truncated tail (capture was not stopped cleanly)
+            }
+            size_t end = pos + size;
+
+            CaptureRecord record;
+            uint16_t event_id = 0, arg_count = 0;
+            readRaw(data, pos, event_id);
+            readRaw(data, pos, arg_count);
+            readRaw(data, pos, record.timestamp_ns);
+            readRaw(data, pos, record.duration_ns);
+            record.event_name = event_id < names.size() ? names[event_id] : std::string();
+
+            bool ok = true;
+            record.args.resize(arg_count);
+            for (uint16_t a = 0; a < arg_count && ok; a++) {
+                ok = readValue(data, pos, record.args[a]);
+            }
+            ok = ok && readValue(data, pos, record.result);
+            pos = end;
+
+            if (ok && !record.event_name.empty()) {
+                out_records.push_back(std::move(record));
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace dart_mc_bridge
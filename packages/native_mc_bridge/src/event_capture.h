@@ -0,0 +1,211 @@
+#ifndef EVENT_CAPTURE_H
+#define EVENT_CAPTURE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ==========================================================================
+// Server Event Capture
+// ==========================================================================
+// Records every server_dispatch_* call (event name, arguments, start time,
+// duration and return value) into a compact binary log so production traffic
+// can be replayed offline against a Dart server isolate (tools/capture_replay).
+//
+// The log is a bounded ring on disk made of kCaptureSegments segment files
+// named "<path>.0" .. "<path>.N". When a segment is full the writer moves to
+// the next one and truncates it, so disk usage never exceeds max_bytes.
+//
+// Segment layout (little endian):
+//   header:  char magic[8] = "RSDCAP01", uint32 version, uint32 index, uint64 sequence
+//   records: uint8 kind, then
+//     kind 1 (name):  uint16 event_id, uint16 length, char name[length]
+//     kind 2 (event): uint32 size (of the rest of the record), uint16 event_id,
+//                     uint16 arg_count, uint64 timestamp_ns, uint64 duration_ns,
+//                     arg_count values, then one result value
+//   values:  uint8 type, then the payload for that type (strings and blobs are
+//            prefixed with a uint32 length)
+//
+// Name records are re-emitted at the start of every segment so each segment
+// can be decoded on its own after older ones have been overwritten.
+// ==========================================================================
+
+namespace dart_mc_bridge {
+
+constexpr int kCaptureSegments = 4;
+constexpr uint32_t kCaptureVersion = 1;
+constexpr char kCaptureMagic[8] = {'R', 'S', 'D', 'C', 'A', 'P', '0', '1'};
+
+enum class CaptureType : uint8_t {
+    None = 0,
+    Int32 = 1,
+    Int64 = 2,
+    Float = 3,
+    Double = 4,
+    Bool = 5,
+    String = 6,
+    Blob = 7,
+};
+
+enum class CaptureRecordKind : uint8_t {
+    Name = 1,
+    Event = 2,
+};
+
+/**
+ * Raw pointer + size argument (packet payloads, chunk arrays).
+ * Recorded as an opaque blob and handed back as a pointer on replay.
+ */
+struct CaptureBlob {
+    const void* data;
+    int32_t size;
+};
+
+/**
+ * Process-wide capture writer. Disabled by default; enabling costs one
+ * relaxed atomic load per dispatch when off.
+ */
+class EventCapture {
+public:
+    static EventCapture& instance() {
+        static EventCapture capture;
+        return capture;
+    }
+
+    // Start capturing into "<path>.0" .. "<path>.N" bounded to max_bytes total.
+    bool start(const char* path, int64_t max_bytes);
+
+    // Stop capturing and flush all pending records to disk.
+    void stop();
+
+    bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    // Nanoseconds since capture start.
+    uint64_t nowNs() const;
+
+    // Append one event record. args/result are already encoded values.
+    void write(const char* event_name, uint64_t timestamp_ns, uint64_t duration_ns,
+               uint16_t arg_count, const std::string& args, const std::string& result);
+
+private:
+    EventCapture() = default;
+    ~EventCapture() { stop(); }
+    EventCapture(const EventCapture&) = delete;
+    EventCapture& operator=(const EventCapture&) = delete;
+
+    bool openSegment(int index);
+    void writeNameRecord(uint16_t id, const std::string& name);
+
+    std::atomic<bool> enabled_{false};
+    std::chrono::steady_clock::time_point start_time_;
+
+    std::mutex mutex_;
+    std::string path_;
+    FILE* file_ = nullptr;
+    int segment_index_ = 0;
+    uint64_t segment_sequence_ = 0;
+    int64_t segment_capacity_ = 0;
+    int64_t segment_size_ = 0;
+    std::unordered_map<std::string, uint16_t> event_ids_;
+    std::vector<std::string> event_names_;
+};
+
+// Value encoders shared by CaptureScope and the replay tool
+void captureEncode(std::string& out, int32_t value);
+void captureEncode(std::string& out, int64_t value);
+void captureEncode(std::string& out, float value);
+void captureEncode(std::string& out, double value);
+void captureEncode(std::string& out, bool value);
+void captureEncode(std::string& out, const char* value);
+void captureEncode(std::string& out, const CaptureBlob& value);
+// Other pointers must be wrapped in a CaptureBlob (never recorded as bool)
+template <typename T>
+void captureEncode(std::string& out, const T* value) = delete;
+
+/**
+ * RAII recorder placed at the top of a server_dispatch_* function.
+ * Encodes the arguments on entry and writes the record (with the elapsed
+ * time and the value passed to ret()) when the dispatch returns.
+ */
+class CaptureScope {
+public:
+    template <typename... Args>
+    explicit CaptureScope(const char* event_name, const Args&... args) : event_name_(event_name) {
+        EventCapture& capture = EventCapture::instance();
+        if (!capture.enabled()) return;
+        active_ = true;
+        arg_count_ = static_cast<uint16_t>(sizeof...(Args));
+        (captureEncode(args_, args), ...);
+        start_ns_ = capture.nowNs();
+    }
+
+    ~CaptureScope() {
+        if (!active_) return;
+        EventCapture& capture = EventCapture::instance();
+        uint64_t end_ns = capture.nowNs();
+        capture.write(event_name_, start_ns_, end_ns - start_ns_, arg_count_, args_, result_);
+    }
+
+    // Re-encode the arguments, for dispatches with out-parameters: call with
+    // the full argument list once the out-parameters have been written.
+    template <typename... Args>
+    void updateArgs(const Args&... args) {
+        if (!active_) return;
+        args_.clear();
+        arg_count_ = static_cast<uint16_t>(sizeof...(Args));
+        (captureEncode(args_, args), ...);
+    }
+
+    // Record the dispatch return value and pass it through.
+    template <typename T>
+    T ret(T value) {
+        if (active_) captureEncode(result_, value);
+        return value;
+    }
+
+private:
+    CaptureScope(const CaptureScope&) = delete;
+    CaptureScope& operator=(const CaptureScope&) = delete;
+
+    const char* event_name_;
+    bool active_ = false;
+    uint16_t arg_count_ = 0;
+    uint64_t start_ns_ = 0;
+    std::string args_;
+    std::string result_;
+};
+
+// ==========================================================================
+// Reader (used by the replay tool)
+// ==========================================================================
+
+struct CaptureValue {
+    CaptureType type = CaptureType::None;
+    int64_t i = 0;        // Int32, Int64, Bool
+    double d = 0.0;       // Float, Double
+    std::string bytes;    // String, Blob
+};
+
+struct CaptureRecord {
+    std::string event_name;
+    uint64_t timestamp_ns = 0;
+    uint64_t duration_ns = 0;
+    std::vector<CaptureValue> args;
+    CaptureValue result;
+};
+
+/**
+ * Reads every surviving segment of a capture in write order.
+ * Returns false if no segment could be opened.
+ */
+bool readCapture(const std::string& path, std::vector<CaptureRecord>& out_records);
+
+} // namespace dart_mc_bridge
+
+#endif // EVENT_CAPTURE_H
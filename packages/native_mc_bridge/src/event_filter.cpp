@@ -0,0 +1,97 @@
+#include "event_filter.h"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+namespace {
+
+struct EventFilter {
+    std::unordered_set<std::string> ids;
+    std::unordered_set<std::string> dimensions;
+    bool has_box = false;
+    int32_t box[6] = {0, 0, 0, 0, 0, 0};
+};
+
+std::mutex g_filter_mutex;
+EventFilter g_filters[EVENT_FILTER_COUNT];
+// Read without the lock so unfiltered events cost one load
+std::atomic<bool> g_filter_active[EVENT_FILTER_COUNT];
+std::atomic<int64_t> g_filter_rejected[EVENT_FILTER_COUNT];
+
+bool valid_event(int32_t event) {
+    return event >= 0 && event < EVENT_FILTER_COUNT;
+}
+
+void split_lines(const char* list, std::unordered_set<std::string>& out) {
+    out.clear();
+    if (list == nullptr) return;
+    std::string current;
+    for (const char* p = list; ; p++) {
+        if (*p == '\n' || *p == '\0') {
+            if (!current.empty()) out.insert(current);
+            current.clear();
+            if (*p == '\0') break;
+        } else {
+            current.push_back(*p);
+        }
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+bool event_filter_set(int32_t event, const char* ids, const char* dimensions, const int32_t* box) {
+    if (!valid_event(event)) return false;
+    std::lock_guard<std::mutex> lock(g_filter_mutex);
+    EventFilter& filter = g_filters[event];
+    split_lines(ids, filter.ids);
+    split_lines(dimensions, filter.dimensions);
+    filter.has_box = box != nullptr;
+    for (int i = 0; i < 6; i++) filter.box[i] = box ? box[i] : 0;
+    g_filter_active[event].store(!filter.ids.empty() || !filter.dimensions.empty() || filter.has_box);
+    return true;
+}
+
+void event_filter_clear(int32_t event) {
+    if (!valid_event(event)) return;
+    std::lock_guard<std::mutex> lock(g_filter_mutex);
+    g_filters[event] = EventFilter();
+    g_filter_active[event].store(false);
+}
+
+bool event_filter_is_active(int32_t event) {
+    return valid_event(event) && g_filter_active[event].load(std::memory_order_relaxed);
+}
+
+bool event_filter_accepts(int32_t event, const char* subject_id, const char* dimension,
+                          int32_t x, int32_t y, int32_t z) {
+    if (!valid_event(event) || !g_filter_active[event].load(std::memory_order_relaxed)) return true;
+
+    bool accepted = true;
+    {
+        std::lock_guard<std::mutex> lock(g_filter_mutex);
+        const EventFilter& filter = g_filters[event];
+        if (filter.has_box) {
+            const int32_t* b = filter.box;
+            accepted = x >= b[0] && y >= b[1] && z >= b[2] && x <= b[3] && y <= b[4] && z <= b[5];
+        }
+        if (accepted && !filter.ids.empty()) {
+            accepted = subject_id != nullptr && filter.ids.count(subject_id) != 0;
+        }
+        if (accepted && !filter.dimensions.empty()) {
+            accepted = dimension != nullptr && filter.dimensions.count(dimension) != 0;
+        }
+    }
+    if (!accepted) g_filter_rejected[event].fetch_add(1, std::memory_order_relaxed);
+    return accepted;
+}
+
+int64_t event_filter_rejected_count(int32_t event) {
+    if (!valid_event(event)) return 0;
+    return g_filter_rejected[event].load(std::memory_order_relaxed);
+}
+
+} // extern "C"
@@ -0,0 +1,57 @@
+#ifndef EVENT_FILTER_H
+#define EVENT_FILTER_H
+
+#include <cstdint>
+
+// ==========================================================================
+// Native Event Filters
+// ==========================================================================
+// Global events enter the server isolate on every occurrence, even when the
+// mod's handler only cares about a few blocks or items. Dart attaches a
+// declarative filter to an event when it registers the handler
+// (Events.setFilter). The JNI entry point checks it before the event reaches
+// server_dispatch_*, so a non-matching event returns the default result
+// without entering the isolate.
+//
+// A filter has up to three conditions. All given conditions must match:
+//   ids         subject ids: the broken block, the used or picked up item,
+//               the damaged entity's type
+//   dimensions  dimension ids of the event's world ("minecraft:overworld")
+//   box         inclusive block-position box: the broken block, or the
+//               player's or damaged entity's position
+// An event with no filter always passes.
+//
+// Filtered-out events are not captured by event_capture (the capture scope
+// is inside server_dispatch_*).
+// ==========================================================================
+
+#define EVENT_FILTER_BLOCK_BREAK 0
+#define EVENT_FILTER_ITEM_USE 1
+#define EVENT_FILTER_ENTITY_DAMAGE 2
+#define EVENT_FILTER_PLAYER_PICKUP_ITEM 3
+#define EVENT_FILTER_COUNT 4
+
+extern "C" {
+
+// Set an event's filter, replacing any previous one. ids and dimensions are
+// '\n'-separated lists, null or empty for no condition. box is min x, y, z,
+// max x, y, z, or null. Returns false for an unknown event.
+bool event_filter_set(int32_t event, const char* ids, const char* dimensions, const int32_t* box);
+
+// Remove an event's filter.
+void event_filter_clear(int32_t event);
+
+// Whether an event has a filter. Lets callers skip preparing the subject.
+bool event_filter_is_active(int32_t event);
+
+// Whether an event passes its filter. subject_id and dimension may be null;
+// a null value fails the corresponding condition.
+bool event_filter_accepts(int32_t event, const char* subject_id, const char* dimension,
+                          int32_t x, int32_t y, int32_t z);
+
+// Number of events of this kind rejected by the filter.
+int64_t event_filter_rejected_count(int32_t event);
+
+} // extern "C"
+
+#endif // EVENT_FILTER_H
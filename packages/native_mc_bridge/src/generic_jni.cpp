@@ -1,7 +1,10 @@
 #include "generic_jni.h"
 #include "object_registry.h"
+#include "dart_bridge_bindings.g.h"
 
+#include <atomic>
 #include <unordered_map>
+#include <unordered_set>
 #include <string>
 #include <mutex>
 #include <vector>
@@ -27,6 +30,30 @@ static std::unordered_map<std::string, jmethodID> method_cache;
 static std::unordered_map<std::string, jfieldID> field_cache;
 static std::mutex cache_mutex;
 
+// Resolved primitive fields for jni_read_fields / jni_write_fields (token = index + 1)
+struct FieldToken {
+    jclass cls;     // Global ref owned by class_cache
+    jfieldID fid;
+    char type;      // JNI type char (Z, B, C, S, I, J, F, D)
+    int32_t size;
+};
+static std::vector<FieldToken> field_tokens;
+static std::unordered_map<std::string, int64_t> field_token_index;
+
+// Static final fields (Blocks.STONE, Items.DIAMOND, registry constants...) are
+// read from the JVM once and then served from here. Object constants are held
+// as one pinned registry handle that jni_release_object will not release.
+static std::unordered_map<std::string, bool> static_field_final;
+static std::unordered_map<std::string, int64_t> static_object_constants;
+static std::unordered_map<std::string, int32_t> static_int_constants;
+static std::unordered_set<int64_t> pinned_handles;
+
+// DartBridge static methods from dart_bridge_bindings.g.h, resolved once
+// (index = position in kDartBridgeBindings)
+static jclass g_bridge_class = nullptr;  // Global ref owned by class_cache
+static jmethodID g_bridge_methods[DART_BRIDGE_BINDING_COUNT];
+static std::atomic<bool> g_bridge_resolved{false};
+
 // ============================================================================
 // Helper Functions
 // ============================================================================
@@ -313,6 +340,93 @@ static std::vector<jvalue> convert_args(JNIEnv* env, const char* sig,
     return jargs;
 }
 
+/**
+ * Resolve every entry of kDartBridgeBindings to a jmethodID.
+ * Missing methods stay null and fail when called; the rest still work.
+ */
+static bool resolve_bridge_bindings(JNIEnv* env) {
+    if (g_bridge_resolved.load(std::memory_order_acquire)) return true;
+
+    jclass cls = get_class(env, DART_BRIDGE_CLASS);
+    if (!cls) return false;
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    if (g_bridge_resolved.load(std::memory_order_relaxed)) return true;
+
+    int32_t missing = 0;
+    for (int32_t i = 0; i < DART_BRIDGE_BINDING_COUNT; i++) {
+        const DartBridgeBinding& binding = kDartBridgeBindings[i];
+        jmethodID mid = env->GetStaticMethodID(cls, binding.name, binding.sig);
+        if (mid == nullptr) {
+            env->ExceptionClear();
+            std::cerr << "generic_jni: Bridge binding not found: " << binding.name << binding.sig << std::endl;
+            missing++;
+        }
+        g_bridge_methods[i] = mid;
+    }
+
+    g_bridge_class = cls;
+    g_bridge_resolved.store(true, std::memory_order_release);
+    std::cout << "generic_jni: Resolved " << (DART_BRIDGE_BINDING_COUNT - missing) << "/"
+              << DART_BRIDGE_BINDING_COUNT << " bridge bindings" << std::endl;
+    return true;
+}
+
+/**
+ * Get the resolved method for a binding index, resolving the table on first use
+ * (dedicated servers never capture a classloader).
+ */
+static jmethodID get_bridge_method(JNIEnv* env, int32_t index) {
+    if (index < 0 || index >= DART_BRIDGE_BINDING_COUNT) {
+        g_last_jni_error = "Bridge binding index out of range: " + std::to_string(index);
+        g_has_jni_error = true;
+        return nullptr;
+    }
+    if (!resolve_bridge_bindings(env)) return nullptr;
+
+    jmethodID mid = g_bridge_methods[index];
+    if (mid == nullptr) {
+        g_last_jni_error = std::string("Bridge method not found: ") + kDartBridgeBindings[index].name +
+                           kDartBridgeBindings[index].sig;
+        g_has_jni_error = true;
+    }
+    return mid;
+}
+
+/**
+ * Whether a static field is final, via Field.getModifiers(). Cached per field.
+ * Once the declaring class is initialized a final field never changes (the
+ * registry-backed constants are assigned during bootstrap, before Dart runs).
+ */
+static bool is_final_static_field(JNIEnv* env, const std::string& key, jclass cls, jfieldID fid) {
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto it = static_field_final.find(key);
+        if (it != static_field_final.end()) return it->second;
+    }
+
+    bool is_final = false;
+    jclass field_cls = get_class(env, "java/lang/reflect/Field");
+    jmethodID get_modifiers = field_cls ?
+        get_method(env, field_cls, "java/lang/reflect/Field", "getModifiers", "()I", false) : nullptr;
+    jobject field = get_modifiers ? env->ToReflectedField(cls, fid, JNI_TRUE) : nullptr;
+    if (field != nullptr) {
+        jint modifiers = env->CallIntMethod(field, get_modifiers);
+        if (env->ExceptionCheck()) {
+            env->ExceptionClear();
+        } else {
+            is_final = (modifiers & 0x0010) != 0;  // java.lang.reflect.Modifier.FINAL
+        }
+        env->DeleteLocalRef(field);
+    } else {
+        env->ExceptionClear();
+    }
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    static_field_final[key] = is_final;
+    return is_final;
+}
+
 /**
  * Extract exception class name and message from a throwable.
  */
@@ -382,6 +496,10 @@ void generic_jni_init(JavaVM* jvm) {
     std::cout << "generic_jni: Initialized" << std::endl;
 }
 
+JNIEnv* generic_jni_get_env() {
+    return get_env();
+}
+
 /**
  * Capture the classloader from the current thread.
  * This MUST be called from the render thread (which uses KnotClassLoader)
@@ -480,10 +598,15 @@ int32_t generic_jni_capture_classloader() {
     env->DeleteLocalRef(threadClass);
 
     std::cout << "generic_jni: Classloader captured successfully" << std::endl;
+
+    // Resolve the DartBridge binding table through the captured classloader
+    resolve_bridge_bindings(env);
     return 1;
 }
 
 void generic_jni_shutdown() {
+    jni_static_field_cache_clear();
+
     JNIEnv* env = get_env();
 
     // Clear cached classes (delete global refs)
@@ -501,6 +624,10 @@ void generic_jni_shutdown() {
         class_cache.clear();
         method_cache.clear();
         field_cache.clear();
+        field_tokens.clear();
+        field_token_index.clear();
+        g_bridge_class = nullptr;
+        g_bridge_resolved.store(false, std::memory_order_release);
     }
 
     g_class_loader = nullptr;
@@ -873,6 +1000,129 @@ bool jni_call_static_bool_method(const char* class_name, const char* method_name
     return result != JNI_FALSE;
 }
 
+// ============================================================================
+// DartBridge Binding Calls
+// ============================================================================
+
+int32_t jni_bridge_binding_count() {
+    return DART_BRIDGE_BINDING_COUNT;
+}
+
+uint32_t jni_bridge_bindings_hash() {
+    return DART_BRIDGE_BINDINGS_HASH;
+}
+
+void jni_bridge_call_void(int32_t index, int64_t* args, int32_t arg_count) {
+    JNIEnv* env = get_env();
+    if (!env) return;
+
+    jmethodID mid = get_bridge_method(env, index);
+    if (!mid) return;
+
+    auto jargs = convert_args(env, kDartBridgeBindings[index].sig, args, arg_count);
+    env->CallStaticVoidMethodA(g_bridge_class, mid, jargs.empty() ? nullptr : jargs.data());
+    check_exception(env);
+}
+
+int32_t jni_bridge_call_int(int32_t index, int64_t* args, int32_t arg_count) {
+    JNIEnv* env = get_env();
+    if (!env) return 0;
+
+    jmethodID mid = get_bridge_method(env, index);
+    if (!mid) return 0;
+
+    auto jargs = convert_args(env, kDartBridgeBindings[index].sig, args, arg_count);
+    jint result = env->CallStaticIntMethodA(g_bridge_class, mid, jargs.empty() ? nullptr : jargs.data());
+
+    if (check_exception(env)) return 0;
+    return result;
+}
+
+int64_t jni_bridge_call_long(int32_t index, int64_t* args, int32_t arg_count) {
+    JNIEnv* env = get_env();
+    if (!env) return 0;
+
+    jmethodID mid = get_bridge_method(env, index);
+    if (!mid) return 0;
+
+    auto jargs = convert_args(env, kDartBridgeBindings[index].sig, args, arg_count);
+    jlong result = env->CallStaticLongMethodA(g_bridge_class, mid, jargs.empty() ? nullptr : jargs.data());
+
+    if (check_exception(env)) return 0;
+    return result;
+}
+
+double jni_bridge_call_double(int32_t index, int64_t* args, int32_t arg_count) {
+    JNIEnv* env = get_env();
+    if (!env) return 0.0;
+
+    jmethodID mid = get_bridge_method(env, index);
+    if (!mid) return 0.0;
+
+    auto jargs = convert_args(env, kDartBridgeBindings[index].sig, args, arg_count);
+    jdouble result = env->CallStaticDoubleMethodA(g_bridge_class, mid, jargs.empty() ? nullptr : jargs.data());
+
+    if (check_exception(env)) return 0.0;
+    return result;
+}
+
+bool jni_bridge_call_bool(int32_t index, int64_t* args, int32_t arg_count) {
+    JNIEnv* env = get_env();
+    if (!env) return false;
+
+    jmethodID mid = get_bridge_method(env, index);
+    if (!mid) return false;
+
+    auto jargs = convert_args(env, kDartBridgeBindings[index].sig, args, arg_count);
+    jboolean result = env->CallStaticBooleanMethodA(g_bridge_class, mid, jargs.empty() ? nullptr : jargs.data());
+
+    if (check_exception(env)) return false;
+    return result != JNI_FALSE;
+}
+
+int64_t jni_bridge_call_object(int32_t index, int64_t* args, int32_t arg_count) {
+    JNIEnv* env = get_env();
+    if (!env) return 0;
+
+    jmethodID mid = get_bridge_method(env, index);
+    if (!mid) return 0;
+
+    auto jargs = convert_args(env, kDartBridgeBindings[index].sig, args, arg_count);
+    jobject result = env->CallStaticObjectMethodA(g_bridge_class, mid, jargs.empty() ? nullptr : jargs.data());
+
+    if (check_exception(env) || result == nullptr) {
+        return 0;
+    }
+
+    int64_t handle = dart_mc_bridge::ObjectRegistry::instance().store(env, result);
+    env->DeleteLocalRef(result);
+
+    return handle;
+}
+
+const char* jni_bridge_call_string(int32_t index, int64_t* args, int32_t arg_count) {
+    JNIEnv* env = get_env();
+    if (!env) return nullptr;
+
+    jmethodID mid = get_bridge_method(env, index);
+    if (!mid) return nullptr;
+
+    auto jargs = convert_args(env, kDartBridgeBindings[index].sig, args, arg_count);
+    jstring jstr = static_cast<jstring>(env->CallStaticObjectMethodA(g_bridge_class, mid,
+                                        jargs.empty() ? nullptr : jargs.data()));
+
+    if (check_exception(env) || jstr == nullptr) {
+        return nullptr;
+    }
+
+    const char* utf = env->GetStringUTFChars(jstr, nullptr);
+    char* result = strdup(utf);
+    env->ReleaseStringUTFChars(jstr, utf);
+    env->DeleteLocalRef(jstr);
+
+    return result;
+}
+
 // ============================================================================
 // Field Access (Instance)
 // ============================================================================
@@ -1104,12 +1354,169 @@ void jni_set_object_field(int64_t obj_handle, const char* class_name,
     check_exception(env);
 }
 
+// ============================================================================
+// Multi-Field Access
+// ============================================================================
+
+static int32_t primitive_size(char type) {
+    switch (type) {
+        case 'Z': case 'B': return 1;
+        case 'C': case 'S': return 2;
+        case 'I': case 'F': return 4;
+        case 'J': case 'D': return 8;
+        default: return 0;
+    }
+}
+
+/**
+ * Copy the tokens' entries out of the table (one lock per call).
+ * Returns false if any token is invalid.
+ */
+static bool lookup_field_tokens(const int64_t* tokens, int32_t count, std::vector<FieldToken>& out) {
+    out.resize(count);
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    for (int32_t i = 0; i < count; i++) {
+        int64_t index = tokens[i] - 1;
+        if (index < 0 || index >= static_cast<int64_t>(field_tokens.size())) return false;
+        out[i] = field_tokens[index];
+    }
+    return true;
+}
+
+/**
+ * Check that obj is an instance of every class the tokens were resolved
+ * against (GetXField with a foreign jfieldID is undefined behavior).
+ */
+static bool check_field_receiver(JNIEnv* env, jobject obj, const std::vector<FieldToken>& fields) {
+    jclass checked = nullptr;
+    for (const auto& field : fields) {
+        if (field.cls == checked) continue;
+        if (!env->IsInstanceOf(obj, field.cls)) {
+            g_last_jni_error = "jni_read_fields/jni_write_fields: field token does not belong to the object's class";
+            g_has_jni_error = true;
+            return false;
+        }
+        checked = field.cls;
+    }
+    return true;
+}
+
+int64_t jni_resolve_field(const char* class_name, const char* field_name, const char* sig) {
+    if (!class_name || !field_name || !sig) return 0;
+    int32_t size = sig[1] == '\0' ? primitive_size(sig[0]) : 0;
+    if (size == 0) {
+        std::cerr << "generic_jni: Field is not primitive: " << class_name << "." << field_name << std::endl;
+        return 0;
+    }
+
+    std::string key = std::string(class_name) + "." + field_name + sig;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto it = field_token_index.find(key);
+        if (it != field_token_index.end()) return it->second;
+    }
+
+    JNIEnv* env = get_env();
+    if (!env) return 0;
+
+    jclass cls = get_class(env, class_name);
+    if (!cls) return 0;
+
+    jfieldID fid = get_field(env, cls, class_name, field_name, sig, false);
+    if (!fid) return 0;
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto it = field_token_index.find(key);
+    if (it != field_token_index.end()) return it->second;
+    field_tokens.push_back({cls, fid, sig[0], size});
+    int64_t token = static_cast<int64_t>(field_tokens.size());
+    field_token_index[key] = token;
+    return token;
+}
+
+int32_t jni_field_token_size(int64_t token) {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    if (token < 1 || token > static_cast<int64_t>(field_tokens.size())) return 0;
+    return field_tokens[token - 1].size;
+}
+
+int32_t jni_read_fields(int64_t obj_handle, const int64_t* tokens, int32_t count, void* out) {
+    if (!tokens || !out || count <= 0) return -1;
+
+    JNIEnv* env = get_env();
+    if (!env) return -1;
+
+    jobject obj = dart_mc_bridge::ObjectRegistry::instance().get(obj_handle);
+    if (!obj) return -1;
+
+    std::vector<FieldToken> fields;
+    if (!lookup_field_tokens(tokens, count, fields)) return -1;
+    if (!check_field_receiver(env, obj, fields)) return -1;
+
+    uint8_t* cursor = static_cast<uint8_t*>(out);
+    for (const auto& field : fields) {
+        switch (field.type) {
+            case 'Z': { jboolean v = env->GetBooleanField(obj, field.fid); std::memcpy(cursor, &v, 1); break; }
+            case 'B': { jbyte v = env->GetByteField(obj, field.fid); std::memcpy(cursor, &v, 1); break; }
+            case 'C': { jchar v = env->GetCharField(obj, field.fid); std::memcpy(cursor, &v, 2); break; }
+            case 'S': { jshort v = env->GetShortField(obj, field.fid); std::memcpy(cursor, &v, 2); break; }
+            case 'I': { jint v = env->GetIntField(obj, field.fid); std::memcpy(cursor, &v, 4); break; }
+            case 'F': { jfloat v = env->GetFloatField(obj, field.fid); std::memcpy(cursor, &v, 4); break; }
+            case 'J': { jlong v = env->GetLongField(obj, field.fid); std::memcpy(cursor, &v, 8); break; }
+            case 'D': { jdouble v = env->GetDoubleField(obj, field.fid); std::memcpy(cursor, &v, 8); break; }
+        }
+        cursor += field.size;
+    }
+    if (check_exception(env)) return -1;
+
+    return static_cast<int32_t>(cursor - static_cast<uint8_t*>(out));
+}
+
+int32_t jni_write_fields(int64_t obj_handle, const int64_t* tokens, int32_t count, const void* in) {
+    if (!tokens || !in || count <= 0) return -1;
+
+    JNIEnv* env = get_env();
+    if (!env) return -1;
+
+    jobject obj = dart_mc_bridge::ObjectRegistry::instance().get(obj_handle);
+    if (!obj) return -1;
+
+    std::vector<FieldToken> fields;
+    if (!lookup_field_tokens(tokens, count, fields)) return -1;
+    if (!check_field_receiver(env, obj, fields)) return -1;
+
+    const uint8_t* cursor = static_cast<const uint8_t*>(in);
+    for (const auto& field : fields) {
+        switch (field.type) {
+            case 'Z': { jboolean v; std::memcpy(&v, cursor, 1); env->SetBooleanField(obj, field.fid, v ? JNI_TRUE : JNI_FALSE); break; }
+            case 'B': { jbyte v; std::memcpy(&v, cursor, 1); env->SetByteField(obj, field.fid, v); break; }
+            case 'C': { jchar v; std::memcpy(&v, cursor, 2); env->SetCharField(obj, field.fid, v); break; }
+            case 'S': { jshort v; std::memcpy(&v, cursor, 2); env->SetShortField(obj, field.fid, v); break; }
+            case 'I': { jint v; std::memcpy(&v, cursor, 4); env->SetIntField(obj, field.fid, v); break; }
+            case 'F': { jfloat v; std::memcpy(&v, cursor, 4); env->SetFloatField(obj, field.fid, v); break; }
+            case 'J': { jlong v; std::memcpy(&v, cursor, 8); env->SetLongField(obj, field.fid, v); break; }
+            case 'D': { jdouble v; std::memcpy(&v, cursor, 8); env->SetDoubleField(obj, field.fid, v); break; }
+        }
+        cursor += field.size;
+    }
+    if (check_exception(env)) return -1;
+
+    return static_cast<int32_t>(cursor - static_cast<const uint8_t*>(in));
+}
+
 // ============================================================================
 // Static Field Access
 // ============================================================================
 
 int64_t jni_get_static_object_field(const char* class_name, const char* field_name,
                                     const char* sig) {
+    std::string key = std::string(class_name) + "." + field_name + sig;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto it = static_object_constants.find(key);
+        if (it != static_object_constants.end()) return it->second;
+    }
+
     JNIEnv* env = get_env();
     if (!env) return 0;
 
@@ -1121,17 +1528,45 @@ int64_t jni_get_static_object_field(const char* class_name, const char* field_na
 
     jobject result = env->GetStaticObjectField(cls, fid);
     if (check_exception(env) || result == nullptr) {
+        // null is not cached: a final field still reads null while its class initializes
         return 0;
     }
 
-    int64_t handle = dart_mc_bridge::ObjectRegistry::instance().store(env, result);
+    auto& registry = dart_mc_bridge::ObjectRegistry::instance();
+    int64_t handle = registry.store(env, result);
     env->DeleteLocalRef(result);
 
+    if (!is_final_static_field(env, key, cls, fid)) {
+        return handle;
+    }
+
+    int64_t existing = 0;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto inserted = static_object_constants.emplace(key, handle);
+        if (inserted.second) {
+            pinned_handles.insert(handle);
+        } else {
+            existing = inserted.first->second;
+        }
+    }
+    if (existing != 0) {
+        // Another thread cached it first
+        registry.release(env, handle);
+        return existing;
+    }
     return handle;
 }
 
 int32_t jni_get_static_int_field(const char* class_name, const char* field_name,
                                  const char* sig) {
+    std::string key = std::string(class_name) + "." + field_name + sig;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto it = static_int_constants.find(key);
+        if (it != static_int_constants.end()) return it->second;
+    }
+
     JNIEnv* env = get_env();
     if (!env) return 0;
 
@@ -1144,9 +1579,33 @@ int32_t jni_get_static_int_field(const char* class_name, const char* field_name,
     jint result = env->GetStaticIntField(cls, fid);
     if (check_exception(env)) return 0;
 
+    if (is_final_static_field(env, key, cls, fid)) {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        static_int_constants.emplace(key, result);
+    }
     return result;
 }
 
+void jni_static_field_cache_clear() {
+    std::unordered_set<int64_t> handles;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        handles.swap(pinned_handles);
+        static_field_final.clear();
+        static_object_constants.clear();
+        static_int_constants.clear();
+    }
+
+    if (handles.empty() || g_jvm == nullptr) return;
+    JNIEnv* env = get_env();
+    if (!env) return;
+
+    auto& registry = dart_mc_bridge::ObjectRegistry::instance();
+    for (int64_t handle : handles) {
+        registry.release(env, handle);
+    }
+}
+
 // ============================================================================
 // Object Lifecycle
 // ============================================================================
@@ -1154,6 +1613,12 @@ int32_t jni_get_static_int_field(const char* class_name, const char* field_name,
 void jni_release_object(int64_t handle) {
     if (handle == 0) return;
 
+    {
+        // Cached static final objects stay alive until jni_static_field_cache_clear()
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        if (pinned_handles.count(handle) != 0) return;
+    }
+
     JNIEnv* env = get_env();
     if (!env) return;
 
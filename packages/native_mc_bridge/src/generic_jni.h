@@ -127,6 +127,75 @@ void jni_set_bool_field(int64_t obj_handle, const char* class_name,
 void jni_set_object_field(int64_t obj_handle, const char* class_name,
                           const char* field_name, const char* sig, int64_t value_handle);
 
+// ============================================================================
+// Multi-Field Access
+// ============================================================================
+// Read or write several primitive instance fields of one object in a single
+// call. Fields are identified by tokens from jni_resolve_field(). Values are
+// packed in token order with no padding, in host byte order, using the Java
+// primitive sizes: Z/B = 1, C/S = 2, I/F = 4, J/D = 8 bytes.
+//
+// Tokens stay valid until generic_jni_shutdown().
+
+/**
+ * Resolve a primitive instance field to a token.
+ * @return Token (> 0), or 0 if the field does not exist or is not primitive
+ */
+int64_t jni_resolve_field(const char* class_name, const char* field_name, const char* sig);
+
+/**
+ * Size in bytes of a token's value in the packed layout (0 for invalid tokens).
+ */
+int32_t jni_field_token_size(int64_t token);
+
+/**
+ * Read the fields into out.
+ * @return Number of bytes written, or -1 on error (nothing is partially valid)
+ */
+int32_t jni_read_fields(int64_t obj_handle, const int64_t* field_tokens, int32_t count, void* out);
+
+/**
+ * Write the fields from in.
+ * @return Number of bytes consumed, or -1 on error
+ */
+int32_t jni_write_fields(int64_t obj_handle, const int64_t* field_tokens, int32_t count, const void* in);
+
+// ============================================================================
+// DartBridge Binding Calls
+// ============================================================================
+// Static methods of com.redstone.DartBridge listed in dart_bridge_bindings.g.h
+// (generated by tools/generate_bridge_bindings.dart). The jmethodIDs are
+// resolved once, when the classloader is captured or on first call, so a
+// call only passes the binding index and the encoded arguments (same
+// encoding as the by-name calls, typed by the table signature).
+
+/**
+ * Number of entries in the binding table.
+ */
+int32_t jni_bridge_binding_count();
+
+/**
+ * Hash of the binding table, compared against the generated Dart bindings
+ * to detect a stale native library.
+ */
+uint32_t jni_bridge_bindings_hash();
+
+void jni_bridge_call_void(int32_t index, int64_t* args, int32_t arg_count);
+int32_t jni_bridge_call_int(int32_t index, int64_t* args, int32_t arg_count);
+int64_t jni_bridge_call_long(int32_t index, int64_t* args, int32_t arg_count);
+double jni_bridge_call_double(int32_t index, int64_t* args, int32_t arg_count);
+bool jni_bridge_call_bool(int32_t index, int64_t* args, int32_t arg_count);
+
+/**
+ * @return Handle to the returned object, or 0 if null/failure
+ */
+int64_t jni_bridge_call_object(int32_t index, int64_t* args, int32_t arg_count);
+
+/**
+ * @return UTF-8 string (free with jni_free_string), or nullptr if null/failure
+ */
+const char* jni_bridge_call_string(int32_t index, int64_t* args, int32_t arg_count);
+
 // ============================================================================
 // Static Field Access
 // ============================================================================
@@ -137,6 +206,16 @@ int64_t jni_get_static_object_field(const char* class_name, const char* field_na
 int32_t jni_get_static_int_field(const char* class_name, const char* field_name,
                                  const char* sig);
 
+/**
+ * Drop the cached static final field values. Reads of static final fields
+ * are served from a cache after the first read (object fields as a pinned
+ * handle that jni_release_object ignores); this releases those handles.
+ * The cache is process-wide, shared by the server and client isolates.
+ * Called from generic_jni_shutdown(), and on server shutdown in server-only
+ * builds where the server is its only user.
+ */
+void jni_static_field_cache_clear();
+
 // ============================================================================
 // Object Lifecycle
 // ============================================================================
@@ -161,6 +240,13 @@ void jni_free_string(const char* str);
  */
 void generic_jni_init(JavaVM* jvm);
 
+/**
+ * JNIEnv for the calling thread, attaching it if necessary.
+ * For bridge modules that make their own upcalls from Dart threads.
+ * @return The env, or nullptr if the JVM is not initialized
+ */
+JNIEnv* generic_jni_get_env();
+
 /**
  * Capture the classloader from the current thread.
  * This MUST be called from the render thread (which uses KnotClassLoader)
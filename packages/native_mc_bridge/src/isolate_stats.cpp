@@ -0,0 +1,176 @@
+#include "isolate_stats.h"
+
+#include <dart_api.h>
+#include <dart_tools_api.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+
+namespace {
+
+const char* g_vm_flags[] = {
+    "--timeline_recorder=callback",
+    "--timeline_streams=GC",
+};
+
+// GC timeline events that stop the mutator
+enum PauseKind { PAUSE_NONE = -1, PAUSE_NEW = 0, PAUSE_OLD = 1 };
+
+// Held while sampling so detach cannot release the group mid-read
+std::mutex g_attach_mutex;
+Dart_IsolateGroup g_group = nullptr;
+
+// Timeline events arrive for every isolate group (service, kernel); only
+// the server group's are counted. 0 while detached.
+std::atomic<Dart_IsolateGroupId> g_group_id{0};
+std::atomic<int64_t> g_new_gc_count{0};
+std::atomic<int64_t> g_old_gc_count{0};
+std::atomic<int64_t> g_pause_total_us{0};
+std::atomic<int64_t> g_pause_max_us{0};
+std::atomic<int64_t> g_pause_last_us{0};
+
+std::atomic<int64_t> g_warn_threshold_us{50 * 1000};
+std::atomic<int64_t> g_pending_warn_us{0};    // Longest over-threshold pause since the last check
+std::atomic<int32_t> g_pending_warn_kind{PAUSE_NONE};
+
+// Begin timestamp of an open Begin/End pause on this GC thread
+thread_local int64_t t_pause_begin_us = -1;
+
+PauseKind pause_kind(const char* label) {
+    if (label == nullptr) return PAUSE_NONE;
+    if (std::strcmp(label, "CollectNewGeneration") == 0 ||
+        std::strcmp(label, "EvacuateNewGeneration") == 0) {
+        return PAUSE_NEW;
+    }
+    if (std::strcmp(label, "CollectOldGeneration") == 0) return PAUSE_OLD;
+    return PAUSE_NONE;
+}
+
+void store_max(std::atomic<int64_t>& target, int64_t value) {
+    int64_t current = target.load(std::memory_order_relaxed);
+    while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+void record_pause(PauseKind kind, int64_t pause_us) {
+    if (pause_us < 0) return;
+    (kind == PAUSE_NEW ? g_new_gc_count : g_old_gc_count).fetch_add(1, std::memory_order_relaxed);
+    g_pause_total_us.fetch_add(pause_us, std::memory_order_relaxed);
+    g_pause_last_us.store(pause_us, std::memory_order_relaxed);
+    store_max(g_pause_max_us, pause_us);
+
+    int64_t threshold = g_warn_threshold_us.load(std::memory_order_relaxed);
+    if (threshold > 0 && pause_us > threshold) {
+        int64_t previous = g_pending_warn_us.load(std::memory_order_relaxed);
+        store_max(g_pending_warn_us, pause_us);
+        if (pause_us > previous) g_pending_warn_kind.store(kind, std::memory_order_relaxed);
+    }
+}
+
+// Runs on whichever thread completes the event, without a current isolate
+void OnTimelineEvent(Dart_TimelineRecorderEvent* event) {
+    if (event == nullptr) return;
+    Dart_IsolateGroupId group_id = g_group_id.load(std::memory_order_relaxed);
+    if (group_id == 0 || event->isolate_group != group_id) return;
+    if (event->stream == nullptr || std::strcmp(event->stream, "GC") != 0) return;
+
+    PauseKind kind = pause_kind(event->label);
+    if (kind == PAUSE_NONE) return;
+
+    switch (event->type) {
+        case Dart_Timeline_Event_Duration:
+            record_pause(kind, event->timestamp1_or_id - event->timestamp0);
+            break;
+        case Dart_Timeline_Event_Begin:
+            t_pause_begin_us = event->timestamp0;
+            break;
+        case Dart_Timeline_Event_End:
+            if (t_pause_begin_us >= 0) {
+                record_pause(kind, event->timestamp0 - t_pause_begin_us);
+                t_pause_begin_us = -1;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+const char** isolate_stats_vm_flags(int* count) {
+    if (count != nullptr) *count = static_cast<int>(sizeof(g_vm_flags) / sizeof(g_vm_flags[0]));
+    return g_vm_flags;
+}
+
+void isolate_stats_attach(Dart_IsolateGroup group) {
+    if (const char* env = std::getenv("REDSTONE_GC_PAUSE_WARN_MS")) {
+        isolate_stats_set_pause_warning(std::atof(env));
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_attach_mutex);
+        g_group = group;
+    }
+    g_group_id.store(Dart_CurrentIsolateGroupId());
+    Dart_SetTimelineRecorderCallback(OnTimelineEvent);
+    Dart_SetEnabledTimelineCategory("GC");
+}
+
+void isolate_stats_detach() {
+    Dart_SetTimelineRecorderCallback(nullptr);
+    g_group_id.store(0);
+    {
+        std::lock_guard<std::mutex> lock(g_attach_mutex);
+        g_group = nullptr;
+    }
+    g_new_gc_count.store(0);
+    g_old_gc_count.store(0);
+    g_pause_total_us.store(0);
+    g_pause_max_us.store(0);
+    g_pause_last_us.store(0);
+    g_pending_warn_us.store(0);
+}
+
+int32_t isolate_stats_sample(int64_t* out, int32_t count) {
+    if (out == nullptr || count <= 0) return 0;
+
+    int64_t values[HEAP_STAT_COUNT];
+    {
+        std::lock_guard<std::mutex> lock(g_attach_mutex);
+        if (g_group == nullptr) return 0;
+        values[HEAP_STAT_NEW_USED] = Dart_IsolateGroupHeapNewUsedMetric(g_group);
+        values[HEAP_STAT_NEW_CAPACITY] = Dart_IsolateGroupHeapNewCapacityMetric(g_group);
+        values[HEAP_STAT_NEW_EXTERNAL] = Dart_IsolateGroupHeapNewExternalMetric(g_group);
+        values[HEAP_STAT_OLD_USED] = Dart_IsolateGroupHeapOldUsedMetric(g_group);
+        values[HEAP_STAT_OLD_CAPACITY] = Dart_IsolateGroupHeapOldCapacityMetric(g_group);
+        values[HEAP_STAT_OLD_EXTERNAL] = Dart_IsolateGroupHeapOldExternalMetric(g_group);
+    }
+    values[HEAP_STAT_NEW_GC_COUNT] = g_new_gc_count.load(std::memory_order_relaxed);
+    values[HEAP_STAT_OLD_GC_COUNT] = g_old_gc_count.load(std::memory_order_relaxed);
+    values[HEAP_STAT_PAUSE_TOTAL_US] = g_pause_total_us.load(std::memory_order_relaxed);
+    values[HEAP_STAT_PAUSE_MAX_US] = g_pause_max_us.load(std::memory_order_relaxed);
+    values[HEAP_STAT_PAUSE_LAST_US] = g_pause_last_us.load(std::memory_order_relaxed);
+
+    int32_t written = count < HEAP_STAT_COUNT ? count : HEAP_STAT_COUNT;
+    std::memcpy(out, values, sizeof(int64_t) * static_cast<size_t>(written));
+    return written;
+}
+
+void isolate_stats_set_pause_warning(double threshold_ms) {
+    g_warn_threshold_us.store(threshold_ms > 0 ? static_cast<int64_t>(threshold_ms * 1000.0) : 0);
+}
+
+void isolate_stats_check_tick(int64_t tick) {
+    int64_t pause_us = g_pending_warn_us.exchange(0, std::memory_order_relaxed);
+    if (pause_us == 0) return;
+    int32_t kind = g_pending_warn_kind.exchange(PAUSE_NONE, std::memory_order_relaxed);
+    std::cerr << "[GC] " << (kind == PAUSE_OLD ? "Old-generation" : "New-generation")
+              << " pause of " << (pause_us / 1000.0) << " ms before tick " << tick
+              << " (threshold " << (g_warn_threshold_us.load() / 1000.0) << " ms)" << std::endl;
+}
+
+} // extern "C"
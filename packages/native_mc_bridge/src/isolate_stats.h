@@ -0,0 +1,65 @@
+#ifndef ISOLATE_STATS_H
+#define ISOLATE_STATS_H
+
+#include <cstdint>
+
+typedef struct _Dart_IsolateGroup* Dart_IsolateGroup;
+
+// ==========================================================================
+// Server Isolate Heap and GC Statistics
+// ==========================================================================
+// Samples the server isolate group's heap (new/old space used, capacity and
+// external bytes). It also counts collections and their pauses from the VM's
+// GC timeline events, so production servers can export memory metrics
+// without attaching DevTools.
+//
+// GC events reach the bridge through Dart_SetTimelineRecorderCallback. That
+// needs the VM flags from isolate_stats_vm_flags() before Dart_Initialize.
+// The AOT server path passes them. The JIT path (dart_dll) initializes the
+// VM itself, so its GC counters stay at zero; heap sizes are still sampled.
+//
+// Any single pause longer than the warning threshold is logged once per tick
+// from the server thread, together with the tick number. The threshold comes
+// from isolate_stats_set_pause_warning() or REDSTONE_GC_PAUSE_WARN_MS
+// (default 50 ms, one tick; 0 disables).
+// ==========================================================================
+
+// isolate_stats_sample() slots - must match DartHeapStats.java
+#define HEAP_STAT_NEW_USED 0          // bytes
+#define HEAP_STAT_NEW_CAPACITY 1      // bytes
+#define HEAP_STAT_NEW_EXTERNAL 2      // bytes
+#define HEAP_STAT_OLD_USED 3          // bytes
+#define HEAP_STAT_OLD_CAPACITY 4      // bytes
+#define HEAP_STAT_OLD_EXTERNAL 5      // bytes
+#define HEAP_STAT_NEW_GC_COUNT 6      // scavenges
+#define HEAP_STAT_OLD_GC_COUNT 7      // old-generation collections
+#define HEAP_STAT_PAUSE_TOTAL_US 8    // sum of GC pauses
+#define HEAP_STAT_PAUSE_MAX_US 9      // longest GC pause
+#define HEAP_STAT_PAUSE_LAST_US 10    // most recent GC pause
+#define HEAP_STAT_COUNT 11
+
+extern "C" {
+
+// VM flags routing GC timeline events to the recorder callback
+const char** isolate_stats_vm_flags(int* count);
+
+// Start sampling a group and register the timeline callback (after Dart_Initialize,
+// with an isolate of that group current). Only that group's GCs are counted.
+void isolate_stats_attach(Dart_IsolateGroup group);
+
+// Stop sampling (before the group shuts down). Waits for an in-flight sample.
+void isolate_stats_detach();
+
+// Fill out[0..count) with HEAP_STAT_* values. Returns the number of slots
+// written, or 0 if no group is attached.
+int32_t isolate_stats_sample(int64_t* out, int32_t count);
+
+// Log threshold for a single GC pause in milliseconds (0 disables)
+void isolate_stats_set_pause_warning(double threshold_ms);
+
+// Log the longest over-threshold pause since the previous call (server thread)
+void isolate_stats_check_tick(int64_t tick);
+
+} // extern "C"
+
+#endif // ISOLATE_STATS_H
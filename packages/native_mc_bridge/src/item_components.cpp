@@ -0,0 +1,145 @@
+#include "item_components.h"
+#include "generic_jni.h"
+#include "upcall_table.h"
+
+#include <jni.h>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+// Bounds-checked reader over a component blob
+class BlobReader {
+public:
+    BlobReader(const uint8_t* data, int32_t length) : data_(data), length_(length) {}
+
+    bool skip(int64_t bytes) {
+        if (bytes < 0 || bytes > length_ - offset_) return false;
+        offset_ += bytes;
+        return true;
+    }
+
+    bool u8(uint8_t& out) {
+        if (offset_ + 1 > length_) return false;
+        out = data_[offset_++];
+        return true;
+    }
+
+    bool u32(uint32_t& out) {
+        if (offset_ + 4 > length_) return false;
+        std::memcpy(&out, data_ + offset_, sizeof(out));
+        offset_ += 4;
+        return true;
+    }
+
+    bool string() {
+        uint32_t length;
+        return u32(length) && skip(length);
+    }
+
+    bool at_end() const { return offset_ == length_; }
+
+private:
+    const uint8_t* data_;
+    int64_t length_;
+    int64_t offset_ = 0;
+};
+
+bool skip_payload(BlobReader& reader, uint8_t tag) {
+    uint32_t count;
+    switch (tag) {
+        case ITEM_COMPONENT_TAG_ABSENT: return true;
+        case ITEM_COMPONENT_TAG_INT: return reader.skip(4);
+        case ITEM_COMPONENT_TAG_BOOL: return reader.skip(1);
+        case ITEM_COMPONENT_TAG_STRING: return reader.string();
+        case ITEM_COMPONENT_TAG_STRING_LIST:
+            if (!reader.u32(count)) return false;
+            for (uint32_t i = 0; i < count; i++) {
+                if (!reader.string()) return false;
+            }
+            return true;
+        case ITEM_COMPONENT_TAG_INT_MAP:
+            if (!reader.u32(count)) return false;
+            for (uint32_t i = 0; i < count; i++) {
+                if (!reader.string() || !reader.skip(4)) return false;
+            }
+            return true;
+        default: return false;
+    }
+}
+
+void clear_exception(JNIEnv* env) {
+    if (env->ExceptionCheck()) {
+        env->ExceptionDescribe();
+        env->ExceptionClear();
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+int32_t item_components_validate(const uint8_t* data, int32_t length) {
+    if (data == nullptr || length < ITEM_COMPONENTS_HEADER_SIZE) return -1;
+    if (data[0] != ITEM_COMPONENTS_VERSION) return -1;
+
+    int32_t count = data[1];
+    BlobReader reader(data + ITEM_COMPONENTS_HEADER_SIZE, length - ITEM_COMPONENTS_HEADER_SIZE);
+    for (int32_t i = 0; i < count; i++) {
+        uint8_t component, tag;
+        if (!reader.u8(component) || !reader.u8(tag)) return -1;
+        if (!skip_payload(reader, tag)) return -1;
+    }
+    return reader.at_end() ? count : -1;
+}
+
+int32_t item_components_read(int64_t handle, const uint8_t* components, int32_t count,
+                             uint8_t* out, int32_t capacity) {
+    if (count < 0 || count > 255 || (count > 0 && components == nullptr)) return -1;
+    if (out == nullptr || capacity < ITEM_COMPONENTS_HEADER_SIZE) return -1;
+
+    const auto& upcalls = dart_mc_bridge::upcalls();
+    JNIEnv* env = generic_jni_get_env();
+    if (env == nullptr || upcalls.read_item_components == nullptr) return -1;
+
+    jobject request = env->NewDirectByteBuffer(const_cast<uint8_t*>(count > 0 ? components : out), count);
+    jobject target = env->NewDirectByteBuffer(out, capacity);
+    jint length = -1;
+    if (request != nullptr && target != nullptr) {
+        length = env->CallStaticIntMethod(upcalls.dart_bridge_class, upcalls.read_item_components,
+            static_cast<jlong>(handle), request, target);
+    }
+    clear_exception(env);
+    if (request != nullptr) env->DeleteLocalRef(request);
+    if (target != nullptr) env->DeleteLocalRef(target);
+
+    if (length == ITEM_COMPONENTS_OVERFLOW) return ITEM_COMPONENTS_OVERFLOW;
+    if (length < 0 || length > capacity || item_components_validate(out, length) < 0) {
+        std::cerr << "item_components_read: Java returned an invalid blob for handle " << handle << std::endl;
+        return -1;
+    }
+    return length;
+}
+
+bool item_components_write(int64_t handle, const uint8_t* data, int32_t length) {
+    if (item_components_validate(data, length) < 0) {
+        std::cerr << "item_components_write: Malformed component blob" << std::endl;
+        return false;
+    }
+
+    const auto& upcalls = dart_mc_bridge::upcalls();
+    JNIEnv* env = generic_jni_get_env();
+    if (env == nullptr || upcalls.write_item_components == nullptr) return false;
+
+    jobject buffer = env->NewDirectByteBuffer(const_cast<uint8_t*>(data), length);
+    jboolean result = JNI_FALSE;
+    if (buffer != nullptr) {
+        result = env->CallStaticBooleanMethod(upcalls.dart_bridge_class, upcalls.write_item_components,
+            static_cast<jlong>(handle), buffer);
+        env->DeleteLocalRef(buffer);
+    }
+    clear_exception(env);
+    return result == JNI_TRUE;
+}
+
+} // extern "C"
@@ -0,0 +1,80 @@
+#ifndef ITEM_COMPONENTS_H
+#define ITEM_COMPONENTS_H
+
+#include <cstdint>
+
+// ==========================================================================
+// Binary Item Stack Components
+// ==========================================================================
+// Bulk get/set of an ItemStackHandle's data components
+// (ItemStackHandle.readComponents / writeComponents in Dart). Each call moves
+// one encoded blob across the bridge. Java (ItemComponentCodec) reads and
+// writes the blob through a direct ByteBuffer over the caller's memory, so
+// lore lines and enchantment maps skip the JSON strings.
+//
+// Layout, little-endian, no padding:
+//   u8 version (ITEM_COMPONENTS_VERSION)
+//   u8 count
+//   count x { u8 component, u8 tag, payload }
+//
+//   component                         value tag
+//   ITEM_COMPONENT_MAX_STACK_SIZE     INT
+//   ITEM_COMPONENT_DAMAGE             INT
+//   ITEM_COMPONENT_MAX_DAMAGE         INT
+//   ITEM_COMPONENT_CUSTOM_NAME        STRING (plain text)
+//   ITEM_COMPONENT_LORE               STRING_LIST (plain text lines)
+//   ITEM_COMPONENT_ENCHANTMENTS       INT_MAP (enchantment id -> level)
+//   ITEM_COMPONENT_UNBREAKABLE        BOOL
+//   ITEM_COMPONENT_DAMAGE_RESISTANT   BOOL (fire)
+//
+//   tag                               payload
+//   ITEM_COMPONENT_TAG_ABSENT         none (read: not set; write: remove)
+//   ITEM_COMPONENT_TAG_INT            i32
+//   ITEM_COMPONENT_TAG_BOOL           u8 (0 or 1)
+//   ITEM_COMPONENT_TAG_STRING         u32 byte length + UTF-8
+//   ITEM_COMPONENT_TAG_STRING_LIST    u32 count + count x string
+//   ITEM_COMPONENT_TAG_INT_MAP        u32 count + count x { string key, i32 value }
+// ==========================================================================
+
+#define ITEM_COMPONENTS_VERSION 1
+#define ITEM_COMPONENTS_HEADER_SIZE 2
+
+#define ITEM_COMPONENT_MAX_STACK_SIZE 1
+#define ITEM_COMPONENT_DAMAGE 2
+#define ITEM_COMPONENT_MAX_DAMAGE 3
+#define ITEM_COMPONENT_CUSTOM_NAME 4
+#define ITEM_COMPONENT_LORE 5
+#define ITEM_COMPONENT_ENCHANTMENTS 6
+#define ITEM_COMPONENT_UNBREAKABLE 7
+#define ITEM_COMPONENT_DAMAGE_RESISTANT 8
+
+#define ITEM_COMPONENT_TAG_ABSENT 0
+#define ITEM_COMPONENT_TAG_INT 1
+#define ITEM_COMPONENT_TAG_BOOL 2
+#define ITEM_COMPONENT_TAG_STRING 3
+#define ITEM_COMPONENT_TAG_STRING_LIST 4
+#define ITEM_COMPONENT_TAG_INT_MAP 5
+
+// item_components_read result when out is too small; retry with more room
+#define ITEM_COMPONENTS_OVERFLOW (-2)
+
+extern "C" {
+
+// Check that a blob is well formed: known version and tags, payloads within
+// bounds, no trailing bytes. Returns the component count, or -1.
+int32_t item_components_validate(const uint8_t* data, int32_t length);
+
+// Encode the requested components (count ITEM_COMPONENT_* codes) of a
+// handle's stack into out. Components of an empty or released stack are
+// ABSENT. Returns the blob length, ITEM_COMPONENTS_OVERFLOW if capacity is
+// too small, or -1 on error.
+int32_t item_components_read(int64_t handle, const uint8_t* components, int32_t count,
+                             uint8_t* out, int32_t capacity);
+
+// Apply every component in a blob to a handle's stack. Returns false if the
+// blob is malformed or a component could not be applied.
+bool item_components_write(int64_t handle, const uint8_t* data, int32_t length);
+
+} // extern "C"
+
+#endif // ITEM_COMPONENTS_H
@@ -10,6 +10,7 @@
 
 #include "dart_bridge_client.h"  // Client functions ONLY - no dart_bridge.h!
 #include "generic_jni.h"          // For generic_jni_capture_classloader
+#include "upcall_table.h"         // DartBridgeClient upcall targets
 
 #ifdef __APPLE__
 #include "multi_surface_renderer.h"  // Multi-surface support (macOS only)
@@ -54,6 +55,15 @@ static void jni_frame_callback(const void* pixels, size_t width, size_t height,
     g_has_new_frame = true;
 }
 
+// Free the frame copy while the client hibernates (reallocated by the next frame)
+static void jni_frame_release_callback() {
+    std::lock_guard<std::mutex> lock(g_frame_mutex);
+    std::vector<uint8_t>().swap(g_frame_buffer);
+    g_frame_width = 0;
+    g_frame_height = 0;
+    g_has_new_frame = false;
+}
+
 extern "C" {
 
 // ==========================================================================
@@ -71,7 +81,7 @@ extern "C" {
  * @param aot_library_path Path to AOT compiled library (can be null for JIT mode)
  */
 JNIEXPORT jboolean JNICALL Java_com_redstone_DartBridgeClient_initClient(
-    JNIEnv* env, jclass /* cls */,
+    JNIEnv* env, jclass cls,
     jstring assets_path, jstring icu_data_path, jstring aot_library_path) {
 
     // Capture JVM reference
@@ -81,8 +91,14 @@ JNIEXPORT jboolean JNICALL Java_com_redstone_DartBridgeClient_initClient(
     }
     dart_client_set_jvm(jvm);
 
+    if (!dart_mc_bridge::upcallsResolveClient(env, cls)) {
+        std::cerr << "JNI: Failed to resolve DartBridgeClient upcalls" << std::endl;
+        return JNI_FALSE;
+    }
+
     // Register the frame callback before initializing
     dart_client_set_frame_callback(jni_frame_callback);
+    dart_client_set_frame_release_callback(jni_frame_release_callback);
 
     const char* assets = assets_path ? env->GetStringUTFChars(assets_path, nullptr) : nullptr;
     const char* icu = icu_data_path ? env->GetStringUTFChars(icu_data_path, nullptr) : nullptr;
@@ -102,6 +118,36 @@ JNIEXPORT jboolean JNICALL Java_com_redstone_DartBridgeClient_initClient(
     return result ? JNI_TRUE : JNI_FALSE;
 }
 
+/*
+ * Class:     com_redstone_DartBridgeClient
+ * Method:    prepareClient
+ * Signature: (Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)Z
+ *
+ * Load the AOT snapshot and map the assets ahead of initClient (lazy start).
+ * Safe to call from a background thread.
+ */
+JNIEXPORT jboolean JNICALL Java_com_redstone_DartBridgeClient_prepareClient(
+    JNIEnv* env, jclass /* cls */,
+    jstring assets_path, jstring icu_data_path, jstring aot_library_path) {
+
+    const char* assets = assets_path ? env->GetStringUTFChars(assets_path, nullptr) : nullptr;
+    const char* icu = icu_data_path ? env->GetStringUTFChars(icu_data_path, nullptr) : nullptr;
+    const char* aot = aot_library_path ? env->GetStringUTFChars(aot_library_path, nullptr) : nullptr;
+
+    if (!assets) {
+        std::cerr << "JNI: Failed to get assets path string for client" << std::endl;
+        return JNI_FALSE;
+    }
+
+    bool result = dart_client_prepare(assets, icu, aot);
+
+    env->ReleaseStringUTFChars(assets_path, assets);
+    if (icu) env->ReleaseStringUTFChars(icu_data_path, icu);
+    if (aot) env->ReleaseStringUTFChars(aot_library_path, aot);
+
+    return result ? JNI_TRUE : JNI_FALSE;
+}
+
 /*
  * Class:     com_redstone_DartBridgeClient
  * Method:    shutdownClient
@@ -155,6 +201,8 @@ JNIEXPORT jstring JNICALL Java_com_redstone_DartBridgeClient_getClientServiceUrl
 JNIEXPORT jobject JNICALL Java_com_redstone_DartBridgeClient_getFramePixels(
     JNIEnv* env, jclass /* cls */) {
 
+    dart_client_wake();
+
     // Check if using hardware renderer (Metal on macOS)
     if (dart_client_is_opengl_renderer()) {
         // Metal/hardware path - read back from IOSurface
@@ -233,6 +281,9 @@ JNIEXPORT jint JNICALL Java_com_redstone_DartBridgeClient_getFrameHeight(
 JNIEXPORT jboolean JNICALL Java_com_redstone_DartBridgeClient_hasNewFrame(
     JNIEnv* /* env */, jclass /* cls */) {
 
+    // A screen is polling for frames: keep the client awake
+    dart_client_wake();
+
     // Check if using OpenGL renderer first
     if (dart_client_is_opengl_renderer()) {
         return dart_client_has_new_frame() ? JNI_TRUE : JNI_FALSE;
@@ -528,6 +579,72 @@ JNIEXPORT void JNICALL Java_com_redstone_DartBridgeClient_scheduleFrame(
     dart_client_schedule_frame();
 }
 
+/*
+ * Class:     com_redstone_DartBridgeClient
+ * Method:    hibernateClient
+ * Signature: ()V
+ *
+ * Release frame memory and pause frame production while no Flutter UI is shown.
+ */
+JNIEXPORT void JNICALL Java_com_redstone_DartBridgeClient_hibernateClient(
+    JNIEnv* /* env */, jclass /* cls */) {
+    dart_client_hibernate();
+}
+
+/*
+ * Class:     com_redstone_DartBridgeClient
+ * Method:    wakeClient
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_com_redstone_DartBridgeClient_wakeClient(
+    JNIEnv* /* env */, jclass /* cls */) {
+    dart_client_wake();
+}
+
+/*
+ * Class:     com_redstone_DartBridgeClient
+ * Method:    isClientHibernating
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_redstone_DartBridgeClient_isClientHibernating(
+    JNIEnv* /* env */, jclass /* cls */) {
+    return dart_client_is_hibernating() ? JNI_TRUE : JNI_FALSE;
+}
+
+/*
+ * Class:     com_redstone_DartBridgeClient
+ * Method:    setHibernateTimeout
+ * Signature: (I)V
+ *
+ * Idle time in milliseconds before the client hibernates on its own (0 = never).
+ */
+JNIEXPORT void JNICALL Java_com_redstone_DartBridgeClient_setHibernateTimeout(
+    JNIEnv* /* env */, jclass /* cls */, jint timeout_ms) {
+    dart_client_set_hibernate_timeout(static_cast<int32_t>(timeout_ms));
+}
+
+/*
+ * Class:     com_redstone_DartBridgeClient
+ * Method:    setDynamicResolution
+ * Signature: (ZDDD)V
+ *
+ * Configure dynamic resolution scaling of the Flutter overlay.
+ */
+JNIEXPORT void JNICALL Java_com_redstone_DartBridgeClient_setDynamicResolution(
+    JNIEnv* /* env */, jclass /* cls */, jboolean enabled, jdouble min_scale, jdouble max_scale, jdouble budget_ms) {
+    dart_client_set_dynamic_resolution(enabled == JNI_TRUE, min_scale, max_scale, budget_ms);
+}
+
+/*
+ * Class:     com_redstone_DartBridgeClient
+ * Method:    getResolutionScale
+ * Signature: ()D
+ */
+JNIEXPORT jdouble JNICALL Java_com_redstone_DartBridgeClient_getResolutionScale(
+    JNIEnv* /* env */, jclass /* cls */) {
+    return dart_client_get_resolution_scale();
+}
+
 /*
  * Class:     com_redstone_DartBridgeClient
  * Method:    nativeSignalContainerFrameReady
@@ -1019,15 +1136,14 @@ JNIEXPORT void JNICALL Java_com_redstone_DartBridgeClient_sendSurfaceKeyEvent(
 
 // Static references for callback
 static JavaVM* g_packet_jvm = nullptr;
-static jclass g_packet_class = nullptr;
-static jmethodID g_packet_method = nullptr;
 
 // Callback function that will be called by native when Dart sends a packet
 static void jni_send_packet_to_server_callback(int32_t packet_type, const uint8_t* data, int32_t data_length) {
     std::cout << "[JNI] jni_send_packet_to_server_callback called: type=0x"
               << std::hex << packet_type << std::dec << ", length=" << data_length << std::endl;
 
-    if (!g_packet_jvm || !g_packet_class || !g_packet_method) {
+    const auto& upcalls = dart_mc_bridge::upcalls();
+    if (!g_packet_jvm || !upcalls.client_ready) {
         std::cerr << "[JNI] send_packet_to_server_callback: Not initialized" << std::endl;
         return;
     }
@@ -1053,7 +1169,7 @@ static void jni_send_packet_to_server_callback(int32_t packet_type, const uint8_
         env->SetByteArrayRegion(jdata, 0, data_length, reinterpret_cast<const jbyte*>(data));
 
         // Call Java method: onSendPacketToServer(int packetType, byte[] data)
-        env->CallStaticVoidMethod(g_packet_class, g_packet_method,
+        env->CallStaticVoidMethod(upcalls.dart_bridge_client_class, upcalls.on_send_packet_to_server,
                                    static_cast<jint>(packet_type), jdata);
 
         env->DeleteLocalRef(jdata);
@@ -1077,13 +1193,9 @@ JNIEXPORT void JNICALL Java_com_redstone_DartBridgeClient_registerClientSendPack
     // Get JVM reference
     env->GetJavaVM(&g_packet_jvm);
 
-    // Create global reference to the class
-    g_packet_class = (jclass)env->NewGlobalRef(cls);
-
-    // Get the method ID for onSendPacketToServer(int, byte[])
-    g_packet_method = env->GetStaticMethodID(cls, "onSendPacketToServer", "(I[B)V");
-    if (g_packet_method == nullptr) {
-        std::cerr << "[JNI] registerClientSendPacketCallback: Failed to find onSendPacketToServer method" << std::endl;
+    // Resolve onSendPacketToServer(int, byte[]) with the other client upcalls
+    if (!dart_mc_bridge::upcallsResolveClient(env, cls)) {
+        std::cerr << "[JNI] registerClientSendPacketCallback: Failed to resolve DartBridgeClient upcalls" << std::endl;
         return;
     }
 
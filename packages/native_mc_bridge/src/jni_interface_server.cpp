@@ -10,10 +10,21 @@
 
 #include "dart_bridge_server.h"  // Server functions ONLY - no dart_bridge.h!
 #include "jni_helpers.h"         // Shared JNI boxing helpers
+#include "upcall_table.h"        // Resolved Java classes/methods
+#include "chunk_snapshot.h"      // Off-thread chunk snapshots
+#include "world_query.h"         // Async world query queue
+#include "chunk_data_store.h"    // Per-chunk Dart data pages
+#include "thread_roles.h"        // Thread priority/affinity roles
+#include "outbound_queue.h"      // Async S2C packet queue
+#include "isolate_stats.h"       // Server isolate heap/GC statistics
+#include "animation_tracks.h"    // Compiled block animation tracks
+#include "command_args.h"        // Binary command argument buffers
+#include "event_filter.h"        // Native filters for global events
 
 #include <jni.h>
 #include <iostream>
 #include <cstring>
+#include <vector>
 
 using namespace jni_helpers;
 
@@ -27,12 +38,26 @@ using namespace jni_helpers;
 // ==========================================================================
 
 static JavaVM* g_jvm = nullptr;
-static jclass g_dart_bridge_class = nullptr;
-static jmethodID g_on_chat_message_method = nullptr;
+
+// Check a global event against its native filter before it enters Dart.
+// The strings are only converted when the event has a filter.
+static bool passes_event_filter(JNIEnv* env, int32_t event, jstring subject_id, jstring dimension,
+                                jint x, jint y, jint z) {
+    if (!event_filter_is_active(event)) return true;
+    // No ids: the caller saw no filter when it built the event
+    if (subject_id == nullptr && dimension == nullptr) return true;
+    const char* subject = subject_id ? env->GetStringUTFChars(subject_id, nullptr) : nullptr;
+    const char* dim = dimension ? env->GetStringUTFChars(dimension, nullptr) : nullptr;
+    bool accepted = event_filter_accepts(event, subject, dim, x, y, z);
+    if (subject) env->ReleaseStringUTFChars(subject_id, subject);
+    if (dim) env->ReleaseStringUTFChars(dimension, dim);
+    return accepted;
+}
 
 // Callback function that gets called from Dart to send chat messages
 static void jni_send_chat_message(int64_t player_id, const char* message) {
-    if (g_jvm == nullptr || g_dart_bridge_class == nullptr || g_on_chat_message_method == nullptr) {
+    const auto& upcalls = dart_mc_bridge::upcalls();
+    if (g_jvm == nullptr || upcalls.on_chat_message == nullptr) {
         std::cerr << "JNI: Chat callback not properly initialized" << std::endl;
         return;
     }
@@ -63,7 +88,7 @@ static void jni_send_chat_message(int64_t player_id, const char* message) {
     }
 
     // Call the Java method
-    env->CallStaticVoidMethod(g_dart_bridge_class, g_on_chat_message_method,
+    env->CallStaticVoidMethod(upcalls.dart_bridge_class, upcalls.on_chat_message,
                                static_cast<jlong>(player_id), jmessage);
 
     // Clean up
@@ -98,9 +123,24 @@ JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* vm, void* /* reserved */) {
         dart_server_set_jvm(vm);
     }
 
+    // Resolve upcall targets while FindClass still sees the mod's class loader
+    JNIEnv* env = nullptr;
+    if (vm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_8) != JNI_OK ||
+        !dart_mc_bridge::upcallsResolveCore(env)) {
+        std::cerr << "JNI: Failed to resolve upcall table" << std::endl;
+        return JNI_ERR;
+    }
+
     return JNI_VERSION_1_8;
 }
 
+JNIEXPORT void JNICALL JNI_OnUnload(JavaVM* vm, void* /* reserved */) {
+    JNIEnv* env = nullptr;
+    if (vm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_8) == JNI_OK) {
+        dart_mc_bridge::upcallsRelease(env);
+    }
+}
+
 // ==========================================================================
 // Server Lifecycle JNI Entry Points
 // ==========================================================================
@@ -195,6 +235,56 @@ JNIEXPORT void JNICALL Java_com_redstone_DartBridge_tickServer(
     dart_server_tick();
 }
 
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    beginServerTick
+ * Signature: ()V
+ *
+ * Mark the start of a server tick (pauses the background pump)
+ */
+JNIEXPORT void JNICALL Java_com_redstone_DartBridge_beginServerTick(
+    JNIEnv* /* env */, jclass /* cls */) {
+    dart_server_begin_tick();
+}
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    applyThreadRole
+ * Signature: (I)Z
+ *
+ * Tag the calling Java thread with a thread role and apply its policy.
+ */
+JNIEXPORT jboolean JNICALL Java_com_redstone_DartBridge_applyThreadRole(
+    JNIEnv* /* env */, jclass /* cls */, jint role) {
+    return thread_role_apply(static_cast<int32_t>(role)) ? JNI_TRUE : JNI_FALSE;
+}
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    configureThreadRole
+ * Signature: (IIJ)Z
+ *
+ * Set a thread role's nice value and CPU affinity mask (0 = any CPU).
+ */
+JNIEXPORT jboolean JNICALL Java_com_redstone_DartBridge_configureThreadRole(
+    JNIEnv* /* env */, jclass /* cls */, jint role, jint nice_value, jlong affinity_mask) {
+    return thread_role_configure(static_cast<int32_t>(role), static_cast<int32_t>(nice_value),
+                                 static_cast<uint64_t>(affinity_mask)) ? JNI_TRUE : JNI_FALSE;
+}
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    isEventFilterActive
+ * Signature: (I)Z
+ *
+ * Whether a native filter is set for an EVENT_FILTER_* event, so callers
+ * can skip building the ids it checks.
+ */
+JNIEXPORT jboolean JNICALL Java_com_redstone_DartBridge_isEventFilterActive(
+    JNIEnv* /* env */, jclass /* cls */, jint event) {
+    return event_filter_is_active(static_cast<int32_t>(event)) ? JNI_TRUE : JNI_FALSE;
+}
+
 /*
  * Class:     com_redstone_DartBridge
  * Method:    getServerServiceUrl
@@ -239,7 +329,7 @@ JNIEXPORT jstring JNICALL Java_com_redstone_DartBridge_getDartServiceUrl(
  * Signature: ()V
  */
 JNIEXPORT void JNICALL Java_com_redstone_DartBridge_setSendChatCallback(
-    JNIEnv* env, jclass cls) {
+    JNIEnv* env, jclass /* cls */) {
 
     // Get JVM reference
     if (g_jvm == nullptr) {
@@ -247,20 +337,6 @@ JNIEXPORT void JNICALL Java_com_redstone_DartBridge_setSendChatCallback(
         dart_server_set_jvm(g_jvm);
     }
 
-    // Create global reference to DartBridge class
-    if (g_dart_bridge_class == nullptr) {
-        g_dart_bridge_class = static_cast<jclass>(env->NewGlobalRef(cls));
-    }
-
-    // Get method ID for onChatMessage
-    g_on_chat_message_method = env->GetStaticMethodID(
-        g_dart_bridge_class, "onChatMessage", "(JLjava/lang/String;)V");
-
-    if (g_on_chat_message_method == nullptr) {
-        std::cerr << "JNI: Failed to find onChatMessage method" << std::endl;
-        return;
-    }
-
     // Register the callback with the native bridge
     server_set_send_chat_message_callback(jni_send_chat_message);
     std::cout << "JNI: Chat message callback set up successfully" << std::endl;
@@ -307,13 +383,15 @@ JNIEXPORT jint JNICALL Java_com_redstone_DartBridge_onServerBlockBreak(
 /*
  * Class:     com_redstone_DartBridge
  * Method:    onBlockBreak
- * Signature: (IIIJ)I
+ * Signature: (IIIJLjava/lang/String;Ljava/lang/String;)I
  *
- * Server-side block break event (alias for Java compatibility).
+ * Server-side block break event. Blocks and dimensions rejected by the
+ * event filter are allowed without entering Dart.
  */
 JNIEXPORT jint JNICALL Java_com_redstone_DartBridge_onBlockBreak(
-    JNIEnv* /* env */, jclass /* cls */,
-    jint x, jint y, jint z, jlong player_id) {
+    JNIEnv* env, jclass /* cls */,
+    jint x, jint y, jint z, jlong player_id, jstring blockId, jstring dimension) {
+    if (!passes_event_filter(env, EVENT_FILTER_BLOCK_BREAK, blockId, dimension, x, y, z)) return 1;
     return server_dispatch_block_break(x, y, z, player_id);
 }
 
@@ -738,12 +816,15 @@ JNIEXPORT jstring JNICALL Java_com_redstone_DartBridge_onPlayerDeath(
 /*
  * Class:     com_redstone_DartBridge
  * Method:    onEntityDamage
- * Signature: (ILjava/lang/String;D)Z
+ * Signature: (ILjava/lang/String;DLjava/lang/String;Ljava/lang/String;III)Z
  *
- * Returns true to allow damage, false to cancel.
+ * Returns true to allow damage, false to cancel. The entity type, dimension
+ * and block position are checked against the event filter first.
  */
 JNIEXPORT jboolean JNICALL Java_com_redstone_DartBridge_onEntityDamage(
-    JNIEnv* env, jclass /* cls */, jint entityId, jstring damageSource, jdouble amount) {
+    JNIEnv* env, jclass /* cls */, jint entityId, jstring damageSource, jdouble amount,
+    jstring entityType, jstring dimension, jint x, jint y, jint z) {
+    if (!passes_event_filter(env, EVENT_FILTER_ENTITY_DAMAGE, entityType, dimension, x, y, z)) return JNI_TRUE;
     const char* source = env->GetStringUTFChars(damageSource, nullptr);
     bool result = server_dispatch_entity_damage(static_cast<int32_t>(entityId), source, static_cast<double>(amount));
     env->ReleaseStringUTFChars(damageSource, source);
@@ -821,12 +902,15 @@ JNIEXPORT jboolean JNICALL Java_com_redstone_DartBridge_onPlayerCommand(
 /*
  * Class:     com_redstone_DartBridge
  * Method:    onItemUse
- * Signature: (ILjava/lang/String;II)Z
+ * Signature: (ILjava/lang/String;IILjava/lang/String;III)Z
  *
- * Returns true to allow use, false to cancel.
+ * Returns true to allow use, false to cancel. The item, dimension and the
+ * player's block position are checked against the event filter first.
  */
 JNIEXPORT jboolean JNICALL Java_com_redstone_DartBridge_onItemUse(
-    JNIEnv* env, jclass /* cls */, jint playerId, jstring itemId, jint count, jint hand) {
+    JNIEnv* env, jclass /* cls */, jint playerId, jstring itemId, jint count, jint hand,
+    jstring dimension, jint x, jint y, jint z) {
+    if (!passes_event_filter(env, EVENT_FILTER_ITEM_USE, itemId, dimension, x, y, z)) return JNI_TRUE;
     const char* item = env->GetStringUTFChars(itemId, nullptr);
     bool result = server_dispatch_item_use(static_cast<int32_t>(playerId), item,
                                     static_cast<int32_t>(count), static_cast<int32_t>(hand));
@@ -889,12 +973,15 @@ JNIEXPORT jboolean JNICALL Java_com_redstone_DartBridge_onBlockPlace(
 /*
  * Class:     com_redstone_DartBridge
  * Method:    onPlayerPickupItem
- * Signature: (II)Z
+ * Signature: (IILjava/lang/String;Ljava/lang/String;III)Z
  *
- * Returns true to allow pickup, false to cancel.
+ * Returns true to allow pickup, false to cancel. The item, dimension and the
+ * player's block position are checked against the event filter first.
  */
 JNIEXPORT jboolean JNICALL Java_com_redstone_DartBridge_onPlayerPickupItem(
-    JNIEnv* /* env */, jclass /* cls */, jint playerId, jint itemEntityId) {
+    JNIEnv* env, jclass /* cls */, jint playerId, jint itemEntityId,
+    jstring itemId, jstring dimension, jint x, jint y, jint z) {
+    if (!passes_event_filter(env, EVENT_FILTER_PLAYER_PICKUP_ITEM, itemId, dimension, x, y, z)) return JNI_TRUE;
     bool result = server_dispatch_player_pickup_item(static_cast<int32_t>(playerId), static_cast<int32_t>(itemEntityId));
     return result ? JNI_TRUE : JNI_FALSE;
 }
@@ -1174,18 +1261,27 @@ JNIEXPORT jint JNICALL Java_com_redstone_DartBridge_onProxyItemUseOnEntity(
 // Command System JNI
 // ==========================================================================
 
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    onCommandExecute
+ * Signature: (JILjava/nio/ByteBuffer;I)I
+ *
+ * Dispatch a command with its arguments encoded in a direct ByteBuffer
+ * (see command_args.h). The buffer is read in place, without copying.
+ */
 JNIEXPORT jint JNICALL Java_com_redstone_DartBridge_onCommandExecute(
     JNIEnv* env, jclass /* cls */,
-    jlong commandId, jint playerId, jstring argsJson) {
-    const char* args = argsJson ? env->GetStringUTFChars(argsJson, nullptr) : "";
-    jint result = static_cast<jint>(server_dispatch_command_execute(
+    jlong commandId, jint playerId, jobject args, jint argsLength) {
+    auto* data = args ? static_cast<const uint8_t*>(env->GetDirectBufferAddress(args)) : nullptr;
+    if (data == nullptr || argsLength < 0 || argsLength > env->GetDirectBufferCapacity(args)) {
+        std::cerr << "onCommandExecute: invalid argument buffer for command " << commandId << std::endl;
+        return 0;
+    }
+    return static_cast<jint>(server_dispatch_command_execute(
         static_cast<int64_t>(commandId),
         static_cast<int32_t>(playerId),
-        args));
-    if (argsJson) {
-        env->ReleaseStringUTFChars(argsJson, args);
-    }
-    return result;
+        data,
+        static_cast<int32_t>(argsLength)));
 }
 
 // ==========================================================================
@@ -1388,8 +1484,7 @@ JNIEXPORT jobjectArray JNICALL Java_com_redstone_DartBridge_getNextBlockRegistra
     }
 
     // Create Object array with 17 elements (14 original + 3 new: isRedstoneSource, hasAnalogOutput, propertiesJson)
-    jclass objectClass = env->FindClass("java/lang/Object");
-    jobjectArray result = env->NewObjectArray(17, objectClass, nullptr);
+    jobjectArray result = env->NewObjectArray(17, dart_mc_bridge::upcalls().object_class, nullptr);
 
     // Use shared boxing helpers from jni_helpers.h
     env->SetObjectArrayElement(result, 0, boxLong(env, static_cast<jlong>(handler_id)));
@@ -1448,8 +1543,7 @@ JNIEXPORT jobjectArray JNICALL Java_com_redstone_DartBridge_getNextItemRegistrat
     }
 
     // Create Object array with 9 elements
-    jclass objectClass = env->FindClass("java/lang/Object");
-    jobjectArray result = env->NewObjectArray(9, objectClass, nullptr);
+    jobjectArray result = env->NewObjectArray(9, dart_mc_bridge::upcalls().object_class, nullptr);
 
     // Use shared boxing helpers from jni_helpers.h
     env->SetObjectArrayElement(result, 0, boxLong(env, static_cast<jlong>(handler_id)));
@@ -1515,8 +1609,7 @@ JNIEXPORT jobjectArray JNICALL Java_com_redstone_DartBridge_getNextEntityRegistr
     }
 
     // Create Object array with 16 elements
-    jclass objectClass = env->FindClass("java/lang/Object");
-    jobjectArray result = env->NewObjectArray(16, objectClass, nullptr);
+    jobjectArray result = env->NewObjectArray(16, dart_mc_bridge::upcalls().object_class, nullptr);
 
     // Use shared boxing helpers from jni_helpers.h
     env->SetObjectArrayElement(result, 0, boxLong(env, static_cast<jlong>(handler_id)));
@@ -1539,6 +1632,481 @@ JNIEXPORT jobjectArray JNICALL Java_com_redstone_DartBridge_getNextEntityRegistr
     return result;
 }
 
+// ==========================================================================
+// Chunk Snapshot JNI Entry Points
+// ==========================================================================
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    getChunkSnapshotWorldId
+ * Signature: (Ljava/lang/String;)I
+ *
+ * Maps a dimension id to the small world id used by chunk snapshots.
+ */
+JNIEXPORT jint JNICALL Java_com_redstone_DartBridge_getChunkSnapshotWorldId(
+    JNIEnv* env, jclass /* cls */, jstring dimension) {
+    if (!dimension) return -1;
+    const char* dimension_str = env->GetStringUTFChars(dimension, nullptr);
+    int32_t world_id = chunk_snapshot_world_id(dimension_str);
+    env->ReleaseStringUTFChars(dimension, dimension_str);
+    return static_cast<jint>(world_id);
+}
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    pollChunkSnapshotRequests
+ * Signature: ()[I
+ *
+ * Drains chunk snapshot requests submitted by Dart.
+ * Returns (worldId, chunkX, chunkZ, mode) tuples, or null if there are none.
+ */
+JNIEXPORT jintArray JNICALL Java_com_redstone_DartBridge_pollChunkSnapshotRequests(
+    JNIEnv* env, jclass /* cls */) {
+    constexpr int32_t kMaxRequests = 1024;
+    int32_t requests[kMaxRequests * 4];
+    int32_t count = chunk_snapshot_poll_requests(requests, kMaxRequests);
+    if (count <= 0) return nullptr;
+
+    jintArray result = env->NewIntArray(count * 4);
+    if (result) {
+        env->SetIntArrayRegion(result, 0, count * 4, reinterpret_cast<const jint*>(requests));
+    }
+    return result;
+}
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    publishChunkSnapshot
+ * Signature: (IIII[I[I[S[SI)V
+ *
+ * Publishes every section of a chunk plus its heightmaps in one call.
+ * paletteSizes[i] is the palette length of section minSectionY + i; palettes
+ * holds all palettes back to back. indices holds 4096 entries for each
+ * section whose palette has more than one state (uniform sections have none).
+ */
+JNIEXPORT void JNICALL Java_com_redstone_DartBridge_publishChunkSnapshot(
+    JNIEnv* env, jclass /* cls */,
+    jint world_id, jint chunk_x, jint chunk_z, jint min_section_y,
+    jintArray palette_sizes, jintArray palettes, jshortArray indices,
+    jshortArray heightmaps, jint heightmap_types) {
+    if (!palette_sizes || !palettes) return;
+
+    jsize section_count = env->GetArrayLength(palette_sizes);
+    jsize palette_total = env->GetArrayLength(palettes);
+    jsize index_total = indices ? env->GetArrayLength(indices) : 0;
+
+    jint* sizes = env->GetIntArrayElements(palette_sizes, nullptr);
+    jint* palette_data = env->GetIntArrayElements(palettes, nullptr);
+    jshort* index_data = indices ? env->GetShortArrayElements(indices, nullptr) : nullptr;
+
+    jsize palette_offset = 0;
+    jsize index_offset = 0;
+    for (jsize i = 0; i < section_count; i++) {
+        jint size = sizes[i];
+        if (size <= 0 || palette_offset + size > palette_total) break;
+
+        const uint16_t* section_indices = nullptr;
+        if (size > 1) {
+            if (index_offset + CHUNK_SECTION_VOLUME > index_total) break;
+            section_indices = reinterpret_cast<const uint16_t*>(index_data + index_offset);
+            index_offset += CHUNK_SECTION_VOLUME;
+        }
+
+        chunk_snapshot_publish_section(
+            static_cast<int32_t>(world_id), static_cast<int32_t>(chunk_x),
+            static_cast<int32_t>(min_section_y + i), static_cast<int32_t>(chunk_z),
+            reinterpret_cast<const int32_t*>(palette_data + palette_offset),
+            static_cast<int32_t>(size), section_indices);
+        palette_offset += size;
+    }
+
+    if (index_data) env->ReleaseShortArrayElements(indices, index_data, JNI_ABORT);
+    env->ReleaseIntArrayElements(palettes, palette_data, JNI_ABORT);
+    env->ReleaseIntArrayElements(palette_sizes, sizes, JNI_ABORT);
+
+    if (heightmaps && heightmap_types > 0 &&
+        env->GetArrayLength(heightmaps) >= heightmap_types * CHUNK_HEIGHTMAP_AREA) {
+        jshort* heights = env->GetShortArrayElements(heightmaps, nullptr);
+        chunk_snapshot_publish_heightmaps(
+            static_cast<int32_t>(world_id), static_cast<int32_t>(chunk_x), static_cast<int32_t>(chunk_z),
+            reinterpret_cast<const int16_t*>(heights), static_cast<int32_t>(heightmap_types));
+        env->ReleaseShortArrayElements(heightmaps, heights, JNI_ABORT);
+    }
+}
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    evictChunkSnapshot
+ * Signature: (III)V
+ *
+ * Drops all snapshots of a chunk (called when the chunk unloads).
+ */
+JNIEXPORT void JNICALL Java_com_redstone_DartBridge_evictChunkSnapshot(
+    JNIEnv* /* env */, jclass /* cls */,
+    jint world_id, jint chunk_x, jint chunk_z) {
+    chunk_snapshot_evict_chunk(
+        static_cast<int32_t>(world_id),
+        static_cast<int32_t>(chunk_x),
+        static_cast<int32_t>(chunk_z));
+}
+
+// ==========================================================================
+// Async World Query JNI Entry Points (server-side)
+// ==========================================================================
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    pollWorldQueries
+ * Signature: (I)[Ljava/lang/Object;
+ *
+ * Takes up to maxQueries pending world queries submitted by Dart.
+ * Returns null if none are pending, otherwise
+ * [ids(long[]), kinds(int[]), dimensions(String[]), texts(String[]), args(double[])]
+ * with WORLD_QUERY_MAX_ARGS args per query.
+ */
+JNIEXPORT jobjectArray JNICALL Java_com_redstone_DartBridge_pollWorldQueries(
+    JNIEnv* env, jclass /* cls */, jint max_queries) {
+    if (max_queries <= 0) return nullptr;
+
+    std::vector<dart_mc_bridge::WorldQuery> queries;
+    dart_mc_bridge::worldQueryTake(queries, static_cast<size_t>(max_queries));
+    if (queries.empty()) return nullptr;
+
+    jsize count = static_cast<jsize>(queries.size());
+    std::vector<jlong> ids(count);
+    std::vector<jint> kinds(count);
+    std::vector<jdouble> args(static_cast<size_t>(count) * WORLD_QUERY_MAX_ARGS);
+
+    jclass string_class = dart_mc_bridge::upcalls().string_class;
+    jobjectArray dimensions = env->NewObjectArray(count, string_class, nullptr);
+    jobjectArray texts = env->NewObjectArray(count, string_class, nullptr);
+
+    for (jsize i = 0; i < count; i++) {
+        const auto& query = queries[i];
+        ids[i] = static_cast<jlong>(query.id);
+        kinds[i] = static_cast<jint>(query.kind);
+        std::memcpy(&args[static_cast<size_t>(i) * WORLD_QUERY_MAX_ARGS], query.args, sizeof(query.args));
+
+        jstring dimension = env->NewStringUTF(query.dimension.c_str());
+        env->SetObjectArrayElement(dimensions, i, dimension);
+        env->DeleteLocalRef(dimension);
+        if (!query.text.empty()) {
+            jstring text = env->NewStringUTF(query.text.c_str());
+            env->SetObjectArrayElement(texts, i, text);
+            env->DeleteLocalRef(text);
+        }
+    }
+
+    jlongArray id_array = env->NewLongArray(count);
+    env->SetLongArrayRegion(id_array, 0, count, ids.data());
+    jintArray kind_array = env->NewIntArray(count);
+    env->SetIntArrayRegion(kind_array, 0, count, kinds.data());
+    jdoubleArray arg_array = env->NewDoubleArray(static_cast<jsize>(args.size()));
+    env->SetDoubleArrayRegion(arg_array, 0, static_cast<jsize>(args.size()), args.data());
+
+    jobjectArray result = env->NewObjectArray(5, dart_mc_bridge::upcalls().object_class, nullptr);
+    env->SetObjectArrayElement(result, 0, id_array);
+    env->SetObjectArrayElement(result, 1, kind_array);
+    env->SetObjectArrayElement(result, 2, dimensions);
+    env->SetObjectArrayElement(result, 3, texts);
+    env->SetObjectArrayElement(result, 4, arg_array);
+    env->DeleteLocalRef(id_array);
+    env->DeleteLocalRef(kind_array);
+    env->DeleteLocalRef(dimensions);
+    env->DeleteLocalRef(texts);
+    env->DeleteLocalRef(arg_array);
+    return result;
+}
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    completeWorldQueries
+ * Signature: ([J[I[Ljava/lang/String;[D[I)V
+ *
+ * Posts a batch of query results back to Dart. Values of query i span
+ * [valueOffsets[i], valueOffsets[i + 1]); texts entries may be null.
+ */
+JNIEXPORT void JNICALL Java_com_redstone_DartBridge_completeWorldQueries(
+    JNIEnv* env, jclass /* cls */,
+    jlongArray ids, jintArray statuses, jobjectArray texts, jdoubleArray values, jintArray value_offsets) {
+    if (!ids || !statuses || !value_offsets) return;
+
+    jsize count = env->GetArrayLength(ids);
+    if (env->GetArrayLength(statuses) < count || env->GetArrayLength(value_offsets) < count + 1) return;
+    jsize value_total = values ? env->GetArrayLength(values) : 0;
+
+    jlong* id_data = env->GetLongArrayElements(ids, nullptr);
+    jint* status_data = env->GetIntArrayElements(statuses, nullptr);
+    jint* offset_data = env->GetIntArrayElements(value_offsets, nullptr);
+    jdouble* value_data = values ? env->GetDoubleArrayElements(values, nullptr) : nullptr;
+
+    for (jsize i = 0; i < count; i++) {
+        jint start = offset_data[i];
+        jint end = offset_data[i + 1];
+        if (start < 0 || end < start || end > value_total) {
+            start = 0;
+            end = 0;
+        }
+
+        jstring text = texts ? static_cast<jstring>(env->GetObjectArrayElement(texts, i)) : nullptr;
+        const char* text_str = text ? env->GetStringUTFChars(text, nullptr) : nullptr;
+
+        dart_mc_bridge::worldQueryComplete(
+            static_cast<int64_t>(id_data[i]), static_cast<int32_t>(status_data[i]), text_str,
+            value_data ? reinterpret_cast<const double*>(value_data + start) : nullptr,
+            static_cast<int32_t>(end - start));
+
+        if (text) {
+            env->ReleaseStringUTFChars(text, text_str);
+            env->DeleteLocalRef(text);
+        }
+    }
+
+    if (value_data) env->ReleaseDoubleArrayElements(values, value_data, JNI_ABORT);
+    env->ReleaseIntArrayElements(value_offsets, offset_data, JNI_ABORT);
+    env->ReleaseIntArrayElements(statuses, status_data, JNI_ABORT);
+    env->ReleaseLongArrayElements(ids, id_data, JNI_ABORT);
+}
+
+// ==========================================================================
+// Isolate Heap Statistics JNI Entry Points (server-side)
+// ==========================================================================
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    getServerHeapStats
+ * Signature: ()[J
+ *
+ * Samples the server isolate heap and GC counters (HEAP_STAT_* order).
+ * Returns null if the server runtime is not running.
+ */
+JNIEXPORT jlongArray JNICALL Java_com_redstone_DartBridge_getServerHeapStats(
+    JNIEnv* env, jclass /* cls */) {
+    int64_t stats[HEAP_STAT_COUNT] = {};
+    if (isolate_stats_sample(stats, HEAP_STAT_COUNT) == 0) return nullptr;
+
+    jlongArray result = env->NewLongArray(HEAP_STAT_COUNT);
+    env->SetLongArrayRegion(result, 0, HEAP_STAT_COUNT, reinterpret_cast<const jlong*>(stats));
+    return result;
+}
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    setGcPauseWarningMs
+ * Signature: (D)V
+ *
+ * Sets the single-pause duration that triggers a GC warning log (0 disables).
+ */
+JNIEXPORT void JNICALL Java_com_redstone_DartBridge_setGcPauseWarningMs(
+    JNIEnv* /* env */, jclass /* cls */, jdouble threshold_ms) {
+    isolate_stats_set_pause_warning(static_cast<double>(threshold_ms));
+}
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    setServerBackgroundPump
+ * Signature: (Z)Z
+ *
+ * Start or stop draining the server isolate from a background thread.
+ */
+JNIEXPORT jboolean JNICALL Java_com_redstone_DartBridge_setServerBackgroundPump(
+    JNIEnv* /* env */, jclass /* cls */, jboolean enabled) {
+    return server_set_background_pump(enabled == JNI_TRUE) ? JNI_TRUE : JNI_FALSE;
+}
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    getServerPumpStats
+ * Signature: ()[J
+ *
+ * Returns [ticksDrained, ticksSkipped, backgroundDrains].
+ */
+JNIEXPORT jlongArray JNICALL Java_com_redstone_DartBridge_getServerPumpStats(
+    JNIEnv* env, jclass /* cls */) {
+    int64_t stats[3] = {};
+    server_get_pump_stats(&stats[0], &stats[1], &stats[2]);
+
+    jlongArray result = env->NewLongArray(3);
+    env->SetLongArrayRegion(result, 0, 3, reinterpret_cast<const jlong*>(stats));
+    return result;
+}
+
+// ==========================================================================
+// Outbound Packet Queue JNI Entry Points (server-side)
+// ==========================================================================
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    setOutboundQueueEnabled
+ * Signature: (Z)V
+ *
+ * Start or stop queueing S2C packets for the sender thread.
+ */
+JNIEXPORT void JNICALL Java_com_redstone_DartBridge_setOutboundQueueEnabled(
+    JNIEnv* /* env */, jclass /* cls */, jboolean enabled) {
+    outbound_queue_set_enabled(enabled == JNI_TRUE);
+}
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    setOutboundQueueLimits
+ * Signature: (JJ)V
+ *
+ * Sets the per-player byte budget per tick (0 = unlimited) and queued-bytes limit.
+ */
+JNIEXPORT void JNICALL Java_com_redstone_DartBridge_setOutboundQueueLimits(
+    JNIEnv* /* env */, jclass /* cls */, jlong tick_budget_bytes, jlong max_queued_bytes) {
+    outbound_queue_set_limits(static_cast<int64_t>(tick_budget_bytes), static_cast<int64_t>(max_queued_bytes));
+}
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    waitOutboundPackets
+ * Signature: (I)Z
+ *
+ * Blocks the sender thread until packets are sendable or the timeout passes.
+ */
+JNIEXPORT jboolean JNICALL Java_com_redstone_DartBridge_waitOutboundPackets(
+    JNIEnv* /* env */, jclass /* cls */, jint timeout_ms) {
+    return outbound_queue_wait(static_cast<int32_t>(timeout_ms)) ? JNI_TRUE : JNI_FALSE;
+}
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    pollOutboundPackets
+ * Signature: (I)[Ljava/lang/Object;
+ *
+ * Takes up to maxBytes of sendable packets. Returns null if none are
+ * sendable, otherwise [playerIds(int[]), types(int[]), offsets(int[]), data(byte[])]
+ * where packet i spans data[offsets[i], offsets[i + 1]).
+ */
+JNIEXPORT jobjectArray JNICALL Java_com_redstone_DartBridge_pollOutboundPackets(
+    JNIEnv* env, jclass /* cls */, jint max_bytes) {
+    std::vector<dart_mc_bridge::OutboundPacket> packets;
+    dart_mc_bridge::outboundQueueTake(packets, max_bytes > 0 ? static_cast<size_t>(max_bytes) : 0);
+    if (packets.empty()) return nullptr;
+
+    jsize count = static_cast<jsize>(packets.size());
+    std::vector<jint> player_ids(count);
+    std::vector<jint> types(count);
+    std::vector<jint> offsets(count + 1);
+    size_t total = 0;
+    for (jsize i = 0; i < count; i++) {
+        player_ids[i] = static_cast<jint>(packets[i].player_id);
+        types[i] = static_cast<jint>(packets[i].packet_type);
+        offsets[i] = static_cast<jint>(total);
+        total += packets[i].data.size();
+    }
+    offsets[count] = static_cast<jint>(total);
+
+    jbyteArray data = env->NewByteArray(static_cast<jsize>(total));
+    for (jsize i = 0; i < count; i++) {
+        const auto& bytes = packets[i].data;
+        if (!bytes.empty()) {
+            env->SetByteArrayRegion(data, offsets[i], static_cast<jsize>(bytes.size()),
+                                    reinterpret_cast<const jbyte*>(bytes.data()));
+        }
+    }
+
+    jintArray player_array = env->NewIntArray(count);
+    env->SetIntArrayRegion(player_array, 0, count, player_ids.data());
+    jintArray type_array = env->NewIntArray(count);
+    env->SetIntArrayRegion(type_array, 0, count, types.data());
+    jintArray offset_array = env->NewIntArray(count + 1);
+    env->SetIntArrayRegion(offset_array, 0, count + 1, offsets.data());
+
+    jobjectArray result = env->NewObjectArray(4, dart_mc_bridge::upcalls().object_class, nullptr);
+    env->SetObjectArrayElement(result, 0, player_array);
+    env->SetObjectArrayElement(result, 1, type_array);
+    env->SetObjectArrayElement(result, 2, offset_array);
+    env->SetObjectArrayElement(result, 3, data);
+    env->DeleteLocalRef(player_array);
+    env->DeleteLocalRef(type_array);
+    env->DeleteLocalRef(offset_array);
+    env->DeleteLocalRef(data);
+    return result;
+}
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    getOutboundQueueStats
+ * Signature: (I)[J
+ *
+ * Returns [queuedPackets, queuedBytes, sentPackets, sentBytes, droppedPackets,
+ * droppedBytes, mergedPackets] for one player, or totals for playerId < 0.
+ */
+JNIEXPORT jlongArray JNICALL Java_com_redstone_DartBridge_getOutboundQueueStats(
+    JNIEnv* env, jclass /* cls */, jint player_id) {
+    int64_t stats[OUTBOUND_STAT_COUNT] = {};
+    outbound_queue_stats(static_cast<int32_t>(player_id), stats, OUTBOUND_STAT_COUNT);
+
+    jlongArray result = env->NewLongArray(OUTBOUND_STAT_COUNT);
+    env->SetLongArrayRegion(result, 0, OUTBOUND_STAT_COUNT, reinterpret_cast<const jlong*>(stats));
+    return result;
+}
+
+// ==========================================================================
+// Chunk Data Store JNI Entry Points (server-side)
+// ==========================================================================
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    setChunkDataRoot
+ * Signature: (Ljava/lang/String;)V
+ *
+ * Sets the folder holding chunk data region files (inside the world save).
+ */
+JNIEXPORT void JNICALL Java_com_redstone_DartBridge_setChunkDataRoot(
+    JNIEnv* env, jclass /* cls */, jstring path) {
+    if (!path) {
+        chunk_data_set_root(nullptr);
+        return;
+    }
+    const char* path_str = env->GetStringUTFChars(path, nullptr);
+    chunk_data_set_root(path_str);
+    env->ReleaseStringUTFChars(path, path_str);
+}
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    onChunkDataLoad
+ * Signature: (III)V
+ */
+JNIEXPORT void JNICALL Java_com_redstone_DartBridge_onChunkDataLoad(
+    JNIEnv* /* env */, jclass /* cls */,
+    jint world_id, jint chunk_x, jint chunk_z) {
+    chunk_data_chunk_loaded(
+        static_cast<int32_t>(world_id),
+        static_cast<int32_t>(chunk_x),
+        static_cast<int32_t>(chunk_z));
+}
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    onChunkDataUnload
+ * Signature: (III)V
+ */
+JNIEXPORT void JNICALL Java_com_redstone_DartBridge_onChunkDataUnload(
+    JNIEnv* /* env */, jclass /* cls */,
+    jint world_id, jint chunk_x, jint chunk_z) {
+    chunk_data_chunk_unloaded(
+        static_cast<int32_t>(world_id),
+        static_cast<int32_t>(chunk_x),
+        static_cast<int32_t>(chunk_z));
+}
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    flushChunkData
+ * Signature: ()I
+ *
+ * Writes back dirty chunk data pages (world save).
+ */
+JNIEXPORT jint JNICALL Java_com_redstone_DartBridge_flushChunkData(
+    JNIEnv* /* env */, jclass /* cls */) {
+    return static_cast<jint>(chunk_data_flush());
+}
+
 // ==========================================================================
 // Block Entity JNI Entry Points (server-side)
 // ==========================================================================
@@ -1699,6 +2267,89 @@ JNIEXPORT void JNICALL Java_com_redstone_DartBridge_onBlockEntityContainerClose(
         static_cast<int64_t>(block_pos_hash));
 }
 
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    onBlockEntityLoadChunk
+ * Signature: ([I[J[B[I)V
+ *
+ * Called once per chunk with every Dart block entity loaded from it.
+ * data holds the concatenated UTF-8 JSON payloads; entry i spans
+ * [offsets[i], offsets[i + 1]). Each entity is loaded then receives setLevel,
+ * all within a single isolate entry.
+ */
+JNIEXPORT void JNICALL Java_com_redstone_DartBridge_onBlockEntityLoadChunk(
+    JNIEnv* env, jclass /* cls */,
+    jintArray handler_ids, jlongArray block_pos_hashes, jbyteArray data, jintArray offsets) {
+    if (!handler_ids || !block_pos_hashes || !data || !offsets) return;
+    jsize count = env->GetArrayLength(handler_ids);
+    if (count <= 0 || env->GetArrayLength(block_pos_hashes) < count ||
+        env->GetArrayLength(offsets) < count + 1) {
+        return;
+    }
+
+    jint* ids = env->GetIntArrayElements(handler_ids, nullptr);
+    jlong* hashes = env->GetLongArrayElements(block_pos_hashes, nullptr);
+    jbyte* bytes = env->GetByteArrayElements(data, nullptr);
+    jint* offs = env->GetIntArrayElements(offsets, nullptr);
+
+    server_dispatch_block_entity_load_chunk(
+        reinterpret_cast<const int32_t*>(ids),
+        reinterpret_cast<const int64_t*>(hashes),
+        reinterpret_cast<const uint8_t*>(bytes),
+        static_cast<int32_t>(env->GetArrayLength(data)),
+        reinterpret_cast<const int32_t*>(offs),
+        static_cast<int32_t>(count));
+
+    env->ReleaseIntArrayElements(offsets, offs, JNI_ABORT);
+    env->ReleaseByteArrayElements(data, bytes, JNI_ABORT);
+    env->ReleaseLongArrayElements(block_pos_hashes, hashes, JNI_ABORT);
+    env->ReleaseIntArrayElements(handler_ids, ids, JNI_ABORT);
+}
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    onBlockEntitySaveChunk
+ * Signature: ([I[J[I)[B
+ *
+ * Called once per chunk to save every Dart block entity in it.
+ * Returns the concatenated UTF-8 JSON payloads and fills out_offsets
+ * (length count + 1) so entry i spans [out_offsets[i], out_offsets[i + 1]).
+ * Returns null if Dart failed to save the chunk.
+ */
+JNIEXPORT jbyteArray JNICALL Java_com_redstone_DartBridge_onBlockEntitySaveChunk(
+    JNIEnv* env, jclass /* cls */,
+    jintArray handler_ids, jlongArray block_pos_hashes, jintArray out_offsets) {
+    if (!handler_ids || !block_pos_hashes || !out_offsets) return nullptr;
+    jsize count = env->GetArrayLength(handler_ids);
+    if (count <= 0 || env->GetArrayLength(block_pos_hashes) < count ||
+        env->GetArrayLength(out_offsets) < count + 1) {
+        return nullptr;
+    }
+
+    jint* ids = env->GetIntArrayElements(handler_ids, nullptr);
+    jlong* hashes = env->GetLongArrayElements(block_pos_hashes, nullptr);
+    jint* offs = env->GetIntArrayElements(out_offsets, nullptr);
+
+    int32_t length = 0;
+    const uint8_t* payload = server_dispatch_block_entity_save_chunk(
+        reinterpret_cast<const int32_t*>(ids),
+        reinterpret_cast<const int64_t*>(hashes),
+        static_cast<int32_t>(count),
+        reinterpret_cast<int32_t*>(offs),
+        &length);
+
+    env->ReleaseIntArrayElements(out_offsets, offs, 0);
+    env->ReleaseLongArrayElements(block_pos_hashes, hashes, JNI_ABORT);
+    env->ReleaseIntArrayElements(handler_ids, ids, JNI_ABORT);
+
+    if (payload == nullptr) return nullptr;
+    jbyteArray result = env->NewByteArray(length);
+    if (result && length > 0) {
+        env->SetByteArrayRegion(result, 0, length, reinterpret_cast<const jbyte*>(payload));
+    }
+    return result;
+}
+
 // ==========================================================================
 // Block Entity Registration Queue JNI Methods
 // ==========================================================================
@@ -1747,8 +2398,7 @@ JNIEXPORT jobjectArray JNICALL Java_com_redstone_DartBridge_getNextBlockEntityRe
     }
 
     // Create Object array with 6 elements
-    jclass objectClass = env->FindClass("java/lang/Object");
-    jobjectArray result = env->NewObjectArray(6, objectClass, nullptr);
+    jobjectArray result = env->NewObjectArray(6, dart_mc_bridge::upcalls().object_class, nullptr);
 
     // Use shared boxing helpers from jni_helpers.h
     env->SetObjectArrayElement(result, 0, boxInt(env, handler_id));
@@ -1803,8 +2453,7 @@ JNIEXPORT jobjectArray JNICALL Java_com_redstone_DartBridge_getNextAnimationRegi
     }
 
     // Create String array with 4 elements
-    jclass stringClass = env->FindClass("java/lang/String");
-    jobjectArray result = env->NewObjectArray(4, stringClass, nullptr);
+    jobjectArray result = env->NewObjectArray(4, dart_mc_bridge::upcalls().string_class, nullptr);
 
     // Convert handler_id to string
     char handler_id_str[32];
@@ -1818,6 +2467,56 @@ JNIEXPORT jobjectArray JNICALL Java_com_redstone_DartBridge_getNextAnimationRegi
     return result;
 }
 
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    hasCompiledAnimation
+ * Signature: (I)Z
+ *
+ * Whether the handler's animation was compiled into a native track.
+ */
+JNIEXPORT jboolean JNICALL Java_com_redstone_DartBridge_hasCompiledAnimation(
+    JNIEnv* /* env */, jclass /* cls */, jint handler_id) {
+    return animation_has_track(handler_id) ? JNI_TRUE : JNI_FALSE;
+}
+
+/*
+ * Class:     com_redstone_DartBridge
+ * Method:    evaluateAnimationTracks
+ * Signature: ([I[F[FI[F)I
+ *
+ * Evaluate count animated block instances into column-major 4x4 matrices
+ * (16 floats each) in outMatrices. posSeeds may be null. Returns the number
+ * of instances that had a compiled track, or -1 if an array is too short.
+ */
+JNIEXPORT jint JNICALL Java_com_redstone_DartBridge_evaluateAnimationTracks(
+    JNIEnv* env, jclass /* cls */, jintArray handler_ids, jfloatArray times,
+    jfloatArray pos_seeds, jint count, jfloatArray out_matrices) {
+    if (handler_ids == nullptr || times == nullptr || out_matrices == nullptr || count <= 0) return 0;
+    if (env->GetArrayLength(handler_ids) < count || env->GetArrayLength(times) < count ||
+        (pos_seeds != nullptr && env->GetArrayLength(pos_seeds) < count) ||
+        env->GetArrayLength(out_matrices) < static_cast<jsize>(count) * ANIMATION_MATRIX_FLOATS) {
+        return -1;
+    }
+
+    // Critical access avoids copying the arrays; nothing below calls back into Java
+    auto* ids = static_cast<jint*>(env->GetPrimitiveArrayCritical(handler_ids, nullptr));
+    auto* t = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(times, nullptr));
+    auto* seeds = pos_seeds != nullptr
+        ? static_cast<jfloat*>(env->GetPrimitiveArrayCritical(pos_seeds, nullptr)) : nullptr;
+    auto* out = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(out_matrices, nullptr));
+
+    int32_t evaluated = 0;
+    if (ids != nullptr && t != nullptr && out != nullptr && (pos_seeds == nullptr || seeds != nullptr)) {
+        evaluated = animation_evaluate_batch(reinterpret_cast<const int32_t*>(ids), t, seeds, count, out);
+    }
+
+    if (out != nullptr) env->ReleasePrimitiveArrayCritical(out_matrices, out, 0);
+    if (seeds != nullptr) env->ReleasePrimitiveArrayCritical(pos_seeds, seeds, JNI_ABORT);
+    if (t != nullptr) env->ReleasePrimitiveArrayCritical(times, t, JNI_ABORT);
+    if (ids != nullptr) env->ReleasePrimitiveArrayCritical(handler_ids, ids, JNI_ABORT);
+    return evaluated;
+}
+
 // ==========================================================================
 // Ore Feature Registration Queue JNI Entry Points
 // ==========================================================================
@@ -1879,8 +2578,7 @@ JNIEXPORT jobjectArray JNICALL Java_com_redstone_DartBridge_getNextOreFeatureReg
     }
 
     // Create Object array with 13 elements
-    jclass objectClass = env->FindClass("java/lang/Object");
-    jobjectArray result = env->NewObjectArray(13, objectClass, nullptr);
+    jobjectArray result = env->NewObjectArray(13, dart_mc_bridge::upcalls().object_class, nullptr);
 
     // Use shared boxing helpers from jni_helpers.h
     env->SetObjectArrayElement(result, 0, boxLong(env, static_cast<jlong>(handler_id)));
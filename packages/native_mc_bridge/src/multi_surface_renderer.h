@@ -14,7 +14,10 @@
 // Flutter views simultaneously (e.g., in-world HUDs, multiple screens).
 //
 // Architecture:
-// - Uses FlutterEngineGroup to spawn child engines (sharing GPU context/fonts)
+// - Child engines are spawned from the main one (dart_client_spawn_surface):
+//   they share the process Dart VM, the main engine's AOT data, the assets
+//   and ICU paths and the Metal device/queue. The embedder API has no
+//   isolate-group spawn, so each surface still gets its own root isolate.
 // - Each surface has its own IOSurface (macOS) for Metal->OpenGL sharing
 // - Surfaces are identified by unique int64_t IDs
 //
@@ -115,7 +118,7 @@ void multi_surface_send_key_event(int64_t surface_id, int32_t type, int64_t phys
 
 // Initialize the multi-surface system.
 // This should be called after the main Flutter engine is initialized.
-// Uses the main engine as the parent for FlutterEngineGroup.
+// Surfaces are normally spawned through dart_client_spawn_surface().
 bool multi_surface_init();
 
 // Shutdown the multi-surface system and destroy all surfaces.
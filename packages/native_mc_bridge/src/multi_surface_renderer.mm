@@ -352,9 +352,8 @@ extern "C" bool multi_surface_is_initialized() {
 // Surface Management
 // ==========================================================================
 
-// External: Get Flutter assets path from main client runtime
-extern const char* dart_client_get_assets_path();
-extern const char* dart_client_get_icu_path();
+// External: main engine AOT data (dart_bridge_client.cpp)
+extern "C" void* dart_client_get_aot_data();
 
 extern "C" int64_t multi_surface_create(int32_t width, int32_t height, const char* initial_route) {
     if (!g_multi_surface_initialized.load()) {
@@ -400,6 +399,14 @@ extern "C" int64_t multi_surface_create(int32_t width, int32_t height, const cha
     args.assets_path = g_assets_path.c_str();
     args.icu_data_path = g_icu_data_path.c_str();
 
+    // Share the main engine's AOT snapshot (mapped once) instead of loading
+    // another copy; in JIT mode this is null and the kernel blob is used.
+    args.aot_data = static_cast<FlutterEngineAOTData>(dart_client_get_aot_data());
+    if (args.aot_data == nullptr && FlutterEngineRunsAOTCompiledDartCode()) {
+        std::cerr << "[MultiSurface] Main engine has no AOT data to share" << std::endl;
+        return 0;
+    }
+
     // Use surfaceMain as the entry point for spawned surfaces
     // This allows them to run independent widget content
     args.custom_dart_entrypoint = "surfaceMain";
@@ -0,0 +1,290 @@
+#include "outbound_queue.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <iostream>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+
+struct QueuedPacket {
+    int32_t packet_type;
+    int64_t merge_key;
+    std::vector<uint8_t> data;
+};
+
+struct PlayerQueue {
+    std::list<QueuedPacket> queues[OUTBOUND_PRIORITY_COUNT];
+    std::unordered_map<int64_t, std::list<QueuedPacket>::iterator> bulk_by_key;
+    int64_t queued_packets = 0;
+    int64_t queued_bytes = 0;
+    int64_t budget_used = 0;  // Gameplay + bulk bytes taken this tick
+    int64_t stats[OUTBOUND_STAT_COUNT] = {};
+};
+
+std::mutex g_outbound_mutex;
+std::condition_variable g_outbound_cv;
+bool g_outbound_enabled = false;
+int64_t g_tick_budget = OUTBOUND_DEFAULT_TICK_BUDGET;
+int64_t g_max_queued = OUTBOUND_DEFAULT_MAX_QUEUED;
+std::unordered_map<int32_t, PlayerQueue> g_players;
+int64_t g_removed_stats[OUTBOUND_STAT_COUNT] = {};  // Counters of departed players
+std::unordered_set<int32_t> g_removed_players;     // Pushes for these are refused until they rejoin
+size_t g_take_cursor = 0;  // Rotates the first player served by each take
+
+bool under_budget(const PlayerQueue& queue) {
+    return g_tick_budget <= 0 || queue.budget_used < g_tick_budget;
+}
+
+// Highest-priority queue with a sendable packet, or -1
+int sendable_priority(const PlayerQueue& queue) {
+    if (!queue.queues[OUTBOUND_PRIORITY_CONTROL].empty()) return OUTBOUND_PRIORITY_CONTROL;
+    if (!under_budget(queue)) return -1;
+    if (!queue.queues[OUTBOUND_PRIORITY_GAMEPLAY].empty()) return OUTBOUND_PRIORITY_GAMEPLAY;
+    if (!queue.queues[OUTBOUND_PRIORITY_BULK].empty()) return OUTBOUND_PRIORITY_BULK;
+    return -1;
+}
+
+bool any_sendable_locked() {
+    for (const auto& entry : g_players) {
+        if (sendable_priority(entry.second) >= 0) return true;
+    }
+    return false;
+}
+
+// Unlink the front packet of a priority queue, keeping the counters in step
+QueuedPacket pop_front(PlayerQueue& queue, int priority) {
+    auto& list = queue.queues[priority];
+    if (priority == OUTBOUND_PRIORITY_BULK && list.front().merge_key != 0) {
+        queue.bulk_by_key.erase(list.front().merge_key);
+    }
+    QueuedPacket packet = std::move(list.front());
+    list.pop_front();
+    queue.queued_packets--;
+    queue.queued_bytes -= static_cast<int64_t>(packet.data.size());
+    return packet;
+}
+
+// Drop the oldest packets of priority >= lowest_droppable (bulk first) until
+// needed bytes fit. Returns false if they still do not fit.
+bool make_room(PlayerQueue& queue, int64_t needed, int lowest_droppable) {
+    for (int priority = OUTBOUND_PRIORITY_COUNT - 1; priority >= lowest_droppable; priority--) {
+        while (queue.queued_bytes + needed > g_max_queued && !queue.queues[priority].empty()) {
+            QueuedPacket dropped = pop_front(queue, priority);
+            queue.stats[OUTBOUND_STAT_DROPPED_PACKETS]++;
+            queue.stats[OUTBOUND_STAT_DROPPED_BYTES] += static_cast<int64_t>(dropped.data.size());
+        }
+    }
+    return queue.queued_bytes + needed <= g_max_queued;
+}
+
+void clear_locked() {
+    for (auto& entry : g_players) {
+        for (int i = 0; i < OUTBOUND_STAT_COUNT; i++) {
+            g_removed_stats[i] += entry.second.stats[i];
+        }
+        g_removed_stats[OUTBOUND_STAT_DROPPED_PACKETS] += entry.second.queued_packets;
+        g_removed_stats[OUTBOUND_STAT_DROPPED_BYTES] += entry.second.queued_bytes;
+    }
+    g_players.clear();
+    g_removed_players.clear();
+}
+
+} // namespace
+
+namespace dart_mc_bridge {
+
+size_t outboundQueueTake(std::vector<OutboundPacket>& out, size_t max_bytes) {
+    std::lock_guard<std::mutex> lock(g_outbound_mutex);
+    if (g_players.empty()) return 0;
+
+    // One packet per player per pass so a backed-up player cannot starve the others
+    std::vector<std::pair<int32_t, PlayerQueue*>> players;
+    players.reserve(g_players.size());
+    for (auto& entry : g_players) {
+        players.emplace_back(entry.first, &entry.second);
+    }
+    size_t start = g_take_cursor++ % players.size();
+
+    size_t taken = 0;
+    size_t taken_bytes = 0;
+    bool progress = true;
+    while (progress && (taken == 0 || taken_bytes < max_bytes)) {
+        progress = false;
+        for (size_t n = 0; n < players.size(); n++) {
+            if (taken > 0 && taken_bytes >= max_bytes) break;
+            auto& player = players[(start + n) % players.size()];
+            PlayerQueue& queue = *player.second;
+            int priority = sendable_priority(queue);
+            if (priority < 0) continue;
+
+            QueuedPacket packet = pop_front(queue, priority);
+            int64_t size = static_cast<int64_t>(packet.data.size());
+            if (priority != OUTBOUND_PRIORITY_CONTROL) queue.budget_used += size;
+            queue.stats[OUTBOUND_STAT_SENT_PACKETS]++;
+            queue.stats[OUTBOUND_STAT_SENT_BYTES] += size;
+
+            out.push_back({player.first, packet.packet_type, std::move(packet.data)});
+            taken++;
+            taken_bytes += static_cast<size_t>(size);
+            progress = true;
+        }
+    }
+    return taken;
+}
+
+} // namespace dart_mc_bridge
+
+extern "C" {
+
+void outbound_queue_set_enabled(bool enabled) {
+    {
+        std::lock_guard<std::mutex> lock(g_outbound_mutex);
+        if (g_outbound_enabled == enabled) return;
+        g_outbound_enabled = enabled;
+        if (!enabled) clear_locked();
+    }
+    g_outbound_cv.notify_all();
+    std::cout << "Outbound packet queue " << (enabled ? "enabled" : "disabled") << std::endl;
+}
+
+bool outbound_queue_is_enabled() {
+    std::lock_guard<std::mutex> lock(g_outbound_mutex);
+    return g_outbound_enabled;
+}
+
+void outbound_queue_set_limits(int64_t tick_budget_bytes, int64_t max_queued_bytes) {
+    std::lock_guard<std::mutex> lock(g_outbound_mutex);
+    g_tick_budget = tick_budget_bytes > 0 ? tick_budget_bytes : 0;
+    if (max_queued_bytes > 0) g_max_queued = max_queued_bytes;
+}
+
+bool outbound_queue_push(int32_t player_id, int32_t packet_type, int32_t priority,
+                         int64_t merge_key, const uint8_t* data, int32_t data_length) {
+    if (priority < 0 || priority >= OUTBOUND_PRIORITY_COUNT || data_length < 0) return false;
+    if (data_length > 0 && data == nullptr) return false;
+    int64_t size = data_length;
+
+    {
+        std::lock_guard<std::mutex> lock(g_outbound_mutex);
+        if (!g_outbound_enabled) return false;
+        // A late packet for a departed player would recreate a queue nobody drains
+        if (!g_removed_players.empty() && g_removed_players.count(player_id) != 0) {
+            g_removed_stats[OUTBOUND_STAT_DROPPED_PACKETS]++;
+            g_removed_stats[OUTBOUND_STAT_DROPPED_BYTES] += size;
+            return false;
+        }
+        PlayerQueue& queue = g_players[player_id];
+
+        // A newer bulk update supersedes the queued one with the same key
+        if (priority == OUTBOUND_PRIORITY_BULK && merge_key != 0) {
+            auto existing = queue.bulk_by_key.find(merge_key);
+            if (existing != queue.bulk_by_key.end()) {
+                QueuedPacket& packet = *existing->second;
+                int64_t growth = size - static_cast<int64_t>(packet.data.size());
+                queue.stats[OUTBOUND_STAT_MERGED_PACKETS]++;
+                if (queue.queued_bytes + growth <= g_max_queued) {
+                    queue.queued_bytes += growth;
+                    packet.packet_type = packet_type;
+                    packet.data.assign(data, data + data_length);
+                    return true;
+                }
+                // Larger update over the limit: drop the superseded packet and
+                // queue this one like a new packet (which may make room or refuse it)
+                queue.queued_packets--;
+                queue.queued_bytes -= static_cast<int64_t>(packet.data.size());
+                queue.queues[OUTBOUND_PRIORITY_BULK].erase(existing->second);
+                queue.bulk_by_key.erase(existing);
+            }
+        }
+
+        // Control packets may evict anything else but are never refused
+        if (!make_room(queue, size, priority == OUTBOUND_PRIORITY_CONTROL ? OUTBOUND_PRIORITY_GAMEPLAY : priority) &&
+            priority != OUTBOUND_PRIORITY_CONTROL) {
+            queue.stats[OUTBOUND_STAT_DROPPED_PACKETS]++;
+            queue.stats[OUTBOUND_STAT_DROPPED_BYTES] += size;
+            return false;
+        }
+
+        auto& list = queue.queues[priority];
+        list.push_back({packet_type, merge_key, std::vector<uint8_t>(data, data + data_length)});
+        if (priority == OUTBOUND_PRIORITY_BULK && merge_key != 0) {
+            queue.bulk_by_key[merge_key] = std::prev(list.end());
+        }
+        queue.queued_packets++;
+        queue.queued_bytes += size;
+    }
+    g_outbound_cv.notify_one();
+    return true;
+}
+
+void outbound_queue_begin_tick() {
+    {
+        std::lock_guard<std::mutex> lock(g_outbound_mutex);
+        if (!g_outbound_enabled) return;
+        for (auto& entry : g_players) {
+            entry.second.budget_used = 0;
+        }
+    }
+    g_outbound_cv.notify_one();
+}
+
+bool outbound_queue_wait(int32_t timeout_ms) {
+    std::unique_lock<std::mutex> lock(g_outbound_mutex);
+    g_outbound_cv.wait_for(lock, std::chrono::milliseconds(timeout_ms > 0 ? timeout_ms : 0),
+                           [] { return any_sendable_locked(); });
+    return any_sendable_locked();
+}
+
+void outbound_queue_add_player(int32_t player_id) {
+    std::lock_guard<std::mutex> lock(g_outbound_mutex);
+    g_removed_players.erase(player_id);
+}
+
+void outbound_queue_remove_player(int32_t player_id) {
+    std::lock_guard<std::mutex> lock(g_outbound_mutex);
+    if (g_outbound_enabled) g_removed_players.insert(player_id);
+    auto it = g_players.find(player_id);
+    if (it == g_players.end()) return;
+    for (int i = 0; i < OUTBOUND_STAT_COUNT; i++) {
+        g_removed_stats[i] += it->second.stats[i];
+    }
+    g_removed_stats[OUTBOUND_STAT_DROPPED_PACKETS] += it->second.queued_packets;
+    g_removed_stats[OUTBOUND_STAT_DROPPED_BYTES] += it->second.queued_bytes;
+    g_players.erase(it);
+}
+
+int32_t outbound_queue_stats(int32_t player_id, int64_t* out, int32_t count) {
+    if (out == nullptr || count <= 0) return 0;
+    int64_t values[OUTBOUND_STAT_COUNT] = {};
+
+    {
+        std::lock_guard<std::mutex> lock(g_outbound_mutex);
+        auto add = [&values](const PlayerQueue& queue) {
+            for (int i = 0; i < OUTBOUND_STAT_COUNT; i++) {
+                values[i] += queue.stats[i];
+            }
+            values[OUTBOUND_STAT_QUEUED_PACKETS] += queue.queued_packets;
+            values[OUTBOUND_STAT_QUEUED_BYTES] += queue.queued_bytes;
+        };
+        if (player_id < 0) {
+            std::memcpy(values, g_removed_stats, sizeof(values));
+            for (const auto& entry : g_players) {
+                add(entry.second);
+            }
+        } else {
+            auto it = g_players.find(player_id);
+            if (it != g_players.end()) add(it->second);
+        }
+    }
+
+    int32_t written = count < OUTBOUND_STAT_COUNT ? count : OUTBOUND_STAT_COUNT;
+    std::memcpy(out, values, sizeof(int64_t) * static_cast<size_t>(written));
+    return written;
+}
+
+} // extern "C"
@@ -0,0 +1,102 @@
+#ifndef OUTBOUND_QUEUE_H
+#define OUTBOUND_QUEUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ==========================================================================
+// Outbound Packet Queue (S2C)
+// ==========================================================================
+// Dart queues server-to-client packets here instead of calling into Java on
+// the server thread. A Java sender thread (OutboundPacketSender) waits on
+// the queue and hands the packets to the network layer.
+//
+// Each player has one queue per priority class. Draining takes control
+// packets first, then gameplay, then bulk. Gameplay and bulk packets count
+// against a per-player byte budget that resets every server tick; control
+// packets ignore it. Packets over budget wait for the next tick.
+//
+// Memory is bounded per player. When a new packet would exceed the limit,
+// the oldest queued packets of the same or lower priority are dropped, bulk
+// first. If that is not enough, the new packet is dropped. Control packets
+// are never dropped. A bulk packet with a non-zero merge key replaces a queued
+// bulk packet with the same key for that player (a superseded update), so
+// it keeps the older packet's place in the queue. If the larger update would
+// exceed the limit, the superseded packet is dropped and the update is
+// queued like a new packet.
+//
+// The queue starts disabled. While it is disabled,
+// server_send_packet_to_client calls the Java send callback synchronously.
+// ==========================================================================
+
+// Priority classes - must match OutboundPacketSender.java and network.dart
+#define OUTBOUND_PRIORITY_CONTROL 0
+#define OUTBOUND_PRIORITY_GAMEPLAY 1
+#define OUTBOUND_PRIORITY_BULK 2
+#define OUTBOUND_PRIORITY_COUNT 3
+
+// Defaults, overridable with outbound_queue_set_limits()
+#define OUTBOUND_DEFAULT_TICK_BUDGET (256 * 1024)          // bytes per player per tick
+#define OUTBOUND_DEFAULT_MAX_QUEUED (4 * 1024 * 1024)      // bytes per player
+
+// outbound_queue_stats() slots
+#define OUTBOUND_STAT_QUEUED_PACKETS 0
+#define OUTBOUND_STAT_QUEUED_BYTES 1
+#define OUTBOUND_STAT_SENT_PACKETS 2
+#define OUTBOUND_STAT_SENT_BYTES 3
+#define OUTBOUND_STAT_DROPPED_PACKETS 4
+#define OUTBOUND_STAT_DROPPED_BYTES 5
+#define OUTBOUND_STAT_MERGED_PACKETS 6
+#define OUTBOUND_STAT_COUNT 7
+
+namespace dart_mc_bridge {
+
+struct OutboundPacket {
+    int32_t player_id;
+    int32_t packet_type;
+    std::vector<uint8_t> data;
+};
+
+// Move up to max_bytes of sendable packets into out (sender thread), always
+// taking at least one packet if any is sendable. Returns the number taken.
+size_t outboundQueueTake(std::vector<OutboundPacket>& out, size_t max_bytes);
+
+} // namespace dart_mc_bridge
+
+extern "C" {
+
+// Start or stop queueing. Disabling discards queued packets.
+void outbound_queue_set_enabled(bool enabled);
+bool outbound_queue_is_enabled();
+
+// Per-player byte budget per tick (0 = unlimited) and queued-bytes limit
+void outbound_queue_set_limits(int64_t tick_budget_bytes, int64_t max_queued_bytes);
+
+// Queue a packet. Returns false if it was dropped (queue disabled, invalid
+// priority, or the player's queue is full).
+bool outbound_queue_push(int32_t player_id, int32_t packet_type, int32_t priority,
+                         int64_t merge_key, const uint8_t* data, int32_t data_length);
+
+// Reset the per-tick byte budgets and wake the sender (server thread)
+void outbound_queue_begin_tick();
+
+// Block until a packet is sendable or timeout_ms passes. Returns true if
+// packets are sendable.
+bool outbound_queue_wait(int32_t timeout_ms);
+
+// Accept packets for a player again after outbound_queue_remove_player (join)
+void outbound_queue_add_player(int32_t player_id);
+
+// Discard a player's queue (disconnect). Their counters are folded into the
+// totals (queued packets count as dropped), and later pushes for the player
+// are refused until outbound_queue_add_player.
+void outbound_queue_remove_player(int32_t player_id);
+
+// Fill out[0..count) with OUTBOUND_STAT_* values for one player, or totals
+// across all players for player_id < 0. Returns the number of slots written.
+int32_t outbound_queue_stats(int32_t player_id, int64_t* out, int32_t count);
+
+} // extern "C"
+
+#endif // OUTBOUND_QUEUE_H
@@ -0,0 +1,134 @@
+#include "packet_schema.h"
+
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+struct SchemaLayout {
+    std::vector<uint8_t> field_types;
+    uint16_t fingerprint = 0;
+    int32_t fixed_size = 0;       // Header + fixed fields + end table
+    int32_t end_table_offset = 0;
+    int32_t var_count = 0;
+};
+
+std::mutex g_schema_mutex;
+std::unordered_map<int32_t, SchemaLayout> g_schemas;
+
+// Field size in bytes, 0 for variable fields, -1 if unknown
+int32_t field_size(uint8_t type) {
+    switch (type) {
+        case PACKET_FIELD_BOOL: return 1;
+        case PACKET_FIELD_U8: return 1;
+        case PACKET_FIELD_I16: return 2;
+        case PACKET_FIELD_I32: return 4;
+        case PACKET_FIELD_I64: return 8;
+        case PACKET_FIELD_F32: return 4;
+        case PACKET_FIELD_F64: return 8;
+        case PACKET_FIELD_STRING: return 0;
+        case PACKET_FIELD_BYTES: return 0;
+        default: return -1;
+    }
+}
+
+// FNV-1a over the id and field types, folded to 16 bits
+uint16_t layout_fingerprint(int32_t schema_id, const std::vector<uint8_t>& types) {
+    uint32_t hash = 2166136261u;
+    auto mix = [&hash](uint8_t byte) {
+        hash ^= byte;
+        hash *= 16777619u;
+    };
+    mix(static_cast<uint8_t>(schema_id & 0xFF));
+    mix(static_cast<uint8_t>((schema_id >> 8) & 0xFF));
+    for (uint8_t type : types) mix(type);
+    return static_cast<uint16_t>((hash ^ (hash >> 16)) & 0xFFFF);
+}
+
+uint16_t read_u16(const uint8_t* p) {
+    uint16_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+uint32_t read_u32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+} // namespace
+
+extern "C" {
+
+int32_t packet_schema_register(int32_t schema_id, const uint8_t* field_types, int32_t field_count,
+                               int32_t* out_offsets, int32_t* out_fingerprint) {
+    if (schema_id < 0 || schema_id > PACKET_SCHEMA_MAX_ID) return -1;
+    if (field_count < 0 || field_count > PACKET_SCHEMA_MAX_FIELDS) return -1;
+    if (field_count > 0 && (field_types == nullptr || out_offsets == nullptr)) return -1;
+
+    SchemaLayout layout;
+    layout.field_types.assign(field_types, field_types + field_count);
+
+    // Fixed fields largest first, then the end table for variable fields
+    int32_t offset = PACKET_SCHEMA_HEADER_SIZE;
+    for (int32_t size : {8, 4, 2, 1}) {
+        for (int32_t i = 0; i < field_count; i++) {
+            int32_t s = field_size(field_types[i]);
+            if (s < 0) return -1;
+            if (s != size) continue;
+            out_offsets[i] = offset;
+            offset += size;
+        }
+    }
+    layout.end_table_offset = offset;
+    for (int32_t i = 0; i < field_count; i++) {
+        if (field_size(field_types[i]) != 0) continue;
+        out_offsets[i] = offset;
+        offset += 4;
+        layout.var_count++;
+    }
+    layout.fixed_size = offset;
+    layout.fingerprint = layout_fingerprint(schema_id, layout.field_types);
+    if (out_fingerprint) *out_fingerprint = layout.fingerprint;
+
+    std::lock_guard<std::mutex> lock(g_schema_mutex);
+    auto it = g_schemas.find(schema_id);
+    if (it != g_schemas.end()) {
+        if (it->second.field_types == layout.field_types) return layout.fixed_size;
+        std::cerr << "[PacketSchema] Schema " << schema_id << " re-registered with a different layout" << std::endl;
+    }
+    g_schemas[schema_id] = std::move(layout);
+    return offset;
+}
+
+int32_t packet_schema_validate(const uint8_t* data, int32_t length) {
+    if (data == nullptr || length < PACKET_SCHEMA_HEADER_SIZE) return -1;
+    int32_t schema_id = read_u16(data);
+    uint16_t fingerprint = read_u16(data + 2);
+
+    std::lock_guard<std::mutex> lock(g_schema_mutex);
+    auto it = g_schemas.find(schema_id);
+    if (it == g_schemas.end()) return -1;
+    const SchemaLayout& layout = it->second;
+    if (fingerprint != layout.fingerprint || length < layout.fixed_size) return -1;
+
+    uint32_t var_length = static_cast<uint32_t>(length - layout.fixed_size);
+    uint32_t previous_end = 0;
+    for (int32_t i = 0; i < layout.var_count; i++) {
+        uint32_t end = read_u32(data + layout.end_table_offset + i * 4);
+        if (end < previous_end || end > var_length) return -1;
+        previous_end = end;
+    }
+    return previous_end == var_length ? schema_id : -1;
+}
+
+int32_t packet_schema_count() {
+    std::lock_guard<std::mutex> lock(g_schema_mutex);
+    return static_cast<int32_t>(g_schemas.size());
+}
+
+} // extern "C"
@@ -0,0 +1,82 @@
+#ifndef PACKET_SCHEMA_H
+#define PACKET_SCHEMA_H
+
+#include <cstdint>
+
+// ==========================================================================
+// Fixed-Layout Packet Schemas
+// ==========================================================================
+// Mods declare a packet's fields once at startup (PacketSchema in
+// dart_mod_common). Both the server and client isolates register the same
+// schema here. The bridge computes the layout and returns every field's
+// offset, so Dart encodes and reads fields with plain ByteData accesses at
+// fixed positions. Nothing is parsed on receive, and field names never go on
+// the wire, only the schema id.
+//
+// Schema packets use their own packet types (PACKET_SCHEMA_S2C and
+// PACKET_SCHEMA_C2S). The bridge validates them before they reach Dart.
+//
+// Payload layout, little-endian, no padding:
+//   u16 schema id
+//   u16 layout fingerprint (of the id and field types; catches mismatched
+//       declarations between server and client)
+//   fixed fields, sorted by size (8, 4, 2, 1 bytes), declaration order within
+//       a size
+//   u32 end offset per variable field, relative to the variable section
+//   variable section: each variable field's bytes, in declaration order
+//
+// For a fixed field the returned offset is its byte offset in the payload.
+// For a variable field it is the byte offset of its u32 end entry. The field's
+// bytes start at the previous variable field's end (0 for the first one).
+//
+//   type                     size
+//   PACKET_FIELD_BOOL        1 (0 or 1)
+//   PACKET_FIELD_U8          1
+//   PACKET_FIELD_I16         2
+//   PACKET_FIELD_I32         4
+//   PACKET_FIELD_I64         8
+//   PACKET_FIELD_F32         4
+//   PACKET_FIELD_F64         8
+//   PACKET_FIELD_STRING      variable, UTF-8
+//   PACKET_FIELD_BYTES       variable
+// ==========================================================================
+
+#define PACKET_SCHEMA_S2C 0x7F
+#define PACKET_SCHEMA_C2S 0xFF
+
+#define PACKET_SCHEMA_HEADER_SIZE 4
+#define PACKET_SCHEMA_MAX_ID 0xFFFF
+#define PACKET_SCHEMA_MAX_FIELDS 64
+
+#define PACKET_FIELD_BOOL 1
+#define PACKET_FIELD_U8 2
+#define PACKET_FIELD_I16 3
+#define PACKET_FIELD_I32 4
+#define PACKET_FIELD_I64 5
+#define PACKET_FIELD_F32 6
+#define PACKET_FIELD_F64 7
+#define PACKET_FIELD_STRING 8
+#define PACKET_FIELD_BYTES 9
+
+extern "C" {
+
+// Register (or re-register) a schema and compute its layout. field_types has
+// field_count PACKET_FIELD_* codes in declaration order. Writes each field's
+// offset to out_offsets and the layout fingerprint to out_fingerprint.
+// Returns the size of the fixed part (header, fixed fields and end table),
+// or -1 if the id or a field type is invalid. Registering an identical
+// layout again is a no-op.
+int32_t packet_schema_register(int32_t schema_id, const uint8_t* field_types, int32_t field_count,
+                               int32_t* out_offsets, int32_t* out_fingerprint);
+
+// Check a schema packet payload against its registered layout: known schema,
+// matching fingerprint, end offsets in order and covering the payload
+// exactly. Returns the schema id, or -1.
+int32_t packet_schema_validate(const uint8_t* data, int32_t length);
+
+// Number of registered schemas.
+int32_t packet_schema_count();
+
+} // extern "C"
+
+#endif // PACKET_SCHEMA_H
@@ -0,0 +1,270 @@
+#include "thread_roles.h"
+
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#elif defined(__APPLE__)
+#include <pthread.h>
+#include <pthread/qos.h>
+#else
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+struct RolePolicy {
+    int32_t nice_value = THREAD_ROLE_NICE_UNSET;
+    uint64_t affinity_mask = 0;
+    uint32_t generation = 0;  // Bumped on every configure
+};
+
+#ifdef _WIN32
+using NativeThread = HANDLE;
+#elif defined(__APPLE__)
+using NativeThread = pthread_t;
+#else
+using NativeThread = pid_t;
+#endif
+
+struct TaggedThread {
+    int32_t role;
+    NativeThread thread;
+};
+
+const char* const kRoleNames[THREAD_ROLE_COUNT] = {
+    "server-tick", "render", "dart-worker", "flutter-raster", "bridge-background",
+};
+
+std::mutex g_roles_mutex;
+RolePolicy g_policies[THREAD_ROLE_COUNT];
+std::vector<TaggedThread> g_tagged;  // Threads to re-apply on reconfigure
+bool g_env_loaded = false;
+
+thread_local int32_t t_role = -1;
+thread_local uint32_t t_generation = 0;
+thread_local NativeThread t_thread{};  // Valid while t_role >= 0
+
+NativeThread current_native_thread() {
+#ifdef _WIN32
+    HANDLE handle = nullptr;
+    DuplicateHandle(GetCurrentProcess(), GetCurrentThread(), GetCurrentProcess(), &handle,
+                    THREAD_SET_INFORMATION | THREAD_QUERY_INFORMATION, FALSE, 0);
+    return handle;
+#elif defined(__APPLE__)
+    return pthread_self();
+#else
+    return static_cast<pid_t>(::syscall(SYS_gettid));
+#endif
+}
+
+// Apply a policy to a thread. On macOS only the calling thread can be changed.
+bool apply_policy(const RolePolicy& policy, NativeThread thread, bool is_current) {
+    bool ok = true;
+#ifdef _WIN32
+    if (thread == nullptr) return false;
+    if (policy.nice_value != THREAD_ROLE_NICE_UNSET) {
+        int priority = policy.nice_value <= -15 ? THREAD_PRIORITY_HIGHEST
+                     : policy.nice_value <= -5  ? THREAD_PRIORITY_ABOVE_NORMAL
+                     : policy.nice_value < 5    ? THREAD_PRIORITY_NORMAL
+                     : policy.nice_value < 15   ? THREAD_PRIORITY_BELOW_NORMAL
+                                                : THREAD_PRIORITY_LOWEST;
+        ok &= SetThreadPriority(thread, priority) != 0;
+    }
+    if (policy.affinity_mask != 0) {
+        ok &= SetThreadAffinityMask(thread, static_cast<DWORD_PTR>(policy.affinity_mask)) != 0;
+    }
+#elif defined(__APPLE__)
+    (void)thread;
+    if (is_current && policy.nice_value != THREAD_ROLE_NICE_UNSET) {
+        qos_class_t qos = policy.nice_value <= -10 ? QOS_CLASS_USER_INTERACTIVE
+                        : policy.nice_value < 0    ? QOS_CLASS_USER_INITIATED
+                        : policy.nice_value < 10   ? QOS_CLASS_UTILITY
+                                                   : QOS_CLASS_BACKGROUND;
+        ok &= pthread_set_qos_class_self_np(qos, 0) == 0;
+    }
+#else
+    (void)is_current;
+    if (policy.nice_value != THREAD_ROLE_NICE_UNSET) {
+        // Per-thread on Linux: PRIO_PROCESS with a tid targets that thread.
+        // Negative values need CAP_SYS_NICE (or a raised RLIMIT_NICE).
+        ok &= ::setpriority(PRIO_PROCESS, static_cast<id_t>(thread), policy.nice_value) == 0;
+    }
+    if (policy.affinity_mask != 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; cpu++) {
+            if (policy.affinity_mask & (1ULL << cpu)) CPU_SET(cpu, &set);
+        }
+        ok &= ::sched_setaffinity(thread, sizeof(set), &set) == 0;
+    }
+#endif
+    return ok;
+}
+
+// Untags the thread when it exits: removes it from g_tagged and, on Windows,
+// closes its duplicated handle
+struct TagGuard {
+    bool tagged = false;
+
+    ~TagGuard() {
+        if (!tagged) return;
+        std::lock_guard<std::mutex> lock(g_roles_mutex);
+        for (auto it = g_tagged.begin(); it != g_tagged.end(); ++it) {
+            if (it->thread == t_thread) {
+#ifdef _WIN32
+                CloseHandle(it->thread);
+#endif
+                g_tagged.erase(it);
+                break;
+            }
+        }
+    }
+};
+
+thread_local TagGuard t_tag_guard;
+
+int32_t role_by_name(const std::string& name) {
+    for (int32_t i = 0; i < THREAD_ROLE_COUNT; i++) {
+        if (name == kRoleNames[i]) return i;
+    }
+    return -1;
+}
+
+// "0-3+6" -> bits 0,1,2,3,6
+uint64_t parse_cpu_list(const std::string& list) {
+    uint64_t mask = 0;
+    size_t pos = 0;
+    while (pos < list.size()) {
+        size_t end = list.find('+', pos);
+        if (end == std::string::npos) end = list.size();
+        std::string range = list.substr(pos, end - pos);
+        size_t dash = range.find('-');
+        int first = std::atoi(range.c_str());
+        int last = dash == std::string::npos ? first : std::atoi(range.c_str() + dash + 1);
+        for (int cpu = first; cpu <= last && cpu < 64; cpu++) {
+            if (cpu >= 0) mask |= 1ULL << cpu;
+        }
+        pos = end + 1;
+    }
+    return mask;
+}
+
+// REDSTONE_THREAD_ROLES="role:nice=N,cpus=A-B+C;role:..." (caller holds g_roles_mutex)
+void load_env_locked() {
+    g_env_loaded = true;
+    const char* env = std::getenv("REDSTONE_THREAD_ROLES");
+    if (env == nullptr || env[0] == '\0') return;
+
+    std::string spec(env);
+    size_t pos = 0;
+    while (pos < spec.size()) {
+        size_t end = spec.find(';', pos);
+        if (end == std::string::npos) end = spec.size();
+        std::string entry = spec.substr(pos, end - pos);
+        pos = end + 1;
+
+        size_t colon = entry.find(':');
+        int32_t role = role_by_name(entry.substr(0, colon));
+        if (role < 0 || colon == std::string::npos) {
+            std::cerr << "REDSTONE_THREAD_ROLES: ignoring '" << entry << "'" << std::endl;
+            continue;
+        }
+
+        RolePolicy& policy = g_policies[role];
+        std::string settings = entry.substr(colon + 1);
+        size_t setting_pos = 0;
+        while (setting_pos < settings.size()) {
+            size_t setting_end = settings.find(',', setting_pos);
+            if (setting_end == std::string::npos) setting_end = settings.size();
+            std::string setting = settings.substr(setting_pos, setting_end - setting_pos);
+            setting_pos = setting_end + 1;
+
+            if (setting.rfind("nice=", 0) == 0) {
+                policy.nice_value = std::atoi(setting.c_str() + 5);
+            } else if (setting.rfind("cpus=", 0) == 0) {
+                policy.affinity_mask = parse_cpu_list(setting.substr(5));
+            }
+        }
+        policy.generation++;
+        std::cout << "Thread role " << kRoleNames[role] << ": nice="
+                  << (policy.nice_value == THREAD_ROLE_NICE_UNSET ? std::string("unset")
+                                                                  : std::to_string(policy.nice_value))
+                  << " affinity=0x" << std::hex << policy.affinity_mask << std::dec << std::endl;
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+bool thread_role_configure(int32_t role, int32_t nice_value, uint64_t affinity_mask) {
+    if (role < 0 || role >= THREAD_ROLE_COUNT) return false;
+    std::lock_guard<std::mutex> lock(g_roles_mutex);
+    if (!g_env_loaded) load_env_locked();
+
+    RolePolicy& policy = g_policies[role];
+    policy.nice_value = nice_value;
+    policy.affinity_mask = affinity_mask;
+    policy.generation++;
+
+    for (const TaggedThread& tagged : g_tagged) {
+        if (tagged.role == role) {
+            apply_policy(policy, tagged.thread, false);
+        }
+    }
+    // The calling thread picks up the change on its next thread_role_apply()
+    return true;
+}
+
+bool thread_role_apply(int32_t role) {
+    if (role < 0 || role >= THREAD_ROLE_COUNT) return false;
+    std::lock_guard<std::mutex> lock(g_roles_mutex);
+    if (!g_env_loaded) load_env_locked();
+
+    const RolePolicy& policy = g_policies[role];
+    if (t_role == role && t_generation == policy.generation) return true;
+
+    if (t_role < 0) {
+        t_thread = current_native_thread();
+        g_tagged.push_back({role, t_thread});
+        t_tag_guard.tagged = true;
+    } else {
+        for (TaggedThread& tagged : g_tagged) {
+            if (tagged.thread == t_thread) tagged.role = role;
+        }
+    }
+    t_role = role;
+    t_generation = policy.generation;
+
+    bool ok = apply_policy(policy, t_thread, true);
+    if (!ok) {
+        std::cerr << "Thread role " << kRoleNames[role] << ": could not apply policy to the current thread"
+                  << std::endl;
+    }
+    return ok;
+}
+
+int32_t thread_role_current() {
+    return t_role;
+}
+
+int32_t thread_role_for_flutter_priority(int32_t priority) {
+    // FlutterThreadPriority: kBackground = 0, kNormal = 1, kDisplay = 2, kRaster = 3
+    switch (priority) {
+        case 2: return THREAD_ROLE_RENDER;
+        case 3: return THREAD_ROLE_FLUTTER_RASTER;
+        default: return THREAD_ROLE_DART_WORKER;
+    }
+}
+
+} // extern "C"
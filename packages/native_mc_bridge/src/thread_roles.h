@@ -0,0 +1,66 @@
+#ifndef THREAD_ROLES_H
+#define THREAD_ROLES_H
+
+#include <cstdint>
+
+// ==========================================================================
+// Thread Roles
+// ==========================================================================
+// Threads that run bridge code are tagged with a role, and each role has a
+// scheduling policy: a nice value (priority) and a CPU affinity mask. This
+// keeps UI raster and background work off the cores the server tick uses.
+//
+// Tagged threads:
+//   server-tick        the thread dispatching server_dispatch_tick
+//   render             the client platform/UI thread (custom task runner)
+//   dart-worker        Flutter engine worker/IO threads
+//   flutter-raster     Flutter engine raster threads
+//   bridge-background  threads spawned by the bridge (Java or native)
+// Flutter engine threads are tagged through thread_priority_setter. Threads
+// the Dart VM creates itself (GC helpers, the server VM's thread pool) have
+// no hook and keep the process defaults.
+//
+// Configuration comes from thread_role_configure() or the environment:
+//   REDSTONE_THREAD_ROLES="server-tick:nice=-5,cpus=0-1;flutter-raster:nice=5,cpus=2-3+6"
+// (cpus is a "+"-separated list of CPUs and ranges).
+// Reconfiguring a role re-applies it to threads already tagged with it. A
+// thread is untagged when it exits, so its id is never touched once reused.
+//
+// Platforms: Linux applies both settings per thread. Windows maps the nice
+// value to a thread priority and the mask to the thread affinity. macOS has
+// no affinity API; the nice value maps to a QoS class for the calling thread.
+// ==========================================================================
+
+enum ThreadRole : int32_t {
+    THREAD_ROLE_SERVER_TICK = 0,
+    THREAD_ROLE_RENDER = 1,
+    THREAD_ROLE_DART_WORKER = 2,
+    THREAD_ROLE_FLUTTER_RASTER = 3,
+    THREAD_ROLE_BRIDGE_BACKGROUND = 4,
+    THREAD_ROLE_COUNT = 5,
+};
+
+// No nice value configured for the role: priority is left alone
+#define THREAD_ROLE_NICE_UNSET INT32_MIN
+
+extern "C" {
+
+// Set the policy for a role. nice_value is -20 (highest) .. 19, or
+// THREAD_ROLE_NICE_UNSET; affinity_mask has bit n set for CPU n, 0 = any CPU.
+// Returns false for an invalid role.
+bool thread_role_configure(int32_t role, int32_t nice_value, uint64_t affinity_mask);
+
+// Tag the calling thread with a role and apply the role's policy. Cheap when
+// the thread already has the role. Returns false if applying failed.
+bool thread_role_apply(int32_t role);
+
+// Role of the calling thread, or -1 if untagged
+int32_t thread_role_current();
+
+// Role for a FlutterThreadPriority value (kBackground, kNormal, kDisplay,
+// kRaster), for thread_priority_setter callbacks
+int32_t thread_role_for_flutter_priority(int32_t priority);
+
+} // extern "C"
+
+#endif // THREAD_ROLES_H
@@ -0,0 +1,122 @@
+#include "upcall_table.h"
+
+#include <iostream>
+
+namespace dart_mc_bridge {
+
+namespace {
+
+UpcallTable g_upcalls;
+
+jclass resolve_class(JNIEnv* env, const char* name) {
+    jclass local = env->FindClass(name);
+    if (local == nullptr) {
+        env->ExceptionClear();
+        std::cerr << "Upcall table: class " << name << " not found" << std::endl;
+        return nullptr;
+    }
+    jclass global = static_cast<jclass>(env->NewGlobalRef(local));
+    env->DeleteLocalRef(local);
+    return global;
+}
+
+jmethodID resolve_static(JNIEnv* env, jclass cls, const char* class_name, const char* name, const char* sig) {
+    if (cls == nullptr) return nullptr;
+    jmethodID method = env->GetStaticMethodID(cls, name, sig);
+    if (method == nullptr) {
+        env->ExceptionClear();
+        std::cerr << "Upcall table: method " << class_name << "." << name << sig << " not found" << std::endl;
+    }
+    return method;
+}
+
+void release_class(JNIEnv* env, jclass& cls) {
+    if (cls != nullptr) {
+        env->DeleteGlobalRef(cls);
+        cls = nullptr;
+    }
+}
+
+} // namespace
+
+const UpcallTable& upcalls() {
+    return g_upcalls;
+}
+
+bool upcallsResolveCore(JNIEnv* env) {
+    if (g_upcalls.core_ready) return true;
+    UpcallTable& t = g_upcalls;
+
+    t.object_class = resolve_class(env, "java/lang/Object");
+    t.string_class = resolve_class(env, "java/lang/String");
+    t.integer_class = resolve_class(env, "java/lang/Integer");
+    t.long_class = resolve_class(env, "java/lang/Long");
+    t.double_class = resolve_class(env, "java/lang/Double");
+    t.float_class = resolve_class(env, "java/lang/Float");
+    t.boolean_class = resolve_class(env, "java/lang/Boolean");
+    t.integer_value_of = resolve_static(env, t.integer_class, "Integer", "valueOf", "(I)Ljava/lang/Integer;");
+    t.long_value_of = resolve_static(env, t.long_class, "Long", "valueOf", "(J)Ljava/lang/Long;");
+    t.double_value_of = resolve_static(env, t.double_class, "Double", "valueOf", "(D)Ljava/lang/Double;");
+    t.float_value_of = resolve_static(env, t.float_class, "Float", "valueOf", "(F)Ljava/lang/Float;");
+    t.boolean_value_of = resolve_static(env, t.boolean_class, "Boolean", "valueOf", "(Z)Ljava/lang/Boolean;");
+
+    t.dart_bridge_class = resolve_class(env, "com/redstone/DartBridge");
+    t.on_chat_message = resolve_static(env, t.dart_bridge_class, "DartBridge",
+        "onChatMessage", "(JLjava/lang/String;)V");
+    t.open_container_for_player = resolve_static(env, t.dart_bridge_class, "DartBridge",
+        "openContainerForPlayer", "(ILjava/lang/String;)Z");
+    t.read_item_components = resolve_static(env, t.dart_bridge_class, "DartBridge",
+        "readItemComponents", "(JLjava/nio/ByteBuffer;Ljava/nio/ByteBuffer;)I");
+    t.write_item_components = resolve_static(env, t.dart_bridge_class, "DartBridge",
+        "writeItemComponents", "(JLjava/nio/ByteBuffer;)Z");
+
+    t.container_menu_class = resolve_class(env, "com/redstone/DartContainerMenu");
+    t.get_container_item = resolve_static(env, t.container_menu_class, "DartContainerMenu",
+        "getContainerItemImpl", "(JI)Ljava/lang/String;");
+    t.set_container_item = resolve_static(env, t.container_menu_class, "DartContainerMenu",
+        "setContainerItemImpl", "(JILjava/lang/String;I)V");
+    t.get_container_slot_count = resolve_static(env, t.container_menu_class, "DartContainerMenu",
+        "getContainerSlotCountImpl", "(J)I");
+    t.clear_container_slot = resolve_static(env, t.container_menu_class, "DartContainerMenu",
+        "clearContainerSlotImpl", "(JI)V");
+
+    t.core_ready = t.object_class && t.string_class &&
+        t.integer_value_of && t.long_value_of && t.double_value_of && t.float_value_of && t.boolean_value_of &&
+        t.on_chat_message && t.open_container_for_player &&
+        t.read_item_components && t.write_item_components &&
+        t.get_container_item && t.set_container_item && t.get_container_slot_count && t.clear_container_slot;
+    return t.core_ready;
+}
+
+bool upcallsResolveClient(JNIEnv* env, jclass client_class) {
+    if (g_upcalls.client_ready) return true;
+    if (client_class == nullptr) return false;
+    UpcallTable& t = g_upcalls;
+
+    t.dart_bridge_client_class = static_cast<jclass>(env->NewGlobalRef(client_class));
+    t.on_slot_positions_update = resolve_static(env, t.dart_bridge_client_class, "DartBridgeClient",
+        "onSlotPositionsUpdate", "(I[I)V");
+    t.on_send_packet_to_server = resolve_static(env, t.dart_bridge_client_class, "DartBridgeClient",
+        "onSendPacketToServer", "(I[B)V");
+
+    t.client_ready = t.on_slot_positions_update && t.on_send_packet_to_server;
+    if (!t.client_ready) release_class(env, t.dart_bridge_client_class);
+    return t.client_ready;
+}
+
+void upcallsRelease(JNIEnv* env) {
+    UpcallTable& t = g_upcalls;
+    release_class(env, t.object_class);
+    release_class(env, t.string_class);
+    release_class(env, t.integer_class);
+    release_class(env, t.long_class);
+    release_class(env, t.double_class);
+    release_class(env, t.float_class);
+    release_class(env, t.boolean_class);
+    release_class(env, t.dart_bridge_class);
+    release_class(env, t.container_menu_class);
+    release_class(env, t.dart_bridge_client_class);
+    t = UpcallTable();
+}
+
+} // namespace dart_mc_bridge
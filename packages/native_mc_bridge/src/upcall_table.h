@@ -0,0 +1,77 @@
+#ifndef UPCALL_TABLE_H
+#define UPCALL_TABLE_H
+
+#include <jni.h>
+
+// ==========================================================================
+// Upcall Table
+// ==========================================================================
+// Every Java class and method the bridge calls into, resolved once into
+// global refs. Upcalls then do no FindClass/Get*MethodID on the hot path.
+//
+// Core entries are resolved in JNI_OnLoad. FindClass there uses the class
+// loader of the class that loaded the library (DartBridge), so mod classes
+// resolve. The same call made later from a natively attached thread (a
+// Dart thread) would only see the system class loader. DartBridgeClient
+// only exists on the client; its entries are resolved when the client
+// runtime starts.
+//
+// Resolution fails fast. A missing class or method is logged by name,
+// JNI_OnLoad returns JNI_ERR, and System.loadLibrary throws.
+// ==========================================================================
+
+namespace dart_mc_bridge {
+
+struct UpcallTable {
+    // java.lang
+    jclass object_class = nullptr;
+    jclass string_class = nullptr;
+    jclass integer_class = nullptr;
+    jclass long_class = nullptr;
+    jclass double_class = nullptr;
+    jclass float_class = nullptr;
+    jclass boolean_class = nullptr;
+    jmethodID integer_value_of = nullptr;  // Integer.valueOf(I) - cached small values
+    jmethodID long_value_of = nullptr;
+    jmethodID double_value_of = nullptr;
+    jmethodID float_value_of = nullptr;
+    jmethodID boolean_value_of = nullptr;
+
+    // com.redstone.DartBridge
+    jclass dart_bridge_class = nullptr;
+    jmethodID on_chat_message = nullptr;            // onChatMessage(JLjava/lang/String;)V
+    jmethodID open_container_for_player = nullptr;  // openContainerForPlayer(ILjava/lang/String;)Z
+    jmethodID read_item_components = nullptr;       // readItemComponents(JLjava/nio/ByteBuffer;Ljava/nio/ByteBuffer;)I
+    jmethodID write_item_components = nullptr;      // writeItemComponents(JLjava/nio/ByteBuffer;)Z
+
+    // com.redstone.DartContainerMenu
+    jclass container_menu_class = nullptr;
+    jmethodID get_container_item = nullptr;        // getContainerItemImpl(JI)Ljava/lang/String;
+    jmethodID set_container_item = nullptr;        // setContainerItemImpl(JILjava/lang/String;I)V
+    jmethodID get_container_slot_count = nullptr;  // getContainerSlotCountImpl(J)I
+    jmethodID clear_container_slot = nullptr;      // clearContainerSlotImpl(JI)V
+
+    // com.redstone.DartBridgeClient (client only)
+    jclass dart_bridge_client_class = nullptr;
+    jmethodID on_slot_positions_update = nullptr;  // onSlotPositionsUpdate(I[I)V
+    jmethodID on_send_packet_to_server = nullptr;  // onSendPacketToServer(I[B)V
+
+    bool core_ready = false;
+    bool client_ready = false;
+};
+
+// The resolved table. Entries are null until their resolve call succeeds.
+const UpcallTable& upcalls();
+
+// Resolve java.lang and common com.redstone entries (JNI_OnLoad)
+bool upcallsResolveCore(JNIEnv* env);
+
+// Resolve DartBridgeClient entries from the class itself (client init)
+bool upcallsResolveClient(JNIEnv* env, jclass client_class);
+
+// Drop every global ref (JNI_OnUnload)
+void upcallsRelease(JNIEnv* env);
+
+} // namespace dart_mc_bridge
+
+#endif // UPCALL_TABLE_H
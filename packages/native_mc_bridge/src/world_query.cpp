@@ -0,0 +1,127 @@
+#include "world_query.h"
+
+#include <dart_native_api.h>
+
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+std::mutex g_query_mutex;
+std::deque<dart_mc_bridge::WorldQuery> g_pending;
+std::unordered_map<int64_t, int64_t> g_in_flight;  // completion id -> reply port
+std::atomic<int64_t> g_next_query_id{1};
+
+bool post_result(int64_t reply_port, int64_t id, int32_t status, const char* text,
+                 const double* values, int32_t value_count) {
+    Dart_CObject id_obj;
+    id_obj.type = Dart_CObject_kInt64;
+    id_obj.value.as_int64 = id;
+
+    Dart_CObject status_obj;
+    status_obj.type = Dart_CObject_kInt32;
+    status_obj.value.as_int32 = status;
+
+    Dart_CObject text_obj;
+    if (text != nullptr) {
+        text_obj.type = Dart_CObject_kString;
+        text_obj.value.as_string = const_cast<char*>(text);
+    } else {
+        text_obj.type = Dart_CObject_kNull;
+    }
+
+    // Dart_PostCObject copies typed data, so values may point at JNI memory
+    Dart_CObject values_obj;
+    values_obj.type = Dart_CObject_kTypedData;
+    values_obj.value.as_typed_data.type = Dart_TypedData_kFloat64;
+    values_obj.value.as_typed_data.length = values != nullptr ? value_count * static_cast<intptr_t>(sizeof(double)) : 0;
+    values_obj.value.as_typed_data.values = reinterpret_cast<const uint8_t*>(values);
+
+    Dart_CObject* elements[] = {&id_obj, &status_obj, &text_obj, &values_obj};
+    Dart_CObject message;
+    message.type = Dart_CObject_kArray;
+    message.value.as_array.length = 4;
+    message.value.as_array.values = elements;
+
+    return Dart_PostCObject(reply_port, &message);
+}
+
+} // namespace
+
+namespace dart_mc_bridge {
+
+void worldQueryTake(std::vector<WorldQuery>& out, size_t max_queries) {
+    std::lock_guard<std::mutex> lock(g_query_mutex);
+    while (!g_pending.empty() && out.size() < max_queries) {
+        WorldQuery& query = g_pending.front();
+        g_in_flight[query.id] = query.reply_port;
+        out.push_back(std::move(query));
+        g_pending.pop_front();
+    }
+}
+
+bool worldQueryComplete(int64_t id, int32_t status, const char* text, const double* values, int32_t value_count) {
+    int64_t reply_port;
+    {
+        std::lock_guard<std::mutex> lock(g_query_mutex);
+        auto it = g_in_flight.find(id);
+        if (it == g_in_flight.end()) return false;
+        reply_port = it->second;
+        g_in_flight.erase(it);
+    }
+    // A closed port just drops the message (the Dart side went away)
+    post_result(reply_port, id, status, text, values, value_count);
+    return true;
+}
+
+} // namespace dart_mc_bridge
+
+extern "C" {
+
+int64_t world_query_submit(int64_t reply_port, int32_t kind, const char* dimension, const char* text,
+                           const double* args, int32_t arg_count) {
+    if (kind < WORLD_QUERY_BLOCK_ID || kind > WORLD_QUERY_RAYCAST) return -1;
+
+    dart_mc_bridge::WorldQuery query;
+    query.id = g_next_query_id.fetch_add(1, std::memory_order_relaxed);
+    query.reply_port = reply_port;
+    query.kind = kind;
+    query.dimension = dimension ? dimension : "minecraft:overworld";
+    query.text = text ? text : "";
+    std::memset(query.args, 0, sizeof(query.args));
+    if (args != nullptr && arg_count > 0) {
+        int32_t count = arg_count < WORLD_QUERY_MAX_ARGS ? arg_count : WORLD_QUERY_MAX_ARGS;
+        std::memcpy(query.args, args, sizeof(double) * count);
+    }
+
+    int64_t id = query.id;
+    std::lock_guard<std::mutex> lock(g_query_mutex);
+    g_pending.push_back(std::move(query));
+    return id;
+}
+
+int32_t world_query_pending() {
+    std::lock_guard<std::mutex> lock(g_query_mutex);
+    return static_cast<int32_t>(g_pending.size());
+}
+
+void world_query_cancel_all() {
+    std::deque<dart_mc_bridge::WorldQuery> pending;
+    std::unordered_map<int64_t, int64_t> in_flight;
+    {
+        std::lock_guard<std::mutex> lock(g_query_mutex);
+        pending.swap(g_pending);
+        in_flight.swap(g_in_flight);
+    }
+    for (const auto& query : pending) {
+        post_result(query.reply_port, query.id, WORLD_QUERY_CANCELLED, nullptr, nullptr, 0);
+    }
+    for (const auto& entry : in_flight) {
+        post_result(entry.second, entry.first, WORLD_QUERY_CANCELLED, nullptr, nullptr, 0);
+    }
+}
+
+} // extern "C"
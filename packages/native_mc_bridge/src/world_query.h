@@ -0,0 +1,71 @@
+#ifndef WORLD_QUERY_H
+#define WORLD_QUERY_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// ==========================================================================
+// Asynchronous World Query Queue
+// ==========================================================================
+// Dart submits world reads that must run on the server thread (block reads,
+// entity searches, raycasts) without blocking on a synchronous JNI call.
+// Each query carries a completion id and the native port of a Dart
+// ReceivePort. Java drains the queue in one batch at a fixed point of every
+// server tick and hands the results back here; they are delivered to Dart
+// with Dart_PostCObject and complete the caller's Future.
+//
+// Reply message (a Dart List):
+//   [int completion_id, int status, String? text, Float64List values]
+// ==========================================================================
+
+// Query kinds - must match WorldQueryService.java and world_query.dart
+#define WORLD_QUERY_BLOCK_ID 0            // args: x, y, z            -> text
+#define WORLD_QUERY_IS_AIR 1              // args: x, y, z            -> values[0]
+#define WORLD_QUERY_REDSTONE_SIGNAL 2     // args: x, y, z            -> values[0]
+#define WORLD_QUERY_ENTITIES_IN_BOX 3     // args: min xyz, max xyz   -> (id, class) pairs
+#define WORLD_QUERY_ENTITIES_IN_RADIUS 4  // args: center xyz, radius -> (id, class) pairs
+#define WORLD_QUERY_RAYCAST 5             // args: from xyz, to xyz   -> hit, pos xyz, face, location xyz
+
+#define WORLD_QUERY_MAX_ARGS 8
+
+// Completion status
+#define WORLD_QUERY_OK 0
+#define WORLD_QUERY_FAILED 1
+#define WORLD_QUERY_CANCELLED 2
+
+namespace dart_mc_bridge {
+
+struct WorldQuery {
+    int64_t id;
+    int64_t reply_port;
+    int32_t kind;
+    std::string dimension;
+    std::string text;  // Optional filter (e.g. entity type)
+    double args[WORLD_QUERY_MAX_ARGS];
+};
+
+// Move up to max_queries pending queries into out (server thread).
+// Taken queries stay in flight until completed or cancelled.
+void worldQueryTake(std::vector<WorldQuery>& out, size_t max_queries);
+
+// Deliver the result of an in-flight query. Returns false if the id is unknown.
+bool worldQueryComplete(int64_t id, int32_t status, const char* text, const double* values, int32_t value_count);
+
+} // namespace dart_mc_bridge
+
+extern "C" {
+
+// Submit a query. Returns its completion id (> 0), or -1 if the kind is invalid.
+int64_t world_query_submit(int64_t reply_port, int32_t kind, const char* dimension, const char* text,
+                           const double* args, int32_t arg_count);
+
+// Number of queries waiting to be serviced
+int32_t world_query_pending();
+
+// Complete every queued and in-flight query with WORLD_QUERY_CANCELLED (server shutdown)
+void world_query_cancel_all();
+
+} // extern "C"
+
+#endif // WORLD_QUERY_H
@@ -0,0 +1,345 @@
+// ==========================================================================
+// Capture Replay Tool
+// ==========================================================================
+// Replays a server event capture (see src/event_capture.h) into a Dart
+// server isolate without Minecraft and reports per-event latency.
+//
+// Usage:
+//   capture_replay <capture_path> --script <server.dill> [--packages <package_config.json>]
+//   capture_replay <capture_path> --aot <server_aot.so>
+//
+// Options:
+//   --realtime        Honour the original spacing between events
+//   --iterations N    Replay the whole capture N times (default 1)
+//   --csv <file>      Also write per-event latency stats as CSV
+//
+// There is no JVM in this process, so Dart handlers that call back into
+// Minecraft through generic JNI receive default values.
+// ==========================================================================
+
+#include "dart_bridge_server.h"
+#include "event_capture.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using dart_mc_bridge::CaptureRecord;
+using dart_mc_bridge::CaptureType;
+using dart_mc_bridge::CaptureValue;
+
+namespace {
+
+// ==========================================================================
+// Argument decoding
+// ==========================================================================
+
+template <typename T>
+T decodeArg(CaptureValue& value) {
+    if constexpr (std::is_same_v<T, const char*>) {
+        return value.type == CaptureType::None ? nullptr : value.bytes.c_str();
+    } else if constexpr (std::is_pointer_v<T>) {
+        // Blobs (and out-parameters) get a private, writable copy
+        if (value.bytes.size() < 8) value.bytes.resize(8, '\0');
+        return reinterpret_cast<T>(&value.bytes[0]);
+    } else if constexpr (std::is_same_v<T, bool>) {
+        return value.i != 0;
+    } else if constexpr (std::is_floating_point_v<T>) {
+        return static_cast<T>(value.d);
+    } else {
+        return static_cast<T>(value.i);
+    }
+}
+
+template <typename R, typename... P, size_t... I>
+void invokeWith(R (*fn)(P...), std::vector<CaptureValue>& args, std::index_sequence<I...>) {
+    fn(decodeArg<P>(args[I])...);
+}
+
+template <typename R, typename... P>
+bool invoke(R (*fn)(P...), const CaptureRecord& record) {
+    if (record.args.size() != sizeof...(P)) return false;
+    std::vector<CaptureValue> args = record.args;
+    invokeWith(fn, args, std::index_sequence_for<P...>{});
+    return true;
+}
+
+using ReplayFn = std::function<bool(const CaptureRecord&)>;
+
+#define REPLAY_EVENT(fn) {#fn, [](const CaptureRecord& r) { return invoke(&fn, r); }}
+
+const std::unordered_map<std::string, ReplayFn>& replayTable() {
+    static const std::unordered_map<std::string, ReplayFn> table = {
+        REPLAY_EVENT(dart_server_tick),
+        REPLAY_EVENT(server_dispatch_block_break),
+        REPLAY_EVENT(server_dispatch_block_interact),
+        REPLAY_EVENT(server_dispatch_tick),
+        REPLAY_EVENT(server_dispatch_proxy_block_break),
+        REPLAY_EVENT(server_dispatch_proxy_block_use),
+        REPLAY_EVENT(server_dispatch_proxy_block_stepped_on),
+        REPLAY_EVENT(server_dispatch_proxy_block_fallen_upon),
+        REPLAY_EVENT(server_dispatch_proxy_block_random_tick),
+        REPLAY_EVENT(server_dispatch_proxy_block_placed),
+        REPLAY_EVENT(server_dispatch_proxy_block_removed),
+        REPLAY_EVENT(server_dispatch_proxy_block_neighbor_changed),
+        REPLAY_EVENT(server_dispatch_proxy_block_entity_inside),
+        REPLAY_EVENT(server_dispatch_proxy_block_get_signal),
+        REPLAY_EVENT(server_dispatch_proxy_block_get_direct_signal),
+        REPLAY_EVENT(server_dispatch_proxy_block_get_analog_output),
+        REPLAY_EVENT(server_dispatch_proxy_block_set_state),
+        REPLAY_EVENT(server_dispatch_block_entity_set_level),
+        REPLAY_EVENT(server_dispatch_block_entity_load),
+        REPLAY_EVENT(server_dispatch_block_entity_save),
+        REPLAY_EVENT(server_dispatch_block_entity_tick),
+        REPLAY_EVENT(server_dispatch_block_entity_get_data_slot),
+        REPLAY_EVENT(server_dispatch_block_entity_set_data_slot),
+        REPLAY_EVENT(server_dispatch_block_entity_removed),
+        REPLAY_EVENT(server_dispatch_block_entity_container_open),
+        REPLAY_EVENT(server_dispatch_block_entity_container_close),
+        REPLAY_EVENT(server_dispatch_block_entity_load_chunk),
+        REPLAY_EVENT(server_dispatch_block_entity_save_chunk),
+        REPLAY_EVENT(server_dispatch_player_join),
+        REPLAY_EVENT(server_dispatch_player_leave),
+        REPLAY_EVENT(server_dispatch_player_respawn),
+        REPLAY_EVENT(server_dispatch_player_change_dimension),
+        REPLAY_EVENT(server_dispatch_entity_change_dimension),
+        REPLAY_EVENT(server_dispatch_player_death),
+        REPLAY_EVENT(server_dispatch_entity_damage),
+        REPLAY_EVENT(server_dispatch_entity_death),
+        REPLAY_EVENT(server_dispatch_player_attack_entity),
+        REPLAY_EVENT(server_dispatch_player_chat),
+        REPLAY_EVENT(server_dispatch_player_command),
+        REPLAY_EVENT(server_dispatch_item_use),
+        REPLAY_EVENT(server_dispatch_item_use_on_block),
+        REPLAY_EVENT(server_dispatch_item_use_on_entity),
+        REPLAY_EVENT(server_dispatch_block_place),
+        REPLAY_EVENT(server_dispatch_player_pickup_item),
+        REPLAY_EVENT(server_dispatch_player_drop_item),
+        REPLAY_EVENT(server_dispatch_server_starting),
+        REPLAY_EVENT(server_dispatch_server_started),
+        REPLAY_EVENT(server_dispatch_server_stopping),
+        REPLAY_EVENT(server_dispatch_registry_ready),
+        REPLAY_EVENT(server_dispatch_proxy_entity_spawn),
+        REPLAY_EVENT(server_dispatch_proxy_entity_tick),
+        REPLAY_EVENT(server_dispatch_proxy_entity_death),
+        REPLAY_EVENT(server_dispatch_proxy_entity_damage),
+        REPLAY_EVENT(server_dispatch_proxy_entity_attack),
+        REPLAY_EVENT(server_dispatch_proxy_entity_target),
+        REPLAY_EVENT(server_dispatch_proxy_projectile_hit_entity),
+        REPLAY_EVENT(server_dispatch_proxy_projectile_hit_block),
+        REPLAY_EVENT(server_dispatch_proxy_animal_breed),
+        REPLAY_EVENT(server_dispatch_proxy_item_attack_entity),
+        REPLAY_EVENT(server_dispatch_proxy_item_use),
+        REPLAY_EVENT(server_dispatch_proxy_item_use_on_block),
+        REPLAY_EVENT(server_dispatch_proxy_item_use_on_entity),
+        REPLAY_EVENT(server_dispatch_command_execute),
+        REPLAY_EVENT(server_dispatch_custom_goal_can_use),
+        REPLAY_EVENT(server_dispatch_custom_goal_can_continue_to_use),
+        REPLAY_EVENT(server_dispatch_custom_goal_start),
+        REPLAY_EVENT(server_dispatch_custom_goal_tick),
+        REPLAY_EVENT(server_dispatch_custom_goal_stop),
+        REPLAY_EVENT(server_dispatch_client_packet),
+    };
+    return table;
+}
+
+#undef REPLAY_EVENT
+
+// ==========================================================================
+// Statistics
+// ==========================================================================
+
+struct EventStats {
+    std::vector<uint64_t> replay_ns;
+    uint64_t captured_total_ns = 0;
+};
+
+uint64_t percentile(const std::vector<uint64_t>& sorted, double p) {
+    if (sorted.empty()) return 0;
+    size_t index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+double toMicros(uint64_t ns) {
+    return static_cast<double>(ns) / 1000.0;
+}
+
+void printUsage() {
+    std::cerr << "Usage: capture_replay <capture_path> (--script <server.dill> [--packages <package_config.json>]"
+              << " | --aot <library>) [--realtime] [--iterations N] [--csv <file>]" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        printUsage();
+        return 1;
+    }
+
+    std::string capture_path = argv[1];
+    const char* script_path = nullptr;
+    const char* package_config = nullptr;
+    const char* aot_path = nullptr;
+    const char* csv_path = nullptr;
+    bool realtime = false;
+    int iterations = 1;
+
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--script" && has_value) {
+            script_path = argv[++i];
+        } else if (arg == "--packages" && has_value) {
+            package_config = argv[++i];
+        } else if (arg == "--aot" && has_value) {
+            aot_path = argv[++i];
+        } else if (arg == "--csv" && has_value) {
+            csv_path = argv[++i];
+        } else if (arg == "--iterations" && has_value) {
+            iterations = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--realtime") {
+            realtime = true;
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+    if ((script_path == nullptr) == (aot_path == nullptr)) {
+        printUsage();
+        return 1;
+    }
+
+    std::vector<CaptureRecord> records;
+    if (!dart_mc_bridge::readCapture(capture_path, records) || records.empty()) {
+        std::cerr << "No capture records found at " << capture_path << ".[0-"
+                  << (dart_mc_bridge::kCaptureSegments - 1) << "]" << std::endl;
+        return 1;
+    }
+    // Records are written when a dispatch returns but stamped when it began,
+    // so nested dispatches come before their parent. Replay in start order.
+    std::stable_sort(records.begin(), records.end(), [](const CaptureRecord& a, const CaptureRecord& b) {
+        return a.timestamp_ns < b.timestamp_ns;
+    });
+    std::cout << "Loaded " << records.size() << " captured events" << std::endl;
+
+    // Never record the replay itself. Init would otherwise start a capture at
+    // REDSTONE_CAPTURE_PATH and delete its segments, which may be the very
+    // capture being replayed.
+#ifdef _WIN32
+    _putenv_s("REDSTONE_CAPTURE_PATH", "");
+#else
+    unsetenv("REDSTONE_CAPTURE_PATH");
+#endif
+
+    bool initialized = aot_path != nullptr ? dart_server_init_aot(aot_path)
+                                           : dart_server_init(script_path, package_config, 0);
+    if (!initialized) {
+        std::cerr << "Failed to initialize the Dart server isolate" << std::endl;
+        return 1;
+    }
+
+    const auto& table = replayTable();
+    std::map<std::string, EventStats> stats;
+    std::map<std::string, size_t> skipped;
+
+    for (int iteration = 0; iteration < iterations; iteration++) {
+        auto replay_start = std::chrono::steady_clock::now();
+        uint64_t first_timestamp = records.front().timestamp_ns;
+
+        for (const CaptureRecord& record : records) {
+            auto it = table.find(record.event_name);
+            if (it == table.end()) {
+                skipped[record.event_name]++;
+                continue;
+            }
+
+            if (realtime) {
+                std::this_thread::sleep_until(replay_start +
+                    std::chrono::nanoseconds(record.timestamp_ns - first_timestamp));
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            bool ok = it->second(record);
+            auto end = std::chrono::steady_clock::now();
+            if (!ok) {
+                skipped[record.event_name]++;
+                continue;
+            }
+
+            EventStats& event = stats[record.event_name];
+            event.replay_ns.push_back(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+            event.captured_total_ns += record.duration_ns;
+        }
+    }
+
+    dart_server_shutdown();
+
+    // Report, slowest total first
+    std::vector<std::pair<std::string, EventStats*>> ordered;
+    for (auto& entry : stats) {
+        std::sort(entry.second.replay_ns.begin(), entry.second.replay_ns.end());
+        ordered.emplace_back(entry.first, &entry.second);
+    }
+    auto total_of = [](const EventStats* s) {
+        uint64_t total = 0;
+        for (uint64_t ns : s->replay_ns) total += ns;
+        return total;
+    };
+    std::sort(ordered.begin(), ordered.end(), [&](const auto& a, const auto& b) {
+        return total_of(a.second) > total_of(b.second);
+    });
+
+    std::ofstream csv;
+    if (csv_path != nullptr) {
+        csv.open(csv_path);
+        csv << "event,count,total_us,mean_us,p50_us,p90_us,p99_us,max_us,captured_mean_us\n";
+    }
+
+    std::cout << std::endl << std::left << std::setw(52) << "event" << std::right
+              << std::setw(9) << "count" << std::setw(12) << "total_us" << std::setw(10) << "mean_us"
+              << std::setw(10) << "p50_us" << std::setw(10) << "p99_us" << std::setw(11) << "max_us"
+              << std::setw(13) << "captured_us" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+
+    for (const auto& [name, event] : ordered) {
+        size_t count = event->replay_ns.size();
+        uint64_t total = total_of(event);
+        double mean = toMicros(total) / static_cast<double>(count);
+        // Captured durations are summed over every iteration too
+        double captured_mean = toMicros(event->captured_total_ns) / static_cast<double>(count);
+
+        std::cout << std::left << std::setw(52) << name << std::right
+                  << std::setw(9) << count << std::setw(12) << toMicros(total) << std::setw(10) << mean
+                  << std::setw(10) << toMicros(percentile(event->replay_ns, 0.50))
+                  << std::setw(10) << toMicros(percentile(event->replay_ns, 0.99))
+                  << std::setw(11) << toMicros(event->replay_ns.back())
+                  << std::setw(13) << captured_mean << std::endl;
+
+        if (csv.is_open()) {
+            csv << name << ',' << count << ',' << toMicros(total) << ',' << mean << ','
+                << toMicros(percentile(event->replay_ns, 0.50)) << ','
+                << toMicros(percentile(event->replay_ns, 0.90)) << ','
+                << toMicros(percentile(event->replay_ns, 0.99)) << ','
+                << toMicros(event->replay_ns.back()) << ',' << captured_mean << '\n';
+        }
+    }
+
+    for (const auto& [name, count] : skipped) {
+        std::cout << "Skipped " << count << " '" << name << "' events (unknown or malformed)" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,284 @@
+// ==========================================================================
+// DartBridge Binding Generator
+// ==========================================================================
+// Reads the public static (non-native) methods of DartBridge.java and
+// generates a binding table for them:
+//
+//   native_mc_bridge/src/dart_bridge_bindings.g.h
+//     Method name/signature table. generic_jni resolves every entry to a
+//     jmethodID once, so calls through jni_bridge_call_* skip the per-call
+//     class/method lookup and string marshalling of the class, method name
+//     and signature.
+//
+//   dart_mod_common/lib/src/jni/dart_bridge_bindings.g.dart
+//     Typed Dart wrappers (DartBridgeBindings.getBlockId(...)) that call the
+//     table by index.
+//
+// Only methods whose parameters and return type are primitives, String or
+// primitive arrays are bound (float returns excepted); the rest (server
+// instances, handlers, ...) are not callable from Dart anyway.
+//
+// Usage (from the repository root):
+//   dart run packages/native_mc_bridge/tools/generate_bridge_bindings.dart
+//   dart run packages/native_mc_bridge/tools/generate_bridge_bindings.dart --check
+//
+// --check writes nothing and exits with status 1 if either output differs
+// from what DartBridge.java generates (run by CI).
+//
+// Re-run after changing DartBridge.java. Both outputs carry a hash of the
+// table; if the native library and the Dart code disagree, the Dart side
+// falls back to by-name calls instead of calling the wrong method.
+// ==========================================================================
+
+import 'dart:io';
+
+const _javaSource =
+    'packages/java_mc_bridge/src/main/java/com/redstone/DartBridge.java';
+const _headerOutput = 'packages/native_mc_bridge/src/dart_bridge_bindings.g.h';
+const _dartOutput =
+    'packages/dart_mod_common/lib/src/jni/dart_bridge_bindings.g.dart';
+
+const _primitiveDescriptors = {
+  'void': 'V',
+  'boolean': 'Z',
+  'byte': 'B',
+  'char': 'C',
+  'short': 'S',
+  'int': 'I',
+  'long': 'J',
+  'float': 'F',
+  'double': 'D',
+};
+
+// Dart reserved words that are legal Java identifiers
+const _dartReserved = {'in', 'is', 'rethrow', 'var', 'with'};
+
+final _methodPattern = RegExp(
+  r'public\s+static\s+(?!native\b)(?:<[^>]*>\s+)?([\w\[\]]+)\s+(\w+)\s*\(([^)]*)\)\s*(?:throws\s+[\w.,\s]+)?\{',
+);
+
+class _Param {
+  final String name;
+  final String descriptor;
+
+  _Param(this.name, this.descriptor);
+}
+
+class _Binding {
+  final String javaName;
+  final String dartName;
+  final List<_Param> params;
+  final String returnDescriptor;
+
+  _Binding(this.javaName, this.dartName, this.params, this.returnDescriptor);
+
+  String get signature =>
+      '(${params.map((p) => p.descriptor).join()})$returnDescriptor';
+}
+
+/// JNI descriptor for a Java type, or null if it cannot be bound.
+String? _descriptor(String type) {
+  if (type.endsWith('[]')) {
+    final element = _descriptor(type.substring(0, type.length - 2));
+    if (element == null || element == 'V' || element.startsWith('L')) {
+      return null;
+    }
+    return '[$element';
+  }
+  if (type == 'String') return 'Ljava/lang/String;';
+  return _primitiveDescriptors[type];
+}
+
+/// Dart parameter type for a JNI descriptor.
+String _dartParamType(String descriptor) {
+  switch (descriptor) {
+    case 'Z':
+      return 'bool';
+    case 'F':
+    case 'D':
+      return 'double';
+    case 'Ljava/lang/String;':
+      return 'String?';
+    default:
+      return 'int'; // integral primitives and array handles
+  }
+}
+
+/// (Dart return type, GenericJniBridge call suffix) for a return descriptor.
+(String, String) _dartReturn(String descriptor) {
+  switch (descriptor) {
+    case 'V':
+      return ('void', 'Void');
+    case 'Z':
+      return ('bool', 'Bool');
+    case 'B':
+    case 'C':
+    case 'S':
+    case 'I':
+      return ('int', 'Int');
+    case 'J':
+      return ('int', 'Long');
+    case 'D':
+      return ('double', 'Double');
+    case 'Ljava/lang/String;':
+      return ('String?', 'String');
+    default:
+      return ('int', 'Object'); // arrays come back as object handles
+  }
+}
+
+List<_Binding> _parse(String source) {
+  final bindings = <_Binding>[];
+  final nameCounts = <String, int>{};
+
+  for (final match in _methodPattern.allMatches(source)) {
+    // float returns have no by-name static call to fall back to
+    final returnDescriptor = _descriptor(match.group(1)!);
+    if (returnDescriptor == null || returnDescriptor == 'F') continue;
+
+    final params = <_Param>[];
+    var bindable = true;
+    final rawParams = match.group(3)!.trim();
+    if (rawParams.isNotEmpty) {
+      for (final raw in rawParams.split(',')) {
+        final parts = raw
+            .replaceAll(RegExp(r'@\w+\s*'), '')
+            .replaceAll(RegExp(r'\bfinal\s+'), '')
+            .trim()
+            .split(RegExp(r'\s+'));
+        final descriptor = parts.length == 2 ? _descriptor(parts[0]) : null;
+        if (descriptor == null || descriptor == 'V') {
+          bindable = false;
+          break;
+        }
+        final name = parts[1];
+        params.add(_Param(_dartReserved.contains(name) ? '${name}_' : name, descriptor));
+      }
+    }
+    if (!bindable) continue;
+
+    final javaName = match.group(2)!;
+    final seen = nameCounts.update(javaName, (n) => n + 1, ifAbsent: () => 1);
+    final dartName = seen == 1 ? javaName : '$javaName$seen';
+    bindings.add(_Binding(javaName, dartName, params, returnDescriptor));
+  }
+  return bindings;
+}
+
+/// 32-bit FNV-1a over "name signature\n" for every entry.
+int _tableHash(List<_Binding> bindings) {
+  var hash = 0x811c9dc5;
+  for (final b in bindings) {
+    for (final unit in '${b.javaName} ${b.signature}\n'.codeUnits) {
+      hash ^= unit;
+      hash = (hash * 0x01000193) & 0xffffffff;
+    }
+  }
+  return hash;
+}
+
+String _hex(int hash) => '0x${hash.toRadixString(16).padLeft(8, '0')}';
+
+String _generateHeader(List<_Binding> bindings, int hash) {
+  final buffer = StringBuffer();
+  buffer.writeln('// GENERATED CODE - DO NOT MODIFY BY HAND');
+  buffer.writeln('// Generated by tools/generate_bridge_bindings.dart from DartBridge.java');
+  buffer.writeln();
+  buffer.writeln('#ifndef DART_BRIDGE_BINDINGS_G_H');
+  buffer.writeln('#define DART_BRIDGE_BINDINGS_G_H');
+  buffer.writeln();
+  buffer.writeln('#define DART_BRIDGE_CLASS "com/redstone/DartBridge"');
+  buffer.writeln('#define DART_BRIDGE_BINDING_COUNT ${bindings.length}');
+  buffer.writeln('#define DART_BRIDGE_BINDINGS_HASH ${_hex(hash)}u');
+  buffer.writeln();
+  buffer.writeln('struct DartBridgeBinding {');
+  buffer.writeln('    const char* name;');
+  buffer.writeln('    const char* sig;');
+  buffer.writeln('};');
+  buffer.writeln();
+  buffer.writeln(
+      'static const DartBridgeBinding kDartBridgeBindings[DART_BRIDGE_BINDING_COUNT] = {');
+  for (var i = 0; i < bindings.length; i++) {
+    final b = bindings[i];
+    buffer.writeln('    {"${b.javaName}", "${b.signature}"},  // $i');
+  }
+  buffer.writeln('};');
+  buffer.writeln();
+  buffer.writeln('#endif // DART_BRIDGE_BINDINGS_G_H');
+  return buffer.toString();
+}
+
+String _generateDart(List<_Binding> bindings, int hash) {
+  final buffer = StringBuffer();
+  buffer.writeln('// GENERATED CODE - DO NOT MODIFY BY HAND');
+  buffer.writeln('// Generated by tools/generate_bridge_bindings.dart from DartBridge.java');
+  buffer.writeln();
+  buffer.writeln('/// Typed bindings for the static methods of com.redstone.DartBridge.');
+  buffer.writeln('library;');
+  buffer.writeln();
+  buffer.writeln("import 'generic_bridge.dart';");
+  buffer.writeln();
+  buffer.writeln('/// Pre-resolved calls into `com.redstone.DartBridge`.');
+  buffer.writeln('///');
+  buffer.writeln('/// Each method calls a jmethodID resolved once by the native library,');
+  buffer.writeln('/// instead of looking the method up by name on every call.');
+  buffer.writeln('abstract final class DartBridgeBindings {');
+  buffer.writeln('  /// Number of bound methods.');
+  buffer.writeln('  static const int count = ${bindings.length};');
+  buffer.writeln();
+  buffer.writeln('  /// Hash of the binding table; must match the native library.');
+  buffer.writeln('  static const int tableHash = ${_hex(hash)};');
+  for (var i = 0; i < bindings.length; i++) {
+    final b = bindings[i];
+    final (returnType, kind) = _dartReturn(b.returnDescriptor);
+    final params =
+        b.params.map((p) => '${_dartParamType(p.descriptor)} ${p.name}').join(', ');
+    final args = b.params.map((p) => p.name).join(', ');
+    final call = "GenericJniBridge.callBridge$kind($i, '${b.javaName}', "
+        "'${b.signature}'${args.isEmpty ? '' : ', [$args]'})";
+    buffer.writeln();
+    buffer.writeln('  static $returnType ${b.dartName}($params) =>');
+    buffer.writeln('      $call;');
+  }
+  buffer.writeln('}');
+  return buffer.toString();
+}
+
+void main(List<String> args) {
+  final check = args.contains('--check');
+  final paths = args.where((arg) => !arg.startsWith('--')).toList();
+  final root = paths.isNotEmpty ? paths.first : '.';
+  final source = File('$root/$_javaSource');
+  if (!source.existsSync()) {
+    stderr.writeln('DartBridge.java not found at ${source.path}; '
+        'run from the repository root or pass it as the first argument.');
+    exit(1);
+  }
+
+  final bindings = _parse(source.readAsStringSync());
+  final hash = _tableHash(bindings);
+  final outputs = {
+    _headerOutput: _generateHeader(bindings, hash),
+    _dartOutput: _generateDart(bindings, hash),
+  };
+
+  if (check) {
+    final stale = [
+      for (final entry in outputs.entries)
+        if (!_matches(File('$root/${entry.key}'), entry.value)) entry.key,
+    ];
+    if (stale.isNotEmpty) {
+      stderr.writeln('DartBridge bindings are out of date with DartBridge.java: '
+          '${stale.join(', ')}. Run `just bridge-bindings` and commit the result.');
+      exit(1);
+    }
+    print('DartBridge bindings are up to date (${bindings.length}, hash ${_hex(hash)})');
+    return;
+  }
+
+  outputs.forEach((path, contents) => File('$root/$path').writeAsStringSync(contents));
+  print('Generated ${bindings.length} DartBridge bindings (hash ${_hex(hash)})');
+}
+
+bool _matches(File file, String contents) =>
+    file.existsSync() && file.readAsStringSync() == contents;
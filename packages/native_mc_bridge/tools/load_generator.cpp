@@ -0,0 +1,405 @@
+// ==========================================================================
+// Server Bridge Load Generator
+// ==========================================================================
+// Drives the server_dispatch_* API directly against a real Dart server
+// snapshot (no Minecraft, no network) to find where the bridge falls over.
+//
+// Usage:
+//   load_generator --script <server.dill> [--packages <package_config.json>] [options]
+//   load_generator --aot <server_aot.so> [options]
+//
+// Profiles (--profile NAME, then any option below overrides it):
+//   idle      1 player,   0 entities,    0 block events, 0 packets/s
+//   survival  8 players,  200 entities,  20 block events, 200 packets/s
+//   stress    64 players, 5000 entities, 500 block events, 5000 packets/s
+//
+// Options:
+//   --players N            Connected players (join/leave + packet senders)
+//   --entities N           Proxy entities ticked every tick
+//   --block-events N       Block break/interact events per tick
+//   --packets-per-second N Client packets per second across all players
+//   --packet-size N        Packet payload size in bytes (default 64)
+//   --threads N            Worker threads for entity ticks and block events
+//                          (mimics Minecraft's worker threads, default 1)
+//   --ticks N              Ticks to run (default 200)
+//   --tps N                Target ticks per second, 0 = unthrottled (default 20)
+//   --entity-handler N     Proxy entity handler id to dispatch to (default 1)
+//   --block-handler N      Proxy block handler id for random ticks (0 = off)
+//
+// There is no JVM in this process, so Dart handlers that call back into
+// Minecraft through generic JNI receive default values.
+// ==========================================================================
+
+#include "dart_bridge_server.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct LoadProfile {
+    int players = 8;
+    int entities = 200;
+    int block_events = 20;
+    int packets_per_second = 200;
+    int packet_size = 64;
+    int threads = 1;
+    int ticks = 200;
+    int tps = 20;
+    int64_t entity_handler = 1;
+    int64_t block_handler = 0;
+};
+
+bool applyNamedProfile(const std::string& name, LoadProfile& profile) {
+    if (name == "idle") {
+        profile.players = 1;
+        profile.entities = 0;
+        profile.block_events = 0;
+        profile.packets_per_second = 0;
+    } else if (name == "survival") {
+        profile.players = 8;
+        profile.entities = 200;
+        profile.block_events = 20;
+        profile.packets_per_second = 200;
+    } else if (name == "stress") {
+        profile.players = 64;
+        profile.entities = 5000;
+        profile.block_events = 500;
+        profile.packets_per_second = 5000;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// ==========================================================================
+// Latency recording
+// ==========================================================================
+
+enum EventKind {
+    kEventServerTick,
+    kEventEntityTick,
+    kEventBlockBreak,
+    kEventBlockInteract,
+    kEventBlockRandomTick,
+    kEventClientPacket,
+    kEventWholeTick,
+    kEventKindCount,
+};
+
+const char* kEventNames[kEventKindCount] = {
+    "dart_server_tick + dispatch_tick",
+    "proxy_entity_tick",
+    "block_break",
+    "block_interact",
+    "proxy_block_random_tick",
+    "client_packet",
+    "whole tick",
+};
+
+struct LatencyLog {
+    std::vector<uint64_t> samples[kEventKindCount];
+
+    template <typename Fn>
+    void time(EventKind kind, Fn&& fn) {
+        auto start = Clock::now();
+        fn();
+        samples[kind].push_back(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count()));
+    }
+
+    void merge(LatencyLog& other) {
+        for (int i = 0; i < kEventKindCount; i++) {
+            samples[i].insert(samples[i].end(), other.samples[i].begin(), other.samples[i].end());
+            other.samples[i].clear();
+        }
+    }
+};
+
+uint64_t percentile(const std::vector<uint64_t>& sorted, double p) {
+    if (sorted.empty()) return 0;
+    size_t index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+double toMicros(uint64_t ns) {
+    return static_cast<double>(ns) / 1000.0;
+}
+
+// ==========================================================================
+// Worker pool - one task batch per tick, joined before the tick ends
+// ==========================================================================
+
+class TickWorkers {
+public:
+    explicit TickWorkers(int count) : logs_(count) {
+        for (int i = 0; i < count; i++) {
+            threads_.emplace_back([this, i] { run(i); });
+        }
+    }
+
+    ~TickWorkers() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+            generation_++;
+        }
+        start_cv_.notify_all();
+        for (auto& thread : threads_) thread.join();
+    }
+
+    // Run work(worker_index, worker_count, log) on every worker and wait for all
+    void runTick(std::function<void(int, int, LatencyLog&)> work) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            work_ = std::move(work);
+            pending_ = static_cast<int>(threads_.size());
+            generation_++;
+        }
+        start_cv_.notify_all();
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this] { return pending_ == 0; });
+    }
+
+    void collect(LatencyLog& into) {
+        for (auto& log : logs_) into.merge(log);
+    }
+
+private:
+    void run(int index) {
+        uint64_t seen = 0;
+        while (true) {
+            std::function<void(int, int, LatencyLog&)> work;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                start_cv_.wait(lock, [&] { return generation_ != seen; });
+                seen = generation_;
+                if (stopping_) return;
+                work = work_;
+            }
+            work(index, static_cast<int>(threads_.size()), logs_[index]);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                pending_--;
+            }
+            done_cv_.notify_one();
+        }
+    }
+
+    std::vector<std::thread> threads_;
+    std::vector<LatencyLog> logs_;
+    std::mutex mutex_;
+    std::condition_variable start_cv_;
+    std::condition_variable done_cv_;
+    std::function<void(int, int, LatencyLog&)> work_;
+    uint64_t generation_ = 0;
+    int pending_ = 0;
+    bool stopping_ = false;
+};
+
+void printUsage() {
+    std::cerr << "Usage: load_generator (--script <server.dill> [--packages <package_config.json>] | --aot <library>)"
+              << " [--profile idle|survival|stress] [--players N] [--entities N] [--block-events N]"
+              << " [--packets-per-second N] [--packet-size N] [--threads N] [--ticks N] [--tps N]"
+              << " [--entity-handler N] [--block-handler N]" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    LoadProfile profile;
+    const char* script_path = nullptr;
+    const char* package_config = nullptr;
+    const char* aot_path = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            printUsage();
+            return 1;
+        }
+        const char* value = argv[++i];
+        if (arg == "--script") script_path = value;
+        else if (arg == "--packages") package_config = value;
+        else if (arg == "--aot") aot_path = value;
+        else if (arg == "--profile") {
+            if (!applyNamedProfile(value, profile)) {
+                std::cerr << "Unknown profile: " << value << std::endl;
+                return 1;
+            }
+        }
+        else if (arg == "--players") profile.players = std::max(0, std::atoi(value));
+        else if (arg == "--entities") profile.entities = std::max(0, std::atoi(value));
+        else if (arg == "--block-events") profile.block_events = std::max(0, std::atoi(value));
+        else if (arg == "--packets-per-second") profile.packets_per_second = std::max(0, std::atoi(value));
+        else if (arg == "--packet-size") profile.packet_size = std::max(0, std::atoi(value));
+        else if (arg == "--threads") profile.threads = std::max(1, std::atoi(value));
+        else if (arg == "--ticks") profile.ticks = std::max(1, std::atoi(value));
+        else if (arg == "--tps") profile.tps = std::max(0, std::atoi(value));
+        else if (arg == "--entity-handler") profile.entity_handler = std::atoll(value);
+        else if (arg == "--block-handler") profile.block_handler = std::atoll(value);
+        else {
+            printUsage();
+            return 1;
+        }
+    }
+    if ((script_path == nullptr) == (aot_path == nullptr)) {
+        printUsage();
+        return 1;
+    }
+
+    bool initialized = aot_path != nullptr ? dart_server_init_aot(aot_path)
+                                           : dart_server_init(script_path, package_config, 0);
+    if (!initialized) {
+        std::cerr << "Failed to initialize the Dart server isolate" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Profile: " << profile.players << " players, " << profile.entities << " entities, "
+              << profile.block_events << " block events/tick, " << profile.packets_per_second
+              << " packets/s (" << profile.packet_size << " B), " << profile.threads << " threads, "
+              << profile.ticks << " ticks @ " << (profile.tps > 0 ? std::to_string(profile.tps) : "unthrottled")
+              << " tps" << std::endl;
+
+    // World setup: lifecycle, players and entities exist before the first tick
+    server_dispatch_server_starting();
+    server_dispatch_server_started();
+    for (int p = 0; p < profile.players; p++) {
+        server_dispatch_player_join(p + 1);
+    }
+    for (int e = 0; e < profile.entities; e++) {
+        server_dispatch_proxy_entity_spawn(profile.entity_handler, 1000 + e, 0);
+    }
+
+    server_reset_isolate_contention();
+
+    TickWorkers workers(profile.threads);
+    LatencyLog main_log;
+    std::vector<uint8_t> packet(static_cast<size_t>(profile.packet_size), 0x5A);
+    double packets_per_tick = profile.tps > 0
+        ? static_cast<double>(profile.packets_per_second) / profile.tps
+        : static_cast<double>(profile.packets_per_second) / 20.0;
+    double packet_budget = 0.0;
+    int overruns = 0;
+    auto tick_interval = profile.tps > 0 ? std::chrono::nanoseconds(1000000000LL / profile.tps)
+                                         : std::chrono::nanoseconds(0);
+
+    auto run_start = Clock::now();
+    auto next_tick = run_start;
+
+    for (int tick = 0; tick < profile.ticks; tick++) {
+        auto tick_start = Clock::now();
+
+        // Server thread: drain the isolate and dispatch the tick event
+        main_log.time(kEventServerTick, [&] {
+            dart_server_tick();
+            server_dispatch_tick(tick);
+        });
+
+        // Worker threads: entity ticks and block events, split evenly
+        workers.runTick([&, tick](int index, int count, LatencyLog& log) {
+            std::mt19937 rng(static_cast<uint32_t>(tick * 7919 + index));
+            for (int e = index; e < profile.entities; e += count) {
+                log.time(kEventEntityTick, [&] {
+                    server_dispatch_proxy_entity_tick(profile.entity_handler, 1000 + e);
+                });
+            }
+            for (int b = index; b < profile.block_events; b += count) {
+                int32_t x = static_cast<int32_t>(rng() % 256) - 128;
+                int32_t y = static_cast<int32_t>(rng() % 128);
+                int32_t z = static_cast<int32_t>(rng() % 256) - 128;
+                int64_t player = profile.players > 0 ? 1 + static_cast<int64_t>(rng() % profile.players) : 0;
+                if (profile.block_handler != 0 && b % 3 == 2) {
+                    log.time(kEventBlockRandomTick, [&] {
+                        server_dispatch_proxy_block_random_tick(profile.block_handler, 0, x, y, z);
+                    });
+                } else if (b % 2 == 0) {
+                    log.time(kEventBlockBreak, [&] { server_dispatch_block_break(x, y, z, player); });
+                } else {
+                    log.time(kEventBlockInteract, [&] { server_dispatch_block_interact(x, y, z, player, 0); });
+                }
+            }
+        });
+
+        // Network thread: client packets arrive between ticks
+        packet_budget += packets_per_tick;
+        int packets = static_cast<int>(packet_budget);
+        packet_budget -= packets;
+        for (int p = 0; p < packets && profile.players > 0; p++) {
+            main_log.time(kEventClientPacket, [&] {
+                server_dispatch_client_packet(1 + (p % profile.players), 0, packet.data(),
+                                              static_cast<int32_t>(packet.size()));
+            });
+        }
+
+        auto tick_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - tick_start);
+        main_log.samples[kEventWholeTick].push_back(static_cast<uint64_t>(tick_ns.count()));
+        if (tick_ns > std::chrono::milliseconds(50)) overruns++;
+
+        if (profile.tps > 0) {
+            next_tick += tick_interval;
+            std::this_thread::sleep_until(next_tick);
+        }
+    }
+
+    double elapsed_s = std::chrono::duration<double>(Clock::now() - run_start).count();
+    workers.collect(main_log);
+
+    int64_t entries = 0, contended = 0, wait_ns = 0;
+    server_get_isolate_contention(&entries, &contended, &wait_ns);
+
+    for (int p = 0; p < profile.players; p++) {
+        server_dispatch_player_leave(p + 1);
+    }
+    server_dispatch_server_stopping();
+    dart_server_shutdown();
+
+    // Report
+    size_t total_events = 0;
+    for (int i = 0; i < kEventWholeTick; i++) total_events += main_log.samples[i].size();
+
+    std::cout << std::endl << std::fixed << std::setprecision(1);
+    std::cout << "Ran " << profile.ticks << " ticks in " << std::setprecision(3) << elapsed_s
+              << std::setprecision(1) << " s, "
+              << total_events << " dispatches (" << static_cast<double>(total_events) / elapsed_s
+              << " dispatches/s), " << overruns << " ticks over 50 ms" << std::endl << std::endl;
+
+    std::cout << std::left << std::setw(36) << "event" << std::right << std::setw(10) << "count"
+              << std::setw(12) << "per_sec" << std::setw(10) << "p50_us" << std::setw(10) << "p99_us"
+              << std::setw(11) << "p999_us" << std::setw(11) << "max_us" << std::endl;
+    for (int i = 0; i < kEventKindCount; i++) {
+        auto& samples = main_log.samples[i];
+        if (samples.empty()) continue;
+        std::sort(samples.begin(), samples.end());
+        std::cout << std::left << std::setw(36) << kEventNames[i] << std::right
+                  << std::setw(10) << samples.size()
+                  << std::setw(12) << static_cast<double>(samples.size()) / elapsed_s
+                  << std::setw(10) << toMicros(percentile(samples, 0.50))
+                  << std::setw(10) << toMicros(percentile(samples, 0.99))
+                  << std::setw(11) << toMicros(percentile(samples, 0.999))
+                  << std::setw(11) << toMicros(samples.back()) << std::endl;
+    }
+
+    std::cout << std::endl << "Isolate contention: " << entries << " entries, " << contended
+              << " contended (" << (entries > 0 ? 100.0 * static_cast<double>(contended) / entries : 0.0)
+              << "%), " << static_cast<double>(wait_ns) / 1e6 << " ms total wait";
+    if (contended > 0) {
+        std::cout << ", " << toMicros(static_cast<uint64_t>(wait_ns / contended)) << " us mean wait";
+    }
+    std::cout << std::endl;
+    return 0;
+}